@@ -55,7 +55,8 @@ enum acpi_error
 	ACPI_ERR_CHECKSUMFAIL = -2,
 	ACPI_ERR_BADTABLE = -3,
 	ACPI_ERR_BADTABLESIGNATURE = -4,
-	ACPI_ERR_TABLENOTFOUND = -5
+	ACPI_ERR_TABLENOTFOUND = -5,
+	ACPI_ERR_NOMEMORY = -6
 };
 
 /*
@@ -104,6 +105,23 @@ int get_acpi_table(
 		struct acpi_table *p_table,
 		const unsigned int size);
 
+/*!
+ * Retrieve the specified ACPI table into a new allocation, verified.
+ * The caller is responsible for freeing *pp_table.
+ * Returns the size of the table on success.
+ */
+int get_acpi_table_alloc(
+		const char *signature,
+		struct acpi_table **pp_table);
+
+/*!
+ * Retrieve the header of the specified ACPI table
+ * without reading the rest of the table.
+ */
+int get_acpi_table_header(
+		const char *signature,
+		struct acpi_table_header *p_header);
+
 /*!
  * Verify the ACPI table size, checksum and signature
  */
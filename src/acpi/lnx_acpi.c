@@ -36,10 +36,87 @@
 #include <unistd.h>
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #define	SYSFS_ACPI_PATH	"/sys/firmware/acpi/tables/"
 int g_count = 0;
 
+/*
+ * Build the sysfs path of an ACPI table
+ */
+static void get_acpi_table_path(const char *signature, char *table_path)
+{
+	s_strncpy(table_path, PATH_MAX, SYSFS_ACPI_PATH,
+		strnlen(SYSFS_ACPI_PATH, PATH_MAX));
+	s_strncat(table_path, PATH_MAX, signature, strnlen(signature, PATH_MAX));
+}
+
+/*!
+ * Return the header of the specified ACPI table
+ */
+int get_acpi_table_header(
+		const char *signature,
+		struct acpi_table_header *p_header)
+{
+	int rc = ACPI_SUCCESS;
+
+	char table_path[PATH_MAX];
+	get_acpi_table_path(signature, table_path);
+
+	int fd = open(table_path, O_RDONLY|O_CLOEXEC);
+	if (fd < 0)
+	{
+		rc = ACPI_ERR_TABLENOTFOUND;
+	}
+	else
+	{
+		if (read(fd, p_header, sizeof (*p_header)) != sizeof (*p_header))
+		{
+			rc = ACPI_ERR_BADTABLE;
+		}
+		close(fd);
+	}
+
+	return rc;
+}
+
+/*
+ * Read the rest of an ACPI table whose header was already read from fd
+ * into p_table, then verify it
+ */
+static int read_acpi_table_body(int fd, const char *signature, struct acpi_table *p_table)
+{
+	int rc = ACPI_SUCCESS;
+	if (p_table->header.length < sizeof (struct acpi_table_header))
+	{
+		return ACPI_ERR_BADTABLE;
+	}
+
+	size_t requested_bytes = p_table->header.length - sizeof (struct acpi_table_header);
+	unsigned char *p_buff = p_table->p_ext_tables;
+	size_t total_read = 0;
+
+	while (total_read < requested_bytes)
+	{
+		ssize_t bytes_read = read(fd, p_buff + total_read, requested_bytes - total_read);
+		if (bytes_read <= 0)
+		{
+			break;
+		}
+		total_read += bytes_read;
+	}
+
+	if (total_read != requested_bytes)
+	{
+		rc = ACPI_ERR_BADTABLE;
+	}
+	else
+	{
+		rc = check_acpi_table(signature, p_table);
+	}
+	return rc;
+}
+
 /*!
  * Return the specified ACPI table or the size
  * required
@@ -52,9 +129,7 @@ int get_acpi_table(
 	int rc = 0;
 
 	char table_path[PATH_MAX];
-	s_strncpy(table_path, PATH_MAX, SYSFS_ACPI_PATH,
-		strnlen(SYSFS_ACPI_PATH, PATH_MAX));
-	s_strncat(table_path, PATH_MAX, signature, strnlen(signature, PATH_MAX));
+	get_acpi_table_path(signature, table_path);
 
 	int fd = open(table_path, O_RDONLY|O_CLOEXEC);
 	if (fd < 0)
@@ -85,25 +160,60 @@ int get_acpi_table(
 				}
 				else
 				{
-					size_t requested_bytes = total_table_size - header_size;
-					unsigned char *p_buff = p_table->p_ext_tables;
-					ssize_t total_read = 0;
-
-					while (total_read < requested_bytes)
-					{
-						ssize_t bytes_read = read(fd, p_buff, requested_bytes);
-						p_buff += bytes_read;
-						total_read += bytes_read;
-					}
-
-					if (total_read != requested_bytes)
-					{
-						rc = ACPI_ERR_BADTABLE;
-					}
-					else
-					{
-						rc = check_acpi_table(signature, p_table);
-					}
+					rc = read_acpi_table_body(fd, signature, p_table);
+				}
+			}
+		}
+		close(fd);
+	}
+
+	return rc;
+}
+
+/*!
+ * Allocate and return the specified ACPI table in one open/read sequence
+ */
+int get_acpi_table_alloc(
+		const char *signature,
+		struct acpi_table **pp_table)
+{
+	int rc = 0;
+
+	char table_path[PATH_MAX];
+	get_acpi_table_path(signature, table_path);
+
+	int fd = open(table_path, O_RDONLY|O_CLOEXEC);
+	if (fd < 0)
+	{
+		rc = ACPI_ERR_TABLENOTFOUND;
+	}
+	else
+	{
+		struct acpi_table_header header;
+		if (read(fd, &header, sizeof (header)) != sizeof (header) ||
+			header.length < sizeof (header))
+		{
+			rc = ACPI_ERR_BADTABLE;
+		}
+		else
+		{
+			struct acpi_table *p_table = malloc(header.length);
+			if (!p_table)
+			{
+				rc = ACPI_ERR_NOMEMORY;
+			}
+			else
+			{
+				memcpy(&(p_table->header), &header, sizeof (header));
+				rc = read_acpi_table_body(fd, signature, p_table);
+				if (rc == ACPI_SUCCESS)
+				{
+					*pp_table = p_table;
+					rc = (int)header.length;
+				}
+				else
+				{
+					free(p_table);
 				}
 			}
 		}
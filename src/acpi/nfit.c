@@ -34,6 +34,7 @@
 #include "acpi.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 enum nfit_error acpi_error_to_nfit_error(enum acpi_error acpi_err)
 {
@@ -51,6 +52,9 @@ enum nfit_error acpi_error_to_nfit_error(enum acpi_error acpi_err)
 		case ACPI_ERR_TABLENOTFOUND:
 			nfit_err = NFIT_ERR_TABLENOTFOUND;
 			break;
+		case ACPI_ERR_NOMEMORY:
+			nfit_err = NFIT_ERR_NOMEMORY;
+			break;
 		default:
 			nfit_err = NFIT_SUCCESS;
 			break;
@@ -65,29 +69,31 @@ int nfit_get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
 {
 	int result = NFIT_SUCCESS;
 
-	int buffer_size = get_acpi_table("NFIT", NULL, 0);
+	struct acpi_table *p_table = NULL;
+	int buffer_size = get_acpi_table_alloc("NFIT", &p_table);
 	if (buffer_size <= 0)
 	{
 		result = acpi_error_to_nfit_error(buffer_size);
 	}
 	else
 	{
-		unsigned char *buffer = (unsigned char *) calloc(1, buffer_size);
-		if (!buffer)
-		{
-			result = NFIT_ERR_NOMEMORY;
-		}
-		else
-		{
-			result = acpi_error_to_nfit_error(
-					get_acpi_table("NFIT", (struct acpi_table *)buffer,
-						(int)buffer_size));
-			if (result == NFIT_SUCCESS)
-			{
-				result = nfit_parse_raw_nfit(buffer, buffer_size, pp_parsed_nfit);
-			}
-			free(buffer);
-		}
+		result = nfit_parse_raw_nfit((unsigned char *)p_table, buffer_size, pp_parsed_nfit);
+		free(p_table);
+	}
+	return result;
+}
+
+/*
+ * Retrieve only the NFIT header from ACPI, enough to tell whether
+ * a previously parsed NFIT is still current
+ */
+int nfit_get_nfit_header(struct nfit *p_nfit_header)
+{
+	struct acpi_table_header header;
+	int result = acpi_error_to_nfit_error(get_acpi_table_header("NFIT", &header));
+	if (result == NFIT_SUCCESS)
+	{
+		memmove(p_nfit_header, &header, sizeof (struct nfit));
 	}
 	return result;
 }
@@ -107,6 +107,11 @@ void nfit_print_error(const int err);
  */
 int nfit_get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit);
 
+/*
+ * Retrieve only the NFIT header from ACPI
+ */
+int nfit_get_nfit_header(struct nfit *p_nfit_header);
+
 /*
  * Clean up a parsed nfit structure
  */
@@ -119,6 +124,60 @@ void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit);
 int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
 	struct parsed_nfit** pp_parsed_nfit);
 
+/*
+ * Copy a parsed nfit structure into a buffer of at least p_src->arena_size bytes,
+ * rebasing the extension table lists onto the copy
+ */
+void nfit_copy_parsed_nfit(struct parsed_nfit *p_dst, const struct parsed_nfit *p_src);
+
+/*
+ * Restore the pointers of a parsed nfit structure of size bytes that was
+ * copied from another address space, such as a persisted cache
+ */
+int nfit_restore_parsed_nfit(struct parsed_nfit *p_nfit, const size_t size);
+
+/*
+ * Bytes needed for the lookup indexes of an NFIT with the given table counts
+ */
+size_t nfit_lookup_index_size(const struct parsed_nfit *p_counts);
+
+/*
+ * Build the lookup indexes of a parsed NFIT into p_index_arena, which must be
+ * at least nfit_lookup_index_size bytes
+ */
+int nfit_build_lookup_indexes(struct parsed_nfit *p_nfit, unsigned char *p_index_arena);
+
+/*
+ * Point the lookup indexes of a copied parsed NFIT at the copy
+ */
+void nfit_rebase_lookup_indexes(struct parsed_nfit *p_dst, const struct parsed_nfit *p_src);
+
+/*
+ * Retrieve the positions in region_mapping_list of the region mappings
+ * for a DIMM handle, in NFIT order. Returns the count.
+ */
+int nfit_get_region_mappings_for_handle(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned int handle, const int **pp_ordinals);
+
+/*
+ * Retrieve the positions in region_mapping_list of the region mappings
+ * for a SPA range index, in NFIT order. Returns the count.
+ */
+int nfit_get_region_mappings_for_spa_index(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short spa_index, const int **pp_ordinals);
+
+/*
+ * Retrieve the first region mapping for a DIMM handle, NULL if not found.
+ */
+const struct region_mapping *nfit_get_region_mapping_for_handle(
+		const struct parsed_nfit *p_parsed_nfit, const unsigned int handle);
+
+/*
+ * Retrieve the control region table with a given index, NULL if not found.
+ */
+const struct control_region *nfit_get_control_region(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short index);
+
 /*
  * Print a parsed_nfit structure
  */
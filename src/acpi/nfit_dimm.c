@@ -68,30 +68,24 @@ int add_dimm_control_region_info_from_index(const struct parsed_nfit *p_parsed_n
 		const unsigned short index, struct nfit_dimm *p_dimm)
 {
 	int result = NFIT_ERR_BADNFIT;
-	for (int i = 0; i < p_parsed_nfit->control_region_count; i++)
+	const struct control_region *p_control_region =
+			nfit_get_control_region(p_parsed_nfit, index);
+	if (p_control_region)
 	{
-		if (p_parsed_nfit->control_region_list[i].index == index)
-		{
-			p_dimm->serial_number = p_parsed_nfit->control_region_list[i].serial_number;
-			p_dimm->vendor_id = p_parsed_nfit->control_region_list[i].vendor_id;
-			p_dimm->device_id = p_parsed_nfit->control_region_list[i].device_id;
-			p_dimm->revision_id = p_parsed_nfit->control_region_list[i].revision_id;
-			p_dimm->subsystem_vendor_id =
-				p_parsed_nfit->control_region_list[i].subsystem_vendor_id;
-			p_dimm->subsystem_device_id =
-				p_parsed_nfit->control_region_list[i].subsystem_device_id;
-			p_dimm->subsystem_revision_id =
-				p_parsed_nfit->control_region_list[i].subsystem_revision_id;
-			p_dimm->valid_fields = p_parsed_nfit->control_region_list[i].valid_fields;
-			p_dimm->manufacturing_location =
-				p_parsed_nfit->control_region_list[i].manufacturing_location;
-			p_dimm->manufacturing_date =
-				p_parsed_nfit->control_region_list[i].manufacturing_date;
-
-			add_all_dimm_format_codes_from_nfit(p_parsed_nfit, p_dimm);
-
-			result = NFIT_SUCCESS;
-		}
+		p_dimm->serial_number = p_control_region->serial_number;
+		p_dimm->vendor_id = p_control_region->vendor_id;
+		p_dimm->device_id = p_control_region->device_id;
+		p_dimm->revision_id = p_control_region->revision_id;
+		p_dimm->subsystem_vendor_id = p_control_region->subsystem_vendor_id;
+		p_dimm->subsystem_device_id = p_control_region->subsystem_device_id;
+		p_dimm->subsystem_revision_id = p_control_region->subsystem_revision_id;
+		p_dimm->valid_fields = p_control_region->valid_fields;
+		p_dimm->manufacturing_location = p_control_region->manufacturing_location;
+		p_dimm->manufacturing_date = p_control_region->manufacturing_date;
+
+		add_all_dimm_format_codes_from_nfit(p_parsed_nfit, p_dimm);
+
+		result = NFIT_SUCCESS;
 	}
 	return result;
 
@@ -101,18 +95,15 @@ int add_dimm_info_from_handle(const struct parsed_nfit *p_parsed_nfit,
 		const unsigned int handle, struct nfit_dimm *p_dimm)
 {
 	int result = NFIT_ERR_BADNFIT;
-	for (int i = 0; i < p_parsed_nfit->region_mapping_count; i++)
+	const struct region_mapping *p_mapping =
+			nfit_get_region_mapping_for_handle(p_parsed_nfit, handle);
+	if (p_mapping)
 	{
-		if (p_parsed_nfit->region_mapping_list[i].handle == handle)
-		{
-			p_dimm->handle = handle;
-			p_dimm->physical_id = p_parsed_nfit->region_mapping_list[i].physical_id;
-			p_dimm->state_flags = p_parsed_nfit->region_mapping_list[i].state_flag;
-			result = add_dimm_control_region_info_from_index(p_parsed_nfit,
-					p_parsed_nfit->region_mapping_list[i].control_region_index,
-					p_dimm);
-			break;
-		}
+		p_dimm->handle = handle;
+		p_dimm->physical_id = p_mapping->physical_id;
+		p_dimm->state_flags = p_mapping->state_flag;
+		result = add_dimm_control_region_info_from_index(p_parsed_nfit,
+				p_mapping->control_region_index, p_dimm);
 	}
 	return result;
 }
@@ -120,16 +111,7 @@ int add_dimm_info_from_handle(const struct parsed_nfit *p_parsed_nfit,
 unsigned char has_matching_control_region_table(const struct parsed_nfit *p_parsed_nfit,
 		const unsigned short index)
 {
-	int found = 0;
-	for (int i = 0; i < p_parsed_nfit->control_region_count; i++)
-	{
-		if (p_parsed_nfit->control_region_list[i].index == index)
-		{
-			found = 1;
-			break;
-		}
-	}
-	return found;
+	return nfit_get_control_region(p_parsed_nfit, index) != NULL;
 }
 
 
@@ -139,15 +121,11 @@ int get_unique_dimm_region_handles(const struct parsed_nfit *p_parsed_nfit,
 	int dimm_count = 0;
 	for (int i = 0; i < p_parsed_nfit->region_mapping_count; i++)
 	{
-		unsigned char is_unique = 1;
-		for (int j = 0; j < dimm_count && is_unique; j++)
-		{
-			if (p_parsed_nfit->region_mapping_list[i].handle == p_unique_handles[j])
-			{
-				is_unique = 0;
-			}
-		}
-		if (is_unique)
+		// a handle is new when this is its first mapping in NFIT order
+		const int *p_ordinals = NULL;
+		unsigned int handle = p_parsed_nfit->region_mapping_list[i].handle;
+		if (nfit_get_region_mappings_for_handle(p_parsed_nfit, handle, &p_ordinals) > 0 &&
+			p_ordinals[0] == i)
 		{
 			// make sure it has a matching control region
 			if (!has_matching_control_region_table(p_parsed_nfit,
@@ -158,7 +136,7 @@ int get_unique_dimm_region_handles(const struct parsed_nfit *p_parsed_nfit,
 			}
 			else
 			{
-				p_unique_handles[dimm_count] = p_parsed_nfit->region_mapping_list[i].handle;
+				p_unique_handles[dimm_count] = handle;
 				dimm_count++;
 			}
 		}
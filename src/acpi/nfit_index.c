@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file builds and queries the lookup indexes carried by a parsed NFIT so
+ * DIMM and interleave set queries don't rescan the extension table lists.
+ */
+
+#include "nfit.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define	NFIT_INDEX_ALIGNMENT	8
+#define	NFIT_INDEX_ALIGN(size) \
+	(((size) + (NFIT_INDEX_ALIGNMENT - 1)) & ~((size_t)NFIT_INDEX_ALIGNMENT - 1))
+
+struct nfit_index_key
+{
+	unsigned int key;
+	int ordinal;
+};
+
+int compare_nfit_index_keys(const void *p_lhs, const void *p_rhs)
+{
+	const struct nfit_index_key *p_left = (const struct nfit_index_key *)p_lhs;
+	const struct nfit_index_key *p_right = (const struct nfit_index_key *)p_rhs;
+
+	int result = 0;
+	if (p_left->key != p_right->key)
+	{
+		result = (p_left->key < p_right->key) ? -1 : 1;
+	}
+	else if (p_left->ordinal != p_right->ordinal)
+	{
+		// keep tables sharing a key in NFIT order
+		result = (p_left->ordinal < p_right->ordinal) ? -1 : 1;
+	}
+	return result;
+}
+
+/*
+ * Sort the keys and group them into index entries, writing the ordinals
+ * starting at p_nfit->index_ordinals[ordinal_start]. Returns the entry count.
+ */
+int build_nfit_index(struct parsed_nfit *p_nfit, struct nfit_index_key *p_keys,
+		const int key_count, const int ordinal_start, struct nfit_index_entry *p_entries)
+{
+	qsort(p_keys, key_count, sizeof (struct nfit_index_key), compare_nfit_index_keys);
+
+	int entry_count = 0;
+	for (int i = 0; i < key_count; i++)
+	{
+		if (entry_count == 0 || p_entries[entry_count - 1].key != p_keys[i].key)
+		{
+			p_entries[entry_count].key = p_keys[i].key;
+			p_entries[entry_count].first = ordinal_start + i;
+			p_entries[entry_count].count = 0;
+			entry_count++;
+		}
+		p_entries[entry_count - 1].count++;
+		p_nfit->index_ordinals[ordinal_start + i] = p_keys[i].ordinal;
+	}
+	return entry_count;
+}
+
+const struct nfit_index_entry *find_nfit_index_entry(const struct nfit_index_entry *p_entries,
+		const int entry_count, const unsigned int key)
+{
+	const struct nfit_index_entry *p_entry = NULL;
+
+	int low = 0;
+	int high = entry_count - 1;
+	while (low <= high)
+	{
+		int mid = low + (high - low) / 2;
+		if (p_entries[mid].key == key)
+		{
+			p_entry = &p_entries[mid];
+			break;
+		}
+		else if (p_entries[mid].key < key)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+	return p_entry;
+}
+
+/*
+ * Bytes needed for the lookup indexes of an NFIT with the given table counts
+ */
+size_t nfit_lookup_index_size(const struct parsed_nfit *p_counts)
+{
+	size_t mapping_count = p_counts->region_mapping_count;
+	size_t control_region_count = p_counts->control_region_count;
+
+	// at most one entry per table, every table appears once per index
+	return NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * mapping_count) +
+		NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * mapping_count) +
+		NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * control_region_count) +
+		NFIT_INDEX_ALIGN(sizeof (int) * (2 * mapping_count + control_region_count));
+}
+
+/*
+ * Build the lookup indexes of a parsed NFIT into p_index_arena, which must be
+ * at least nfit_lookup_index_size bytes
+ */
+int nfit_build_lookup_indexes(struct parsed_nfit *p_nfit, unsigned char *p_index_arena)
+{
+	int result = NFIT_SUCCESS;
+
+	p_nfit->handle_index_count = 0;
+	p_nfit->handle_index = NULL;
+	p_nfit->spa_index_count = 0;
+	p_nfit->spa_index = NULL;
+	p_nfit->control_region_index_count = 0;
+	p_nfit->control_region_index = NULL;
+	p_nfit->index_ordinals = NULL;
+
+	int mapping_count = p_nfit->region_mapping_count;
+	int control_region_count = p_nfit->control_region_count;
+	int key_count = mapping_count > control_region_count ? mapping_count : control_region_count;
+	if (key_count == 0)
+	{
+		return result;
+	}
+
+	size_t offset = 0;
+	p_nfit->handle_index = (struct nfit_index_entry *)(p_index_arena + offset);
+	offset += NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * mapping_count);
+	p_nfit->spa_index = (struct nfit_index_entry *)(p_index_arena + offset);
+	offset += NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * mapping_count);
+	p_nfit->control_region_index = (struct nfit_index_entry *)(p_index_arena + offset);
+	offset += NFIT_INDEX_ALIGN(sizeof (struct nfit_index_entry) * control_region_count);
+	p_nfit->index_ordinals = (int *)(p_index_arena + offset);
+
+	struct nfit_index_key *p_keys = malloc(sizeof (struct nfit_index_key) * key_count);
+	if (!p_keys)
+	{
+		result = NFIT_ERR_NOMEMORY;
+	}
+	else
+	{
+		for (int i = 0; i < mapping_count; i++)
+		{
+			p_keys[i].key = p_nfit->region_mapping_list[i].handle;
+			p_keys[i].ordinal = i;
+		}
+		p_nfit->handle_index_count = build_nfit_index(p_nfit, p_keys, mapping_count,
+				0, p_nfit->handle_index);
+
+		for (int i = 0; i < mapping_count; i++)
+		{
+			p_keys[i].key = p_nfit->region_mapping_list[i].spa_index;
+			p_keys[i].ordinal = i;
+		}
+		p_nfit->spa_index_count = build_nfit_index(p_nfit, p_keys, mapping_count,
+				mapping_count, p_nfit->spa_index);
+
+		for (int i = 0; i < control_region_count; i++)
+		{
+			p_keys[i].key = p_nfit->control_region_list[i].index;
+			p_keys[i].ordinal = i;
+		}
+		p_nfit->control_region_index_count = build_nfit_index(p_nfit, p_keys,
+				control_region_count, 2 * mapping_count, p_nfit->control_region_index);
+
+		free(p_keys);
+	}
+
+	return result;
+}
+
+/*
+ * Point the lookup indexes of a copied parsed NFIT at the copy
+ */
+void nfit_rebase_lookup_indexes(struct parsed_nfit *p_dst, const struct parsed_nfit *p_src)
+{
+	if (p_src->handle_index)
+	{
+		p_dst->handle_index = (struct nfit_index_entry *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->handle_index - (const unsigned char *)p_src));
+	}
+	if (p_src->spa_index)
+	{
+		p_dst->spa_index = (struct nfit_index_entry *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->spa_index - (const unsigned char *)p_src));
+	}
+	if (p_src->control_region_index)
+	{
+		p_dst->control_region_index = (struct nfit_index_entry *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->control_region_index - (const unsigned char *)p_src));
+	}
+	if (p_src->index_ordinals)
+	{
+		p_dst->index_ordinals = (int *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->index_ordinals - (const unsigned char *)p_src));
+	}
+}
+
+/*
+ * Retrieve the positions in region_mapping_list of the region mappings
+ * for a DIMM handle, in NFIT order. Returns the count.
+ */
+int nfit_get_region_mappings_for_handle(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned int handle, const int **pp_ordinals)
+{
+	int count = 0;
+	const struct nfit_index_entry *p_entry = find_nfit_index_entry(
+			p_parsed_nfit->handle_index, p_parsed_nfit->handle_index_count, handle);
+	if (p_entry)
+	{
+		*pp_ordinals = &p_parsed_nfit->index_ordinals[p_entry->first];
+		count = p_entry->count;
+	}
+	return count;
+}
+
+/*
+ * Retrieve the positions in region_mapping_list of the region mappings
+ * for a SPA range index, in NFIT order. Returns the count.
+ */
+int nfit_get_region_mappings_for_spa_index(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short spa_index, const int **pp_ordinals)
+{
+	int count = 0;
+	const struct nfit_index_entry *p_entry = find_nfit_index_entry(
+			p_parsed_nfit->spa_index, p_parsed_nfit->spa_index_count, spa_index);
+	if (p_entry)
+	{
+		*pp_ordinals = &p_parsed_nfit->index_ordinals[p_entry->first];
+		count = p_entry->count;
+	}
+	return count;
+}
+
+/*
+ * Retrieve the first region mapping for a DIMM handle, NULL if not found.
+ */
+const struct region_mapping *nfit_get_region_mapping_for_handle(
+		const struct parsed_nfit *p_parsed_nfit, const unsigned int handle)
+{
+	const struct region_mapping *p_mapping = NULL;
+	const int *p_ordinals = NULL;
+	if (nfit_get_region_mappings_for_handle(p_parsed_nfit, handle, &p_ordinals) > 0)
+	{
+		p_mapping = &p_parsed_nfit->region_mapping_list[p_ordinals[0]];
+	}
+	return p_mapping;
+}
+
+/*
+ * Retrieve the control region table with a given index, NULL if not found.
+ * If the index is duplicated the last table in NFIT order is returned.
+ */
+const struct control_region *nfit_get_control_region(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short index)
+{
+	const struct control_region *p_control_region = NULL;
+	const struct nfit_index_entry *p_entry = find_nfit_index_entry(
+			p_parsed_nfit->control_region_index, p_parsed_nfit->control_region_index_count,
+			index);
+	if (p_entry)
+	{
+		int ordinal = p_parsed_nfit->index_ordinals[p_entry->first + p_entry->count - 1];
+		p_control_region = &p_parsed_nfit->control_region_list[ordinal];
+	}
+	return p_control_region;
+}
@@ -30,225 +30,277 @@
 #include <string.h>
 #include <stdlib.h>
 
+// the parsed_nfit and all of its extension table lists share one allocation
+#define	NFIT_ARENA_ALIGNMENT	8
+#define	NFIT_ARENA_ALIGN(size) \
+	(((size) + (NFIT_ARENA_ALIGNMENT - 1)) & ~((size_t)NFIT_ARENA_ALIGNMENT - 1))
+
+// every extension table starts with a 16-bit type and a 16-bit length
+#define	NFIT_EXTENSION_HEADER_SIZE	4
+
+/*
+ * Read a little-endian 16-bit field from the raw NFIT
+ */
+static inline unsigned short nfit_read_u16(const unsigned char *p_field)
+{
+	return (unsigned short)(p_field[0] | (p_field[1] << 8));
+}
+
 /*
- * Allocate space for and copy the spa table
- * to the parsed_nfit structure.
+ * Copy the spa table into the next entry of the
+ * pre-sized spa list in the parsed_nfit structure.
  */
 int add_spa_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct spa *p_spa_table)
+	const struct spa *p_spa_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->spa_list[p_nfit->spa_count],
+		p_spa_table,
+		length < sizeof (struct spa) ? length : sizeof (struct spa));
+	p_nfit->spa_count++;
 
-	// allocate space for the extension table
-	p_nfit->spa_list =
-		(struct spa *)
-		realloc(p_nfit->spa_list,
-		sizeof (struct spa) *
-		(p_nfit->spa_count + 1));
-	if (!p_nfit->spa_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->spa_list[p_nfit->spa_count],
-			p_spa_table,
-			sizeof (struct spa));
-		p_nfit->spa_count++;
-	}
-
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the region_mapping table
- * to the parsed_nfit structure.
+ * Copy the region_mapping table into the next entry of the
+ * pre-sized region_mapping list in the parsed_nfit structure.
  */
 int add_region_mapping_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct region_mapping *p_region_mapping_table)
+	const struct region_mapping *p_region_mapping_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->region_mapping_list =
-		(struct region_mapping *)
-		realloc(p_nfit->region_mapping_list,
-		sizeof (struct region_mapping) *
-		(p_nfit->region_mapping_count + 1));
-	if (!p_nfit->region_mapping_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->region_mapping_list[p_nfit->region_mapping_count],
-			p_region_mapping_table,
-			sizeof (struct region_mapping));
-		p_nfit->region_mapping_count++;
-	}
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->region_mapping_list[p_nfit->region_mapping_count],
+		p_region_mapping_table,
+		length < sizeof (struct region_mapping) ? length : sizeof (struct region_mapping));
+	p_nfit->region_mapping_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the interleave table
- * to the parsed_nfit structure.
+ * Copy the interleave table into the next entry of the
+ * pre-sized interleave list in the parsed_nfit structure.
  */
 int add_interleave_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct interleave *p_interleave_table)
+	const struct interleave *p_interleave_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->interleave_list =
-		(struct interleave *)
-		realloc(p_nfit->interleave_list,
-		sizeof (struct interleave) *
-		(p_nfit->interleave_count + 1));
-	if (!p_nfit->interleave_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->interleave_list[p_nfit->interleave_count],
-			p_interleave_table,
-			sizeof (struct interleave));
-		p_nfit->interleave_count++;
-	}
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->interleave_list[p_nfit->interleave_count],
+		p_interleave_table,
+		length < sizeof (struct interleave) ? length : sizeof (struct interleave));
+	p_nfit->interleave_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the smbios_management_info table
- * to the parsed_nfit structure.
+ * Copy the smbios_management_info table into the next entry of the
+ * pre-sized smbios_management_info list in the parsed_nfit structure.
  */
 int add_smbios_management_info_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct smbios_management_info *p_smbios_management_info_table)
+	const struct smbios_management_info *p_smbios_management_info_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->smbios_management_info_list =
-		(struct smbios_management_info *)
-		realloc(p_nfit->smbios_management_info_list,
-		sizeof (struct smbios_management_info) *
-		(p_nfit->smbios_management_info_count + 1));
-	if (!p_nfit->smbios_management_info_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->smbios_management_info_list[p_nfit->smbios_management_info_count],
-			p_smbios_management_info_table,
-			sizeof (struct smbios_management_info));
-		p_nfit->smbios_management_info_count++;
-	}
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->smbios_management_info_list[p_nfit->smbios_management_info_count],
+		p_smbios_management_info_table,
+		length < sizeof (struct smbios_management_info) ? length : sizeof (struct smbios_management_info));
+	p_nfit->smbios_management_info_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the control_region table
- * to the parsed_nfit structure.
+ * Copy the control_region table into the next entry of the
+ * pre-sized control_region list in the parsed_nfit structure.
  */
 int add_control_region_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct control_region *p_control_region_table)
+	const struct control_region *p_control_region_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->control_region_list =
-		(struct control_region *)
-		realloc(p_nfit->control_region_list,
-		sizeof (struct control_region) *
-		(p_nfit->control_region_count + 1));
-	if (!p_nfit->control_region_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->control_region_list[p_nfit->control_region_count],
-			p_control_region_table,
-			sizeof (struct control_region));
-		p_nfit->control_region_count++;
-	}
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->control_region_list[p_nfit->control_region_count],
+		p_control_region_table,
+		length < sizeof (struct control_region) ? length : sizeof (struct control_region));
+	p_nfit->control_region_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the block_data_window_region table
- * to the parsed_nfit structure.
+ * Copy the block_data_window_region table into the next entry of the
+ * pre-sized block_data_window_region list in the parsed_nfit structure.
  */
 int add_block_data_window_region_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct block_data_window_region *p_block_data_window_region_table)
+	const struct block_data_window_region *p_block_data_window_region_table,
+	const size_t length)
+{
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->block_data_window_region_list[p_nfit->block_data_window_region_count],
+		p_block_data_window_region_table,
+		length < sizeof (struct block_data_window_region) ? length : sizeof (struct block_data_window_region));
+	p_nfit->block_data_window_region_count++;
+
+	return NFIT_SUCCESS;
+}
+/*
+ * Copy the flush_hint_address table into the next entry of the
+ * pre-sized flush_hint_address list in the parsed_nfit structure.
+ */
+int add_flush_hint_address_to_parsed_nfit(
+	struct parsed_nfit *p_nfit,
+	const struct flush_hint_address *p_flush_hint_address_table,
+	const size_t length)
+{
+	// the list was sized by the counting pass, short tables are zero-filled
+	memmove(&p_nfit->flush_hint_address_list[p_nfit->flush_hint_address_count],
+		p_flush_hint_address_table,
+		length < sizeof (struct flush_hint_address) ? length : sizeof (struct flush_hint_address));
+	p_nfit->flush_hint_address_count++;
+
+	return NFIT_SUCCESS;
+}
+
+/*
+ * Count the extension tables of each type, validating each table header.
+ */
+int count_nfit_extension_tables(const unsigned char *buffer, size_t buffer_size,
+	struct parsed_nfit *p_counts)
 {
 	int result = NFIT_SUCCESS;
 
-	// allocate space for the extension table
-	p_nfit->block_data_window_region_list =
-		(struct block_data_window_region *)
-		realloc(p_nfit->block_data_window_region_list,
-		sizeof (struct block_data_window_region) *
-		(p_nfit->block_data_window_region_count + 1));
-	if (!p_nfit->block_data_window_region_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
+	size_t offset = sizeof (struct nfit);
+	while (offset < buffer_size)
 	{
-		// copy the extension table
-		memmove(&p_nfit->block_data_window_region_list[p_nfit->block_data_window_region_count],
-			p_block_data_window_region_table,
-			sizeof (struct block_data_window_region));
-		p_nfit->block_data_window_region_count++;
+		if ((offset + NFIT_EXTENSION_HEADER_SIZE) > buffer_size)
+		{
+			result = NFIT_ERR_BADNFIT;
+			break;
+		}
+
+		unsigned short type = nfit_read_u16(buffer + offset);
+		unsigned short length = nfit_read_u16(buffer + offset + 2);
+
+		// check the length for validity
+		if (length == 0 || (length + offset) > buffer_size)
+		{
+			result = NFIT_ERR_BADNFIT;
+			break;
+		}
+
+		switch (type)
+		{
+			case 0: // spa extension table
+				p_counts->spa_count++;
+				break;
+			case 1: // region_mapping extension table
+				p_counts->region_mapping_count++;
+				break;
+			case 2: // interleave extension table
+				p_counts->interleave_count++;
+				break;
+			case 3: // smbios_management_info extension table
+				p_counts->smbios_management_info_count++;
+				break;
+			case 4: // control_region extension table
+				p_counts->control_region_count++;
+				break;
+			case 5: // block_data_window_region extension table
+				p_counts->block_data_window_region_count++;
+				break;
+			case 6: // flush_hint_address extension table
+				p_counts->flush_hint_address_count++;
+				break;
+
+			default:
+				break;
+		}
+		offset += length;
 	}
 
 	return result;
 }
+
 /*
- * Allocate space for and copy the flush_hint_address table
- * to the parsed_nfit structure.
+ * Bytes needed for a parsed NFIT with the given extension table counts
  */
-int add_flush_hint_address_to_parsed_nfit(
-	struct parsed_nfit *p_nfit,
-	const struct flush_hint_address *p_flush_hint_address_table)
+static size_t get_parsed_nfit_arena_size(const struct parsed_nfit *p_counts)
 {
-	int result = NFIT_SUCCESS;
+	size_t arena_size = NFIT_ARENA_ALIGN(sizeof (struct parsed_nfit));
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct spa) * p_counts->spa_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct region_mapping) * p_counts->region_mapping_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct interleave) * p_counts->interleave_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct smbios_management_info) * p_counts->smbios_management_info_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct control_region) * p_counts->control_region_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct block_data_window_region) * p_counts->block_data_window_region_count);
+	arena_size += NFIT_ARENA_ALIGN(sizeof (struct flush_hint_address) * p_counts->flush_hint_address_count);
+	arena_size += nfit_lookup_index_size(p_counts);
+	return arena_size;
+}
 
-	// allocate space for the extension table
-	p_nfit->flush_hint_address_list =
-		(struct flush_hint_address *)
-		realloc(p_nfit->flush_hint_address_list,
-		sizeof (struct flush_hint_address) *
-		(p_nfit->flush_hint_address_count + 1));
-	if (!p_nfit->flush_hint_address_list)
+/*
+ * Point the extension table lists of a parsed NFIT at their place in its
+ * allocation. Returns the offset of the lookup indexes.
+ */
+static size_t layout_parsed_nfit(struct parsed_nfit *p_nfit,
+	const struct parsed_nfit *p_counts)
+{
+	unsigned char *p_arena = (unsigned char *)p_nfit;
+	size_t arena_offset = NFIT_ARENA_ALIGN(sizeof (struct parsed_nfit));
+	p_nfit->spa_list = NULL;
+	if (p_counts->spa_count)
 	{
-		result = NFIT_ERR_NOMEMORY;
+		p_nfit->spa_list = (struct spa *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct spa) * p_counts->spa_count);
 	}
-	else
+	p_nfit->region_mapping_list = NULL;
+	if (p_counts->region_mapping_count)
 	{
-		// copy the extension table
-		memmove(&p_nfit->flush_hint_address_list[p_nfit->flush_hint_address_count],
-			p_flush_hint_address_table,
-			sizeof (struct flush_hint_address));
-		p_nfit->flush_hint_address_count++;
+		p_nfit->region_mapping_list = (struct region_mapping *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct region_mapping) * p_counts->region_mapping_count);
 	}
-
-	return result;
+	p_nfit->interleave_list = NULL;
+	if (p_counts->interleave_count)
+	{
+		p_nfit->interleave_list = (struct interleave *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct interleave) * p_counts->interleave_count);
+	}
+	p_nfit->smbios_management_info_list = NULL;
+	if (p_counts->smbios_management_info_count)
+	{
+		p_nfit->smbios_management_info_list = (struct smbios_management_info *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct smbios_management_info) * p_counts->smbios_management_info_count);
+	}
+	p_nfit->control_region_list = NULL;
+	if (p_counts->control_region_count)
+	{
+		p_nfit->control_region_list = (struct control_region *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct control_region) * p_counts->control_region_count);
+	}
+	p_nfit->block_data_window_region_list = NULL;
+	if (p_counts->block_data_window_region_count)
+	{
+		p_nfit->block_data_window_region_list = (struct block_data_window_region *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct block_data_window_region) * p_counts->block_data_window_region_count);
+	}
+	p_nfit->flush_hint_address_list = NULL;
+	if (p_counts->flush_hint_address_count)
+	{
+		p_nfit->flush_hint_address_list = (struct flush_hint_address *)(p_arena + arena_offset);
+		arena_offset += NFIT_ARENA_ALIGN(sizeof (struct flush_hint_address) * p_counts->flush_hint_address_count);
+	}
+	return arena_offset;
 }
+
 /*
  * Parse raw NFIT data into a parsed_nfit structure.
+ * The first pass counts the extension tables so the second can copy them
+ * into a single pre-sized allocation.
  * The caller is responsible for freeing the parsed_nfit structure.
  */
 int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
@@ -256,33 +308,39 @@ int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
 {
 	int result = NFIT_SUCCESS;
 
-	if (buffer_size == 0 || buffer == NULL)
+	if (buffer_size < sizeof (struct nfit) || buffer == NULL)
 	{
 		return NFIT_ERR_BADINPUT;
 	}
 
-	*pp_parsed_nfit = calloc(1, sizeof (struct parsed_nfit));
-	if (!(*pp_parsed_nfit))
+	struct parsed_nfit counts;
+	memset(&counts, 0, sizeof (counts));
+	result = count_nfit_extension_tables(buffer, buffer_size, &counts);
+	if (result != NFIT_SUCCESS)
+	{
+		return result;
+	}
+
+	size_t arena_size = get_parsed_nfit_arena_size(&counts);
+	unsigned char *p_arena = calloc(1, arena_size);
+	if (!p_arena)
 	{
 		return NFIT_ERR_NOMEMORY;
 	}
 
+	struct parsed_nfit *p_nfit = (struct parsed_nfit *)p_arena;
+	p_nfit->arena_size = arena_size;
+	size_t arena_offset = layout_parsed_nfit(p_nfit, &counts);
+
 	// copy the NFIT header
-	memmove(&(*pp_parsed_nfit)->nfit, buffer, sizeof (struct nfit));
+	memmove(&p_nfit->nfit, buffer, sizeof (struct nfit));
 	size_t offset = sizeof (struct nfit);
 
-	// copy the NFIT extension tables
+	// copy the NFIT extension tables, the headers were validated by the first pass
 	while (offset < buffer_size && result == NFIT_SUCCESS)
 	{
-		unsigned short type = *(buffer + offset);
-		unsigned short length = *(buffer + offset + 2);
-
-		// check the length for validity
-		if (length == 0 || (length + offset) > buffer_size)
-		{
-			result = NFIT_ERR_BADNFIT;
-			break;
-		}
+		unsigned short type = nfit_read_u16(buffer + offset);
+		unsigned short length = nfit_read_u16(buffer + offset + 2);
 
 		// create the extension table
 		switch (type)
@@ -290,102 +348,173 @@ int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
 			case 0: // spa extension table
 			{
 				result = add_spa_to_parsed_nfit(
-					*pp_parsed_nfit, (struct spa *)(buffer + offset));
+					p_nfit, (struct spa *)(buffer + offset), length);
 				break;
 			}
 			case 1: // region_mapping extension table
 			{
 				result = add_region_mapping_to_parsed_nfit(
-					*pp_parsed_nfit, (struct region_mapping *)(buffer + offset));
+					p_nfit, (struct region_mapping *)(buffer + offset), length);
 				break;
 			}
 			case 2: // interleave extension table
 			{
 				result = add_interleave_to_parsed_nfit(
-					*pp_parsed_nfit, (struct interleave *)(buffer + offset));
+					p_nfit, (struct interleave *)(buffer + offset), length);
 				break;
 			}
 			case 3: // smbios_management_info extension table
 			{
 				result = add_smbios_management_info_to_parsed_nfit(
-					*pp_parsed_nfit, (struct smbios_management_info *)(buffer + offset));
+					p_nfit, (struct smbios_management_info *)(buffer + offset), length);
 				break;
 			}
 			case 4: // control_region extension table
 			{
 				result = add_control_region_to_parsed_nfit(
-					*pp_parsed_nfit, (struct control_region *)(buffer + offset));
+					p_nfit, (struct control_region *)(buffer + offset), length);
 				break;
 			}
 			case 5: // block_data_window_region extension table
 			{
 				result = add_block_data_window_region_to_parsed_nfit(
-					*pp_parsed_nfit, (struct block_data_window_region *)(buffer + offset));
+					p_nfit, (struct block_data_window_region *)(buffer + offset), length);
 				break;
 			}
 			case 6: // flush_hint_address extension table
 			{
 				result = add_flush_hint_address_to_parsed_nfit(
-					*pp_parsed_nfit, (struct flush_hint_address *)(buffer + offset));
+					p_nfit, (struct flush_hint_address *)(buffer + offset), length);
 				break;
 			}
+
 			default:
 				break;
 		}
 		offset += length;
 	} // end while extension tables
 
+	if (result == NFIT_SUCCESS)
+	{
+		result = nfit_build_lookup_indexes(p_nfit, p_arena + arena_offset);
+	}
+
 	// on error, free the parsed_nfit struct
-	if (result != NFIT_SUCCESS && *pp_parsed_nfit)
+	if (result != NFIT_SUCCESS)
+	{
+		free_parsed_nfit(p_nfit);
+	}
+	else
 	{
-		free_parsed_nfit(*pp_parsed_nfit);
+		*pp_parsed_nfit = p_nfit;
 	}
 
 	return result;
 }
 
 /*
- * Clean up a parsed nfit structure
+ * Copy a parsed nfit structure into a buffer of at least arena_size bytes,
+ * rebasing the extension table lists and lookup indexes onto the copy
  */
-void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit)
+void nfit_copy_parsed_nfit(struct parsed_nfit *p_dst, const struct parsed_nfit *p_src)
 {
-	if (p_parsed_nfit)
+	memmove(p_dst, p_src, p_src->arena_size);
+	if (p_src->spa_list)
 	{
-		if (p_parsed_nfit->spa_count &&
-			p_parsed_nfit->spa_list)
-		{
-			free(p_parsed_nfit->spa_list);
-		}
-		if (p_parsed_nfit->region_mapping_count &&
-			p_parsed_nfit->region_mapping_list)
-		{
-			free(p_parsed_nfit->region_mapping_list);
-		}
-		if (p_parsed_nfit->interleave_count &&
-			p_parsed_nfit->interleave_list)
-		{
-			free(p_parsed_nfit->interleave_list);
-		}
-		if (p_parsed_nfit->smbios_management_info_count &&
-			p_parsed_nfit->smbios_management_info_list)
-		{
-			free(p_parsed_nfit->smbios_management_info_list);
-		}
-		if (p_parsed_nfit->control_region_count &&
-			p_parsed_nfit->control_region_list)
-		{
-			free(p_parsed_nfit->control_region_list);
-		}
-		if (p_parsed_nfit->block_data_window_region_count &&
-			p_parsed_nfit->block_data_window_region_list)
-		{
-			free(p_parsed_nfit->block_data_window_region_list);
-		}
-		if (p_parsed_nfit->flush_hint_address_count &&
-			p_parsed_nfit->flush_hint_address_list)
-		{
-			free(p_parsed_nfit->flush_hint_address_list);
-		}
+		p_dst->spa_list = (struct spa *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->spa_list - (const unsigned char *)p_src));
+	}
+	if (p_src->region_mapping_list)
+	{
+		p_dst->region_mapping_list = (struct region_mapping *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->region_mapping_list - (const unsigned char *)p_src));
+	}
+	if (p_src->interleave_list)
+	{
+		p_dst->interleave_list = (struct interleave *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->interleave_list - (const unsigned char *)p_src));
+	}
+	if (p_src->smbios_management_info_list)
+	{
+		p_dst->smbios_management_info_list = (struct smbios_management_info *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->smbios_management_info_list - (const unsigned char *)p_src));
+	}
+	if (p_src->control_region_list)
+	{
+		p_dst->control_region_list = (struct control_region *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->control_region_list - (const unsigned char *)p_src));
+	}
+	if (p_src->block_data_window_region_list)
+	{
+		p_dst->block_data_window_region_list = (struct block_data_window_region *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->block_data_window_region_list - (const unsigned char *)p_src));
+	}
+	if (p_src->flush_hint_address_list)
+	{
+		p_dst->flush_hint_address_list = (struct flush_hint_address *)((unsigned char *)p_dst +
+			((const unsigned char *)p_src->flush_hint_address_list - (const unsigned char *)p_src));
+	}
+	nfit_rebase_lookup_indexes(p_dst, p_src);
+}
+
+/*
+ * Restore the pointers of a parsed nfit structure whose bytes were copied
+ * from another address space, such as a persisted cache. The extension
+ * table lists are laid out again from their counts and the lookup
+ * indexes are rebuilt, so only the table contents are trusted.
+ */
+int nfit_restore_parsed_nfit(struct parsed_nfit *p_nfit, const size_t size)
+{
+	int result = NFIT_SUCCESS;
+	if (size < sizeof (struct parsed_nfit) || p_nfit->arena_size != size)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->spa_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
 	}
+	else if (p_nfit->region_mapping_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->interleave_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->smbios_management_info_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->control_region_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->block_data_window_region_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (p_nfit->flush_hint_address_count < 0)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else if (get_parsed_nfit_arena_size(p_nfit) != size)
+	{
+		result = NFIT_ERR_BADNFIT;
+	}
+	else
+	{
+		size_t arena_offset = layout_parsed_nfit(p_nfit, p_nfit);
+		result = nfit_build_lookup_indexes(p_nfit, (unsigned char *)p_nfit + arena_offset);
+	}
+	return result;
+}
+
+/*
+ * Clean up a parsed nfit structure. The extension table lists
+ * live in the same allocation.
+ */
+void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit)
+{
 	free(p_parsed_nfit);
 }
\ No newline at end of file
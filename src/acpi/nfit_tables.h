@@ -29,6 +29,7 @@
 #define _NFIT_INTERFACE_NFIT_TABLES_H_
 
 #include "common.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -166,6 +167,17 @@ struct flush_hint_address
 	unsigned char reserved[6];
 } )
 
+/*
+ * Parsed NFIT lookup index entry. The positions of the tables sharing a key
+ * in their list are index_ordinals[first] to index_ordinals[first + count - 1].
+ */
+struct nfit_index_entry
+{
+	unsigned int key;
+	int first;
+	int count;
+};
+
 struct parsed_nfit
 {
 	struct nfit nfit;
@@ -183,6 +195,18 @@ struct parsed_nfit
 	struct block_data_window_region *block_data_window_region_list;
 	int flush_hint_address_count;
 	struct flush_hint_address *flush_hint_address_list;
+
+	// lookup indexes built at parse time, see nfit_index.c
+	int handle_index_count;
+	struct nfit_index_entry *handle_index; // DIMM handle -> region mappings
+	int spa_index_count;
+	struct nfit_index_entry *spa_index; // SPA range index -> region mappings
+	int control_region_index_count;
+	struct nfit_index_entry *control_region_index; // control region index -> control regions
+	int *index_ordinals;
+
+	// size of the single allocation holding this structure and its lists
+	size_t arena_size;
 };
 
 #ifdef __cplusplus
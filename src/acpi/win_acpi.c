@@ -32,6 +32,8 @@
 #include "acpi.h"
 #include <windows.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 DWORD string_to_dword(const char *str)
 {
@@ -77,3 +79,64 @@ int get_acpi_table(const char *table_signature, struct acpi_table *p_table,
 
 	return rc;
 }
+
+/*!
+ * Allocate and return the specified ACPI table.
+ * GetSystemFirmwareTable has no way to return a table without being
+ * told its size, so this is still a size query followed by the fetch.
+ */
+int get_acpi_table_alloc(const char *table_signature, struct acpi_table **pp_table)
+{
+	int rc = get_acpi_table(table_signature, NULL, 0);
+	if (rc > 0)
+	{
+		unsigned int table_size = (unsigned int)rc;
+		struct acpi_table *p_table = calloc(1, table_size);
+		if (!p_table)
+		{
+			rc = ACPI_ERR_NOMEMORY;
+		}
+		else
+		{
+			rc = get_acpi_table(table_signature, p_table, table_size);
+			if (rc >= 0 && rc < (int)sizeof (struct acpi_table_header))
+			{
+				rc = ACPI_ERR_BADTABLE;
+			}
+			else if (rc >= 0)
+			{
+				rc = check_acpi_table(table_signature, p_table);
+			}
+
+			if (rc == ACPI_SUCCESS)
+			{
+				*pp_table = p_table;
+				rc = (int)table_size;
+			}
+			else
+			{
+				free(p_table);
+			}
+		}
+	}
+	return rc;
+}
+
+/*!
+ * Return the header of the specified ACPI table.
+ * GetSystemFirmwareTable only returns whole tables so the table is
+ * fetched and the header copied out of it.
+ */
+int get_acpi_table_header(const char *table_signature,
+	struct acpi_table_header *p_header)
+{
+	struct acpi_table *p_table = NULL;
+	int rc = get_acpi_table_alloc(table_signature, &p_table);
+	if (rc > 0)
+	{
+		memmove(p_header, &p_table->header, sizeof (*p_header));
+		free(p_table);
+		rc = ACPI_SUCCESS;
+	}
+	return rc;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Times copy_file and copy_file_with_sync on a large file against the 512-byte
+ * read/write loop copy_file used before, and checks each copy against the
+ * source. A sparse file is copied as well, to show its holes stay holes.
+ *
+ * Usage: copy_file_bench [size_mb] [dir]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <file_ops/file_ops_adapter.h>
+#include <string/s_str.h>
+
+#define	BENCH_SRC_FILE		"copy_file_bench.src"
+#define	BENCH_DST_FILE		"copy_file_bench.dst"
+#define	BENCH_MB			(1024 * 1024)
+#define	BENCH_LOOP_BYTES	512
+
+static double now_seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int write_source_file(const char *path, const int size_mb)
+{
+	int rc = 1;
+	FILE *p_file = fopen(path, "wb");
+	unsigned char *p_block = malloc(BENCH_MB);
+	if (p_file == NULL || p_block == NULL)
+	{
+		rc = 0;
+	}
+	else
+	{
+		unsigned int seed = 1;
+		for (int mb = 0; mb < size_mb && rc; mb++)
+		{
+			for (size_t i = 0; i < BENCH_MB; i++)
+			{
+				seed = seed * 1103515245 + 12345;
+				p_block[i] = (unsigned char)(seed >> 16);
+			}
+			rc = fwrite(p_block, 1, BENCH_MB, p_file) == BENCH_MB;
+		}
+	}
+
+	if (p_file != NULL && fclose(p_file) != 0)
+	{
+		rc = 0;
+	}
+	free(p_block);
+	return rc;
+}
+
+/*
+ * A file of size_mb with a few bytes of data at the start and the rest a hole
+ */
+static int write_sparse_file(const char *path, const int size_mb)
+{
+	int rc = 0;
+	int fd = open(path, O_WRONLY|O_CREAT|O_EXCL, 0644);
+	if (fd != -1)
+	{
+		rc = (write(fd, "data", 4) == 4) &&
+			(ftruncate(fd, (off_t)size_mb * BENCH_MB) == 0);
+		if (close(fd) != 0)
+		{
+			rc = 0;
+		}
+	}
+	return rc;
+}
+
+/*
+ * The copy loop copy_file used before it copied in the kernel
+ */
+static int loop_copy(const COMMON_PATH source, const COMMON_PATH destination)
+{
+	int rc = 1;
+	int fd_in = open(source, O_RDONLY);
+	int fd_out = open(destination, O_WRONLY|O_CREAT|O_EXCL, 0644);
+	char buf[BENCH_LOOP_BYTES];
+	ssize_t bytes;
+	if (fd_in == -1 || fd_out == -1)
+	{
+		rc = 0;
+	}
+	while (rc && (bytes = read(fd_in, buf, sizeof (buf))) > 0)
+	{
+		rc = write(fd_out, buf, bytes) == bytes;
+	}
+
+	if (fd_in != -1)
+	{
+		close(fd_in);
+	}
+	if (fd_out != -1 && close(fd_out) != 0)
+	{
+		rc = 0;
+	}
+	return rc;
+}
+
+static int files_match(const char *path1, const char *path2)
+{
+	int rc = 0;
+	FILE *p_file1 = fopen(path1, "rb");
+	FILE *p_file2 = fopen(path2, "rb");
+	unsigned char *p_buf1 = malloc(BENCH_MB);
+	unsigned char *p_buf2 = malloc(BENCH_MB);
+	if (p_file1 != NULL && p_file2 != NULL && p_buf1 != NULL && p_buf2 != NULL)
+	{
+		size_t len1;
+		size_t len2;
+		do
+		{
+			len1 = fread(p_buf1, 1, BENCH_MB, p_file1);
+			len2 = fread(p_buf2, 1, BENCH_MB, p_file2);
+		}
+		while (len1 == len2 && len1 > 0 && memcmp(p_buf1, p_buf2, len1) == 0);
+		rc = len1 == 0 && len2 == 0;
+	}
+
+	if (p_file1 != NULL)
+	{
+		fclose(p_file1);
+	}
+	if (p_file2 != NULL)
+	{
+		fclose(p_file2);
+	}
+	free(p_buf1);
+	free(p_buf2);
+	return rc;
+}
+
+typedef int (*CopyFn)(const COMMON_PATH source, const COMMON_PATH destination);
+
+static int lib_copy(const COMMON_PATH source, const COMMON_PATH destination)
+{
+	return copy_file(source, COMMON_PATH_LEN, destination, COMMON_PATH_LEN);
+}
+
+static int lib_copy_sync(const COMMON_PATH source, const COMMON_PATH destination)
+{
+	return copy_file_with_sync(source, COMMON_PATH_LEN, destination, COMMON_PATH_LEN, 1);
+}
+
+/*
+ * Time one copy, report the space it takes on disk and check it against the source
+ */
+static int run(const char *name, CopyFn copy, const COMMON_PATH src_file,
+	const COMMON_PATH dst_file, const int size_mb)
+{
+	double start = now_seconds();
+	int rc = copy(src_file, dst_file);
+	double seconds = now_seconds() - start;
+
+	struct stat stat_buf;
+	if (!rc)
+	{
+		fprintf(stderr, "%s: the copy failed\n", name);
+	}
+	else if (!files_match(src_file, dst_file))
+	{
+		fprintf(stderr, "%s: the copy does not match the source\n", name);
+		rc = 0;
+	}
+	else if (stat(dst_file, &stat_buf) == 0)
+	{
+		printf("%-16s %10.2f ms %10.1f MB/s %10lld KB allocated\n", name,
+			seconds * 1000.0, size_mb / seconds,
+			(long long)stat_buf.st_blocks * 512 / 1024);
+	}
+	remove(dst_file);
+	return rc;
+}
+
+int main(int argc, char *argv[])
+{
+	int rc = 0;
+	int size_mb = argc > 1 ? atoi(argv[1]) : 1024;
+	const char *dir = argc > 2 ? argv[2] : ".";
+	COMMON_PATH src_file;
+	COMMON_PATH dst_file;
+
+	if (size_mb <= 0)
+	{
+		fprintf(stderr, "Usage: %s [size_mb] [dir]\n", argv[0]);
+		return 1;
+	}
+	snprintf(src_file, COMMON_PATH_LEN, "%s/%s", dir, BENCH_SRC_FILE);
+	snprintf(dst_file, COMMON_PATH_LEN, "%s/%s", dir, BENCH_DST_FILE);
+	if (file_exists(src_file, COMMON_PATH_LEN) || file_exists(dst_file, COMMON_PATH_LEN))
+	{
+		fprintf(stderr, "%s already holds %s or %s\n", dir, BENCH_SRC_FILE, BENCH_DST_FILE);
+		return 1;
+	}
+
+	if (!write_source_file(src_file, size_mb))
+	{
+		fprintf(stderr, "Failed to write %d MB to %s\n", size_mb, src_file);
+		rc = 1;
+	}
+	else
+	{
+		printf("%d MB file in %s\n", size_mb, dir);
+		rc |= !run("512B loop", loop_copy, src_file, dst_file, size_mb);
+		rc |= !run("copy_file", lib_copy, src_file, dst_file, size_mb);
+		rc |= !run("copy_file sync", lib_copy_sync, src_file, dst_file, size_mb);
+	}
+	remove(src_file);
+
+	if (!rc && !write_sparse_file(src_file, size_mb))
+	{
+		fprintf(stderr, "Failed to write a sparse file to %s\n", src_file);
+		rc = 1;
+	}
+	else if (!rc)
+	{
+		printf("%d MB sparse file with 4 bytes of data\n", size_mb);
+		rc |= !run("copy_file", lib_copy, src_file, dst_file, size_mb);
+	}
+	remove(src_file);
+
+	return rc;
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Times encrypting and decrypting a support data file with rsa_encrypt and
+ * rsa_decrypt, and checks that the decrypted file matches the original.
+ * A throwaway RSA key pair is generated for the run. The public key is written
+ * to the current directory, where rsa_encrypt looks for it first, so run it
+ * from a directory that does not already hold one.
+ *
+ * Usage: encrypt_bench [size_mb]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openssl/bn.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <encrypt/encrypt.h>
+#include <file_ops/file_ops_adapter.h>
+#include <string/s_str.h>
+
+#define	BENCH_PUBLIC_KEY_FILE	"public.rev0.pem"
+#define	BENCH_PRIVATE_KEY_FILE	"encrypt_bench.private.pem"
+#define	BENCH_SRC_FILE			"encrypt_bench.src"
+#define	BENCH_DECRYPTED_FILE	"encrypt_bench.dec"
+#define	BENCH_RSA_BITS			2048
+#define	BENCH_MB				(1024 * 1024)
+
+static double now_seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Write a fresh RSA key pair: the public key where rsa_encrypt finds it,
+ * the private key for rsa_decrypt.
+ */
+static int write_key_pair()
+{
+	int rc = 0;
+	RSA *p_rsa = RSA_new();
+	BIGNUM *p_exponent = BN_new();
+	FILE *p_public = NULL;
+	FILE *p_private = NULL;
+
+	if (p_rsa == NULL || p_exponent == NULL ||
+		!BN_set_word(p_exponent, RSA_F4) ||
+		!RSA_generate_key_ex(p_rsa, BENCH_RSA_BITS, p_exponent, NULL))
+	{
+		fprintf(stderr, "Failed to generate an RSA key\n");
+	}
+	else if ((p_public = fopen(BENCH_PUBLIC_KEY_FILE, "w")) == NULL ||
+		(p_private = fopen(BENCH_PRIVATE_KEY_FILE, "w")) == NULL)
+	{
+		fprintf(stderr, "Failed to create the key files\n");
+	}
+	else if (!PEM_write_RSA_PUBKEY(p_public, p_rsa) ||
+		!PEM_write_RSAPrivateKey(p_private, p_rsa, NULL, NULL, 0, NULL, NULL))
+	{
+		fprintf(stderr, "Failed to write the key files\n");
+	}
+	else
+	{
+		rc = 1;
+	}
+
+	if (p_public != NULL)
+	{
+		fclose(p_public);
+	}
+	if (p_private != NULL)
+	{
+		fclose(p_private);
+	}
+	BN_free(p_exponent);
+	RSA_free(p_rsa);
+	return rc;
+}
+
+/*
+ * The next megabyte of a stream that does not repeat within a block, so the
+ * run is not flattered by anything that could take a shortcut on it.
+ */
+static void fill_block(unsigned int *p_seed, unsigned char *p_block)
+{
+	for (size_t i = 0; i < BENCH_MB; i++)
+	{
+		*p_seed = *p_seed * 1103515245 + 12345;
+		p_block[i] = (unsigned char)(*p_seed >> 16);
+	}
+}
+
+static int write_source_file(const int size_mb)
+{
+	int rc = 1;
+	FILE *p_file = fopen(BENCH_SRC_FILE, "wb");
+	unsigned char *p_block = malloc(BENCH_MB);
+	if (p_file == NULL || p_block == NULL)
+	{
+		rc = 0;
+	}
+	else
+	{
+		unsigned int seed = 1;
+		for (int mb = 0; mb < size_mb && rc; mb++)
+		{
+			fill_block(&seed, p_block);
+			rc = fwrite(p_block, 1, BENCH_MB, p_file) == BENCH_MB;
+		}
+	}
+
+	if (p_file != NULL && fclose(p_file) != 0)
+	{
+		rc = 0;
+	}
+	free(p_block);
+	return rc;
+}
+
+/*
+ * rsa_encrypt deletes its source file, so the decrypted file is checked
+ * against the same stream regenerated.
+ */
+static int decrypted_file_matches(const int size_mb)
+{
+	int rc = 0;
+	FILE *p_file = fopen(BENCH_DECRYPTED_FILE, "rb");
+	unsigned char *p_expected = malloc(BENCH_MB);
+	unsigned char *p_actual = malloc(BENCH_MB);
+	if (p_file != NULL && p_expected != NULL && p_actual != NULL)
+	{
+		unsigned int seed = 1;
+		rc = 1;
+		for (int mb = 0; mb < size_mb && rc; mb++)
+		{
+			fill_block(&seed, p_expected);
+			rc = fread(p_actual, 1, BENCH_MB, p_file) == BENCH_MB &&
+				memcmp(p_expected, p_actual, BENCH_MB) == 0;
+		}
+		if (rc && fread(p_actual, 1, 1, p_file) != 0)
+		{
+			rc = 0;
+		}
+	}
+
+	if (p_file != NULL)
+	{
+		fclose(p_file);
+	}
+	free(p_expected);
+	free(p_actual);
+	return rc;
+}
+
+static void report(const char *name, const double seconds, const int size_mb)
+{
+	printf("%-8s %10.2f ms %10.1f MB/s\n", name, seconds * 1000.0, size_mb / seconds);
+}
+
+int main(int argc, char *argv[])
+{
+	int rc = 1;
+	int size_mb = argc > 1 ? atoi(argv[1]) : 100;
+	COMMON_PATH src_file;
+	COMMON_PATH encrypted_file;
+	COMMON_PATH decrypted_file;
+	COMMON_PATH private_key_file;
+	COMMON_PATH public_key_file;
+
+	if (size_mb <= 0)
+	{
+		fprintf(stderr, "Usage: %s [size_mb]\n", argv[0]);
+		return 1;
+	}
+	s_strcpy(public_key_file, BENCH_PUBLIC_KEY_FILE, COMMON_PATH_LEN);
+	if (file_exists(public_key_file, COMMON_PATH_LEN))
+	{
+		fprintf(stderr, "%s already exists, run from another directory\n",
+			BENCH_PUBLIC_KEY_FILE);
+		return 1;
+	}
+
+	s_strcpy(src_file, BENCH_SRC_FILE, COMMON_PATH_LEN);
+	encrypted_file[0] = '\0';
+	s_strcpy(decrypted_file, BENCH_DECRYPTED_FILE, COMMON_PATH_LEN);
+	s_strcpy(private_key_file, BENCH_PRIVATE_KEY_FILE, COMMON_PATH_LEN);
+
+	if (!write_key_pair())
+	{
+		// reported by write_key_pair
+	}
+	else if (!write_source_file(size_mb))
+	{
+		fprintf(stderr, "Failed to write %d MB to %s\n", size_mb, BENCH_SRC_FILE);
+	}
+	else
+	{
+		printf("%d MB, RSA-%d key\n", size_mb, BENCH_RSA_BITS);
+
+		double start = now_seconds();
+		int encrypt_rc = rsa_encrypt(src_file, encrypted_file);
+		double encrypt_seconds = now_seconds() - start;
+
+		start = now_seconds();
+		int decrypt_rc = encrypt_rc == COMMON_SUCCESS ?
+			rsa_decrypt(private_key_file, encrypted_file, decrypted_file) : encrypt_rc;
+		double decrypt_seconds = now_seconds() - start;
+
+		if (encrypt_rc != COMMON_SUCCESS)
+		{
+			fprintf(stderr, "rsa_encrypt failed: %d\n", encrypt_rc);
+		}
+		else if (decrypt_rc != COMMON_SUCCESS)
+		{
+			fprintf(stderr, "rsa_decrypt failed: %d\n", decrypt_rc);
+		}
+		else if (!decrypted_file_matches(size_mb))
+		{
+			fprintf(stderr, "The decrypted file does not match the original\n");
+		}
+		else
+		{
+			report("encrypt", encrypt_seconds, size_mb);
+			report("decrypt", decrypt_seconds, size_mb);
+			rc = 0;
+		}
+	}
+
+	remove(BENCH_SRC_FILE);
+	if (encrypted_file[0] != '\0')
+	{
+		remove(encrypted_file);
+	}
+	remove(BENCH_DECRYPTED_FILE);
+	remove(BENCH_PRIVATE_KEY_FILE);
+	remove(BENCH_PUBLIC_KEY_FILE);
+	return rc;
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Times rendering FW command payloads for a support dump over many DIMMs:
+ * a new stringstream per payload, as the fwPayloadToString_* methods built
+ * before FwPayloadFormatter, against one reused FwPayloadFormatter buffer in
+ * the text and JSON formats.
+ *
+ * Usage: fw_payload_formatter_bench [dimm_count] [iterations]
+ */
+
+#include <core/firmware_interface/FwCommands.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+using core::firmware_interface::FwCommands;
+using core::firmware_interface::FwPayloadFormatter;
+
+namespace
+{
+
+struct Payloads
+{
+	struct fwcmd_smart_health_info_data health;
+	struct fwcmd_identify_dimm_data identify;
+};
+
+void fillPayloads(Payloads &payloads, int dimm)
+{
+	unsigned char *p_bytes = (unsigned char *)&payloads;
+	for (size_t i = 0; i < sizeof (payloads); i++)
+	{
+		p_bytes[i] = (unsigned char)('A' + (i + dimm) % 26);
+	}
+	// the baseline streams these as C strings, the parser terminates them
+	payloads.identify.firmware_revision[sizeof (payloads.identify.firmware_revision) - 1] = '\0';
+	payloads.identify.part_number[sizeof (payloads.identify.part_number) - 1] = '\0';
+}
+
+// The stringstream rendering the fwPayloadToString_* methods used before
+// FwPayloadFormatter, copied here as the baseline
+std::string legacyFieldsToString_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data)
+{
+	std::stringstream result;
+	result << "\nIdentify Dimm:" << "\n";
+	result << "VendorId: " << p_data->vendor_id << "\n";
+	result << "DeviceId: " << p_data->device_id << "\n";
+	result << "RevisionId: " << p_data->revision_id << "\n";
+	result << "InterfaceFormatCode: " << p_data->interface_format_code << "\n";
+	result << "FirmwareRevision: " << p_data->firmware_revision << "\n";
+	result << "ReservedOldApi: " << (int) p_data->reserved_old_api << "\n";
+	result << "FeatureSwRequiredMask: " << (int) p_data->feature_sw_required_mask << "\n";
+	result << "InvalidateBeforeBlockRead: " << p_data->feature_sw_required_mask_invalidate_before_block_read << "\n";
+	result << "ReadbackOfBwAddressRegisterRequiredBeforeUse: " << p_data->feature_sw_required_mask_readback_of_bw_address_register_required_before_use << "\n";
+
+	result << "NumberOfBlockWindows: " << p_data->number_of_block_windows << "\n";
+	result << "OffsetOfBlockModeControlRegion: " << p_data->offset_of_block_mode_control_region << "\n";
+	result << "RawCapacity: " << p_data->raw_capacity << "\n";
+	result << "Manufacturer: " << p_data->manufacturer << "\n";
+	result << "SerialNumber: " << p_data->serial_number << "\n";
+	result << "PartNumber: " << p_data->part_number << "\n";
+	result << "DimmSku: " << p_data->dimm_sku << "\n";
+	result << "MemoryModeEnabled: " << p_data->dimm_sku_memory_mode_enabled << "\n";
+	result << "StorageModeEnabled: " << p_data->dimm_sku_storage_mode_enabled << "\n";
+	result << "AppDirectModeEnabled: " << p_data->dimm_sku_app_direct_mode_enabled << "\n";
+	result << "DieSparingCapable: " << p_data->dimm_sku_die_sparing_capable << "\n";
+	result << "SoftProgrammableSku: " << p_data->dimm_sku_soft_programmable_sku << "\n";
+	result << "EncryptionEnabled: " << p_data->dimm_sku_encryption_enabled << "\n";
+
+	result << "InterfaceFormatCodeExtra: " << p_data->interface_format_code_extra << "\n";
+	result << "ApiVer: " << p_data->api_ver << "\n";
+	return result.str();
+}
+
+std::string legacyToString_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data)
+{
+	std::stringstream result;
+	result << "\nIdentify Dimm:" << "\n";
+	result << legacyFieldsToString_IdentifyDimm(p_data);
+
+	return result.str();
+}
+
+std::string legacyFieldsToString_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data)
+{
+	std::stringstream result;
+	result << "\nSmart Health Info:" << "\n";
+	result << "ValidationFlags: " << p_data->validation_flags << "\n";
+	result << "HealthStatus: " << p_data->validation_flags_health_status << "\n";
+	result << "SpareBlocks: " << p_data->validation_flags_spare_blocks << "\n";
+	result << "PercentUsed: " << p_data->validation_flags_percent_used << "\n";
+	result << "MediaTemp: " << p_data->validation_flags_media_temp << "\n";
+	result << "ControllerTemp: " << p_data->validation_flags_controller_temp << "\n";
+	result << "UnsafeShutdownCounter: " << p_data->validation_flags_unsafe_shutdown_counter << "\n";
+	result << "AitDramStatus: " << p_data->validation_flags_ait_dram_status << "\n";
+	result << "AlarmTrips: " << p_data->validation_flags_alarm_trips << "\n";
+	result << "LastShutdownStatus: " << p_data->validation_flags_last_shutdown_status << "\n";
+	result << "VendorSpecificDataSize: " << p_data->validation_flags_vendor_specific_data_size << "\n";
+
+	result << "HealthStatus: " << (int) p_data->health_status << "\n";
+	result << "Noncritical: " << p_data->health_status_noncritical << "\n";
+	result << "Critical: " << p_data->health_status_critical << "\n";
+	result << "Fatal: " << p_data->health_status_fatal << "\n";
+
+	result << "SpareBlocks: " << (int) p_data->spare_blocks << "\n";
+	result << "PercentUsed: " << (int) p_data->percent_used << "\n";
+	result << "AlarmTrips: " << (int) p_data->alarm_trips << "\n";
+	result << "SpareBlockTrip: " << p_data->alarm_trips_spare_block_trip << "\n";
+	result << "MediaTemperatureTrip: " << p_data->alarm_trips_media_temperature_trip << "\n";
+	result << "ControllerTemperatureTrip: " << p_data->alarm_trips_controller_temperature_trip << "\n";
+
+	result << "MediaTemp: " << p_data->media_temp << "\n";
+	result << "ControllerTemp: " << p_data->controller_temp << "\n";
+	result << "UnsafeShutdownCount: " << p_data->unsafe_shutdown_count << "\n";
+	result << "AitDramStatus: " << (int) p_data->ait_dram_status << "\n";
+	result << "LastShutdownStatus: " << (int) p_data->last_shutdown_status << "\n";
+	result << "VendorSpecificDataSize: " << p_data->vendor_specific_data_size << "\n";
+	result << "PowerCycles: " << p_data->power_cycles << "\n";
+	result << "PowerOnTime: " << p_data->power_on_time << "\n";
+	result << "Uptime: " << p_data->uptime << "\n";
+	result << "UnsafeShutdowns: " << p_data->unsafe_shutdowns << "\n";
+	result << "LastShutdownStatusDetails: " << (int) p_data->last_shutdown_status_details << "\n";
+	result << "PmAdrCommandReceived: " << p_data->last_shutdown_status_details_pm_adr_command_received << "\n";
+	result << "PmS3Received: " << p_data->last_shutdown_status_details_pm_s3_received << "\n";
+	result << "PmS5Received: " << p_data->last_shutdown_status_details_pm_s5_received << "\n";
+	result << "DdrtPowerFailCommandReceived: " << p_data->last_shutdown_status_details_ddrt_power_fail_command_received << "\n";
+	result << "Pmic12vPowerFail: " << p_data->last_shutdown_status_details_pmic_12v_power_fail << "\n";
+	result << "PmWarmResetReceived: " << p_data->last_shutdown_status_details_pm_warm_reset_received << "\n";
+	result << "ThermalShutdownReceived: " << p_data->last_shutdown_status_details_thermal_shutdown_received << "\n";
+	result << "FlushComplete: " << p_data->last_shutdown_status_details_flush_complete << "\n";
+
+	result << "LastShutdownTime: " << p_data->last_shutdown_time << "\n";
+	result << "LastShutdownStatusExtendedDetails: " << (int) p_data->last_shutdown_status_extended_details << "\n";
+	result << "ViralInterruptReceived: " << p_data->last_shutdown_status_extended_details_viral_interrupt_received << "\n";
+	result << "SurpriseClockStopInterruptReceived: " << p_data->last_shutdown_status_extended_details_surprise_clock_stop_interrupt_received << "\n";
+	result << "WriteDataFlushComplete: " << p_data->last_shutdown_status_extended_details_write_data_flush_complete << "\n";
+	result << "S4PowerStateReceived: " << p_data->last_shutdown_status_extended_details_s4_power_state_received << "\n";
+
+	result << "MediaErrorInjections: " << p_data->media_error_injections << "\n";
+	result << "NonMediaErrorInjections: " << p_data->non_media_error_injections << "\n";
+	return result.str();
+}
+
+std::string legacyToString_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data)
+{
+	std::stringstream result;
+	result << "\nSmart Health Info:" << "\n";
+	result << legacyFieldsToString_SmartHealthInfo(p_data);
+
+	return result.str();
+}
+
+typedef void (*RenderFn)(FwCommands &cmds, const Payloads &payloads, std::string &buffer,
+	FwPayloadFormatter::Format format);
+
+void renderStrings(FwCommands &cmds, const Payloads &payloads, std::string &buffer,
+	FwPayloadFormatter::Format format)
+{
+	buffer += legacyToString_SmartHealthInfo(&payloads.health);
+	buffer += legacyToString_IdentifyDimm(&payloads.identify);
+}
+
+void renderFormatter(FwCommands &cmds, const Payloads &payloads, std::string &buffer,
+	FwPayloadFormatter::Format format)
+{
+	FwPayloadFormatter formatter(buffer, format);
+	cmds.fwPayloadFormat_SmartHealthInfo(&payloads.health, formatter);
+	cmds.fwPayloadFormat_IdentifyDimm(&payloads.identify, formatter);
+}
+
+void run(const char *name, RenderFn render, FwPayloadFormatter::Format format,
+	FwCommands &cmds, const Payloads *p_payloads, int dimmCount, int iterations)
+{
+	std::string buffer;
+	size_t bytes = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		buffer.clear();
+		for (int d = 0; d < dimmCount; d++)
+		{
+			render(cmds, p_payloads[d], buffer, format);
+		}
+		bytes += buffer.size();
+	}
+	double seconds = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count();
+
+	printf("%-10s %10.2f ms %10.1f MB/s %12zu bytes per dump\n", name,
+		seconds * 1000.0 / iterations, bytes / seconds / (1024.0 * 1024.0),
+		bytes / iterations);
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+	int dimmCount = argc > 1 ? atoi(argv[1]) : 1024;
+	int iterations = argc > 2 ? atoi(argv[2]) : 20;
+	if (dimmCount <= 0 || iterations <= 0)
+	{
+		fprintf(stderr, "Usage: %s [dimm_count] [iterations]\n", argv[0]);
+		return 1;
+	}
+
+	Payloads *p_payloads = new Payloads[dimmCount];
+	for (int d = 0; d < dimmCount; d++)
+	{
+		fillPayloads(p_payloads[d], d);
+	}
+
+	FwCommands &cmds = FwCommands::getFwCommands();
+	printf("%d DIMMs, %d iterations\n", dimmCount, iterations);
+	run("strings", renderStrings, FwPayloadFormatter::FORMAT_TEXT,
+		cmds, p_payloads, dimmCount, iterations);
+	run("text", renderFormatter, FwPayloadFormatter::FORMAT_TEXT,
+		cmds, p_payloads, dimmCount, iterations);
+	run("json", renderFormatter, FwPayloadFormatter::FORMAT_JSON,
+		cmds, p_payloads, dimmCount, iterations);
+
+	delete[] p_payloads;
+	return 0;
+}
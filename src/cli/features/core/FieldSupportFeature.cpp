@@ -61,6 +61,7 @@
 #include <support/DiagnosticCompletionRecordFactory.h>
 #include <support/NVDIMMLogEntryFactory.h>
 #include <string.h>
+#include <stdio.h>
 #include <support/NVDIMMEventLogFactory.h>
 #include "CommandParts.h"
 #include "WbemToCli.h"
@@ -671,6 +672,23 @@ cli::framework::ResultBase *cli::nvmcli::FieldSupportFeature::updateFirmware(
 	return pResult;
 }
 
+/*
+ * Show the FW image transfer progress and rate on one console line
+ */
+static void printFwTransferProgress(const char *deviceUid,
+		const struct fw_transfer_progress *pProgress, void *pContext)
+{
+	const std::string *pDimmId = (const std::string *)pContext;
+	printf("\rTransferring the firmware to " NVM_DIMM_NAME " %s: %3u%% (%llu KiB/s)",
+			pDimmId->c_str(), (unsigned int)pProgress->percent_complete,
+			(unsigned long long)(pProgress->bytes_per_second / 1024));
+	if (pProgress->bytes_transferred == pProgress->total_bytes)
+	{
+		printf("\n");
+	}
+	fflush(stdout);
+}
+
 /*
  * Simple wrapper around WBEM
  */
@@ -679,7 +697,13 @@ void cli::nvmcli::FieldSupportFeature::wbemInstallFromPath(const std::string &de
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 	wbem::software::NVDIMMSoftwareInstallationServiceFactory provider;
-	provider.installFromPath(deviceUid, uri, force);
+
+	std::string dimmId = wbem::physical_asset::NVDIMMFactory::uidToDimmIdStr(deviceUid);
+	struct fw_update_callbacks callbacks;
+	memset(&callbacks, 0, sizeof (callbacks));
+	callbacks.progress = printFwTransferProgress;
+	callbacks.p_context = &dimmId;
+	provider.installFromPath(deviceUid, uri, force, &callbacks);
 }
 
 int cli::nvmcli::FieldSupportFeature::wbemExamineFwImage(const std::string &deviceUid,
@@ -39,6 +39,8 @@
 #include <exception/NvmExceptionNotManageable.h>
 #include <cli/features/core/StringList.h>
 #include <memory>
+#include <unordered_set>
+#include <climits>
 
 namespace cli
 {
@@ -73,15 +75,13 @@ std::string ShowCommandUtilities::getFirstBadDimmId(
 	{
 		std::string dimmId = dimmIds[i];
 		bool dimmIdFound = false;
-		bool isHandle = cli::nvmcli::isStringValidNumber(dimmId);
-		bool isValidUid = isUid(dimmId);
-		for (size_t j = 0; j < devices.size() && !dimmIdFound; j++)
+		if (isUid(dimmId))
 		{
-			if ((isValidUid && framework::stringsIEqual(dimmIds[i], devices[j].getUid())) ||
-					(isHandle && (NVM_UINT32)stringToUInt64(dimmIds[i]) == devices[j].getDeviceHandle()))
-			{
-				dimmIdFound = true;
-			}
+			dimmIdFound = (devices.findByUid(dimmId) != NULL);
+		}
+		if (!dimmIdFound && cli::nvmcli::isStringValidNumber(dimmId))
+		{
+			dimmIdFound = (devices.findByHandle((NVM_UINT32)stringToUInt64(dimmId)) != NULL);
 		}
 		if (!dimmIdFound)
 		{
@@ -133,13 +133,14 @@ std::string ShowCommandUtilities::getFirstBadSocketId(const core::StringList &so
 	std::string badsocketId = "";
 	for (size_t i = 0; i < socketIds.size() && badsocketId.empty(); i++)
 	{
+		// socket IDs must match the device's socket ID string exactly
 		bool socketIdFound = false;
-		for (size_t j = 0; j < devices.size() && !socketIdFound; j++)
+		if (cli::nvmcli::isStringValidNumber(socketIds[i]))
 		{
-			if (socketIds[i] == uint64ToString(devices[j].getSocketId()))
-			{
-				socketIdFound = true;
-			}
+			NVM_UINT64 socketId = stringToUInt64(socketIds[i]);
+			socketIdFound = socketId <= USHRT_MAX &&
+					uint64ToString(socketId) == socketIds[i] &&
+					devices.containsSocket((NVM_UINT16)socketId);
 		}
 		if (!socketIdFound)
 		{
@@ -156,32 +157,28 @@ void ShowCommandUtilities::filterDevicesOnDimmIds(core::device::DeviceCollection
 
 	if (dimmIds.size() > 0)
 	{
-		std::vector<NVM_UINT32> input_handles;
+		std::unordered_set<NVM_UINT32> input_handles;
+		std::unordered_set<std::string> input_uids;
 		for (size_t i = 0; i < dimmIds.size(); i++)
 		{
-			input_handles.push_back((NVM_UINT32)stringToUInt64(dimmIds[i]));
+			std::string dimmId = dimmIds[i];
+			if (cli::nvmcli::isStringValidNumber(dimmId))
+			{
+				input_handles.insert((NVM_UINT32)stringToUInt64(dimmId));
+			}
+			if (isUid(dimmId))
+			{
+				input_uids.insert(dimmId);
+			}
 		}
 
 		for (size_t i = devices.size(); i > 0; i--)
 		{
 			core::device::Device &device = devices[i - 1];
-			NVM_UINT32 expected_handle = device.getDeviceHandle();
-			std::string expected_uid = device.getUid();
 
-			bool device_found = false;
-			for (size_t j = 0; j < dimmIds.size(); j++)
-			{
-				std::string dimmId = dimmIds[j];
-				NVM_UINT32 input_handle = (NVM_UINT32)stringToUInt64(dimmId);
-				bool isHandle = cli::nvmcli::isStringValidNumber(dimmId);
-				bool isValidUid = isUid(dimmId);
-				if ((isHandle && (input_handle == expected_handle))
-						|| (isValidUid && (dimmIds[j] == expected_uid)))
-				{
-					device_found = true;
-					break;
-				}
-			}
+			bool device_found =
+					(input_handles.find(device.getDeviceHandle()) != input_handles.end()) ||
+					(input_uids.find(device.getUid()) != input_uids.end());
 
 			if (!device_found)
 			{
@@ -198,13 +195,14 @@ void ShowCommandUtilities::filterDevicesOnSocketIds(core::device::DeviceCollecti
 
 	if (socketIds.size() > 0)
 	{
+		std::unordered_set<std::string> input_sockets(socketIds.begin(), socketIds.end());
 		for (size_t i = devices.size(); i > 0; i--)
 		{
 			core::device::Device &device = devices[i - 1];
 
 			std::string socketId = uint64ToString(device.getSocketId());
 
-			if (!socketIds.contains(socketId))
+			if (input_sockets.find(socketId) == input_sockets.end())
 			{
 				devices.removeAt(i - 1);
 			}
@@ -77,6 +77,20 @@ static const IXP_PROP_KEY show_dimm_ixp_props[] =
 
 #define LEN_SHOW_DIMM_IXP_PROPS sizeof(show_dimm_ixp_props)/sizeof(IXP_PROP_KEY)
 
+// ixp can look up any of its properties by name, but only the ones above
+// aren't already displayed by the normal show dimm flow
+static bool isShowDimmIxpProp(IXP_PROP_KEY key)
+{
+	for (size_t i = 0; i < LEN_SHOW_DIMM_IXP_PROPS; i++)
+	{
+		if (show_dimm_ixp_props[i] == key)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 ShowDeviceCommand::ShowDeviceCommand(core::device::DeviceService &service)
 	: m_service(service), m_pResult(NULL)
 {
@@ -202,7 +216,8 @@ framework::ResultBase *ShowDeviceCommand::execute(const framework::ParsedCommand
 	{
 		try
 		{
-			m_devices = m_service.getAllDevices();
+			// every DIMM is shown unless filtered, so get all details in one batch
+			m_devices = m_service.getAllDevices(m_dimmIds.empty());
 
 			if (dimmIdsAreValid())
 			{
@@ -443,106 +458,119 @@ void ShowDeviceCommand::createResults()
 	pList->setRoot(ROOT);
 	m_pResult = pList;
 
-	for (size_t i = 0; i < m_devices.size(); i++)
+	// Do IXP calls ////////////
+
+	// It's not using the properties array below as it's a little tricky to
+	// make these calls look like the C++ calls
+	// All DIMMs are queried together so each FIS command is only sent once
+	// per DIMM, and the DIMMs are queried in parallel
+	std::vector<IXP_PROP_KEY> ixpKeys;
+	const std::vector<std::string> &displayNames = m_displayOptions.getDisplay();
+	// If the user specified property names, display only those properties
+	if (displayNames.size() > 0)
 	{
-		framework::PropertyListResult value;
-		for (size_t j = 0; j < m_props.size(); j++)
+		IXP_PROP_KEY key;
+		for (size_t i = 0; i < displayNames.size(); i++)
 		{
-			framework::IPropertyDefinition<core::device::Device> &p = m_props[j];
-			if (isPropertyDisplayed(p))
+			char * name = const_cast<char*>(displayNames[i].c_str());
+			if (IXP_SUCCESS == ixp_get_prop_key_by_name(name,
+					(unsigned int)displayNames[i].size(), &key) &&
+				isShowDimmIxpProp(key))
 			{
-				value.insert(p.getName(), p.getValue(m_devices[i]));
+				ixpKeys.push_back(key);
 			}
-		}
-
 
+			// Improperly named properties have already been handled
+		}
+	}
+	// Process list of ixp-implemented properties, they are only shown
+	// in the "-a" case or if they're user specified
+	else if (m_displayOptions.isAll())
+	{
+		ixpKeys.assign(show_dimm_ixp_props, show_dimm_ixp_props + LEN_SHOW_DIMM_IXP_PROPS);
+	}
 
-		// Do IXP calls ////////////
-
-		// It's not using the properties array above as it's a little tricky to
-		// make these calls look like the C++ calls
-
-		struct ixp_context * ctx;
-		NVM_NFIT_DEVICE_HANDLE handle;
-		unsigned int numProps = 0;
-		handle.handle = m_devices[i].getDeviceHandle();
-		ixp_create_ctx_nfit_handle(&ctx, handle, (void *) NULL);
+	struct ixp_prop_table *pIxpTable = NULL;
+	if (!ixpKeys.empty() && !m_devices.empty())
+	{
+		std::vector<NVM_NFIT_DEVICE_HANDLE> handles(m_devices.size());
+		for (size_t i = 0; i < m_devices.size(); i++)
+		{
+			handles[i].handle = m_devices[i].getDeviceHandle();
+		}
 
-		// Malloc space for all properties that we might gather from ixp
-		// Not strictly necessary but it's simpler this way
-		struct ixp_prop_info * props = (struct ixp_prop_info *)malloc(sizeof(struct ixp_prop_info)
-			*LEN_SHOW_DIMM_IXP_PROPS);
-		if (props == NULL)
+		int rc = ixp_get_props_multi(handles.data(), (unsigned int)handles.size(),
+			ixpKeys.data(), (unsigned int)ixpKeys.size(), &pIxpTable);
+		if (rc == IXP_NO_MEM_RESOURCES)
 		{
 			throw wbem::exception::NvmExceptionLibError(NVM_ERR_NOMEMORY);
 		}
+		else if (rc != IXP_SUCCESS)
+		{
+			throw wbem::exception::NvmExceptionLibError(NVM_ERR_UNKNOWN);
+		}
 
-		const std::vector<std::string> &displayNames = m_displayOptions.getDisplay();
-		// If the user specified property names, display only those properties
-		if (displayNames.size() > 0)
+		// Every ixp property was asked for with "-a", so any failure is an error
+		for (size_t i = 0; i < m_devices.size() && displayNames.empty(); i++)
 		{
-			numProps = 0;
-			IXP_PROP_KEY key;
-			for (size_t i = 0; i < displayNames.size(); i++)
+			if (pIxpTable->handle_status[i] != IXP_SUCCESS)
 			{
-				char * name = const_cast<char*>(displayNames[i].c_str());
-				if (IXP_SUCCESS == ixp_get_prop_key_by_name(name,
-						(unsigned int)displayNames[i].size(), &key))
-				{
-					ixp_init_prop(&props[numProps], key);
-					numProps++;
-				}
-
-				// Improperly named properties have already been handled
+				ixp_free_prop_table(pIxpTable);
+				throw wbem::exception::NvmExceptionLibError(NVM_ERR_UNKNOWN);
 			}
-			ixp_get_props(ctx, props, numProps);
 		}
-		// Process list of ixp-implemented properties, they are only shown
-		// in the "-a" case or if they're user specified
-		else if (m_displayOptions.isAll())
+	}
+	////////////////////////////
+
+	for (size_t i = 0; i < m_devices.size(); i++)
+	{
+		framework::PropertyListResult value;
+		for (size_t j = 0; j < m_props.size(); j++)
 		{
-			// Print out all ixp properties
-			numProps = LEN_SHOW_DIMM_IXP_PROPS;
-			for (unsigned int j = 0; j < LEN_SHOW_DIMM_IXP_PROPS; j++)
-			{
-				ixp_init_prop(&props[j], show_dimm_ixp_props[j]);
-			}
-			if (IXP_SUCCESS != ixp_get_props(ctx, props, LEN_SHOW_DIMM_IXP_PROPS))
+			framework::IPropertyDefinition<core::device::Device> &p = m_props[j];
+			if (isPropertyDisplayed(p))
 			{
-				throw wbem::exception::NvmExceptionLibError(NVM_ERR_UNKNOWN);
+				value.insert(p.getName(), p.getValue(m_devices[i]));
 			}
 		}
 
-		// Now do printf conversion
-		for (unsigned int j = 0; j < numProps; j++)
+		// Now do printf conversion of this DIMM's ixp properties
+		for (unsigned int j = 0; pIxpTable && j < pIxpTable->num_props; j++)
 		{
+			struct ixp_prop_info &prop = pIxpTable->props[j * pIxpTable->num_handles + i];
+			if (prop.prop_value == NULL)
+			{
+				continue;
+			}
+
 			// 16-byte counts
-			if (props[j].prop_key < FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS &&
-				props[j].prop_key >= FIS_MEMORY_INFO_PAGE_0_MEDIA_READS)
+			if (prop.prop_key < FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS &&
+				prop.prop_key >= FIS_MEMORY_INFO_PAGE_0_MEDIA_READS)
 			{
 				// Name, string version of value
-				value.insert(std::string(props[j].prop_name), ShowDeviceCommand::convertCounts((unsigned long long *)(props[j].prop_value)));
+				value.insert(std::string(prop.prop_name), ShowDeviceCommand::convertCounts((unsigned long long *)(prop.prop_value)));
 			}
 			// Boolean
-			else if (props[j].prop_key < FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_INJECTIONS_COUNTER &&
-					props[j].prop_key >= FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_ERROR_INJECTION_ENABLED)
+			else if (prop.prop_key < FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_INJECTIONS_COUNTER &&
+					prop.prop_key >= FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_ERROR_INJECTION_ENABLED)
 			{
-				value.insert(std::string(props[j].prop_name), *((char *)props[j].prop_value) ? "1" : "0");
+				value.insert(std::string(prop.prop_name), *((char *)prop.prop_value) ? "1" : "0");
 			}
 			// Integer
 			else
 			{
-				value.insert(std::string(props[j].prop_name), std::to_string(*((int *)(props[j].prop_value))));
+				value.insert(std::string(prop.prop_name), std::to_string(*((int *)(prop.prop_value))));
 			}
 		}
 
-		ixp_free_props(props, numProps);
-		free(props);
-		////////////////////////////
-
 		pList->insert(ROOT, value);
 	}
 
+	if (pIxpTable)
+	{
+		ixp_free_prop_table(pIxpTable);
+	}
+
 	m_pResult->setOutputType(
 		m_displayOptions.isDefault() ?
 		framework::ResultBase::OUTPUT_TEXTTABLE :
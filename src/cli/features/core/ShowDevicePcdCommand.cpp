@@ -124,13 +124,13 @@ void ShowDevicePcdCommand::createResults()
 	for (size_t i = 0; i < m_devices.size(); i++)
 	{
 		std::string dimmId = ShowCommandUtilities::getDimmId(m_devices[i]);
-		std::string resultPerDimm = "\nDimmID: " + dimmId + '\n';
-		rc = fwCmds.fwGetPayload_PlatformConfigData(m_devices[i].getDeviceHandle(), 1, 1, 0, resultPerDimm);
-		if (rc == NVM_SUCCESS)
-		{
-			result = resultPerDimm;
-		}
-		else
+		// The payload is appended to result, which keeps its capacity
+		// from one DIMM to the next
+		result.assign("\nDimmID: ");
+		result += dimmId;
+		result += '\n';
+		rc = fwCmds.fwGetPayload_PlatformConfigData(m_devices[i].getDeviceHandle(), 1, 1, 0, result);
+		if (rc != NVM_SUCCESS)
 		{
 			NVM_ERROR_DESCRIPTION errStr;
 			nvm_get_error(rc, errStr, NVM_ERROR_LEN);
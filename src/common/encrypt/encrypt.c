@@ -33,6 +33,8 @@
 #include <openssl/pem.h>
 #include <openssl/bio.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <zlib.h>
 #include <string.h>
 #include <assert.h>
@@ -63,42 +65,37 @@
 
 #define	PUBLIC_KEY_FILE	"public.rev0.pem"
 
+// the most deflate can look back, carried from one compressed block to the next
+#define	COMPRESSION_DICT_BYTES	(32 * 1024)
+
 /*
- * Iterative, core guts of compression contained herein
+ * Iterative, core guts of compression contained herein. 'p_output' is a
+ * COMPRESSION_PROCESS_BYTES buffer owned by the caller and reused across calls.
  */
-int raw_compression(int ofd, z_stream *zvar)
+int raw_compression(int ofd, z_stream *zvar, COMMON_UINT8 *p_output)
 {
 	int rc = COMMON_SUCCESS;
 
-	COMMON_UINT8 *p_output = calloc(1, COMPRESSION_PROCESS_BYTES);
-	if(!p_output)
-	{
-		rc = COMMON_ERR_NOMEMORY;
-	}
-	else
+	ssize_t num_done;
+	int flush = (zvar->avail_in == 0) ? Z_FINISH : Z_NO_FLUSH;
+	do
 	{
-		ssize_t num_done;
-		int flush = (zvar->avail_in == 0) ? Z_FINISH : Z_NO_FLUSH;
-		do
+		zvar->avail_out = COMPRESSION_PROCESS_BYTES;
+		zvar->next_out = p_output;
+		if (deflate(zvar, flush) == Z_STREAM_ERROR)
 		{
-			zvar->avail_out = COMPRESSION_PROCESS_BYTES;
-			zvar->next_out = p_output;
-			if (deflate(zvar, flush) == Z_STREAM_ERROR)
-			{
-				rc = COMMON_ERR_BADFILE;
-				break;
-			}
+			rc = COMMON_ERR_BADFILE;
+			break;
+		}
 
-			num_done = (COMPRESSION_PROCESS_BYTES - zvar->avail_out);
-			if (write(ofd, p_output, num_done) != num_done)
-			{
-				rc = COMMON_ERR_BADFILE;
-				break;
-			}
+		num_done = (COMPRESSION_PROCESS_BYTES - zvar->avail_out);
+		if (write(ofd, p_output, num_done) != num_done)
+		{
+			rc = COMMON_ERR_BADFILE;
+			break;
 		}
-		while (zvar->avail_out == 0);
-		free(p_output);
 	}
+	while (zvar->avail_out == 0);
 
 	return rc;
 }
@@ -156,7 +153,8 @@ int compress_file(const COMMON_PATH src_file, COMMON_PATH out_file)
 		else
 		{
 			COMMON_UINT8 *p_input = calloc(1, COMPRESSION_PROCESS_BYTES);
-			if(!p_input)
+			COMMON_UINT8 *p_output = calloc(1, COMPRESSION_PROCESS_BYTES);
+			if (!p_input || !p_output)
 			{
 				rc = COMMON_ERR_NOMEMORY;
 			}
@@ -170,23 +168,24 @@ int compress_file(const COMMON_PATH src_file, COMMON_PATH out_file)
 					assert(num_read <= (1ull << (sizeof (uInt) * 8)));
 					zvar.avail_in = (uInt)num_read;
 					zvar.next_in = p_input;
-					if ((rc = raw_compression(ofd, &zvar)) != COMMON_SUCCESS)
+					if ((rc = raw_compression(ofd, &zvar, p_output)) != COMMON_SUCCESS)
 					{
 						break;
 					}
 				}
-				free(p_input);
-			}
 
-			// One more time to finalize and flush to output file
-			if (rc == COMMON_SUCCESS)
-			{
-				rc = raw_compression(ofd, &zvar);
-				if (zvar.avail_in != 0)
+				// One more time to finalize and flush to output file
+				if (rc == COMMON_SUCCESS)
 				{
-					rc = COMMON_ERR_FAILED;
+					rc = raw_compression(ofd, &zvar, p_output);
+					if (zvar.avail_in != 0)
+					{
+						rc = COMMON_ERR_FAILED;
+					}
 				}
 			}
+			free(p_input);
+			free(p_output);
 		}
 	}
 
@@ -343,107 +342,711 @@ int get_key_file_path(COMMON_PATH key_file)
 	return file_exists(key_file, COMMON_PATH_LEN) ? COMMON_SUCCESS : COMMON_ERR_BADFILE;
 }
 /*
- * Encrypt 'src_file'(INPUT) using an RSA public key, adds a CRYPTO_FILE_EXT file extension
+ * A file being written in the hybrid encrypted format
  */
-int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH out_file)
+struct crypto_stream
+{
+	int efd;
+	EVP_CIPHER_CTX *ctx;
+	COMMON_UINT8 *output; // CRYPTO_PROCESS_BYTES + EVP_MAX_BLOCK_LENGTH, reused for every write
+};
+
+/*
+ * Start encrypting into 'efd' with a random AES-256-GCM key, writing the key
+ * wrapped with 'rsa' in the header
+ */
+int crypto_stream_begin(RSA *rsa, int efd, struct crypto_stream *p_stream)
+{
+	int rc = NVM_SUCCESS;
+	COMMON_UINT8 key[CRYPTO_KEY_LEN];
+	const int max_header_len = CRYPTO_FILE_MAGIC_LEN + 3 + RSA_size(rsa) + CRYPTO_IV_LEN;
+	COMMON_UINT8 *header = malloc(max_header_len);
+
+	memset(p_stream, 0, sizeof (struct crypto_stream));
+	p_stream->efd = efd;
+	p_stream->ctx = EVP_CIPHER_CTX_new();
+	p_stream->output = malloc(CRYPTO_PROCESS_BYTES + EVP_MAX_BLOCK_LENGTH);
+	if ((NULL == header) || (NULL == p_stream->ctx) || (NULL == p_stream->output))
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		COMMON_UINT8 *p_next = header;
+		memmove(p_next, CRYPTO_FILE_MAGIC, CRYPTO_FILE_MAGIC_LEN);
+		p_next += CRYPTO_FILE_MAGIC_LEN;
+		*p_next++ = CRYPTO_FORMAT_VERSION;
+		COMMON_UINT8 *wrapped_key_len = p_next;
+		p_next += 2;
+
+		// only the AES key needs the RSA key, one public operation per file
+		int cnvt_bytes = -1;
+		if ((RAND_bytes(key, CRYPTO_KEY_LEN) != 1) ||
+			((cnvt_bytes = RSA_public_encrypt(CRYPTO_KEY_LEN, key, p_next, rsa,
+				RSA_PKCS1_OAEP_PADDING)) == -1))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else
+		{
+			wrapped_key_len[0] = (COMMON_UINT8)(cnvt_bytes >> 8);
+			wrapped_key_len[1] = (COMMON_UINT8)(cnvt_bytes & 0xFF);
+			p_next += cnvt_bytes;
+			COMMON_UINT8 *iv = p_next;
+			p_next += CRYPTO_IV_LEN;
+			const int header_len = (int)(p_next - header);
+
+			int out_len = 0;
+			if ((RAND_bytes(iv, CRYPTO_IV_LEN) != 1) ||
+				(EVP_EncryptInit_ex(p_stream->ctx, EVP_aes_256_gcm(), NULL, NULL, NULL) != 1) ||
+				(EVP_CIPHER_CTX_ctrl(p_stream->ctx, EVP_CTRL_GCM_SET_IVLEN,
+					CRYPTO_IV_LEN, NULL) != 1) ||
+				(EVP_EncryptInit_ex(p_stream->ctx, NULL, NULL, key, iv) != 1) ||
+				(EVP_EncryptUpdate(p_stream->ctx, NULL, &out_len, header, header_len) != 1))
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+			else if (write(efd, header, header_len) != header_len)
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+		}
+	}
+
+	OPENSSL_cleanse(key, CRYPTO_KEY_LEN);
+	if (header)
+	{
+		free(header);
+	}
+
+	return rc;
+}
+
+/*
+ * Encrypt 'len' bytes of 'data' onto the end of the file
+ */
+int crypto_stream_write(struct crypto_stream *p_stream, const COMMON_UINT8 *data, size_t len)
+{
+	int rc = NVM_SUCCESS;
+	while (len > 0)
+	{
+		int in_len = len < CRYPTO_PROCESS_BYTES ? (int)len : CRYPTO_PROCESS_BYTES;
+		int out_len = 0;
+		if (EVP_EncryptUpdate(p_stream->ctx, p_stream->output, &out_len, data, in_len) != 1)
+		{
+			rc = NVM_ERR_UNKNOWN;
+			break;
+		}
+		else if (write(p_stream->efd, p_stream->output, out_len) != out_len)
+		{
+			rc = NVM_ERR_UNKNOWN;
+			break;
+		}
+		data += in_len;
+		len -= in_len;
+	}
+	return rc;
+}
+
+/*
+ * Finish the file by writing the GCM tag
+ */
+int crypto_stream_end(struct crypto_stream *p_stream)
+{
+	int rc = NVM_SUCCESS;
+
+	// GCM doesn't pad, the final call only produces the tag
+	int out_len = 0;
+	COMMON_UINT8 tag[CRYPTO_TAG_LEN];
+	if ((EVP_EncryptFinal_ex(p_stream->ctx, p_stream->output, &out_len) != 1) ||
+		(write(p_stream->efd, p_stream->output, out_len) != out_len) ||
+		(EVP_CIPHER_CTX_ctrl(p_stream->ctx, EVP_CTRL_GCM_GET_TAG, CRYPTO_TAG_LEN, tag) != 1) ||
+		(write(p_stream->efd, tag, CRYPTO_TAG_LEN) != CRYPTO_TAG_LEN))
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	return rc;
+}
+
+void crypto_stream_free(struct crypto_stream *p_stream)
+{
+	if (p_stream->ctx)
+	{
+		EVP_CIPHER_CTX_free(p_stream->ctx);
+		p_stream->ctx = NULL;
+	}
+	if (p_stream->output)
+	{
+		free(p_stream->output);
+		p_stream->output = NULL;
+	}
+}
+
+/*
+ * Encrypt the rest of 'sfd' into 'efd' with a random AES-256-GCM key,
+ * writing the key wrapped with 'rsa' in the header
+ */
+int aes_gcm_encrypt_file(RSA *rsa, int sfd, int efd)
+{
+	struct crypto_stream stream;
+	COMMON_UINT8 *input = malloc(CRYPTO_PROCESS_BYTES);
+	int rc = crypto_stream_begin(rsa, efd, &stream);
+	if ((rc == NVM_SUCCESS) && (NULL == input))
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else if (rc == NVM_SUCCESS)
+	{
+		ssize_t num_read;
+		while ((num_read = read(sfd, input, CRYPTO_PROCESS_BYTES)) > 0)
+		{
+			if ((rc = crypto_stream_write(&stream, input, num_read)) != NVM_SUCCESS)
+			{
+				break;
+			}
+		}
+		if (num_read < 0)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+
+		if (rc == NVM_SUCCESS)
+		{
+			rc = crypto_stream_end(&stream);
+		}
+	}
+
+	crypto_stream_free(&stream);
+	if (input)
+	{
+		free(input);
+	}
+
+	return rc;
+}
+
+/*
+ * Read the public RSA key used to encrypt support data
+ */
+int read_public_key(RSA **pp_rsa)
+{
+	COMMON_PATH key_file;
+	int rc = get_key_file_path(key_file);
+	if (rc == COMMON_SUCCESS)
+	{
+		BIO *bio = BIO_new_file(key_file, "r");
+
+		// Convert the memory copy PEM format into an openssl data structure
+		if ((bio == NULL) || (PEM_read_bio_RSA_PUBKEY(bio, pp_rsa, NULL, NULL) == NULL))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		if (bio != NULL)
+		{
+			BIO_free(bio);
+		}
+	}
+	return rc;
+}
+
+/*
+ * One block of the input compressed on its own, primed with the end of the
+ * block before it so the ratio stays close to compressing the file in one go
+ */
+struct compress_block
+{
+	z_stream zvar;
+	COMMON_UINT8 *input; // COMPRESSION_BLOCK_BYTES
+	size_t input_len;
+	COMMON_UINT8 *output;
+	size_t output_size;
+	size_t output_len;
+	const COMMON_UINT8 *dict;
+	size_t dict_len;
+	int last;
+	int rc;
+};
+
+/*
+ * Deflate a block of the batch 'arg' into raw deflate data that can be
+ * concatenated with the blocks around it. Every block but the last ends on
+ * a byte boundary.
+ */
+static void compress_block(void *arg, COMMON_UINT32 index)
+{
+	struct compress_block *p_block = &((struct compress_block *)arg)[index];
+	p_block->rc = COMMON_SUCCESS;
+	if ((deflateReset(&p_block->zvar) != Z_OK) ||
+		((p_block->dict_len > 0) &&
+		(deflateSetDictionary(&p_block->zvar, p_block->dict, (uInt)p_block->dict_len) != Z_OK)))
+	{
+		p_block->rc = COMMON_ERR_UNKNOWN;
+	}
+	else
+	{
+		p_block->zvar.next_in = p_block->input;
+		p_block->zvar.avail_in = (uInt)p_block->input_len;
+		p_block->zvar.next_out = p_block->output;
+		p_block->zvar.avail_out = (uInt)p_block->output_size;
+		int zrc = deflate(&p_block->zvar, p_block->last ? Z_FINISH : Z_SYNC_FLUSH);
+		// the output buffer is sized so a block always fits
+		if ((zrc == Z_STREAM_ERROR) || (p_block->zvar.avail_in != 0) ||
+			(p_block->last && (zrc != Z_STREAM_END)))
+		{
+			p_block->rc = COMMON_ERR_FAILED;
+		}
+		p_block->output_len = p_block->output_size - p_block->zvar.avail_out;
+	}
+}
+
+/*
+ * Compress the rest of 'sfd' into a zlib stream and pass it to 'p_stream'.
+ * Up to 'threads' blocks are compressed at a time, all buffers are
+ * allocated once up front.
+ */
+int compress_to_stream(int sfd, const int level, int threads,
+		struct crypto_stream *p_stream)
+{
+	int rc = COMMON_SUCCESS;
+	struct stat statbuf;
+	struct compress_block blocks[COMPRESSION_MAX_THREADS];
+	memset(blocks, 0, sizeof (blocks));
+
+	if (fstat(sfd, &statbuf) != 0)
+	{
+		rc = COMMON_ERR_BADFILE;
+	}
+	else
+	{
+		// no point in more threads than blocks
+		off_t block_count = (statbuf.st_size + COMPRESSION_BLOCK_BYTES - 1) /
+				COMPRESSION_BLOCK_BYTES;
+		if (threads > COMPRESSION_MAX_THREADS)
+		{
+			threads = COMPRESSION_MAX_THREADS;
+		}
+		if (threads > block_count)
+		{
+			threads = (int)block_count;
+		}
+		if (threads < 1)
+		{
+			threads = 1;
+		}
+
+		for (int i = 0; (i < threads) && (rc == COMMON_SUCCESS); i++)
+		{
+			// raw deflate, the zlib header and trailer are written here
+			if (deflateInit2(&blocks[i].zvar, level, Z_DEFLATED, -MAX_WBITS,
+				8, Z_DEFAULT_STRATEGY) != Z_OK)
+			{
+				rc = COMMON_ERR_UNKNOWN;
+				break;
+			}
+			// room for the sync flush marker and final block on top of the bound
+			blocks[i].output_size = deflateBound(&blocks[i].zvar, COMPRESSION_BLOCK_BYTES) + 16;
+			blocks[i].input = malloc(COMPRESSION_BLOCK_BYTES);
+			blocks[i].output = malloc(blocks[i].output_size);
+			if (!blocks[i].input || !blocks[i].output)
+			{
+				rc = COMMON_ERR_NOMEMORY;
+			}
+		}
+
+		COMMON_UINT8 *dict = malloc(COMPRESSION_DICT_BYTES);
+		if (!dict)
+		{
+			rc = COMMON_ERR_NOMEMORY;
+		}
+		else if (rc == COMMON_SUCCESS)
+		{
+			// zlib header for 32K window, with the level hint zlib itself would use
+			int level_flags = 2;
+			if ((level == 0) || (level == 1))
+			{
+				level_flags = 0;
+			}
+			else if ((level > 1) && (level < 6))
+			{
+				level_flags = 1;
+			}
+			else if (level > 6)
+			{
+				level_flags = 3;
+			}
+			COMMON_UINT8 header[2];
+			header[0] = 0x78;
+			header[1] = (COMMON_UINT8)(level_flags << 6);
+			header[1] += 31 - (((header[0] << 8) + header[1]) % 31);
+			rc = crypto_stream_write(p_stream, header, sizeof (header));
+
+			uLong adler = adler32(0L, Z_NULL, 0);
+			size_t dict_len = 0;
+			off_t offset = 0;
+			int last = 0;
+			while ((rc == COMMON_SUCCESS) && !last)
+			{
+				// read the next batch of blocks
+				int count = 0;
+				for (; (count < threads) && !last; count++)
+				{
+					struct compress_block *p_block = &blocks[count];
+					ssize_t num_read = read(sfd, p_block->input, COMPRESSION_BLOCK_BYTES);
+					if (num_read < 0)
+					{
+						rc = COMMON_ERR_BADFILE;
+						break;
+					}
+					p_block->input_len = (size_t)num_read;
+					offset += num_read;
+					last = (num_read == 0) || (offset >= statbuf.st_size);
+					p_block->last = last;
+					adler = adler32(adler, p_block->input, (uInt)p_block->input_len);
+
+					if (count == 0)
+					{
+						p_block->dict = dict;
+						p_block->dict_len = dict_len;
+					}
+					else
+					{
+						struct compress_block *p_prev = &blocks[count - 1];
+						p_block->dict_len = p_prev->input_len < COMPRESSION_DICT_BYTES ?
+								p_prev->input_len : COMPRESSION_DICT_BYTES;
+						p_block->dict = p_prev->input + p_prev->input_len - p_block->dict_len;
+					}
+				}
+
+				if (rc == COMMON_SUCCESS)
+				{
+					run_parallel(count, threads, compress_block, blocks);
+
+					// the output has to stay in order
+					for (int i = 0; (i < count) && (rc == COMMON_SUCCESS); i++)
+					{
+						if ((rc = blocks[i].rc) == COMMON_SUCCESS)
+						{
+							rc = crypto_stream_write(p_stream,
+									blocks[i].output, blocks[i].output_len);
+						}
+					}
+
+					// the next batch is primed with the end of this one
+					struct compress_block *p_prev = &blocks[count - 1];
+					dict_len = p_prev->input_len < COMPRESSION_DICT_BYTES ?
+							p_prev->input_len : COMPRESSION_DICT_BYTES;
+					memmove(dict, p_prev->input + p_prev->input_len - dict_len, dict_len);
+				}
+			}
+
+			if (rc == COMMON_SUCCESS)
+			{
+				COMMON_UINT8 trailer[4];
+				trailer[0] = (COMMON_UINT8)(adler >> 24);
+				trailer[1] = (COMMON_UINT8)(adler >> 16);
+				trailer[2] = (COMMON_UINT8)(adler >> 8);
+				trailer[3] = (COMMON_UINT8)adler;
+				rc = crypto_stream_write(p_stream, trailer, sizeof (trailer));
+			}
+		}
+
+		if (dict)
+		{
+			free(dict);
+		}
+	}
+
+	for (int i = 0; i < COMPRESSION_MAX_THREADS; i++)
+	{
+		if (blocks[i].output_size)
+		{
+			deflateEnd(&blocks[i].zvar);
+		}
+		if (blocks[i].input)
+		{
+			free(blocks[i].input);
+		}
+		if (blocks[i].output)
+		{
+			free(blocks[i].output);
+		}
+	}
+
+	return rc;
+}
+
+/*
+ * Compress and encrypt 'src_file'(INPUT) in a single pass, adds a COMPRESS_FILE_EXT
+ * and a CRYPTO_FILE_EXT file extension
+ */
+int compress_encrypt_file(const COMMON_PATH src_file, COMMON_PATH out_file,
+		const int level, const int threads)
 {
 	int sfd = -1;		// src_file
-	int efd = -1;		// encrypted file
+	int efd = -1;		// compressed and encrypted file
 	int rc = NVM_SUCCESS;
 	RSA *rsa = NULL;
-	BIO *bio = NULL;
 	char temp_file[COMMON_PATH_LEN];
 #ifdef __WINDOWS__
 	int OS_flags = O_BINARY;
 #else
 	int OS_flags = 0;
 #endif
-	COMMON_UINT8 *input = NULL;
-	COMMON_UINT8 *output = NULL;
 
 	// Create a new file, verify the resulting name is within our max allowed length
 	s_strncpy(temp_file, COMMON_PATH_LEN, src_file, COMMON_PATH_LEN);
+	s_strncat(temp_file, COMMON_PATH_LEN, COMPRESS_FILE_EXT, sizeof (COMPRESS_FILE_EXT));
 	s_strncat(temp_file, COMMON_PATH_LEN, CRYPTO_FILE_EXT, sizeof (CRYPTO_FILE_EXT));
-	if (s_strnlen(temp_file, COMMON_PATH_LEN) > COMMON_PATH_LEN)
+	if ((level < Z_DEFAULT_COMPRESSION) || (level > Z_BEST_COMPRESSION))
 	{
-		printf("\n Line 352 src_file: %s temp_file: %s\n", src_file, temp_file);
-        rc = NVM_ERR_UNKNOWN;
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (s_strnlen(temp_file, COMMON_PATH_LEN) > COMMON_PATH_LEN)
+	{
+		rc = NVM_ERR_UNKNOWN;
 	}
 	else
 	{
 		s_strncpy(out_file, COMMON_PATH_LEN, temp_file, COMMON_PATH_LEN);
 
-		// Read the public RSA key into a openssl data structure
-		COMMON_PATH key_file;
-		if ((rc = get_key_file_path(key_file)) == COMMON_SUCCESS)
+		struct stat statbuf;
+		if (stat(out_file, &statbuf) != -1)
 		{
-			bio = BIO_new_file(key_file, "r");
+			unlink(out_file);
+		}
 
-			struct stat statbuf;
-			if (stat(out_file, &statbuf) != -1)
+		// Read the public RSA key into a openssl data structure
+		if ((rc = read_public_key(&rsa)) != COMMON_SUCCESS)
+		{
+			// no key, nothing to encrypt with
+		}
+		else if ((sfd = open(src_file, O_RDWR | OS_flags, 0)) == -1)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else if ((efd = open(out_file, O_RDWR | O_TRUNC | O_CREAT | O_EXCL | OS_flags,
+				GENERIC_NEW_FILE_PERMISSION)) == -1)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else
+		{
+			// the compressed data only ever exists in memory, one batch at a time
+			struct crypto_stream stream;
+			if ((rc = crypto_stream_begin(rsa, efd, &stream)) == NVM_SUCCESS)
 			{
-				unlink(out_file);
+				if ((rc = compress_to_stream(sfd, level, threads, &stream)) != COMMON_SUCCESS)
+				{
+					rc = (rc == COMMON_ERR_NOMEMORY) ? NVM_ERR_NOMEMORY : NVM_ERR_BADFILE;
+				}
+				else
+				{
+					rc = crypto_stream_end(&stream);
+				}
 			}
+			crypto_stream_free(&stream);
+		}
+	}
+
+	if (rsa != NULL)
+	{
+		RSA_free(rsa);
+	}
+	if (efd != -1)
+	{
+		close(efd);
+
+		// Delete the corrupted output if we detect a failure
+		if (rc != NVM_SUCCESS)
+		{
+			delete_file(out_file, COMMON_PATH_LEN);
+		}
+	}
+	if (sfd != -1)
+	{
+		// src file is being replaced with a compressed and encrypted version
+		close(sfd);
+		sfd = -1;
+		delete_file(src_file, COMMON_PATH_LEN);
+	}
+
+	return rc;
+}
+
+/*
+ * Decrypt a file in the hybrid format from 'efd', positioned just past the magic,
+ * into 'dfd'
+ */
+int aes_gcm_decrypt_file(RSA *rsa, int efd, int dfd)
+{
+	int retval = NVM_SUCCESS;
+	COMMON_UINT8 key[CRYPTO_KEY_LEN];
+	const int max_header_len = CRYPTO_FILE_MAGIC_LEN + 3 + RSA_size(rsa) + CRYPTO_IV_LEN;
+	COMMON_UINT8 *header = malloc(max_header_len);
+	COMMON_UINT8 *input = malloc(CRYPTO_PROCESS_BYTES);
+	COMMON_UINT8 *output = malloc(CRYPTO_PROCESS_BYTES + EVP_MAX_BLOCK_LENGTH);
+	EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+	struct stat statbuf;
+	if ((NULL == header) || (NULL == input) || (NULL == output) || (NULL == ctx))
+	{
+		retval = NVM_ERR_NOMEMORY;
+	}
+	else if (fstat(efd, &statbuf) != 0)
+	{
+		retval = NVM_ERR_BADFILE;
+	}
+	else
+	{
+		// rebuild the header as it is read, it is authenticated with the data
+		COMMON_UINT8 *p_next = header;
+		memmove(p_next, CRYPTO_FILE_MAGIC, CRYPTO_FILE_MAGIC_LEN);
+		p_next += CRYPTO_FILE_MAGIC_LEN;
+		int wrapped_key_len = 0;
+		if (read(efd, p_next, 3) != 3)
+		{
+			retval = NVM_ERR_BADFILE;
+		}
+		else if (p_next[0] != CRYPTO_FORMAT_VERSION)
+		{
+			// Written by a newer version of the software
+			retval = NVM_ERR_NOTSUPPORTED;
+		}
+		else if ((wrapped_key_len = (p_next[1] << 8) | p_next[2]) > RSA_size(rsa))
+		{
+			retval = NVM_ERR_BADFILE;
+		}
+		else
+		{
+			p_next += 3;
+			COMMON_UINT8 *wrapped_key = p_next;
+			p_next += wrapped_key_len;
+			COMMON_UINT8 *iv = p_next;
+			p_next += CRYPTO_IV_LEN;
+			const int header_len = (int)(p_next - header);
+			const ssize_t data_len = (ssize_t)statbuf.st_size - header_len - CRYPTO_TAG_LEN;
 
-			// Convert the memory copy PEM format into an openssl data structure
-			if (PEM_read_bio_RSA_PUBKEY(bio, &rsa, NULL, NULL) == NULL)
+			int out_len = 0;
+			if ((data_len < 0) ||
+				(read(efd, wrapped_key, wrapped_key_len) != wrapped_key_len) ||
+				(read(efd, iv, CRYPTO_IV_LEN) != CRYPTO_IV_LEN))
 			{
-				rc = NVM_ERR_UNKNOWN;
+				retval = NVM_ERR_BADFILE;
 			}
-			else if ((sfd = open(src_file, O_RDWR | OS_flags, 0)) == -1)
+			else if (RSA_private_decrypt(wrapped_key_len, wrapped_key, key, rsa,
+				RSA_PKCS1_OAEP_PADDING) != CRYPTO_KEY_LEN)
 			{
-				printf("\n Line 379 src_file: %s\n", src_file);
-				rc = NVM_ERR_BADFILE;
+				// Unable to unwrap the file key
+				retval = NVM_ERR_UNKNOWN;
 			}
-			else if ((efd = open(out_file, O_RDWR | O_TRUNC | O_CREAT | O_EXCL | OS_flags,
-					GENERIC_NEW_FILE_PERMISSION)) == -1)
+			else if ((EVP_DecryptInit_ex(ctx, EVP_aes_256_gcm(), NULL, NULL, NULL) != 1) ||
+				(EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, CRYPTO_IV_LEN, NULL) != 1) ||
+				(EVP_DecryptInit_ex(ctx, NULL, NULL, key, iv) != 1) ||
+				(EVP_DecryptUpdate(ctx, NULL, &out_len, header, header_len) != 1))
 			{
-				printf("\n Line 384 out_file: %s\n", out_file);
-				rc = NVM_ERR_BADFILE;
+				retval = NVM_ERR_UNKNOWN;
 			}
 			else
 			{
-				// Encryption using an RSA key can't encrypt data larger than
-				// the key itself by definition. Thus the input file must be
-				// chunked up into small pieces and each block of file must be
-				// encrypted sequentially to get around this restriction. Further
-				// qualification comes from
-				// "http://www.openssl.org/docs/crypto/RSA_public_encrypt.html"
-				// where it indicates that the limit must be
-				// modified by RSA_PKCS1_OAEP_PADDING_OFFSET.
-				const int MAX_ENCRYPTION_LENGTH = (RSA_size(rsa) - RSA_PKCS1_OAEP_PADDING_OFFSET);
-				input = malloc(MAX_ENCRYPTION_LENGTH * sizeof(COMMON_UINT8));
-				output = malloc(RSA_size(rsa) * sizeof(COMMON_UINT8)); // openssl lib API requires larger output buf
-				if ((NULL == input) || (NULL == output))
+				ssize_t remaining = data_len;
+				while (remaining > 0)
 				{
-					rc = NVM_ERR_NOMEMORY;
+					ssize_t num_read = read(efd, input, remaining < CRYPTO_PROCESS_BYTES ?
+						remaining : CRYPTO_PROCESS_BYTES);
+					if (num_read <= 0)
+					{
+						retval = NVM_ERR_BADFILE;
+						break;
+					}
+					else if (EVP_DecryptUpdate(ctx, output, &out_len, input, (int)num_read) != 1)
+					{
+						retval = NVM_ERR_UNKNOWN;
+						break;
+					}
+					else if (write(dfd, output, out_len) != out_len)
+					{
+						// Unable to write decrypted SQL DB file
+						retval = NVM_ERR_UNKNOWN;
+						break;
+					}
+					remaining -= num_read;
 				}
-				else
+
+				// the file is only good if the tag matches
+				COMMON_UINT8 tag[CRYPTO_TAG_LEN];
+				if ((retval == NVM_SUCCESS) &&
+					((read(efd, tag, CRYPTO_TAG_LEN) != CRYPTO_TAG_LEN) ||
+					(EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, CRYPTO_TAG_LEN, tag) != 1) ||
+					(EVP_DecryptFinal_ex(ctx, output, &out_len) != 1) ||
+					(write(dfd, output, out_len) != out_len)))
 				{
-					ssize_t num_read;
-					int cnvt_bytes;
+					retval = NVM_ERR_UNKNOWN;
+				}
+			}
+		}
+	}
 
-					while ((num_read = read(sfd, input, MAX_ENCRYPTION_LENGTH)) != 0)
-					{
-						cnvt_bytes = RSA_public_encrypt(num_read, input, output, rsa,
-							RSA_PKCS1_OAEP_PADDING);
-						if (cnvt_bytes == -1)
-						{
-							char err_buf[120];
-							ERR_load_crypto_strings();
+	OPENSSL_cleanse(key, CRYPTO_KEY_LEN);
+	if (ctx)
+	{
+		EVP_CIPHER_CTX_free(ctx);
+	}
+	if (header)
+	{
+		free(header);
+	}
+	if (input)
+	{
+		free(input);
+	}
+	if (output)
+	{
+		free(output);
+	}
 
-							ERR_error_string_n(ERR_get_error(), err_buf, sizeof(err_buf));
-							rc = NVM_ERR_UNKNOWN;
-							break;
-						}
-						else if (write(efd, output, cnvt_bytes) != cnvt_bytes)
-						{
-							printf("\n Line 418 out_file: %s\n", out_file);
-							rc = NVM_ERR_UNKNOWN;
-							break;
-						}
-					}
-				}
+	return retval;
+}
+
+/*
+ * Decrypt a file in the older format, a series of RSA encrypted blocks, from 'efd' into 'dfd'
+ */
+int rsa_decrypt_blocks(RSA *rsa, int efd, int dfd)
+{
+	int retval = NVM_SUCCESS;
+
+	// Encryption using an RSA key can't encrypt data larger than the key itself by definition.
+	// Thus the input file must be chunked up into small pieces and each block of file must be
+	// encrypted sequentially to get around this restriction. Further qualification comes from
+	// "http://www.openssl.org/docs/crypto/RSA_public_encrypt.html" where it indicates that the
+	// limit must be modified by RSA_PKCS1_OAEP_PADDING_OFFSET.
+	const int MAX_ENCRYPTION_LENGTH = (RSA_size(rsa) - RSA_PKCS1_OAEP_PADDING_OFFSET);
+	const ssize_t output_size = MAX_ENCRYPTION_LENGTH * sizeof(COMMON_UINT8);
+	COMMON_UINT8 *output = malloc(output_size);
+	const ssize_t input_size = RSA_size(rsa) * sizeof(COMMON_UINT8);
+	COMMON_UINT8 *input = malloc(input_size);
+	if ((NULL == input) || (NULL == output))
+	{
+		retval = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		ssize_t num_read;
+		int cnvt_bytes;
+
+		while ((num_read = read(efd, input, input_size)) != 0)
+		{
+			cnvt_bytes = RSA_private_decrypt(num_read, input, output, rsa,
+				RSA_PKCS1_OAEP_PADDING);
+			if (cnvt_bytes == -1)
+			{
+				// Unable to decrypt SQL DB file
+				retval = NVM_ERR_UNKNOWN;
+				break;
+			}
+			else if (write(dfd, output, cnvt_bytes) != cnvt_bytes)
+			{
+				// Unable to write decrypted SQL DB file
+				retval = NVM_ERR_UNKNOWN;
+				break;
 			}
 		}
 	}
@@ -456,13 +1059,70 @@ int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH out_file)
 	{
 		free(output);
 	}
-	if (rsa != NULL)
+
+	return retval;
+}
+
+/*
+ * Encrypt 'src_file'(INPUT) using an RSA public key, adds a CRYPTO_FILE_EXT file extension
+ */
+int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH out_file)
+{
+	int sfd = -1;		// src_file
+	int efd = -1;		// encrypted file
+	int rc = NVM_SUCCESS;
+	RSA *rsa = NULL;
+	char temp_file[COMMON_PATH_LEN];
+#ifdef __WINDOWS__
+	int OS_flags = O_BINARY;
+#else
+	int OS_flags = 0;
+#endif
+
+	// Create a new file, verify the resulting name is within our max allowed length
+	s_strncpy(temp_file, COMMON_PATH_LEN, src_file, COMMON_PATH_LEN);
+	s_strncat(temp_file, COMMON_PATH_LEN, CRYPTO_FILE_EXT, sizeof (CRYPTO_FILE_EXT));
+	if (s_strnlen(temp_file, COMMON_PATH_LEN) > COMMON_PATH_LEN)
 	{
-		RSA_free(rsa);
+		printf("\n Line 352 src_file: %s temp_file: %s\n", src_file, temp_file);
+        rc = NVM_ERR_UNKNOWN;
 	}
-	if (bio != NULL)
+	else
 	{
-		BIO_free(bio);
+		s_strncpy(out_file, COMMON_PATH_LEN, temp_file, COMMON_PATH_LEN);
+
+		struct stat statbuf;
+		if (stat(out_file, &statbuf) != -1)
+		{
+			unlink(out_file);
+		}
+
+		// Read the public RSA key into a openssl data structure
+		if ((rc = read_public_key(&rsa)) == COMMON_SUCCESS)
+		{
+			if ((sfd = open(src_file, O_RDWR | OS_flags, 0)) == -1)
+			{
+				printf("\n Line 379 src_file: %s\n", src_file);
+				rc = NVM_ERR_BADFILE;
+			}
+			else if ((efd = open(out_file, O_RDWR | O_TRUNC | O_CREAT | O_EXCL | OS_flags,
+					GENERIC_NEW_FILE_PERMISSION)) == -1)
+			{
+				printf("\n Line 384 out_file: %s\n", out_file);
+				rc = NVM_ERR_BADFILE;
+			}
+			else
+			{
+				// the file is encrypted with a one-time AES key, and only that
+				// key is encrypted with the RSA key
+				rc = aes_gcm_encrypt_file(rsa, sfd, efd);
+			}
+		}
+	}
+
+	if (rsa != NULL)
+	{
+		RSA_free(rsa);
 	}
 	if (efd != -1)
 	{
@@ -501,8 +1161,6 @@ int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 #else
 	int OS_flags = 0;
 #endif
-	COMMON_UINT8 *input = NULL;
-	COMMON_UINT8 *output = NULL;
 
 	// Read the private RSA key into a openssl data structure
 	bio = BIO_new_file(rsaKeyFile, "r");
@@ -530,53 +1188,23 @@ int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 	}
 	else
 	{
-		// Encryption using an RSA key can't encrypt data larger than the key itself by definition.
-		// Thus the input file must be chunked up into small pieces and each block of file must be
-		// encrypted sequentially to get around this restriction. Further qualification comes from
-		// "http://www.openssl.org/docs/crypto/RSA_public_encrypt.html" where it indicates that the
-		// limit must be modified by RSA_PKCS1_OAEP_PADDING_OFFSET.
-		const int MAX_ENCRYPTION_LENGTH = (RSA_size(rsa) - RSA_PKCS1_OAEP_PADDING_OFFSET);
-		const ssize_t output_size = MAX_ENCRYPTION_LENGTH * sizeof(COMMON_UINT8);
-		output = malloc(output_size);
-		const ssize_t input_size = RSA_size(rsa) * sizeof(COMMON_UINT8);
-		input = malloc(input_size);
-		if ((NULL == input) || (NULL == output))
+		COMMON_UINT8 magic[CRYPTO_FILE_MAGIC_LEN];
+		if ((read(efd, magic, CRYPTO_FILE_MAGIC_LEN) == CRYPTO_FILE_MAGIC_LEN) &&
+			(memcmp(magic, CRYPTO_FILE_MAGIC, CRYPTO_FILE_MAGIC_LEN) == 0))
+		{
+			retval = aes_gcm_decrypt_file(rsa, efd, dfd);
+		}
+		// no magic, the file was written before the hybrid format
+		else if (lseek(efd, 0, SEEK_SET) != 0)
 		{
-			retval = NVM_ERR_NOMEMORY;
+			retval = NVM_ERR_BADFILE;
 		}
 		else
 		{
-			ssize_t num_read;
-			int cnvt_bytes;
-
-			while ((num_read = read(efd, input, input_size)) != 0)
-			{
-				cnvt_bytes = RSA_private_decrypt(num_read, input, output, rsa,
-					RSA_PKCS1_OAEP_PADDING);
-				if (cnvt_bytes == -1)
-				{
-					// Unable to decrypt SQL DB file
-					retval = NVM_ERR_UNKNOWN;
-					break;
-				}
-				else if (write(dfd, output, cnvt_bytes) != cnvt_bytes)
-				{
-					// Unable to write decrypted SQL DB file
-					retval = NVM_ERR_UNKNOWN;
-					break;
-				}
-			}
+			retval = rsa_decrypt_blocks(rsa, efd, dfd);
 		}
 	}
 
-	if (input)
-	{
-		free(input);
-	}
-	if (output)
-	{
-		free(output);
-	}
 	if (rsa != NULL)
 	{
 		RSA_free(rsa);
@@ -592,6 +1220,12 @@ int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 	if (dfd != -1)
 	{
 		close(dfd);
+
+		// Don't leave unauthenticated or partial output behind
+		if (retval != NVM_SUCCESS)
+		{
+			delete_file(decryptedFile, COMMON_PATH_LEN);
+		}
 	}
 
 	return retval;
@@ -57,6 +57,16 @@ extern "C"
  */
 #define	COMPRESSION_PROCESS_BYTES			(128 * 1024)
 
+/*!
+ * 1MB; the unit of work when compressing with several threads
+ */
+#define	COMPRESSION_BLOCK_BYTES				(1024 * 1024)
+
+/*!
+ * The most threads used to compress a file
+ */
+#define	COMPRESSION_MAX_THREADS				4
+
 /*!
  * Good average for speed and compression factor
  */
@@ -85,6 +95,35 @@ extern "C"
  */
 #define	RSA_PKCS1_OAEP_PADDING_OFFSET		42
 
+/*!
+ * Identifies an encrypted file in the hybrid format. Files without it are a series
+ * of RSA encrypted blocks, as written before the hybrid format was introduced.
+ * @remarks
+ * 		An encrypted file in the hybrid format is laid out as:
+ * 		magic | version (1 byte) | wrapped key length (2 bytes, big endian) |
+ * 		RSA-OAEP wrapped AES key | GCM IV | AES-256-GCM ciphertext | GCM tag
+ * 		Everything before the ciphertext is authenticated along with it.
+ */
+#define	CRYPTO_FILE_MAGIC					"NVMCRYPT"
+#define	CRYPTO_FILE_MAGIC_LEN				8
+
+/*!
+ * The version of the hybrid format written by rsa_encrypt
+ */
+#define	CRYPTO_FORMAT_VERSION				1
+
+/*!
+ * AES-256 key, GCM IV and GCM tag sizes in bytes
+ */
+#define	CRYPTO_KEY_LEN						32
+#define	CRYPTO_IV_LEN						12
+#define	CRYPTO_TAG_LEN						16
+
+/*!
+ * 1MB; the amount of the file encrypted or decrypted at a time
+ */
+#define	CRYPTO_PROCESS_BYTES				(1024 * 1024)
+
 #ifdef __WINDOWS__
 /*!
  * The set of file permissions allowed for newly created files
@@ -132,6 +171,9 @@ NVM_COMMON_API extern int decompress_file(const COMMON_PATH srcFile, COMMON_PATH
 
 /*!
  * Generate an encrypted file from the contents of an input file, using an RSA public key.
+ * @remarks
+ * 		The file is encrypted with a random AES-256-GCM key, and only that key is
+ * 		encrypted with the RSA public key.
  * @param[in] src_file
  * The input filepath
  * @param[in] out_file
@@ -145,7 +187,32 @@ NVM_COMMON_API extern int decompress_file(const COMMON_PATH srcFile, COMMON_PATH
 NVM_COMMON_API extern int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH out_file);
 
 /*!
- * Decrypt an encrypted file
+ * Generate a compressed and encrypted file from the contents of an input file in a single
+ * pass, without writing the compressed data to disk.
+ * @remarks
+ * 		Decrypting the output with rsa_decrypt gives the same kind of file as compress_file.
+ * 		The input is compressed in blocks of COMPRESSION_BLOCK_BYTES, up to @c threads
+ * 		blocks at a time. Each block is primed with the end of the one before it.
+ * @param[in] src_file
+ * 		The input filepath, deleted once it has been read
+ * @param[out] out_file
+ * 		The (compressed and encrypted) output filepath
+ * @param[in] level
+ * 		The zlib compression level, 0-9, or -1 for the zlib default
+ * @param[in] threads
+ * 		The number of threads to compress with, at most COMPRESSION_MAX_THREADS
+ * @return
+ * 		@c NVM_SUCCESS @n
+ * 		@c NVM_ERR_INVALIDPARAMETER @n
+ * 		@c NVM_ERR_BADFILE @n
+ * 		@c NVM_ERR_UNKNOWN @n
+ * 		@c NVM_ERR_NOMEMORY
+ */
+NVM_COMMON_API extern int compress_encrypt_file(const COMMON_PATH src_file, COMMON_PATH out_file,
+		const int level, const int threads);
+
+/*!
+ * Decrypt an encrypted file, in either the hybrid format or the older RSA block format
  * @param[in] rsaKeyFile
  * The filepath of a RSA private key file used to decrypt @c encryptedFile
  * @param[in] encryptedFile
@@ -153,7 +220,7 @@ NVM_COMMON_API extern int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH ou
  * @param[in] decryptedFile
  * The (decrypted) output filepath
  * @return
- * 0 if success, NVM_ERR_XXX if failed
+ * 0 if success, NVM_ERR_XXX if failed. The decrypted file is removed on failure.
  */
 NVM_COMMON_API extern int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 		const COMMON_PATH decryptedFile);
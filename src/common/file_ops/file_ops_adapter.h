@@ -93,6 +93,26 @@ NVM_COMMON_API extern int create_dir(const COMMON_PATH path, const COMMON_SIZE p
 NVM_COMMON_API extern int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 		const COMMON_PATH destination, const COMMON_SIZE destination_len);
 
+/*!
+ * Copy a file, optionally flushing the copy to storage before returning
+ * @param[in] source
+ * 		The full path of the source file to be copied
+ * @param[in] source_len
+ * 		The length of the source buffer
+ * @param[in] destination
+ * 		The full path that the source file should be copied to.
+ * @param[in] destination_len
+ * 		The length of the destination buffer
+ * @param[in] sync
+ * 		Non-zero to flush the copy to storage
+ * @return
+ * 		Non-zero if success, @n
+ * 		0 if failure
+ */
+NVM_COMMON_API extern int copy_file_with_sync(const COMMON_PATH source,
+		const COMMON_SIZE source_len, const COMMON_PATH destination,
+		const COMMON_SIZE destination_len, const COMMON_BOOL sync);
+
 /*!
  * Copy a file to a buffer
  * @note The buffer needs to be freed by the caller
@@ -111,6 +131,33 @@ NVM_COMMON_API extern int copy_file(const COMMON_PATH source, const COMMON_SIZE
 NVM_COMMON_API extern int copy_file_to_buffer(const COMMON_PATH path, const COMMON_SIZE path_len,
 		void **pp_buf, unsigned int *p_buf_len);
 
+/*!
+ * Map a file read-only into memory instead of copying it to a buffer
+ * @note The mapping needs to be released by the caller with #unmap_file
+ * @param[in] path
+ * 		The full path of the file to be mapped
+ * @param[in] path_len
+ * 		The length of the path buffer
+ * @param[in,out] pp_buf
+ * 		Set to the start of the mapped file contents
+ * @param[in,out] p_buf_len
+ * 		The length of the mapped file
+ * @return
+ * 		COMMON_SUCCESS if success, @n
+ * 		COMMON_ERR_INVALIDPARAMETER or COMMON_ERR_BADFILE if failure
+ */
+NVM_COMMON_API extern int map_file_read_only(const COMMON_PATH path, const COMMON_SIZE path_len,
+		const void **pp_buf, unsigned int *p_buf_len);
+
+/*!
+ * Release a mapping returned by #map_file_read_only
+ * @param[in] p_buf
+ * 		The start of the mapped file contents
+ * @param[in] buf_len
+ * 		The length of the mapped file
+ */
+NVM_COMMON_API extern void unmap_file(const void *p_buf, const unsigned int buf_len);
+
 /*!
  * Copy a buffer to a file
  * @param[in] p_buf
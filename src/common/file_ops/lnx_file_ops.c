@@ -30,6 +30,10 @@
  * system call wrappers.
  */
 
+// copy_file_range, SEEK_DATA and SEEK_HOLE are GNU extensions
+#ifndef _GNU_SOURCE
+#define	_GNU_SOURCE
+#endif
 
 #include <unistd.h>
 #include <stdlib.h>
@@ -39,11 +43,37 @@
 // file I/O
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
+#include <sys/sendfile.h>
 
 #include "file_ops_adapter.h"
 #include <string/s_str.h>
 
+// copy_file_range was added to glibc in 2.27
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 27)))
+#define	HAVE_COPY_FILE_RANGE	1
+#else
+#define	HAVE_COPY_FILE_RANGE	0
+#endif
+
+// most the kernel is asked to copy at once
+#define	COPY_CHUNK_BYTES	(64 * 1024 * 1024)
+// buffer used when the kernel can't copy the file itself
+#define	COPY_BUFFER_BYTES	(1024 * 1024)
+#define	COPY_BUFFER_ALIGNMENT	4096
+
+// errors meaning the copy method can't be used for these files
+#define	IS_COPY_UNSUPPORTED(err)	(((err) == ENOSYS) || ((err) == EXDEV) || \
+		((err) == EINVAL) || ((err) == EOPNOTSUPP))
+
+enum copy_method
+{
+	COPY_METHOD_COPY_FILE_RANGE,
+	COPY_METHOD_SENDFILE,
+	COPY_METHOD_BUFFER
+};
+
 extern char *realpath(__const char *__restrict __name,
 	char *__restrict __resolved) __THROW __wur;
 
@@ -125,6 +155,121 @@ int create_dir(const COMMON_PATH path, const COMMON_SIZE path_len)
  */
 int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 		const COMMON_PATH destination, const COMMON_SIZE destination_len)
+{
+	return copy_file_with_sync(source, source_len, destination, destination_len, 0);
+}
+
+/*
+ * Copy 'len' bytes at 'offset' in fd_in to the same offset in fd_out. The copy
+ * is done in the kernel when it can be, falling back to the next method when the
+ * kernel or file system doesn't support one. Partial copies are continued.
+ */
+static int copy_extent(int fd_in, int fd_out, off_t offset, off_t len,
+		enum copy_method *p_method, void **pp_buf)
+{
+	int rc = 1;
+	off_t in_offset = offset;
+	off_t out_offset = offset;
+	while (rc && (len > 0))
+	{
+		ssize_t copied = -1;
+		size_t chunk = (len > COPY_CHUNK_BYTES) ? COPY_CHUNK_BYTES : (size_t)len;
+		if (*p_method == COPY_METHOD_COPY_FILE_RANGE)
+		{
+#if HAVE_COPY_FILE_RANGE
+			// advances both offsets
+			copied = copy_file_range(fd_in, &in_offset, fd_out, &out_offset, chunk, 0);
+#else
+			errno = ENOSYS;
+#endif
+			if ((copied == -1) && IS_COPY_UNSUPPORTED(errno))
+			{
+				*p_method = COPY_METHOD_SENDFILE;
+				continue;
+			}
+		}
+		else if (*p_method == COPY_METHOD_SENDFILE)
+		{
+			// sendfile writes at the current position of the output
+			if (lseek(fd_out, out_offset, SEEK_SET) == -1)
+			{
+				rc = 0;
+				break;
+			}
+			copied = sendfile(fd_out, fd_in, &in_offset, chunk);
+			if ((copied == -1) && IS_COPY_UNSUPPORTED(errno))
+			{
+				*p_method = COPY_METHOD_BUFFER;
+				continue;
+			}
+			if (copied > 0)
+			{
+				out_offset += copied;
+			}
+		}
+		else
+		{
+			if (!*pp_buf &&
+				(posix_memalign(pp_buf, COPY_BUFFER_ALIGNMENT, COPY_BUFFER_BYTES) != 0))
+			{
+				*pp_buf = NULL;
+				rc = 0;
+				break;
+			}
+			if (chunk > COPY_BUFFER_BYTES)
+			{
+				chunk = COPY_BUFFER_BYTES;
+			}
+			copied = pread(fd_in, *pp_buf, chunk, in_offset);
+			// a write may be short, keep going until the whole read is written
+			ssize_t written = 0;
+			while ((copied > 0) && (written < copied))
+			{
+				ssize_t num_written = pwrite(fd_out, (char *)*pp_buf + written,
+						copied - written, out_offset + written);
+				if (num_written > 0)
+				{
+					written += num_written;
+				}
+				else if ((num_written == -1) && (errno == EINTR))
+				{
+					continue;
+				}
+				else
+				{
+					rc = 0;
+					break;
+				}
+			}
+			if (copied > 0)
+			{
+				in_offset += copied;
+				out_offset += copied;
+			}
+		}
+
+		if (rc)
+		{
+			if (copied > 0)
+			{
+				len -= copied;
+			}
+			else if ((copied == 0) || (errno != EINTR))
+			{
+				// source is shorter than it was or the copy failed
+				rc = 0;
+			}
+		}
+	}
+	return rc;
+}
+
+/*
+ * Copy a file, optionally flushing the copy to storage before returning
+ */
+int copy_file_with_sync(const COMMON_PATH source, const COMMON_SIZE source_len,
+		const COMMON_PATH destination, const COMMON_SIZE destination_len,
+		const COMMON_BOOL sync)
 {
 	// safe file names
 	COMMON_PATH source_path;
@@ -135,9 +280,6 @@ int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 	// open both files
 	int fd_in = open(source_path, O_RDONLY);
 	int fd_out = open(destination_path, O_WRONLY|O_CREAT|O_EXCL, 0x0664);
-	char buf[512];
-	size_t copied = 0;
-	size_t bytestocopy;
 
 	// assume that we are successful until proven otherwise
 	int rc = 1;
@@ -146,21 +288,47 @@ int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 		struct stat stat_buf;
 		if (fstat(fd_in, &stat_buf) == 0)
 		{
-			while (copied < stat_buf.st_size && rc != -1)
+			enum copy_method method = COPY_METHOD_COPY_FILE_RANGE;
+			void *p_buf = NULL;
+			off_t offset = 0;
+			while (rc && (offset < stat_buf.st_size))
 			{
-				bytestocopy = (stat_buf.st_size > 512) ? 512 : stat_buf.st_size;
-				rc = (read(fd_in, buf, bytestocopy) != -1);
-				if (rc)
+				// only the data is copied, holes in a sparse file stay holes
+				off_t data_start = offset;
+				off_t data_end = stat_buf.st_size;
+#ifdef SEEK_DATA
+				data_start = lseek(fd_in, offset, SEEK_DATA);
+				if ((data_start == -1) && (errno == ENXIO))
+				{
+					// the rest of the file is a hole
+					break;
+				}
+				else if (data_start == -1)
 				{
-					rc = (write(fd_out, buf, bytestocopy) != -1);
+					// file system can't tell, copy everything
+					data_start = offset;
 				}
-				if (rc)
+				else
 				{
-					copied += bytestocopy;
+					data_end = lseek(fd_in, data_start, SEEK_HOLE);
+					if ((data_end == -1) || (data_end > stat_buf.st_size))
+					{
+						data_end = stat_buf.st_size;
+					}
 				}
+#endif
+				rc = copy_extent(fd_in, fd_out, data_start, data_end - data_start,
+						&method, &p_buf);
+				offset = data_end;
 			}
+			free(p_buf);
 
-			if (copied != stat_buf.st_size)
+			// a hole at the end of the file only exists by the file size
+			if (rc && (ftruncate(fd_out, stat_buf.st_size) != 0))
+			{
+				rc = 0;
+			}
+			if (rc && sync && (fsync(fd_out) != 0))
 			{
 				rc = 0;
 			}
@@ -190,6 +358,71 @@ int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 	return rc;
 }
 
+/*
+ * Map a file read-only into memory.
+ */
+int map_file_read_only(const COMMON_PATH path, const COMMON_SIZE path_len,
+		const void **pp_buf, unsigned int *p_buf_len)
+{
+	int rc = COMMON_SUCCESS;
+
+	if (path == NULL || pp_buf == NULL || p_buf_len == NULL)
+	{
+		rc = COMMON_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		// safe file name
+		COMMON_PATH file_path;
+		s_strncpy(file_path, COMMON_PATH_LEN, path, path_len);
+
+		struct stat stat_buf;
+		int fd = open(file_path, O_RDONLY);
+		if (fd == -1)
+		{
+			rc = COMMON_ERR_BADFILE;
+		}
+		// make sure it's a regular, non-empty file that fits the length
+		else if (fstat(fd, &stat_buf) != 0 || !S_ISREG(stat_buf.st_mode) ||
+				stat_buf.st_size <= 0 || stat_buf.st_size > UINT_MAX)
+		{
+			rc = COMMON_ERR_BADFILE;
+		}
+		else
+		{
+			void *p_map = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p_map == MAP_FAILED)
+			{
+				rc = COMMON_ERR_BADFILE;
+			}
+			else
+			{
+				*pp_buf = p_map;
+				*p_buf_len = (unsigned int)stat_buf.st_size;
+			}
+		}
+
+		// the mapping stays valid after the file is closed
+		if (fd != -1)
+		{
+			close(fd);
+		}
+	}
+
+	return rc;
+}
+
+/*
+ * Release a mapping returned by map_file_read_only.
+ */
+void unmap_file(const void *p_buf, const unsigned int buf_len)
+{
+	if (p_buf != NULL)
+	{
+		munmap((void *)p_buf, buf_len);
+	}
+}
+
 /*
  * linux version of open_file.
  */
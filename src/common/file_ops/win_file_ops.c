@@ -129,6 +129,16 @@ int create_dir(const COMMON_PATH path, const COMMON_SIZE path_len)
  */
 int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 		const COMMON_PATH destination, const COMMON_SIZE destination_len)
+{
+	return copy_file_with_sync(source, source_len, destination, destination_len, 0);
+}
+
+/*
+ * Copy a file, optionally flushing the copy to storage before returning
+ */
+int copy_file_with_sync(const COMMON_PATH source, const COMMON_SIZE source_len,
+		const COMMON_PATH destination, const COMMON_SIZE destination_len,
+		const COMMON_BOOL sync)
 {
 	// safe file names
 	COMMON_PATH source_path;
@@ -141,7 +151,101 @@ int copy_file(const COMMON_PATH source, const COMMON_SIZE source_len,
 	utf8_to_wchar(w_source, (size_t)COMMON_PATH_LEN, source_path, (int)COMMON_PATH_LEN);
 	utf8_to_wchar(w_dest, (size_t)COMMON_PATH_LEN, destination_path, (int)COMMON_PATH_LEN);
 
-	return (CopyFileW(w_source, w_dest, 1) != 0);
+	int rc = (CopyFileW(w_source, w_dest, 1) != 0);
+	if (rc && sync)
+	{
+		HANDLE h_file = CreateFileW(w_dest, GENERIC_WRITE, 0, NULL,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (h_file == INVALID_HANDLE_VALUE)
+		{
+			rc = 0;
+		}
+		else
+		{
+			rc = (FlushFileBuffers(h_file) != 0);
+			CloseHandle(h_file);
+		}
+	}
+	return rc;
+}
+
+/*
+ * Map a file read-only into memory.
+ * Note: Windows version must convert paths to UTF-16 first
+ */
+int map_file_read_only(const COMMON_PATH path, const COMMON_SIZE path_len,
+		const void **pp_buf, unsigned int *p_buf_len)
+{
+	int rc = COMMON_SUCCESS;
+
+	if (path == NULL || pp_buf == NULL || p_buf_len == NULL)
+	{
+		rc = COMMON_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		// safe file name
+		COMMON_PATH file_path;
+		s_strncpy(file_path, COMMON_PATH_LEN, path, path_len);
+
+		COMMON_WPATH w_path;
+		utf8_to_wchar(w_path, (size_t)COMMON_PATH_LEN, file_path, (int)COMMON_PATH_LEN);
+
+		HANDLE file = CreateFileW(w_path, GENERIC_READ, FILE_SHARE_READ, NULL,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		HANDLE mapping = NULL;
+		LARGE_INTEGER file_size;
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			rc = COMMON_ERR_BADFILE;
+		}
+		// make sure it's not empty and fits the length
+		else if (!GetFileSizeEx(file, &file_size) ||
+				file_size.QuadPart <= 0 || file_size.QuadPart > UINT_MAX)
+		{
+			rc = COMMON_ERR_BADFILE;
+		}
+		else if ((mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL)) == NULL)
+		{
+			rc = COMMON_ERR_BADFILE;
+		}
+		else
+		{
+			void *p_map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (p_map == NULL)
+			{
+				rc = COMMON_ERR_BADFILE;
+			}
+			else
+			{
+				*pp_buf = p_map;
+				*p_buf_len = (unsigned int)file_size.QuadPart;
+			}
+		}
+
+		// the view stays valid after the handles are closed
+		if (mapping != NULL)
+		{
+			CloseHandle(mapping);
+		}
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(file);
+		}
+	}
+
+	return rc;
+}
+
+/*
+ * Release a mapping returned by map_file_read_only.
+ */
+void unmap_file(const void *p_buf, const unsigned int buf_len)
+{
+	if (p_buf != NULL)
+	{
+		UnmapViewOfFile(p_buf);
+	}
 }
 
 /*
@@ -46,6 +46,7 @@
 #include <sys/types.h>
 #include <sys/ipc.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include <string/s_str.h>
 #include <string/unicode_utilities.h>
@@ -174,15 +175,105 @@ int stop_process(unsigned int process_id)
 }
 
 /*
- * Create a thread on the current process
+ * Create a detached thread on the current process
  */
-void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void *callback_arg)
+int create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void *callback_arg)
 {
-	pthread_create(
-			(pthread_t *)p_thread_id,
+	int rc = COMMON_ERR_FAILED;
+	pthread_t thread;
+	if (pthread_create(&thread,
 			NULL, // default attributes
 			callback,
-			callback_arg);
+			callback_arg) == 0)
+	{
+		// nothing joins it, so its resources are released when it exits
+		pthread_detach(thread);
+		*p_thread_id = (COMMON_UINT64)thread;
+		rc = COMMON_SUCCESS;
+	}
+	return rc;
+}
+
+/*
+ * Work shared by the threads of run_parallel
+ */
+struct parallel_work
+{
+	COMMON_UINT32 count;
+	COMMON_UINT32 next_index;
+	void (*callback)(void *, COMMON_UINT32);
+	void *callback_arg;
+};
+
+static void *parallel_worker(void *arg)
+{
+	struct parallel_work *p_work = (struct parallel_work *)arg;
+	COMMON_UINT32 index;
+	while ((index = __sync_fetch_and_add(&p_work->next_index, 1)) < p_work->count)
+	{
+		p_work->callback(p_work->callback_arg, index);
+	}
+	return NULL;
+}
+
+/*
+ * Call the callback for each index using up to max_threads threads
+ */
+void run_parallel(COMMON_UINT32 count, COMMON_UINT32 max_threads,
+	void (*callback)(void *, COMMON_UINT32), void *callback_arg)
+{
+	struct parallel_work work;
+	work.count = count;
+	work.next_index = 0;
+	work.callback = callback;
+	work.callback_arg = callback_arg;
+
+	COMMON_UINT32 thread_count = count < max_threads ? count : max_threads;
+	pthread_t *p_threads = NULL;
+	if (thread_count > 1)
+	{
+		p_threads = malloc((thread_count - 1) * sizeof (pthread_t));
+	}
+
+	// the caller is one of the threads, the others are only joined if started
+	COMMON_UINT32 started = 0;
+	if (p_threads)
+	{
+		for (COMMON_UINT32 i = 0; i < thread_count - 1; i++)
+		{
+			if (pthread_create(&p_threads[started], NULL, parallel_worker, &work) == 0)
+			{
+				started++;
+			}
+		}
+	}
+	parallel_worker(&work);
+	for (COMMON_UINT32 i = 0; i < started; i++)
+	{
+		pthread_join(p_threads[i], NULL);
+	}
+	if (p_threads)
+	{
+		free(p_threads);
+	}
+}
+
+static COMMON_UINT32 g_device_change_count = 0;
+
+/*
+ * Record that the devices have changed
+ */
+void notify_device_change()
+{
+	__sync_add_and_fetch(&g_device_change_count, 1);
+}
+
+/*
+ * Retrieve the number of device changes so far
+ */
+COMMON_UINT32 get_device_change_count()
+{
+	return __sync_add_and_fetch(&g_device_change_count, 0);
 }
 
 /*
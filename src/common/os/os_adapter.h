@@ -175,11 +175,59 @@ NVM_COMMON_API extern int stop_process(unsigned int process_id);
 NVM_COMMON_API extern void nvm_sleep(unsigned long time);
 
 /*!
- * Create a thread on the current process
+ * Create a detached thread on the current process
+ * @param[out] p_thread_id
+ * 		The ID of the thread, if successfully started
+ * @param[in] callback
+ * 		The function the thread runs
+ * @param[in] callback_arg
+ * 		The argument passed to @c callback
+ * @return
+ * 		COMMON_SUCCESS @n
+ * 		COMMON_ERR_FAILED
  */
-NVM_COMMON_API extern void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *),
+NVM_COMMON_API extern int create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *),
 	void *callback_arg);
 
+/*!
+ * Default maximum number of threads for run_parallel
+ */
+#define	PARALLEL_MAX_THREADS	8
+
+/*!
+ * Call @c callback once for each index from 0 to @c count - 1, spread over up to
+ * @c max_threads threads. The calling thread is one of them and every thread
+ * takes the next unclaimed index until none are left, so the work items must be
+ * independent of each other.
+ * @remarks
+ * 		If a thread can't be started its share is done by the others, so every
+ * 		index is always processed. Returns once all of them are done.
+ * @param[in] count
+ * 		The number of work items
+ * @param[in] max_threads
+ * 		The maximum number of threads, including the calling thread
+ * @param[in] callback
+ * 		Called with @c callback_arg and the index of the work item
+ * @param[in] callback_arg
+ * 		The argument passed to @c callback
+ */
+NVM_COMMON_API extern void run_parallel(COMMON_UINT32 count, COMMON_UINT32 max_threads,
+	void (*callback)(void *, COMMON_UINT32), void *callback_arg);
+
+/*!
+ * Record that the state of the devices has changed, e.g. new FW or a new
+ * security state, so anything cached from them is stale.
+ */
+NVM_COMMON_API extern void notify_device_change();
+
+/*!
+ * Get the number of device changes recorded in this process so far.
+ * A cache keeps the count it was filled at and is stale once it differs.
+ * @return
+ * 		The device change count
+ */
+NVM_COMMON_API extern COMMON_UINT32 get_device_change_count();
+
 /*!
  * Gets the current threads ID.  Useful in logging.
  * @return
@@ -37,6 +37,7 @@
 #include <windows.h>
 #include <winnt.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <tchar.h> // todo: remove this header and replace associated functions
 #include <direct.h> // for _getcwd
 
@@ -149,17 +150,112 @@ void nvm_sleep(unsigned long time)
 }
 
 /*
- * Create a thread on the current process
+ * Create a detached thread on the current process
  */
-void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void * callback_arg)
+int create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void * callback_arg)
 {
-	CreateThread(
+	int rc = COMMON_ERR_FAILED;
+	DWORD thread_id = 0;
+	HANDLE thread = CreateThread(
 			NULL, // default security
 			0,  // default stack size
 			(LPTHREAD_START_ROUTINE)callback,
 			(LPVOID)callback_arg,
 			0, // Immediately run thread
-			(LPDWORD)p_thread_id);
+			&thread_id);
+	if (thread)
+	{
+		// closing the handle doesn't stop the thread
+		CloseHandle(thread);
+		*p_thread_id = thread_id;
+		rc = COMMON_SUCCESS;
+	}
+	return rc;
+}
+
+/*
+ * Work shared by the threads of run_parallel
+ */
+struct parallel_work
+{
+	LONG count;
+	volatile LONG next_index;
+	void (*callback)(void *, COMMON_UINT32);
+	void *callback_arg;
+};
+
+static DWORD WINAPI parallel_worker(LPVOID arg)
+{
+	struct parallel_work *p_work = (struct parallel_work *)arg;
+	LONG index;
+	// InterlockedIncrement returns the new value
+	while ((index = InterlockedIncrement(&p_work->next_index) - 1) < p_work->count)
+	{
+		p_work->callback(p_work->callback_arg, (COMMON_UINT32)index);
+	}
+	return 0;
+}
+
+/*
+ * Call the callback for each index using up to max_threads threads
+ */
+void run_parallel(COMMON_UINT32 count, COMMON_UINT32 max_threads,
+	void (*callback)(void *, COMMON_UINT32), void *callback_arg)
+{
+	struct parallel_work work;
+	work.count = (LONG)count;
+	work.next_index = 0;
+	work.callback = callback;
+	work.callback_arg = callback_arg;
+
+	COMMON_UINT32 thread_count = count < max_threads ? count : max_threads;
+	HANDLE *p_threads = NULL;
+	if (thread_count > 1)
+	{
+		p_threads = malloc((thread_count - 1) * sizeof (HANDLE));
+	}
+
+	// the caller is one of the threads, the others are only waited on if started
+	COMMON_UINT32 started = 0;
+	if (p_threads)
+	{
+		for (COMMON_UINT32 i = 0; i < thread_count - 1; i++)
+		{
+			HANDLE thread = CreateThread(NULL, 0, parallel_worker, &work, 0, NULL);
+			if (thread)
+			{
+				p_threads[started++] = thread;
+			}
+		}
+	}
+	parallel_worker(&work);
+	for (COMMON_UINT32 i = 0; i < started; i++)
+	{
+		WaitForSingleObject(p_threads[i], INFINITE);
+		CloseHandle(p_threads[i]);
+	}
+	if (p_threads)
+	{
+		free(p_threads);
+	}
+}
+
+static volatile LONG g_device_change_count = 0;
+
+/*
+ * Record that the devices have changed
+ */
+void notify_device_change()
+{
+	InterlockedIncrement(&g_device_change_count);
+}
+
+/*
+ * Retrieve the number of device changes so far
+ */
+COMMON_UINT32 get_device_change_count()
+{
+	return (COMMON_UINT32)InterlockedCompareExchange(&g_device_change_count, 0, 0);
 }
 
 /*
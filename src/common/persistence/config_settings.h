@@ -164,6 +164,16 @@ extern "C"
 //! SQL Key name for whether the topology state has been initialized
 #define	SQL_KEY_TOPOLOGY_STATE_VALID "TOPOLOGY_STATE_VALID"
 
+//! SQL Key name for whether the parsed NFIT is persisted for reuse across processes
+#define	SQL_KEY_NFIT_CACHE_PERSIST "NFIT_CACHE_PERSIST"
+
+//! SQL Key name for the digest of the system inputs to the last platform config diagnostic
+#define	SQL_KEY_PCONFIG_DIAG_SYSTEM_DIGEST "PCONFIG_DIAG_SYSTEM_DIGEST"
+
+//! SQL Key name prefix, followed by the DIMM UID, for the digest of a DIMM's PCD
+//! as of the last platform config diagnostic
+#define	SQL_KEY_PCONFIG_DIAG_PCD_DIGEST "PCONFIG_DIAG_PCD_DIGEST_"
+
 //! SQL Key name for minimum severity an event must have to log it to syslog
 #define	SQL_KEY_EVENT_SYSLOG_MIN_SEVERITY	"EVENT_SYSLOG_MIN_SEVERITY"
 
@@ -209,6 +219,9 @@ extern "C"
 //! SQL Key name for the % of performance logs to be trimmed if max number of rows is exceeded
 #define	SQL_KEY_PERFORMANCE_LOG_TRIM_PERCENT "PERFORMANCE_LOG_TRIM_PERCENT"
 
+//! SQL Key name for how old, in seconds, a stored performance sample may be to stand in for a live query
+#define	SQL_KEY_PERFORMANCE_METRIC_MAX_SAMPLE_AGE_SECONDS "PERFORMANCE_METRIC_MAX_SAMPLE_AGE_SECONDS"
+
 #ifdef __cplusplus
 }
 #endif
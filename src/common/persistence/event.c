@@ -612,6 +612,75 @@ void params_to_event(const enum event_type type, const enum event_severity sever
 	COMMON_LOG_EXIT();
 }
 
+/*
+ * Translate an event into a db event and add it to the event table
+ */
+static int add_event_to_db(PersistentStore *p_store, const struct event *p_event)
+{
+	int rc = NVM_SUCCESS;
+	struct db_event db_event;
+	memset(&db_event, 0, sizeof (struct db_event));
+
+	// Note: db_event.id will be auto generated by sqlite
+	// get current time
+	time_t time_now;
+	time_now = time(NULL);
+	db_event.time = time_now;
+
+	// translate event struct into db event struct
+	db_event.type = p_event->type;
+	db_event.severity = p_event->severity;
+	db_event.code = p_event->code;
+	db_event.action_required = p_event->action_required;
+	uid_copy(p_event->uid, db_event.uid);
+	s_strcpy(db_event.arg1, p_event->args[0], NVM_EVENT_ARG_LEN);
+	s_strcpy(db_event.arg2, p_event->args[1], NVM_EVENT_ARG_LEN);
+	s_strcpy(db_event.arg3, p_event->args[2], NVM_EVENT_ARG_LEN);
+	db_event.diag_result = p_event->diag_result;
+
+	// store it
+	if (db_add_event(p_store, &db_event) != DB_SUCCESS)
+	{
+		// database issue
+		COMMON_LOG_ERROR("Failed to store an event in the database");
+		rc = NVM_ERR_UNKNOWN;
+	}
+	return rc;
+}
+
+/*
+ * Trim the oldest events that don't require action once the event table is full
+ */
+static void roll_event_table(PersistentStore *p_store)
+{
+	int max_events = 10000; // default if key is missing
+	int defaultTrimPercent = 10;
+	int trim_percent = defaultTrimPercent;
+	get_bounded_config_value_int(SQL_KEY_EVENT_LOG_MAX, &max_events);
+	get_bounded_config_value_int(SQL_KEY_EVENT_LOG_TRIM_PERCENT, &trim_percent);
+	if (trim_percent < 0)
+	{
+		trim_percent = defaultTrimPercent;
+	}
+
+	int event_count = 0;
+	table_row_count(p_store, "event", &event_count);
+	if (event_count >= max_events)
+	{
+		int trim_events = (trim_percent * max_events/100);
+		char sql[1024];
+		s_snprintf(sql, 1024,
+				"DELETE FROM event "
+				"where id IN "
+				"(SELECT id FROM event where action_required = 0 ORDER BY id LIMIT %d)",
+				trim_events);
+		if (db_run_custom_sql(p_store, sql) != DB_SUCCESS)
+		{
+			COMMON_LOG_ERROR("Failed to trim the event log");
+		}
+	}
+}
+
 /*
  * Store an event log entry in the db
  */
@@ -624,65 +693,10 @@ int store_event(struct event *p_event, COMMON_BOOL syslog)
 	{
 		rc = NVM_ERR_UNKNOWN;
 	}
-	else
+	else if ((rc = add_event_to_db(p_store, p_event)) == NVM_SUCCESS)
 	{
-		struct db_event db_event;
-		memset(&db_event, 0, sizeof (struct db_event));
-
-		// Note: db_event.id will be auto generated by sqlite
-		// get current time
-		time_t time_now;
-		time_now = time(NULL);
-		db_event.time = time_now;
-
-		// translate event struct into db event struct
-		db_event.type = p_event->type;
-		db_event.severity = p_event->severity;
-		db_event.code = p_event->code;
-		db_event.action_required = p_event->action_required;
-		uid_copy(p_event->uid, db_event.uid);
-		s_strcpy(db_event.arg1, p_event->args[0], NVM_EVENT_ARG_LEN);
-		s_strcpy(db_event.arg2, p_event->args[1], NVM_EVENT_ARG_LEN);
-		s_strcpy(db_event.arg3, p_event->args[2], NVM_EVENT_ARG_LEN);
-		db_event.diag_result = p_event->diag_result;
-
-		// store it
-		if (db_add_event(p_store, &db_event) == DB_SUCCESS)
-		{
-			// roll table
-			int max_events = 10000; // default if key is missing
-			int defaultTrimPercent = 10;
-			int trim_percent = defaultTrimPercent;
-			get_bounded_config_value_int(SQL_KEY_EVENT_LOG_MAX, &max_events);
-			get_bounded_config_value_int(SQL_KEY_EVENT_LOG_TRIM_PERCENT, &trim_percent);
-			if (trim_percent < 0)
-			{
-				trim_percent = defaultTrimPercent;
-			}
-
-			int event_count = 0;
-			table_row_count(p_store, "event", &event_count);
-			if (event_count >= max_events)
-			{
-				int trim_events = (trim_percent * max_events/100);
-				char sql[1024];
-				s_snprintf(sql, 1024,
-						"DELETE FROM event "
-						"where id IN "
-						"(SELECT id FROM event where action_required = 0 ORDER BY id LIMIT %d)",
-						trim_events);
-				if (db_run_custom_sql(p_store, sql) != DB_SUCCESS)
-				{
-					COMMON_LOG_ERROR("Failed to trim the event log");
-				}
-			}
-		}
-		else
-		{
-			// database issue
-			COMMON_LOG_ERROR("Failed to store an event in the database");
-			rc = NVM_ERR_UNKNOWN;
-		}
+		// roll table
+		roll_event_table(p_store);
 	}
 
 	// store the event in the syslog
@@ -697,6 +711,46 @@ int store_event(struct event *p_event, COMMON_BOOL syslog)
 	return rc;
 }
 
+/*
+ * Store a list of event log entries in the db in a single transaction
+ */
+int store_events(struct event *p_events, const NVM_UINT32 count, COMMON_BOOL syslog)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	PersistentStore *p_store = get_lib_store();
+	if (!p_store)
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else if (count > 0)
+	{
+		db_begin_transaction(p_store);
+		for (NVM_UINT32 i = 0; i < count; i++)
+		{
+			int tmp_rc = add_event_to_db(p_store, &p_events[i]);
+			KEEP_ERROR(rc, tmp_rc);
+		}
+		db_end_transaction(p_store);
+
+		// roll table once for the whole list
+		roll_event_table(p_store);
+	}
+
+	// store the events in the syslog
+	if (syslog)
+	{
+		for (NVM_UINT32 i = 0; i < count; i++)
+		{
+			populate_event_message(&p_events[i]);
+			log_event_in_syslog(&p_events[i], NVM_SYSLOG_SOURCE);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Store an event log entry in the db
  */
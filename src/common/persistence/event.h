@@ -235,6 +235,21 @@ enum event_code_config
  */
 NVM_COMMON_API int store_event(struct event *p_event, COMMON_BOOL syslog);
 
+/*
+ * Store a list of event log entries in the db in a single transaction
+ */
+NVM_COMMON_API int store_events(struct event *p_events, const NVM_UINT32 count,
+		COMMON_BOOL syslog);
+
+/*
+ * Helper function to copy a list of params into an event struct
+ */
+NVM_COMMON_API void params_to_event(const enum event_type type,
+		const enum event_severity severity, const NVM_UINT16 code,
+		const NVM_UID device_uid, const NVM_BOOL action_required, const NVM_EVENT_ARG arg1,
+		const NVM_EVENT_ARG arg2, const NVM_EVENT_ARG arg3,
+		const enum diagnostic_result result, struct event *p_event);
+
 /*
  * Helper method to convert event info into a struct to store in the db
  */
@@ -368,6 +368,12 @@ void apply_bound_to_config_value(const char *key, int *value)
 	{
 		apply_bound(value, PERFORMANCE_LOG_TRIM_PERCENT_BOUND, MAX_TRIM_PERCENT);
 	}
+	else if ((s_strncmp(key, SQL_KEY_PERFORMANCE_METRIC_MAX_SAMPLE_AGE_SECONDS,
+			s_strnlen(key, CONFIG_SETTINGS_KEY_MAX_LEN)) == 0) &&
+			(*value < 0))
+	{
+		apply_bound(value, 0, INT_MAX);
+	}
 	else if ((s_strncmp(key, SQL_KEY_EVENT_LOG_TRIM_PERCENT,
 			s_strnlen(key, CONFIG_SETTINGS_KEY_MAX_LEN)) == 0) &&
 			(*value < EVENT_LOG_TRIM_PERCENT_BOUND))
@@ -519,12 +525,15 @@ int set_default_config_settings(PersistentStore *p_ps)
 		add_config_value_to_pstore(p_ps, SQL_KEY_PERFORMANCE_MONITOR_INTERVAL_MINUTES, "180");
 		add_config_value_to_pstore(p_ps, SQL_KEY_PERFORMANCE_LOG_MAX, "10000");
 		add_config_value_to_pstore(p_ps, SQL_KEY_PERFORMANCE_LOG_TRIM_PERCENT, "30");
+		// 0 = always query the DIMMs
+		add_config_value_to_pstore(p_ps, SQL_KEY_PERFORMANCE_METRIC_MAX_SAMPLE_AGE_SECONDS, "60");
 
 		add_config_value_to_pstore(p_ps, SQL_KEY_EVENT_MONITOR_ENABLED, "0");
 		add_config_value_to_pstore(p_ps, SQL_KEY_EVENT_MONITOR_INTERVAL_MINUTES, "1");
 		add_config_value_to_pstore(p_ps, SQL_KEY_EVENT_LOG_MAX, "10000");
 		add_config_value_to_pstore(p_ps, SQL_KEY_EVENT_LOG_TRIM_PERCENT, "10");
 		add_config_value_to_pstore(p_ps, SQL_KEY_TOPOLOGY_STATE_VALID, "0");
+		add_config_value_to_pstore(p_ps, SQL_KEY_NFIT_CACHE_PERSIST, "0");
 
 		// CLI default device identifier output - HANDLE (or uid)
 		add_config_value_to_pstore(p_ps, SQL_KEY_CLI_DIMM_ID, "HANDLE");
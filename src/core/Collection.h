@@ -28,22 +28,35 @@
 #define CR_MGMT_DEVICECOLLECTION_H
 
 #include <vector>
+#include <memory>
+#include <unordered_map>
 #include <stddef.h>
 #include "ExportCore.h"
 
 namespace core
 {
+/*
+ * Collection of items cloned from the ones pushed into it. Copies of a collection
+ * share the cloned items.
+ */
 template<class T>
 class Collection
 {
 public:
+	virtual ~Collection() {}
 	T & operator[](const int i);
 	void push_back(T &item);
 	size_t size() const;
 	void removeAt(size_t index);
 
 protected:
-	std::vector<T *> m_collection;
+	std::vector<std::shared_ptr<T> > m_collection;
+
+	/*
+	 * Called whenever items are added or removed so a subclass can drop
+	 * any index it keeps over the item positions.
+	 */
+	virtual void itemsChanged() {}
 };
 
 template<class T>
@@ -55,8 +68,9 @@ T &Collection<T>::operator[](const int i)
 template<class T>
 void Collection<T>::push_back(T &item)
 {
-	T *copy = item.clone();
+	std::shared_ptr<T> copy(item.clone());
 	m_collection.push_back(copy);
+	itemsChanged();
 }
 
 template<class T>
@@ -68,6 +82,52 @@ template<class T>
 void Collection<T>::removeAt(size_t index)
 {
 	m_collection.erase(m_collection.begin() + index);
+	itemsChanged();
+}
+
+/*
+ * Hash index from a key to the positions of the matching items in a Collection,
+ * so lookups don't have to scan the whole collection. A key may match more than
+ * one item.
+ */
+template<class Key>
+class CollectionIndex
+{
+public:
+	void add(const Key &key, const size_t position);
+	const std::vector<size_t> &find(const Key &key) const;
+	bool contains(const Key &key) const;
+	void clear();
+
+private:
+	std::unordered_map<Key, std::vector<size_t> > m_positions;
+	std::vector<size_t> m_noPositions;
+};
+
+template<class Key>
+void CollectionIndex<Key>::add(const Key &key, const size_t position)
+{
+	m_positions[key].push_back(position);
+}
+
+template<class Key>
+const std::vector<size_t> &CollectionIndex<Key>::find(const Key &key) const
+{
+	typename std::unordered_map<Key, std::vector<size_t> >::const_iterator iter =
+			m_positions.find(key);
+	return iter != m_positions.end() ? iter->second : m_noPositions;
+}
+
+template<class Key>
+bool CollectionIndex<Key>::contains(const Key &key) const
+{
+	return m_positions.find(key) != m_positions.end();
+}
+
+template<class Key>
+void CollectionIndex<Key>::clear()
+{
+	m_positions.clear();
 }
 
 }
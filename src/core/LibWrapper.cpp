@@ -161,6 +161,13 @@ int LibWrapper::getDeviceDetails(const NVM_UID deviceUid, struct device_details
 	return nvm_get_device_details(deviceUid, pDetails);
 }
 
+int LibWrapper::getDevicesDetails(const NVM_UID *pDeviceUids, struct device_details *pDetails,
+	int *pResults, const NVM_UINT32 count) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+	return nvm_get_devices_details(pDeviceUids, pDetails, pResults, count);
+}
+
 int LibWrapper::getDevicePerformance(const NVM_UID deviceUid,
 	struct device_performance *pPerformance) const
 {
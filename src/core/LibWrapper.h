@@ -77,6 +77,8 @@ public:
 		const struct device_settings *pSettings) const;
 
 	virtual int getDeviceDetails(const NVM_UID deviceUid, struct device_details *pDetails) const;
+	virtual int getDevicesDetails(const NVM_UID *pDeviceUids, struct device_details *pDetails,
+		int *pResults, const NVM_UINT32 count) const;
 
 	virtual int getDevicePerformance(const NVM_UID deviceUid,
 		struct device_performance *pPerformance) const;
@@ -391,6 +391,44 @@ struct device_details NvmLibrary::getDeviceDetails(const std::string &deviceUid)
 
 }
 
+std::map<std::string, struct device_details> NvmLibrary::getDevicesDetails(
+	const std::vector<std::string> &deviceUids)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	int rc;
+
+	std::map<std::string, struct device_details> result;
+	size_t count = deviceUids.size();
+	if (count > 0)
+	{
+		std::unique_ptr<NVM_UID[]> lib_deviceUids(new NVM_UID[count]);
+		std::unique_ptr<struct device_details[]> fromLib(new device_details[count]);
+		std::unique_ptr<int[]> results(new int[count]);
+		for (size_t i = 0; i < count; i++)
+		{
+			core::Helper::stringToUid(deviceUids[i], lib_deviceUids[i]);
+		}
+
+		rc = m_lib.getDevicesDetails(lib_deviceUids.get(), fromLib.get(), results.get(),
+			(NVM_UINT32)count);
+		if (rc < 0)
+		{
+			throw core::LibraryException(rc);
+		}
+
+		// devices that failed are left out, so the caller falls back to a
+		// single device query that reports the error
+		for (size_t i = 0; i < count; i++)
+		{
+			if (results[i] == NVM_SUCCESS)
+			{
+				result[deviceUids[i]] = fromLib[i];
+			}
+		}
+	}
+	return result;
+}
+
 struct device_performance NvmLibrary::getDevicePerformance(const std::string &deviceUid)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -1143,10 +1181,12 @@ void NvmLibrary::runDiagnostic(const std::string &deviceUid, const struct diagno
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 	int rc;
 
+	// no UID runs the diagnostic on all devices
 	NVM_UID lib_deviceUid;
 	core::Helper::stringToUid(deviceUid, lib_deviceUid);
 
-	rc = m_lib.runDiagnostic(lib_deviceUid, &pDiagnostic, &pResults);
+	rc = m_lib.runDiagnostic(deviceUid.empty() ? NULL : lib_deviceUid,
+		&pDiagnostic, &pResults);
 	if (rc < 0)
 	{
 		throw core::LibraryException(rc);
@@ -29,6 +29,7 @@
 
 #include "LibWrapper.h"
 
+#include <map>
 #include <string>
 #include <vector>
 #include "ExportCore.h"
@@ -65,6 +66,8 @@ public:
 	virtual void modifyDeviceSettings(const std::string &deviceUid,
 		const struct device_settings &settings);
 	virtual struct device_details getDeviceDetails(const std::string &deviceUid);
+	virtual std::map<std::string, struct device_details> getDevicesDetails(
+		const std::vector<std::string> &deviceUids);
 	virtual struct device_performance getDevicePerformance(const std::string &deviceUid);
 	virtual void updateDeviceFw(const std::string &deviceUid, const std::string path,
 		const bool force);
@@ -27,84 +27,99 @@
 
 #include "Device.h"
 #include <iomanip>
+#include <algorithm>
+#include <os/os_adapter.h>
+#ifdef __WINDOWS__
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 #include <fis_types.h>
 
 namespace core
 {
 namespace device
 {
+/*
+ * The discovery is fixed when the Device is created. The details and events
+ * are retrieved at most once, under the lock, and never change afterwards.
+ */
+struct Device::DeviceState
+{
+	DeviceState(NvmLibrary &lib, const device_discovery &discovery) :
+		lib(lib),
+		discovery(discovery),
+		deviceUid(Helper::uidToString(discovery.uid))
+	{
+		mutex_init((OS_MUTEX *)&lock, NULL);
+	}
+
+	~DeviceState()
+	{
+		mutex_delete((OS_MUTEX *)&lock, NULL);
+	}
+
+	NvmLibrary &lib;
+	const device_discovery discovery;
+	const std::string deviceUid;
+#ifdef __WINDOWS__
+	HANDLE lock;
+#else
+	pthread_mutex_t lock;
+#endif
+	std::unique_ptr<device_details> pDetails;
+	std::unique_ptr<std::vector<event> > pActionRequiredEvents;
+};
+
 Device::Device() :
-	m_lib(NvmLibrary::getNvmLibrary()),
-	m_discovery(device_discovery()),
-	m_pDetails(NULL),
-	m_pActionRequiredEvents(NULL)
+	m_pState(new DeviceState(NvmLibrary::getNvmLibrary(), device_discovery()))
 {
 
 }
 
 Device::Device(NvmLibrary &lib, const device_discovery &discovery) :
-	m_lib(lib),
-	m_pDetails(NULL),
-	m_pActionRequiredEvents(NULL)
+	m_pState(new DeviceState(lib, discovery))
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	memmove(&m_discovery, &discovery, sizeof(m_discovery));
-	m_deviceUid = Helper::uidToString(m_discovery.uid);
+}
+
+Device::Device(NvmLibrary &lib, const device_discovery &discovery,
+	const device_details &details) :
+	m_pState(new DeviceState(lib, discovery))
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	m_pState->pDetails.reset(new device_details(details));
 }
 
 Device::Device(const Device &other) :
-	m_lib(other.m_lib),
-	m_pDetails(NULL),
-	m_pActionRequiredEvents(NULL)
+	m_pState(other.m_pState)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	copy(other);
+}
+
+Device::Device(Device &&other) :
+	m_pState(std::move(other.m_pState))
+{
 }
 
 Device &Device::operator=(const Device &other)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	if (&other == this)
-		return *this;
-
-	copy(other);
+	m_pState = other.m_pState;
 
 	return *this;
 }
 
-void Device::copy(const Device &other)
+Device &Device::operator=(Device &&other)
 {
-	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	this->m_lib = other.m_lib;
-	this->m_discovery = other.m_discovery;
-	this->m_deviceUid = other.m_deviceUid;
-	if (other.m_pDetails)
-	{
-		this->m_pDetails = new device_details();
-		memmove(this->m_pDetails, other.m_pDetails, sizeof(device_details));
-	}
+	m_pState = std::move(other.m_pState);
 
-	if (other.m_pActionRequiredEvents)
-	{
-		this->m_pActionRequiredEvents = new std::vector<event>();
-		for (size_t i = 0; i < other.m_pActionRequiredEvents->size(); i++)
-		{
-			(*this->m_pActionRequiredEvents).push_back((*other.m_pActionRequiredEvents)[i]);
-		}
-	}
+	return *this;
 }
 
 Device::~Device()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	if (m_pDetails)
-	{
-		delete m_pDetails;
-	}
-	if (m_pActionRequiredEvents)
-	{
-		delete m_pActionRequiredEvents;
-	}
 }
 
 Device *Device::clone() const
@@ -340,7 +355,7 @@ fw_log_level Device::getFwLogLevel()
 	fw_log_level result = FW_LOG_LEVEL_UNKNOWN;
 	try
 	{
-		result = m_lib.getFwLogLevel(m_deviceUid);
+		result = m_pState->lib.getFwLogLevel(m_pState->deviceUid);
 	}
 	catch (core::LibraryException &)
 	{
@@ -848,54 +863,73 @@ NVM_UINT32 Device::ixpPropertyPlaceholder()
 const device_discovery &Device::getDiscovery()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return m_discovery;
+	return m_pState->discovery;
 }
 
 const device_details &Device::getDetails()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	if (m_pDetails == NULL)
+	// lock
+	mutex_lock((OS_MUTEX *)&m_pState->lock);
+	if (!m_pState->pDetails)
 	{
-		m_pDetails = new device_details();
+		std::unique_ptr<device_details> pDetails(new device_details());
 		try
 		{
-			const device_details &details = m_lib.getDeviceDetails(m_deviceUid);
-			memmove(m_pDetails, &details, sizeof(details));
+			*pDetails = m_pState->lib.getDeviceDetails(m_pState->deviceUid);
 		}
 		catch (core::LibraryException &e)
 		{
 			if (e.getErrorCode() != NVM_ERR_NOTMANAGEABLE)
 			{
+				mutex_unlock((OS_MUTEX *)&m_pState->lock);
 				throw;
 			}
 		}
-
+		catch (...)
+		{
+			mutex_unlock((OS_MUTEX *)&m_pState->lock);
+			throw;
+		}
+		m_pState->pDetails = std::move(pDetails);
 	}
-	return *m_pDetails;
+	mutex_unlock((OS_MUTEX *)&m_pState->lock);
+	// unlock
+	return *m_pState->pDetails;
 }
 
 const std::vector<event> &Device::getEvents()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	if (m_pActionRequiredEvents == NULL)
+	// lock
+	mutex_lock((OS_MUTEX *)&m_pState->lock);
+	if (!m_pState->pActionRequiredEvents)
 	{
-		m_pActionRequiredEvents = new std::vector<event>();
+		std::unique_ptr<std::vector<event> > pEvents(new std::vector<event>());
 		event_filter filter;
 		memset(&filter, 0, sizeof(filter));
 		filter.filter_mask = NVM_FILTER_ON_AR | NVM_FILTER_ON_UID;
 		filter.action_required = 1;
-		memmove(filter.uid, getDiscovery().uid, sizeof(filter.uid));
+		memmove(filter.uid, m_pState->discovery.uid, sizeof(filter.uid));
 
 		try
 		{
-			*m_pActionRequiredEvents = m_lib.getEvents(filter);
+			*pEvents = m_pState->lib.getEvents(filter);
 		}
 		catch (core::LibraryException &)
 		{
 			// don't throw
 		}
+		catch (...)
+		{
+			mutex_unlock((OS_MUTEX *)&m_pState->lock);
+			throw;
+		}
+		m_pState->pActionRequiredEvents = std::move(pEvents);
 	}
-	return *m_pActionRequiredEvents;
+	mutex_unlock((OS_MUTEX *)&m_pState->lock);
+	// unlock
+	return *m_pState->pActionRequiredEvents;
 }
 
 std::string Device::getFormattedManufacturingDate(NVM_UINT16 manufacturingdate)
@@ -922,5 +956,95 @@ std::string Device::getFormattedManufacturingDate(NVM_UINT16 manufacturingdate)
 	return date_str.str();
 }
 
+namespace
+{
+std::string getUidIndexKey(const std::string &uid)
+{
+	std::string key(uid);
+	std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+	return key;
+}
+}
+
+Device *DeviceCollection::findByUid(const std::string &uid)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	buildIndexes();
+	return findFirst(m_uidIndex.find(getUidIndexKey(uid)));
+}
+
+Device *DeviceCollection::findByHandle(const NVM_UINT32 handle)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	buildIndexes();
+	return findFirst(m_handleIndex.find(handle));
+}
+
+Device *DeviceCollection::findByDeviceId(const std::string &deviceId)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	Device *pDevice = findByUid(deviceId);
+	if (!pDevice && !deviceId.empty() &&
+			deviceId.find_first_not_of("0123456789") == std::string::npos)
+	{
+		std::stringstream handleStr(deviceId);
+		NVM_UINT64 handle = 0;
+		handleStr >> handle;
+
+		// only an exact decimal handle string identifies the device
+		pDevice = findByHandle((NVM_UINT32)handle);
+		if (pDevice)
+		{
+			std::stringstream expected;
+			expected << pDevice->getDeviceHandle();
+			if (expected.str() != deviceId)
+			{
+				pDevice = NULL;
+			}
+		}
+	}
+
+	return pDevice;
+}
+
+bool DeviceCollection::containsSocket(const NVM_UINT16 socketId)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	buildIndexes();
+	return m_socketIndex.contains(socketId);
+}
+
+void DeviceCollection::itemsChanged()
+{
+	m_indexed = false;
+	m_uidIndex.clear();
+	m_handleIndex.clear();
+	m_socketIndex.clear();
+}
+
+void DeviceCollection::buildIndexes()
+{
+	if (!m_indexed)
+	{
+		for (size_t i = 0; i < m_collection.size(); i++)
+		{
+			Device &device = *(m_collection[i]);
+			m_uidIndex.add(getUidIndexKey(device.getUid()), i);
+			m_handleIndex.add(device.getDeviceHandle(), i);
+			m_socketIndex.add(device.getSocketId(), i);
+		}
+		m_indexed = true;
+	}
+}
+
+Device *DeviceCollection::findFirst(const std::vector<size_t> &positions)
+{
+	return positions.empty() ? NULL : m_collection[positions.front()].get();
+}
+
 }
 }
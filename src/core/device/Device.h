@@ -35,6 +35,7 @@
 #include <utility.h>
 #include <nvm_types.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <string/s_str.h>
@@ -85,9 +86,12 @@ class NVM_CORE_API Device
 public:
 	Device();
 	Device(NvmLibrary &lib, const device_discovery &discovery);
+	Device(NvmLibrary &lib, const device_discovery &discovery, const device_details &details);
 	virtual ~Device();
 	Device &operator=(const Device &other);
 	Device(const Device &other);
+	Device &operator=(Device &&other);
+	Device(Device &&other);
 
 	virtual Device *clone() const;
 
@@ -183,20 +187,55 @@ public:
 	virtual NVM_UINT32 ixpPropertyPlaceholder();
 
 private:
-	NvmLibrary &m_lib;
-	device_discovery m_discovery;
-	device_details *m_pDetails;
-	std::vector<event> *m_pActionRequiredEvents;
-	std::string m_deviceUid;
+	// copies share the state, so copying a Device never copies its details
+	struct DeviceState;
+	std::shared_ptr<DeviceState> m_pState;
 
 	const device_discovery &getDiscovery();
 	const device_details &getDetails();
 	const std::vector<event> &getEvents();
-	void copy(const Device &other);
 };
 
+/*
+ * Collection of devices indexed by UID, handle and socket. The indexes are
+ * built on the first lookup and dropped whenever devices are added or removed.
+ */
 class NVM_CORE_API DeviceCollection : public Collection<Device>
 {
+public:
+	DeviceCollection() : m_indexed(false) {}
+
+	/*
+	 * Returns the device with the UID (compared case-insensitively), or NULL.
+	 */
+	Device *findByUid(const std::string &uid);
+
+	/*
+	 * Returns the device with the handle, or NULL.
+	 */
+	Device *findByHandle(const NVM_UINT32 handle);
+
+	/*
+	 * Returns the device identified by either its UID or its decimal handle, or NULL.
+	 */
+	Device *findByDeviceId(const std::string &deviceId);
+
+	/*
+	 * Returns true if any device in the collection is on the socket.
+	 */
+	bool containsSocket(const NVM_UINT16 socketId);
+
+protected:
+	void itemsChanged();
+
+private:
+	bool m_indexed;
+	CollectionIndex<std::string> m_uidIndex;
+	CollectionIndex<NVM_UINT32> m_handleIndex;
+	CollectionIndex<NVM_UINT16> m_socketIndex;
+
+	void buildIndexes();
+	Device *findFirst(const std::vector<size_t> &positions);
 };
 
 }
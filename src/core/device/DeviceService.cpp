@@ -74,16 +74,44 @@ std::vector<std::string> core::device::DeviceService::getManageableUids()
 	return result;
 }
 
-core::device::DeviceCollection core::device::DeviceService::getAllDevices()
+core::device::DeviceCollection core::device::DeviceService::getAllDevices(
+		const bool prefetchDetails)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 	DeviceCollection result;
 
 	const std::vector<device_discovery> &discoveries = m_lib.getDevices();
+
+	// retrieve the details of every manageable device in one parallel call
+	// instead of one device at a time as each Device first needs them
+	std::map<std::string, struct device_details> details;
+	if (prefetchDetails)
+	{
+		std::vector<std::string> manageableUids;
+		for (size_t i = 0; i < discoveries.size(); i++)
+		{
+			if (discoveries[i].manageability == MANAGEMENT_VALIDCONFIG)
+			{
+				manageableUids.push_back(Helper::uidToString(discoveries[i].uid));
+			}
+		}
+		details = m_lib.getDevicesDetails(manageableUids);
+	}
+
 	for(size_t i = 0; i < discoveries.size(); i++)
 	{
-		Device device(m_lib, discoveries[i]);
-		result.push_back(device);
+		std::map<std::string, struct device_details>::const_iterator found =
+				details.find(Helper::uidToString(discoveries[i].uid));
+		if (found != details.end())
+		{
+			Device device(m_lib, discoveries[i], found->second);
+			result.push_back(device);
+		}
+		else
+		{
+			Device device(m_lib, discoveries[i]);
+			result.push_back(device);
+		}
 	}
 
 	return result;
@@ -124,28 +152,13 @@ std::string core::device::DeviceService::getUidForDeviceIdFromCollection(
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	std::string uid;
-
-	bool found = false;
-	for (size_t i = 0; i < devices.size(); i++)
-	{
-		Device &dev = devices[i];
-		std::stringstream handleStr;
-		handleStr << dev.getDeviceHandle();
-
-		if (deviceId == dev.getUid() || deviceId == handleStr.str())
-		{
-			uid = dev.getUid();
-			found = true;
-			break;
-		}
-	}
-
-	if (!found)
+	Device *pDevice = devices.findByDeviceId(deviceId);
+	if (!pDevice)
 	{
 		throw LibraryException(NVM_ERR_BADDEVICE);
 	}
 
+	std::string uid = pDevice->getUid();
 	return uid;
 }
 
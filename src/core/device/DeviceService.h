@@ -49,7 +49,7 @@ public:
 	virtual std::vector<std::string> getAllUids();
 	virtual std::vector<std::string> getManageableUids();
 	virtual std::vector<std::string> getUidsForDeviceIds(const std::vector<std::string> &deviceIds);
-	virtual DeviceCollection getAllDevices();
+	virtual DeviceCollection getAllDevices(const bool prefetchDetails = false);
 	virtual Result<Device> getDevice(std::string uid);
 	virtual std::string getFirmwareApiVersionByUid(const std::string &deviceUid);
 	virtual NVM_UINT32 getHandleByUid(const std::string &deviceUid);
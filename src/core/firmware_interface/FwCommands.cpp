@@ -29,7 +29,6 @@
 #include "firmware_interface/fis_commands.h"
 #include "firmware_interface/fw_command_printer.h"
 #include "fis_types.h"
-#include "sstream"
 #include <cstring>
 #include <cstdlib>
 #include <stdio.h>
@@ -73,63 +72,90 @@ FwCommands::~FwCommands()
 }
 
 enum return_code FwCommands::fwGetPayload_IdentifyDimm(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_IdentifyDimm(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_IdentifyDimm(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_identify_dimm_result result = m_wrapper.FwcmdAllocIdentifyDimm(handle);
+	struct fwcmd_identify_dimm_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetIdentifyDimmInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_IdentifyDimm(result.p_data);
+		fwPayloadFormat_IdentifyDimm(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeIdentifyDimm(&result);
+	m_wrapper.FwcmdFreeIdentifyDimmData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_IdentifyDimmCharacteristics(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_IdentifyDimmCharacteristics(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_IdentifyDimmCharacteristics(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_identify_dimm_characteristics_result result = m_wrapper.FwcmdAllocIdentifyDimmCharacteristics(handle);
+	struct fwcmd_identify_dimm_characteristics_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetIdentifyDimmCharacteristicsInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_IdentifyDimmCharacteristics(result.p_data);
+		fwPayloadFormat_IdentifyDimmCharacteristics(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeIdentifyDimmCharacteristics(&result);
+	m_wrapper.FwcmdFreeIdentifyDimmCharacteristicsData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_GetSecurityState(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_GetSecurityState(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_GetSecurityState(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_get_security_state_result result = m_wrapper.FwcmdAllocGetSecurityState(handle);
+	struct fwcmd_get_security_state_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetGetSecurityStateInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_GetSecurityState(result.p_data);
+		fwPayloadFormat_GetSecurityState(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeGetSecurityState(&result);
+	m_wrapper.FwcmdFreeGetSecurityStateData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_SetPassphrase(unsigned int handle, const char current_passphrase[33], const char new_passphrase[33], std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_SetPassphrase(handle, current_passphrase, new_passphrase, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_SetPassphrase(unsigned int handle, const char current_passphrase[33], const char new_passphrase[33], FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -147,6 +173,12 @@ enum return_code FwCommands::fwGetPayload_SetPassphrase(unsigned int handle, con
 }
 
 enum return_code FwCommands::fwGetPayload_DisablePassphrase(unsigned int handle, const char current_passphrase[33], std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_DisablePassphrase(handle, current_passphrase, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_DisablePassphrase(unsigned int handle, const char current_passphrase[33], FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -164,6 +196,12 @@ enum return_code FwCommands::fwGetPayload_DisablePassphrase(unsigned int handle,
 }
 
 enum return_code FwCommands::fwGetPayload_UnlockUnit(unsigned int handle, const char current_passphrase[33], std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_UnlockUnit(handle, current_passphrase, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_UnlockUnit(unsigned int handle, const char current_passphrase[33], FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -181,6 +219,12 @@ enum return_code FwCommands::fwGetPayload_UnlockUnit(unsigned int handle, const
 }
 
 enum return_code FwCommands::fwGetPayload_SecureErase(unsigned int handle, const char current_passphrase[33], std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_SecureErase(handle, current_passphrase, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_SecureErase(unsigned int handle, const char current_passphrase[33], FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -198,6 +242,12 @@ enum return_code FwCommands::fwGetPayload_SecureErase(unsigned int handle, const
 }
 
 enum return_code FwCommands::fwGetPayload_FreezeLock(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_FreezeLock(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_FreezeLock(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -215,120 +265,168 @@ enum return_code FwCommands::fwGetPayload_FreezeLock(unsigned int handle, std::s
 }
 
 enum return_code FwCommands::fwGetPayload_GetAlarmThreshold(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_GetAlarmThreshold(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_GetAlarmThreshold(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_get_alarm_threshold_result result = m_wrapper.FwcmdAllocGetAlarmThreshold(handle);
+	struct fwcmd_get_alarm_threshold_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetGetAlarmThresholdInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_GetAlarmThreshold(result.p_data);
+		fwPayloadFormat_GetAlarmThreshold(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeGetAlarmThreshold(&result);
+	m_wrapper.FwcmdFreeGetAlarmThresholdData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_PowerManagementPolicy(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_PowerManagementPolicy(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_PowerManagementPolicy(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_power_management_policy_result result = m_wrapper.FwcmdAllocPowerManagementPolicy(handle);
+	struct fwcmd_power_management_policy_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetPowerManagementPolicyInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_PowerManagementPolicy(result.p_data);
+		fwPayloadFormat_PowerManagementPolicy(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreePowerManagementPolicy(&result);
+	m_wrapper.FwcmdFreePowerManagementPolicyData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_DieSparingPolicy(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_DieSparingPolicy(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_DieSparingPolicy(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_die_sparing_policy_result result = m_wrapper.FwcmdAllocDieSparingPolicy(handle);
+	struct fwcmd_die_sparing_policy_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetDieSparingPolicyInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_DieSparingPolicy(result.p_data);
+		fwPayloadFormat_DieSparingPolicy(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeDieSparingPolicy(&result);
+	m_wrapper.FwcmdFreeDieSparingPolicyData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_AddressRangeScrub(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_AddressRangeScrub(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_AddressRangeScrub(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_address_range_scrub_result result = m_wrapper.FwcmdAllocAddressRangeScrub(handle);
+	struct fwcmd_address_range_scrub_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetAddressRangeScrubInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_AddressRangeScrub(result.p_data);
+		fwPayloadFormat_AddressRangeScrub(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeAddressRangeScrub(&result);
+	m_wrapper.FwcmdFreeAddressRangeScrubData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_OptionalConfigurationDataPolicy(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_OptionalConfigurationDataPolicy(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_OptionalConfigurationDataPolicy(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_optional_configuration_data_policy_result result = m_wrapper.FwcmdAllocOptionalConfigurationDataPolicy(handle);
+	struct fwcmd_optional_configuration_data_policy_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetOptionalConfigurationDataPolicyInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_OptionalConfigurationDataPolicy(result.p_data);
+		fwPayloadFormat_OptionalConfigurationDataPolicy(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeOptionalConfigurationDataPolicy(&result);
+	m_wrapper.FwcmdFreeOptionalConfigurationDataPolicyData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_PmonRegisters(unsigned int handle, const unsigned short pmon_retreive_mask, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_PmonRegisters(handle, pmon_retreive_mask, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_PmonRegisters(unsigned int handle, const unsigned short pmon_retreive_mask, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_pmon_registers_result result = m_wrapper.FwcmdAllocPmonRegisters(handle, pmon_retreive_mask);
+	struct fwcmd_pmon_registers_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetPmonRegistersInto(handle, pmon_retreive_mask, &data, &error))
 	{
-		resultString += fwPayloadToString_PmonRegisters(result.p_data);
+		fwPayloadFormat_PmonRegisters(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreePmonRegisters(&result);
+	m_wrapper.FwcmdFreePmonRegistersData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_SetAlarmThreshold(unsigned int handle, const unsigned char enable, const unsigned short peak_power_budget, const unsigned short avg_power_budget, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_SetAlarmThreshold(handle, enable, peak_power_budget, avg_power_budget, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_SetAlarmThreshold(unsigned int handle, const unsigned char enable, const unsigned short peak_power_budget, const unsigned short avg_power_budget, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -346,348 +444,480 @@ enum return_code FwCommands::fwGetPayload_SetAlarmThreshold(unsigned int handle,
 }
 
 enum return_code FwCommands::fwGetPayload_SystemTime(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_SystemTime(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_SystemTime(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_system_time_result result = m_wrapper.FwcmdAllocSystemTime(handle);
+	struct fwcmd_system_time_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetSystemTimeInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_SystemTime(result.p_data);
+		fwPayloadFormat_SystemTime(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeSystemTime(&result);
+	m_wrapper.FwcmdFreeSystemTimeData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_PlatformConfigData(unsigned int handle, const unsigned char partition_id, const unsigned char command_option, const unsigned int offset, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_PlatformConfigData(handle, partition_id, command_option, offset, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_PlatformConfigData(unsigned int handle, const unsigned char partition_id, const unsigned char command_option, const unsigned int offset, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_platform_config_data_result result = m_wrapper.FwcmdAllocPlatformConfigData(handle, partition_id, command_option, offset);
+	struct fwcmd_platform_config_data_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetPlatformConfigDataInto(handle, partition_id, command_option, offset, &data, &error))
 	{
-		resultString += fwPayloadToString_Custom_PlatformConfigData(result.p_data);
+		fwPayloadFormat_Custom_PlatformConfigData(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreePlatformConfigData(&result);
+	m_wrapper.FwcmdFreePlatformConfigDataData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_NamespaceLabels(unsigned int handle, const unsigned char partition_id, const unsigned char command_option, const unsigned int offset, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_NamespaceLabels(handle, partition_id, command_option, offset, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_NamespaceLabels(unsigned int handle, const unsigned char partition_id, const unsigned char command_option, const unsigned int offset, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_namespace_labels_result result = m_wrapper.FwcmdAllocNamespaceLabels(handle, partition_id, command_option, offset);
+	struct fwcmd_namespace_labels_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetNamespaceLabelsInto(handle, partition_id, command_option, offset, &data, &error))
 	{
-		resultString += fwPayloadToString_NamespaceLabels(result.p_data);
+		fwPayloadFormat_NamespaceLabels(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeNamespaceLabels(&result);
+	m_wrapper.FwcmdFreeNamespaceLabelsData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_DimmPartitionInfo(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_DimmPartitionInfo(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_DimmPartitionInfo(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_dimm_partition_info_result result = m_wrapper.FwcmdAllocDimmPartitionInfo(handle);
+	struct fwcmd_dimm_partition_info_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetDimmPartitionInfoInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_DimmPartitionInfo(result.p_data);
+		fwPayloadFormat_DimmPartitionInfo(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeDimmPartitionInfo(&result);
+	m_wrapper.FwcmdFreeDimmPartitionInfoData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_FwDebugLogLevel(unsigned int handle, const unsigned char log_id, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_FwDebugLogLevel(handle, log_id, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_FwDebugLogLevel(unsigned int handle, const unsigned char log_id, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_fw_debug_log_level_result result = m_wrapper.FwcmdAllocFwDebugLogLevel(handle, log_id);
+	struct fwcmd_fw_debug_log_level_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetFwDebugLogLevelInto(handle, log_id, &data, &error))
 	{
-		resultString += fwPayloadToString_FwDebugLogLevel(result.p_data);
+		fwPayloadFormat_FwDebugLogLevel(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeFwDebugLogLevel(&result);
+	m_wrapper.FwcmdFreeFwDebugLogLevelData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_FwLoadFlag(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_FwLoadFlag(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_FwLoadFlag(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_fw_load_flag_result result = m_wrapper.FwcmdAllocFwLoadFlag(handle);
+	struct fwcmd_fw_load_flag_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetFwLoadFlagInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_FwLoadFlag(result.p_data);
+		fwPayloadFormat_FwLoadFlag(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeFwLoadFlag(&result);
+	m_wrapper.FwcmdFreeFwLoadFlagData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_ConfigLockdown(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_ConfigLockdown(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_ConfigLockdown(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_config_lockdown_result result = m_wrapper.FwcmdAllocConfigLockdown(handle);
+	struct fwcmd_config_lockdown_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetConfigLockdownInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_ConfigLockdown(result.p_data);
+		fwPayloadFormat_ConfigLockdown(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeConfigLockdown(&result);
+	m_wrapper.FwcmdFreeConfigLockdownData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_DdrtIoInitInfo(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_DdrtIoInitInfo(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_DdrtIoInitInfo(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_ddrt_io_init_info_result result = m_wrapper.FwcmdAllocDdrtIoInitInfo(handle);
+	struct fwcmd_ddrt_io_init_info_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetDdrtIoInitInfoInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_DdrtIoInitInfo(result.p_data);
+		fwPayloadFormat_DdrtIoInitInfo(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeDdrtIoInitInfo(&result);
+	m_wrapper.FwcmdFreeDdrtIoInitInfoData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_GetSupportedSkuFeatures(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_GetSupportedSkuFeatures(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_GetSupportedSkuFeatures(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_get_supported_sku_features_result result = m_wrapper.FwcmdAllocGetSupportedSkuFeatures(handle);
+	struct fwcmd_get_supported_sku_features_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetGetSupportedSkuFeaturesInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_GetSupportedSkuFeatures(result.p_data);
+		fwPayloadFormat_GetSupportedSkuFeatures(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeGetSupportedSkuFeatures(&result);
+	m_wrapper.FwcmdFreeGetSupportedSkuFeaturesData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_EnableDimm(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_EnableDimm(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_EnableDimm(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_enable_dimm_result result = m_wrapper.FwcmdAllocEnableDimm(handle);
+	struct fwcmd_enable_dimm_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetEnableDimmInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_EnableDimm(result.p_data);
+		fwPayloadFormat_EnableDimm(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeEnableDimm(&result);
+	m_wrapper.FwcmdFreeEnableDimmData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_SmartHealthInfo(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_SmartHealthInfo(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_SmartHealthInfo(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_smart_health_info_result result = m_wrapper.FwcmdAllocSmartHealthInfo(handle);
+	struct fwcmd_smart_health_info_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetSmartHealthInfoInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_SmartHealthInfo(result.p_data);
+		fwPayloadFormat_SmartHealthInfo(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeSmartHealthInfo(&result);
+	m_wrapper.FwcmdFreeSmartHealthInfoData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_FirmwareImageInfo(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_FirmwareImageInfo(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_FirmwareImageInfo(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_firmware_image_info_result result = m_wrapper.FwcmdAllocFirmwareImageInfo(handle);
+	struct fwcmd_firmware_image_info_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetFirmwareImageInfoInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_FirmwareImageInfo(result.p_data);
+		fwPayloadFormat_FirmwareImageInfo(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeFirmwareImageInfo(&result);
+	m_wrapper.FwcmdFreeFirmwareImageInfoData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_FirmwareDebugLog(unsigned int handle, const unsigned char log_action, const unsigned int log_page_offset, const unsigned char log_id, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_FirmwareDebugLog(handle, log_action, log_page_offset, log_id, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_FirmwareDebugLog(unsigned int handle, const unsigned char log_action, const unsigned int log_page_offset, const unsigned char log_id, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_firmware_debug_log_result result = m_wrapper.FwcmdAllocFirmwareDebugLog(handle, log_action, log_page_offset, log_id);
+	struct fwcmd_firmware_debug_log_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetFirmwareDebugLogInto(handle, log_action, log_page_offset, log_id, &data, &error))
 	{
-		resultString += fwPayloadToString_FirmwareDebugLog(result.p_data);
+		fwPayloadFormat_FirmwareDebugLog(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeFirmwareDebugLog(&result);
+	m_wrapper.FwcmdFreeFirmwareDebugLogData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_MemoryInfoPage0(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_MemoryInfoPage0(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_MemoryInfoPage0(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_memory_info_page_0_result result = m_wrapper.FwcmdAllocMemoryInfoPage0(handle);
+	struct fwcmd_memory_info_page_0_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetMemoryInfoPage0Into(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_MemoryInfoPage0(result.p_data);
+		fwPayloadFormat_MemoryInfoPage0(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeMemoryInfoPage0(&result);
+	m_wrapper.FwcmdFreeMemoryInfoPage0Data(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_MemoryInfoPage1(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_MemoryInfoPage1(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_MemoryInfoPage1(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_memory_info_page_1_result result = m_wrapper.FwcmdAllocMemoryInfoPage1(handle);
+	struct fwcmd_memory_info_page_1_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetMemoryInfoPage1Into(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_MemoryInfoPage1(result.p_data);
+		fwPayloadFormat_MemoryInfoPage1(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeMemoryInfoPage1(&result);
+	m_wrapper.FwcmdFreeMemoryInfoPage1Data(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_MemoryInfoPage3(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_MemoryInfoPage3(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_MemoryInfoPage3(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_memory_info_page_3_result result = m_wrapper.FwcmdAllocMemoryInfoPage3(handle);
+	struct fwcmd_memory_info_page_3_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetMemoryInfoPage3Into(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_MemoryInfoPage3(result.p_data);
+		fwPayloadFormat_MemoryInfoPage3(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeMemoryInfoPage3(&result);
+	m_wrapper.FwcmdFreeMemoryInfoPage3Data(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_LongOperationStatus(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_LongOperationStatus(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_LongOperationStatus(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_long_operation_status_result result = m_wrapper.FwcmdAllocLongOperationStatus(handle);
+	struct fwcmd_long_operation_status_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetLongOperationStatusInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_LongOperationStatus(result.p_data);
+		fwPayloadFormat_LongOperationStatus(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeLongOperationStatus(&result);
+	m_wrapper.FwcmdFreeLongOperationStatusData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_Bsr(unsigned int handle, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_Bsr(handle, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_Bsr(unsigned int handle, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
-	struct fwcmd_bsr_result result = m_wrapper.FwcmdAllocBsr(handle);
+	struct fwcmd_bsr_data data;
+	struct fwcmd_error_code error;
 
-	if (result.success)
+	if (m_wrapper.FwcmdGetBsrInto(handle, &data, &error))
 	{
-		resultString += fwPayloadToString_Bsr(result.p_data);
+		fwPayloadFormat_Bsr(&data, formatter);
 	}
 	else
 	{
-		rc = convertFwcmdErrorCodeToNvmErrorCode(result.error_code);
+		rc = convertFwcmdErrorCodeToNvmErrorCode(error);
 	}
 
-	m_wrapper.FwcmdFreeBsr(&result);
+	m_wrapper.FwcmdFreeBsrData(&data);
 	return rc;
 }
 
 enum return_code FwCommands::fwGetPayload_Format(unsigned int handle, const unsigned char fill_pattern, const unsigned char preserve_pdas_write_count, std::string &resultString)
+{
+	FwPayloadFormatter formatter(resultString);
+	return fwGetPayload_Format(handle, fill_pattern, preserve_pdas_write_count, formatter);
+}
+
+enum return_code FwCommands::fwGetPayload_Format(unsigned int handle, const unsigned char fill_pattern, const unsigned char preserve_pdas_write_count, FwPayloadFormatter &formatter)
 {
 	enum return_code rc = NVM_SUCCESS;
 
@@ -704,964 +934,1897 @@ enum return_code FwCommands::fwGetPayload_Format(unsigned int handle, const unsi
 	return rc;
 }
 
+void FwCommands::fwPayloadFormat_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Identify Dimm");
+	formatter.heading("Identify Dimm");
+	fwPayloadMembersFormat_IdentifyDimm(p_data, formatter);
+
+	formatter.endPayload();
+}
+
 std::string FwCommands::fwPayloadToString_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data)
 {
-	std::stringstream result;
-	result << "\nIdentify Dimm:" << "\n";
-	result << fwPayloadFieldsToString_IdentifyDimm(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_IdentifyDimm(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_IdentifyDimmCharacteristics(const struct fwcmd_identify_dimm_characteristics_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Identify Dimm Characteristics");
+	formatter.heading("Identify Dimm Characteristics");
+	fwPayloadMembersFormat_IdentifyDimmCharacteristics(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_IdentifyDimmCharacteristics(const struct fwcmd_identify_dimm_characteristics_data *p_data)
 {
-	std::stringstream result;
-	result << "\nIdentify Dimm Characteristics:" << "\n";
-	result << fwPayloadFieldsToString_IdentifyDimmCharacteristics(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_IdentifyDimmCharacteristics(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_GetSecurityState(const struct fwcmd_get_security_state_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Get Security State");
+	formatter.heading("Get Security State");
+	fwPayloadMembersFormat_GetSecurityState(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_GetSecurityState(const struct fwcmd_get_security_state_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Security State:" << "\n";
-	result << fwPayloadFieldsToString_GetSecurityState(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_GetSecurityState(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_GetAlarmThreshold(const struct fwcmd_get_alarm_threshold_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Get Alarm Threshold");
+	formatter.heading("Get Alarm Threshold");
+	fwPayloadMembersFormat_GetAlarmThreshold(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_GetAlarmThreshold(const struct fwcmd_get_alarm_threshold_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Alarm Threshold:" << "\n";
-	result << fwPayloadFieldsToString_GetAlarmThreshold(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_GetAlarmThreshold(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_PowerManagementPolicy(const struct fwcmd_power_management_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Power Management Policy");
+	formatter.heading("Power Management Policy");
+	fwPayloadMembersFormat_PowerManagementPolicy(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_PowerManagementPolicy(const struct fwcmd_power_management_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPower Management Policy:" << "\n";
-	result << fwPayloadFieldsToString_PowerManagementPolicy(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_PowerManagementPolicy(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_DieSparingPolicy(const struct fwcmd_die_sparing_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Die Sparing Policy");
+	formatter.heading("Die Sparing Policy");
+	fwPayloadMembersFormat_DieSparingPolicy(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_DieSparingPolicy(const struct fwcmd_die_sparing_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDie Sparing Policy:" << "\n";
-	result << fwPayloadFieldsToString_DieSparingPolicy(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_DieSparingPolicy(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_AddressRangeScrub(const struct fwcmd_address_range_scrub_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Address Range Scrub");
+	formatter.heading("Address Range Scrub");
+	fwPayloadMembersFormat_AddressRangeScrub(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_AddressRangeScrub(const struct fwcmd_address_range_scrub_data *p_data)
 {
-	std::stringstream result;
-	result << "\nAddress Range Scrub:" << "\n";
-	result << fwPayloadFieldsToString_AddressRangeScrub(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_AddressRangeScrub(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFormat_OptionalConfigurationDataPolicy(const struct fwcmd_optional_configuration_data_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Optional Configuration Data Policy");
+	formatter.heading("Optional Configuration Data Policy");
+	fwPayloadMembersFormat_OptionalConfigurationDataPolicy(p_data, formatter);
+
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_OptionalConfigurationDataPolicy(const struct fwcmd_optional_configuration_data_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nOptional Configuration Data Policy:" << "\n";
-	result << fwPayloadFieldsToString_OptionalConfigurationDataPolicy(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_OptionalConfigurationDataPolicy(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_PmonRegisters(const struct fwcmd_pmon_registers_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Pmon Registers");
+	formatter.heading("Pmon Registers");
+	fwPayloadMembersFormat_PmonRegisters(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_PmonRegisters(const struct fwcmd_pmon_registers_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPmon Registers:" << "\n";
-	result << fwPayloadFieldsToString_PmonRegisters(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_PmonRegisters(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_SystemTime(const struct fwcmd_system_time_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("System Time");
+	formatter.heading("System Time");
+	fwPayloadMembersFormat_SystemTime(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_SystemTime(const struct fwcmd_system_time_data *p_data)
 {
-	std::stringstream result;
-	result << "\nSystem Time:" << "\n";
-	result << fwPayloadFieldsToString_SystemTime(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_SystemTime(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_DeviceIdentificationV1(const struct fwcmd_device_identification_v1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Device Identification V1");
+	formatter.heading("Platform Config Data Device Identification V1");
+	fwPayloadMembersFormat_DeviceIdentificationV1(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_DeviceIdentificationV1(const struct fwcmd_device_identification_v1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDevice Identification V1:" << "\n";
-	result << fwPayloadFieldsToString_DeviceIdentificationV1(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_DeviceIdentificationV1(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_DeviceIdentificationV2(const struct fwcmd_device_identification_v2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Device Identification V2");
+	formatter.heading("Platform Config Data Device Identification V2");
+	fwPayloadMembersFormat_DeviceIdentificationV2(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_DeviceIdentificationV2(const struct fwcmd_device_identification_v2_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDevice Identification V2:" << "\n";
-	result << fwPayloadFieldsToString_DeviceIdentificationV2(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_DeviceIdentificationV2(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_IdInfoTable(const struct fwcmd_id_info_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Id Info Table");
+	formatter.heading("Platform Config Data Identification Information Table");
+	fwPayloadMembersFormat_IdInfoTable(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_IdInfoTable(const struct fwcmd_id_info_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nId Info Table:" << "\n";
-	result << fwPayloadFieldsToString_IdInfoTable(p_data);
-
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_IdInfoTable(p_data, formatter);
+	return result;
 }
 
-std::string FwCommands::fwPayloadToString_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data)
+void FwCommands::fwPayloadFormat_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data,
+	FwPayloadFormatter &formatter)
 {
-	std::stringstream result;
-	result << "\nInterleave Information Table:" << "\n";
-	result << fwPayloadFieldsToString_InterleaveInformationTable(p_data);
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Interleave Information Table");
+	formatter.heading("Platform Config Data Interleave Information Table");
+	fwPayloadMembersFormat_InterleaveInformationTable(p_data, formatter);
 
 	for (int i = 0; i < p_data->id_info_table_count; i++)
 	{
-		result << fwPayloadToString_IdInfoTable(&p_data->id_info_table[i]);
+		fwPayloadFormat_IdInfoTable(&p_data->id_info_table[i], formatter);
 	}
 
-	return result.str();
+	formatter.endPayload();
 }
 
-std::string FwCommands::fwPayloadToString_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data)
+std::string FwCommands::fwPayloadToString_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data)
+{
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_InterleaveInformationTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data,
+	FwPayloadFormatter &formatter)
 {
-	std::stringstream result;
-	result << "\nPartition Size Change Table:" << "\n";
-	result << fwPayloadFieldsToString_PartitionSizeChangeTable(p_data);
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Partition Size Change Table");
+	formatter.heading("Platform Config Data Partition Size Change Table");
+	fwPayloadMembersFormat_PartitionSizeChangeTable(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
-std::string FwCommands::fwPayloadToString_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data)
+std::string FwCommands::fwPayloadToString_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data)
+{
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_PartitionSizeChangeTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data,
+	FwPayloadFormatter &formatter)
 {
-	std::stringstream result;
-	result << "\nCurrent Config Table:" << "\n";
-	result << fwPayloadFieldsToString_CurrentConfigTable(p_data);
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Current Config Table");
+	formatter.heading("Platform Config Data Current Config Table");
+	fwPayloadMembersFormat_CurrentConfigTable(p_data, formatter);
 
 	for (int i = 0; i < p_data->interleave_information_table_count; i++)
 	{
-		result << fwPayloadToString_InterleaveInformationTable(&p_data->interleave_information_table[i]);
+		fwPayloadFormat_InterleaveInformationTable(&p_data->interleave_information_table[i], formatter);
 	}
-	return result.str();
+	formatter.endPayload();
 }
 
-std::string FwCommands::fwPayloadToString_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data)
+std::string FwCommands::fwPayloadToString_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nConfig Input Table:" << "\n";
-	result << fwPayloadFieldsToString_ConfigInputTable(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_CurrentConfigTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Config Input Table");
+	formatter.heading("Platform Config Data Config Input Table");
+	fwPayloadMembersFormat_ConfigInputTable(p_data, formatter);
 
 	for (int i = 0; i < p_data->interleave_information_table_count; i++)
 	{
-		result << fwPayloadToString_InterleaveInformationTable(&p_data->interleave_information_table[i]);
+		fwPayloadFormat_InterleaveInformationTable(&p_data->interleave_information_table[i], formatter);
 	}
 	for (int i = 0; i < p_data->partition_size_change_table_count; i++)
 	{
-		result << fwPayloadToString_PartitionSizeChangeTable(&p_data->partition_size_change_table[i]);
+		fwPayloadFormat_PartitionSizeChangeTable(&p_data->partition_size_change_table[i], formatter);
 	}
-	return result.str();
+	formatter.endPayload();
 }
 
-std::string FwCommands::fwPayloadToString_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data)
+std::string FwCommands::fwPayloadToString_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data)
+{
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_ConfigInputTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data,
+	FwPayloadFormatter &formatter)
 {
-	std::stringstream result;
-	result << "\nConfig Output Table:" << "\n";
-	result << fwPayloadFieldsToString_ConfigOutputTable(p_data);
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Config Output Table");
+	formatter.heading("Platform Config Data Config Output Table");
+	fwPayloadMembersFormat_ConfigOutputTable(p_data, formatter);
 
 	for (int i = 0; i < p_data->interleave_information_table_count; i++)
 	{
-		result << fwPayloadToString_InterleaveInformationTable(&p_data->interleave_information_table[i]);
+		fwPayloadFormat_InterleaveInformationTable(&p_data->interleave_information_table[i], formatter);
 	}
 	for (int i = 0; i < p_data->partition_size_change_table_count; i++)
 	{
-		result << fwPayloadToString_PartitionSizeChangeTable(&p_data->partition_size_change_table[i]);
+		fwPayloadFormat_PartitionSizeChangeTable(&p_data->partition_size_change_table[i], formatter);
 	}
-	return result.str();
+	formatter.endPayload();
+}
+
+std::string FwCommands::fwPayloadToString_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data)
+{
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_ConfigOutputTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_PlatformConfigData(const struct fwcmd_platform_config_data_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Platform Config Data");
+	formatter.heading("Platform Config Data Configuration Header Table");
+	fwPayloadMembersFormat_PlatformConfigData(p_data, formatter);
+
+	fwPayloadFormat_CurrentConfigTable(&p_data->current_config_table, formatter);
+	fwPayloadFormat_ConfigInputTable(&p_data->config_input_table, formatter);
+	fwPayloadFormat_ConfigOutputTable(&p_data->config_output_table, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_PlatformConfigData(const struct fwcmd_platform_config_data_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data:" << "\n";
-	result << fwPayloadFieldsToString_PlatformConfigData(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_PlatformConfigData(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_NsIndex(const struct fwcmd_ns_index_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Ns Index");
+	formatter.heading("Ns Index");
+	fwPayloadMembersFormat_NsIndex(p_data, formatter);
 
-	result << fwPayloadToString_CurrentConfigTable(&p_data->current_config_table);
-	result << fwPayloadToString_ConfigInputTable(&p_data->config_input_table);
-	result << fwPayloadToString_ConfigOutputTable(&p_data->config_output_table);
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_NsIndex(const struct fwcmd_ns_index_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Index:" << "\n";
-	result << fwPayloadFieldsToString_NsIndex(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_NsIndex(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_NsLabel(const struct fwcmd_ns_label_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Ns Label");
+	formatter.heading("Ns Label");
+	fwPayloadMembersFormat_NsLabel(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_NsLabel(const struct fwcmd_ns_label_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label:" << "\n";
-	result << fwPayloadFieldsToString_NsLabel(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_NsLabel(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFormat_NsLabelV11(const struct fwcmd_ns_label_v1_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Ns Label V1 1");
+	formatter.heading("Ns Label V1 1");
+	fwPayloadMembersFormat_NsLabelV11(p_data, formatter);
+
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_NsLabelV11(const struct fwcmd_ns_label_v1_1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label V1 1:" << "\n";
-	result << fwPayloadFieldsToString_NsLabelV11(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_NsLabelV11(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_NsLabelV12(const struct fwcmd_ns_label_v1_2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Ns Label V1 2");
+	formatter.heading("Ns Label V1 2");
+	fwPayloadMembersFormat_NsLabelV12(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_NsLabelV12(const struct fwcmd_ns_label_v1_2_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label V1 2:" << "\n";
-	result << fwPayloadFieldsToString_NsLabelV12(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_NsLabelV12(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_NamespaceLabels(const struct fwcmd_namespace_labels_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Namespace Labels");
+	formatter.heading("Namespace Labels");
+	fwPayloadMembersFormat_NamespaceLabels(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_NamespaceLabels(const struct fwcmd_namespace_labels_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNamespace Labels:" << "\n";
-	result << fwPayloadFieldsToString_NamespaceLabels(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_NamespaceLabels(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFormat_DimmPartitionInfo(const struct fwcmd_dimm_partition_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Dimm Partition Info");
+	formatter.heading("Dimm Partition Info");
+	fwPayloadMembersFormat_DimmPartitionInfo(p_data, formatter);
+
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_DimmPartitionInfo(const struct fwcmd_dimm_partition_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDimm Partition Info:" << "\n";
-	result << fwPayloadFieldsToString_DimmPartitionInfo(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_DimmPartitionInfo(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFormat_FwDebugLogLevel(const struct fwcmd_fw_debug_log_level_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Fw Debug Log Level");
+	formatter.heading("Fw Debug Log Level");
+	fwPayloadMembersFormat_FwDebugLogLevel(p_data, formatter);
+
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_FwDebugLogLevel(const struct fwcmd_fw_debug_log_level_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFw Debug Log Level:" << "\n";
-	result << fwPayloadFieldsToString_FwDebugLogLevel(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_FwDebugLogLevel(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_FwLoadFlag(const struct fwcmd_fw_load_flag_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Fw Load Flag");
+	formatter.heading("Fw Load Flag");
+	fwPayloadMembersFormat_FwLoadFlag(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_FwLoadFlag(const struct fwcmd_fw_load_flag_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFw Load Flag:" << "\n";
-	result << fwPayloadFieldsToString_FwLoadFlag(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_FwLoadFlag(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_ConfigLockdown(const struct fwcmd_config_lockdown_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Config Lockdown");
+	formatter.heading("Config Lockdown");
+	fwPayloadMembersFormat_ConfigLockdown(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_ConfigLockdown(const struct fwcmd_config_lockdown_data *p_data)
 {
-	std::stringstream result;
-	result << "\nConfig Lockdown:" << "\n";
-	result << fwPayloadFieldsToString_ConfigLockdown(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_ConfigLockdown(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_DdrtIoInitInfo(const struct fwcmd_ddrt_io_init_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Ddrt Io Init Info");
+	formatter.heading("Ddrt Io Init Info");
+	fwPayloadMembersFormat_DdrtIoInitInfo(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_DdrtIoInitInfo(const struct fwcmd_ddrt_io_init_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDdrt Io Init Info:" << "\n";
-	result << fwPayloadFieldsToString_DdrtIoInitInfo(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_DdrtIoInitInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_GetSupportedSkuFeatures(const struct fwcmd_get_supported_sku_features_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Get Supported Sku Features");
+	formatter.heading("Get Supported Sku Features");
+	fwPayloadMembersFormat_GetSupportedSkuFeatures(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_GetSupportedSkuFeatures(const struct fwcmd_get_supported_sku_features_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Supported Sku Features:" << "\n";
-	result << fwPayloadFieldsToString_GetSupportedSkuFeatures(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_GetSupportedSkuFeatures(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_EnableDimm(const struct fwcmd_enable_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Enable Dimm");
+	formatter.heading("Enable Dimm");
+	fwPayloadMembersFormat_EnableDimm(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_EnableDimm(const struct fwcmd_enable_dimm_data *p_data)
 {
-	std::stringstream result;
-	result << "\nEnable Dimm:" << "\n";
-	result << fwPayloadFieldsToString_EnableDimm(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_EnableDimm(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Smart Health Info");
+	formatter.heading("Smart Health Info");
+	fwPayloadMembersFormat_SmartHealthInfo(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nSmart Health Info:" << "\n";
-	result << fwPayloadFieldsToString_SmartHealthInfo(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_SmartHealthInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_FirmwareImageInfo(const struct fwcmd_firmware_image_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Firmware Image Info");
+	formatter.heading("Firmware Image Info");
+	fwPayloadMembersFormat_FirmwareImageInfo(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_FirmwareImageInfo(const struct fwcmd_firmware_image_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFirmware Image Info:" << "\n";
-	result << fwPayloadFieldsToString_FirmwareImageInfo(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_FirmwareImageInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_FirmwareDebugLog(const struct fwcmd_firmware_debug_log_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Firmware Debug Log");
+	formatter.heading("Firmware Debug Log");
+	fwPayloadMembersFormat_FirmwareDebugLog(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_FirmwareDebugLog(const struct fwcmd_firmware_debug_log_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFirmware Debug Log:" << "\n";
-	result << fwPayloadFieldsToString_FirmwareDebugLog(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_FirmwareDebugLog(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_MemoryInfoPage0(const struct fwcmd_memory_info_page_0_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Memory Info Page 0");
+	formatter.heading("Memory Info Page 0");
+	fwPayloadMembersFormat_MemoryInfoPage0(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_MemoryInfoPage0(const struct fwcmd_memory_info_page_0_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 0:" << "\n";
-	result << fwPayloadFieldsToString_MemoryInfoPage0(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_MemoryInfoPage0(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_MemoryInfoPage1(const struct fwcmd_memory_info_page_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Memory Info Page 1");
+	formatter.heading("Memory Info Page 1");
+	fwPayloadMembersFormat_MemoryInfoPage1(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_MemoryInfoPage1(const struct fwcmd_memory_info_page_1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 1:" << "\n";
-	result << fwPayloadFieldsToString_MemoryInfoPage1(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_MemoryInfoPage1(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_MemoryInfoPage3(const struct fwcmd_memory_info_page_3_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Memory Info Page 3");
+	formatter.heading("Memory Info Page 3");
+	fwPayloadMembersFormat_MemoryInfoPage3(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_MemoryInfoPage3(const struct fwcmd_memory_info_page_3_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 3:" << "\n";
-	result << fwPayloadFieldsToString_MemoryInfoPage3(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_MemoryInfoPage3(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFormat_LongOperationStatus(const struct fwcmd_long_operation_status_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Long Operation Status");
+	formatter.heading("Long Operation Status");
+	fwPayloadMembersFormat_LongOperationStatus(p_data, formatter);
+
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_LongOperationStatus(const struct fwcmd_long_operation_status_data *p_data)
 {
-	std::stringstream result;
-	result << "\nLong Operation Status:" << "\n";
-	result << fwPayloadFieldsToString_LongOperationStatus(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_LongOperationStatus(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFormat_Bsr(const struct fwcmd_bsr_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	// the text format has always repeated the name above the fields header
+	formatter.beginPayload("Bsr");
+	formatter.heading("Bsr");
+	fwPayloadMembersFormat_Bsr(p_data, formatter);
 
-	return result.str();
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadToString_Bsr(const struct fwcmd_bsr_data *p_data)
 {
-	std::stringstream result;
-	result << "\nBsr:" << "\n";
-	result << fwPayloadFieldsToString_Bsr(p_data);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_Bsr(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Identify Dimm");
+	fwPayloadMembersFormat_IdentifyDimm(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data)
 {
-	std::stringstream result;
-	result << "\nIdentify Dimm:" << "\n";
-	result << "VendorId: " << p_data->vendor_id << "\n";
-	result << "DeviceId: " << p_data->device_id << "\n";
-	result << "RevisionId: " << p_data->revision_id << "\n";
-	result << "InterfaceFormatCode: " << p_data->interface_format_code << "\n";
-	result << "FirmwareRevision: " << p_data->firmware_revision << "\n";
-	result << "ReservedOldApi: " << (int) p_data->reserved_old_api << "\n";
-	result << "FeatureSwRequiredMask: " << (int) p_data->feature_sw_required_mask << "\n";	result << "InvalidateBeforeBlockRead: " << p_data->feature_sw_required_mask_invalidate_before_block_read << "\n";
-	result << "ReadbackOfBwAddressRegisterRequiredBeforeUse: " << p_data->feature_sw_required_mask_readback_of_bw_address_register_required_before_use << "\n";
-
-	result << "NumberOfBlockWindows: " << p_data->number_of_block_windows << "\n";
-	result << "OffsetOfBlockModeControlRegion: " << p_data->offset_of_block_mode_control_region << "\n";
-	result << "RawCapacity: " << p_data->raw_capacity << "\n";
-	result << "Manufacturer: " << p_data->manufacturer << "\n";
-	result << "SerialNumber: " << p_data->serial_number << "\n";
-	result << "PartNumber: " << p_data->part_number << "\n";
-	result << "DimmSku: " << p_data->dimm_sku << "\n";	result << "MemoryModeEnabled: " << p_data->dimm_sku_memory_mode_enabled << "\n";
-	result << "StorageModeEnabled: " << p_data->dimm_sku_storage_mode_enabled << "\n";
-	result << "AppDirectModeEnabled: " << p_data->dimm_sku_app_direct_mode_enabled << "\n";
-	result << "DieSparingCapable: " << p_data->dimm_sku_die_sparing_capable << "\n";
-	result << "SoftProgrammableSku: " << p_data->dimm_sku_soft_programmable_sku << "\n";
-	result << "EncryptionEnabled: " << p_data->dimm_sku_encryption_enabled << "\n";
-
-	result << "InterfaceFormatCodeExtra: " << p_data->interface_format_code_extra << "\n";
-	result << "ApiVer: " << p_data->api_ver << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_IdentifyDimm(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_IdentifyDimmCharacteristics(const struct fwcmd_identify_dimm_characteristics_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Identify Dimm Characteristics");
+	fwPayloadMembersFormat_IdentifyDimmCharacteristics(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_IdentifyDimmCharacteristics(const struct fwcmd_identify_dimm_characteristics_data *p_data)
 {
-	std::stringstream result;
-	result << "\nIdentify Dimm Characteristics:" << "\n";
-	result << "ControllerTempShutdownThreshold: " << p_data->controller_temp_shutdown_threshold << "\n";
-	result << "MediaTempShutdownThreshold: " << p_data->media_temp_shutdown_threshold << "\n";
-	result << "ThrottlingStartThreshold: " << p_data->throttling_start_threshold << "\n";
-	result << "ThrottlingStopThreshold: " << p_data->throttling_stop_threshold << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_IdentifyDimmCharacteristics(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_GetSecurityState(const struct fwcmd_get_security_state_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Get Security State");
+	fwPayloadMembersFormat_GetSecurityState(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_GetSecurityState(const struct fwcmd_get_security_state_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Security State:" << "\n";
-	result << "SecurityState: " << (int) p_data->security_state << "\n";	result << "Enabled: " << p_data->security_state_enabled << "\n";
-	result << "Locked: " << p_data->security_state_locked << "\n";
-	result << "Frozen: " << p_data->security_state_frozen << "\n";
-	result << "CountExpired: " << p_data->security_state_count_expired << "\n";
-	result << "NotSupported: " << p_data->security_state_not_supported << "\n";
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_GetSecurityState(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_GetAlarmThreshold(const struct fwcmd_get_alarm_threshold_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Get Alarm Threshold");
+	fwPayloadMembersFormat_GetAlarmThreshold(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_GetAlarmThreshold(const struct fwcmd_get_alarm_threshold_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Alarm Threshold:" << "\n";
-	result << "Enable: " << p_data->enable << "\n";	result << "SpareBlock: " << p_data->enable_spare_block << "\n";
-	result << "MediaTemp: " << p_data->enable_media_temp << "\n";
-	result << "ControllerTemp: " << p_data->enable_controller_temp << "\n";
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_GetAlarmThreshold(p_data, formatter);
+	return result;
+}
 
-	result << "SpareBlockThreshold: " << (int) p_data->spare_block_threshold << "\n";
-	result << "MediaTempThreshold: " << p_data->media_temp_threshold << "\n";
-	result << "ControllerTempThreshold: " << p_data->controller_temp_threshold << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_PowerManagementPolicy(const struct fwcmd_power_management_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Power Management Policy");
+	fwPayloadMembersFormat_PowerManagementPolicy(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_PowerManagementPolicy(const struct fwcmd_power_management_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPower Management Policy:" << "\n";
-	result << "Enable: " << (int) p_data->enable << "\n";
-	result << "PeakPowerBudget: " << p_data->peak_power_budget << "\n";
-	result << "AveragePowerBudget: " << p_data->average_power_budget << "\n";
-	result << "MaxPower: " << (int) p_data->max_power << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_PowerManagementPolicy(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_DieSparingPolicy(const struct fwcmd_die_sparing_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Die Sparing Policy");
+	fwPayloadMembersFormat_DieSparingPolicy(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_DieSparingPolicy(const struct fwcmd_die_sparing_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDie Sparing Policy:" << "\n";
-	result << "Enable: " << (int) p_data->enable << "\n";
-	result << "Aggressiveness: " << (int) p_data->aggressiveness << "\n";
-	result << "Supported: " << (int) p_data->supported << "\n";	result << "Rank0: " << p_data->supported_rank_0 << "\n";
-	result << "Rank1: " << p_data->supported_rank_1 << "\n";
-	result << "Rank2: " << p_data->supported_rank_2 << "\n";
-	result << "Rank3: " << p_data->supported_rank_3 << "\n";
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_DieSparingPolicy(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_AddressRangeScrub(const struct fwcmd_address_range_scrub_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Address Range Scrub");
+	fwPayloadMembersFormat_AddressRangeScrub(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_AddressRangeScrub(const struct fwcmd_address_range_scrub_data *p_data)
 {
-	std::stringstream result;
-	result << "\nAddress Range Scrub:" << "\n";
-	result << "Enable: " << (int) p_data->enable << "\n";
-	result << "DpaStartAddress: " << p_data->dpa_start_address << "\n";
-	result << "DpaEndAddress: " << p_data->dpa_end_address << "\n";
-	result << "DpaCurrentAddress: " << p_data->dpa_current_address << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_AddressRangeScrub(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_OptionalConfigurationDataPolicy(const struct fwcmd_optional_configuration_data_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Optional Configuration Data Policy");
+	fwPayloadMembersFormat_OptionalConfigurationDataPolicy(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_OptionalConfigurationDataPolicy(const struct fwcmd_optional_configuration_data_policy_data *p_data)
 {
-	std::stringstream result;
-	result << "\nOptional Configuration Data Policy:" << "\n";
-	result << "FirstFastRefresh: " << (int) p_data->first_fast_refresh << "\n";
-	result << "ViralPolicyEnabled: " << (int) p_data->viral_policy_enabled << "\n";
-	result << "ViralStatus: " << (int) p_data->viral_status << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_OptionalConfigurationDataPolicy(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_PmonRegisters(const struct fwcmd_pmon_registers_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Pmon Registers");
+	fwPayloadMembersFormat_PmonRegisters(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_PmonRegisters(const struct fwcmd_pmon_registers_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPmon Registers:" << "\n";
-	result << "PmonRetreiveMask: " << p_data->pmon_retreive_mask << "\n";
-	result << "Pmon0Counter: " << p_data->pmon_0_counter << "\n";
-	result << "Pmon0Control: " << p_data->pmon_0_control << "\n";
-	result << "Pmon1Counter: " << p_data->pmon_1_counter << "\n";
-	result << "Pmon1Control: " << p_data->pmon_1_control << "\n";
-	result << "Pmon2Counter: " << p_data->pmon_2_counter << "\n";
-	result << "Pmon2Control: " << p_data->pmon_2_control << "\n";
-	result << "Pmon3Counter: " << p_data->pmon_3_counter << "\n";
-	result << "Pmon3Control: " << p_data->pmon_3_control << "\n";
-	result << "Pmon4Counter: " << p_data->pmon_4_counter << "\n";
-	result << "Pmon4Control: " << p_data->pmon_4_control << "\n";
-	result << "Pmon5Counter: " << p_data->pmon_5_counter << "\n";
-	result << "Pmon5Control: " << p_data->pmon_5_control << "\n";
-	result << "Pmon6Counter: " << p_data->pmon_6_counter << "\n";
-	result << "Pmon6Control: " << p_data->pmon_6_control << "\n";
-	result << "Pmon7Counter: " << p_data->pmon_7_counter << "\n";
-	result << "Pmon7Control: " << p_data->pmon_7_control << "\n";
-	result << "Pmon8Counter: " << p_data->pmon_8_counter << "\n";
-	result << "Pmon8Control: " << p_data->pmon_8_control << "\n";
-	result << "Pmon9Counter: " << p_data->pmon_9_counter << "\n";
-	result << "Pmon9Control: " << p_data->pmon_9_control << "\n";
-	result << "Pmon10Counter: " << p_data->pmon_10_counter << "\n";
-	result << "Pmon10Control: " << p_data->pmon_10_control << "\n";
-	result << "Pmon11Counter: " << p_data->pmon_11_counter << "\n";
-	result << "Pmon11Control: " << p_data->pmon_11_control << "\n";
-	result << "Pmon14Counter: " << p_data->pmon_14_counter << "\n";
-	result << "Pmon14Control: " << p_data->pmon_14_control << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_PmonRegisters(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_SystemTime(const struct fwcmd_system_time_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("System Time");
+	fwPayloadMembersFormat_SystemTime(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_SystemTime(const struct fwcmd_system_time_data *p_data)
 {
-	std::stringstream result;
-	result << "\nSystem Time:" << "\n";
-	result << "UnixTime: " << p_data->unix_time << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_SystemTime(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_DeviceIdentificationV1(const struct fwcmd_device_identification_v1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Device Identification V1");
+	fwPayloadMembersFormat_DeviceIdentificationV1(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_DeviceIdentificationV1(const struct fwcmd_device_identification_v1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Device Identification V1:" << "\n";
-	result << "ManufacturerId: " << p_data->manufacturer_id << "\n";
-	result << "SerialNumber: " << p_data->serial_number << "\n";
-	result << "ModelNumber: " << p_data->model_number << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_DeviceIdentificationV1(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_DeviceIdentificationV2(const struct fwcmd_device_identification_v2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Device Identification V2");
+	fwPayloadMembersFormat_DeviceIdentificationV2(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_DeviceIdentificationV2(const struct fwcmd_device_identification_v2_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Device Identification V2:" << "\n";
-	result << "Uid: " << p_data->uid << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_DeviceIdentificationV2(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_IdInfoTable(const struct fwcmd_id_info_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Identification Information Table");
+	fwPayloadMembersFormat_IdInfoTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_IdInfoTable(const struct fwcmd_id_info_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Identification Information Table:" << "\n";
-	result << fwPayloadToString_DeviceIdentificationV1(&p_data->device_identification.device_identification_v1);
-	result << fwPayloadToString_DeviceIdentificationV2(&p_data->device_identification.device_identification_v2);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_IdInfoTable(p_data, formatter);
+	return result;
+}
 
-	result << "PartitionOffset: " << p_data->partition_offset << "\n";
-	result << "PartitionSize: " << p_data->partition_size << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Interleave Information Table");
+	fwPayloadMembersFormat_InterleaveInformationTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Interleave Information Table:" << "\n";
-	result << "Type: " << p_data->type << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "Index: " << p_data->index << "\n";
-	result << "NumberOfDimms: " << (int) p_data->number_of_dimms << "\n";
-	result << "MemoryType: " << (int) p_data->memory_type << "\n";
-	result << "Format: " << p_data->format << "\n";
-	result << "MirrorEnabled: " << (int) p_data->mirror_enabled << "\n";
-	result << "ChangeStatus: " << (int) p_data->change_status << "\n";
-	result << "MemorySpare: " << (int) p_data->memory_spare << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_InterleaveInformationTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Partition Size Change Table");
+	fwPayloadMembersFormat_PartitionSizeChangeTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Partition Size Change Table:" << "\n";
-	result << "Type: " << p_data->type << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "PlatformConfigDataPartitionSizeChangeTable: " << p_data->platform_config_data_partition_size_change_table << "\n";
-	result << "PersistentMemoryPartitionSize: " << p_data->persistent_memory_partition_size << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_PartitionSizeChangeTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Current Config Table");
+	fwPayloadMembersFormat_CurrentConfigTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Current Config Table:" << "\n";
-	result << "Signature: " << p_data->signature << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "Revision: " << (int) p_data->revision << "\n";
-	result << "Checksum: " << (int) p_data->checksum << "\n";
-	result << "OemId: " << p_data->oem_id << "\n";
-	result << "OemTableId: " << p_data->oem_table_id << "\n";
-	result << "OemRevision: " << p_data->oem_revision << "\n";
-	result << "CreatorId: " << p_data->creator_id << "\n";
-	result << "CreatorRevision: " << p_data->creator_revision << "\n";
-	result << "ConfigStatus: " << p_data->config_status << "\n";
-	result << "VolatileMemorySize: " << p_data->volatile_memory_size << "\n";
-	result << "PersistentMemorySize: " << p_data->persistent_memory_size << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_CurrentConfigTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Config Input Table");
+	fwPayloadMembersFormat_ConfigInputTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Config Input Table:" << "\n";
-	result << "Signature: " << p_data->signature << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "Revision: " << (int) p_data->revision << "\n";
-	result << "Checksum: " << (int) p_data->checksum << "\n";
-	result << "OemId: " << p_data->oem_id << "\n";
-	result << "OemTableId: " << p_data->oem_table_id << "\n";
-	result << "OemRevision: " << p_data->oem_revision << "\n";
-	result << "CreatorId: " << p_data->creator_id << "\n";
-	result << "CreatorRevision: " << p_data->creator_revision << "\n";
-	result << "SequenceNumber: " << p_data->sequence_number << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_ConfigInputTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Config Output Table");
+	fwPayloadMembersFormat_ConfigOutputTable(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Config Output Table:" << "\n";
-	result << "Signature: " << p_data->signature << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "Revision: " << (int) p_data->revision << "\n";
-	result << "Checksum: " << (int) p_data->checksum << "\n";
-	result << "OemId: " << p_data->oem_id << "\n";
-	result << "OemTableId: " << p_data->oem_table_id << "\n";
-	result << "OemRevision: " << p_data->oem_revision << "\n";
-	result << "CreatorId: " << p_data->creator_id << "\n";
-	result << "CreatorRevision: " << p_data->creator_revision << "\n";
-	result << "SequenceNumber: " << p_data->sequence_number << "\n";
-	result << "ValidationStatus: " << (int) p_data->validation_status << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_ConfigOutputTable(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_PlatformConfigData(const struct fwcmd_platform_config_data_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Platform Config Data Configuration Header Table");
+	fwPayloadMembersFormat_PlatformConfigData(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_PlatformConfigData(const struct fwcmd_platform_config_data_data *p_data)
 {
-	std::stringstream result;
-	result << "\nPlatform Config Data Configuration Header Table:" << "\n";
-	result << "Signature: " << p_data->signature << "\n";
-	result << "Length: " << p_data->length << "\n";
-	result << "Revision: " << (int) p_data->revision << "\n";
-	result << "Checksum: " << (int) p_data->checksum << "\n";
-	result << "OemId: " << p_data->oem_id << "\n";
-	result << "OemTableId: " << p_data->oem_table_id << "\n";
-	result << "OemRevision: " << p_data->oem_revision << "\n";
-	result << "CreatorId: " << p_data->creator_id << "\n";
-	result << "CreatorRevision: " << p_data->creator_revision << "\n";
-	result << "CurrentConfigSize: " << p_data->current_config_size << "\n";
-	result << "CurrentConfigOffset: " << p_data->current_config_offset << "\n";
-	result << "InputConfigSize: " << p_data->input_config_size << "\n";
-	result << "InputConfigOffset: " << p_data->input_config_offset << "\n";
-	result << "OutputConfigSize: " << p_data->output_config_size << "\n";
-	result << "OutputConfigOffset: " << p_data->output_config_offset << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_PlatformConfigData(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_NsIndex(const struct fwcmd_ns_index_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Ns Index");
+	fwPayloadMembersFormat_NsIndex(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_NsIndex(const struct fwcmd_ns_index_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Index:" << "\n";
-	result << "Signature: " << p_data->signature << "\n";
-	result << "Flags: " << p_data->flags << "\n";
-	result << "Sequence: " << p_data->sequence << "\n";
-	result << "MyOffset: " << p_data->my_offset << "\n";
-	result << "MySize: " << p_data->my_size << "\n";
-	result << "OtherOffset: " << p_data->other_offset << "\n";
-	result << "LabelOffset: " << p_data->label_offset << "\n";
-	result << "Nlabel: " << p_data->nlabel << "\n";
-	result << "LabelMajorVersion: " << p_data->label_major_version << "\n";
-	result << "LabelMinorVersion: " << p_data->label_minor_version << "\n";
-	result << "Checksum: " << p_data->checksum << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_NsIndex(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_NsLabel(const struct fwcmd_ns_label_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Ns Label");
+	fwPayloadMembersFormat_NsLabel(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_NsLabel(const struct fwcmd_ns_label_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label:" << "\n";
-	result << "Uuid: " << p_data->uuid << "\n";
-	result << "Name: " << p_data->name << "\n";
-	result << "Flags: " << p_data->flags << "\n";	result << "ReadOnly: " << p_data->flags_read_only << "\n";
-	result << "Local: " << p_data->flags_local << "\n";
-	result << "Updating: " << p_data->flags_updating << "\n";
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_NsLabel(p_data, formatter);
+	return result;
+}
 
-	result << "Nlabel: " << p_data->nlabel << "\n";
-	result << "Position: " << p_data->position << "\n";
-	result << "IsetCookie: " << p_data->iset_cookie << "\n";
-	result << "LbaSize: " << p_data->lba_size << "\n";
-	result << "Dpa: " << p_data->dpa << "\n";
-	result << "Rawsize: " << p_data->rawsize << "\n";
-	result << "Slot: " << p_data->slot << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_NsLabelV11(const struct fwcmd_ns_label_v1_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Ns Label V1 1");
+	fwPayloadMembersFormat_NsLabelV11(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_NsLabelV11(const struct fwcmd_ns_label_v1_1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label V1 1:" << "\n";
-	result << fwPayloadToString_NsLabel(&p_data->label);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_NsLabelV11(p_data, formatter);
+	return result;
+}
 
-	result << "Unused: " << p_data->unused << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_NsLabelV12(const struct fwcmd_ns_label_v1_2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Ns Label V1 2");
+	fwPayloadMembersFormat_NsLabelV12(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_NsLabelV12(const struct fwcmd_ns_label_v1_2_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNs Label V1 2:" << "\n";
-	result << fwPayloadToString_NsLabel(&p_data->label);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_NsLabelV12(p_data, formatter);
+	return result;
+}
 
-	result << "Alignment: " << (int) p_data->alignment << "\n";
-	result << "Reserved: " << p_data->reserved << "\n";
-	result << "TypeGuid: " << p_data->type_guid << "\n";
-	result << "AddressAbstractionGuid: " << p_data->address_abstraction_guid << "\n";
-	result << "Reserved1: " << p_data->reserved1 << "\n";
-	result << "Checksum: " << p_data->checksum << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_NamespaceLabels(const struct fwcmd_namespace_labels_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Namespace Labels");
+	fwPayloadMembersFormat_NamespaceLabels(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_NamespaceLabels(const struct fwcmd_namespace_labels_data *p_data)
 {
-	std::stringstream result;
-	result << "\nNamespace Labels:" << "\n";
-	result << fwPayloadToString_NsIndex(&p_data->index1);
-
-	result << fwPayloadToString_NsIndex(&p_data->index2);
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_NamespaceLabels(p_data, formatter);
+	return result;
+}
 
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_DimmPartitionInfo(const struct fwcmd_dimm_partition_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Dimm Partition Info");
+	fwPayloadMembersFormat_DimmPartitionInfo(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_DimmPartitionInfo(const struct fwcmd_dimm_partition_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDimm Partition Info:" << "\n";
-	result << "VolatileCapacity: " << p_data->volatile_capacity << "\n";
-	result << "VolatileStart: " << p_data->volatile_start << "\n";
-	result << "PmCapacity: " << p_data->pm_capacity << "\n";
-	result << "PmStart: " << p_data->pm_start << "\n";
-	result << "RawCapacity: " << p_data->raw_capacity << "\n";
-	result << "EnabledCapacity: " << p_data->enabled_capacity << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_DimmPartitionInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_FwDebugLogLevel(const struct fwcmd_fw_debug_log_level_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Fw Debug Log Level");
+	fwPayloadMembersFormat_FwDebugLogLevel(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_FwDebugLogLevel(const struct fwcmd_fw_debug_log_level_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFw Debug Log Level:" << "\n";
-	result << "LogLevel: " << (int) p_data->log_level << "\n";
-	result << "Logs: " << (int) p_data->logs << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_FwDebugLogLevel(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_FwLoadFlag(const struct fwcmd_fw_load_flag_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Fw Load Flag");
+	fwPayloadMembersFormat_FwLoadFlag(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_FwLoadFlag(const struct fwcmd_fw_load_flag_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFw Load Flag:" << "\n";
-	result << "LoadFlag: " << (int) p_data->load_flag << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_FwLoadFlag(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_ConfigLockdown(const struct fwcmd_config_lockdown_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Config Lockdown");
+	fwPayloadMembersFormat_ConfigLockdown(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_ConfigLockdown(const struct fwcmd_config_lockdown_data *p_data)
 {
-	std::stringstream result;
-	result << "\nConfig Lockdown:" << "\n";
-	result << "Locked: " << (int) p_data->locked << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_ConfigLockdown(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_DdrtIoInitInfo(const struct fwcmd_ddrt_io_init_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Ddrt Io Init Info");
+	fwPayloadMembersFormat_DdrtIoInitInfo(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_DdrtIoInitInfo(const struct fwcmd_ddrt_io_init_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nDdrt Io Init Info:" << "\n";
-	result << "DdrtIoInfo: " << (int) p_data->ddrt_io_info << "\n";
-	result << "DdrtTrainingStatus: " << (int) p_data->ddrt_training_status << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_DdrtIoInitInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_GetSupportedSkuFeatures(const struct fwcmd_get_supported_sku_features_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Get Supported Sku Features");
+	fwPayloadMembersFormat_GetSupportedSkuFeatures(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_GetSupportedSkuFeatures(const struct fwcmd_get_supported_sku_features_data *p_data)
 {
-	std::stringstream result;
-	result << "\nGet Supported Sku Features:" << "\n";
-	result << "DimmSku: " << p_data->dimm_sku << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_GetSupportedSkuFeatures(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_EnableDimm(const struct fwcmd_enable_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Enable Dimm");
+	fwPayloadMembersFormat_EnableDimm(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_EnableDimm(const struct fwcmd_enable_dimm_data *p_data)
 {
-	std::stringstream result;
-	result << "\nEnable Dimm:" << "\n";
-	result << "Enable: " << (int) p_data->enable << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_EnableDimm(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Smart Health Info");
+	fwPayloadMembersFormat_SmartHealthInfo(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nSmart Health Info:" << "\n";
-	result << "ValidationFlags: " << p_data->validation_flags << "\n";	result << "HealthStatus: " << p_data->validation_flags_health_status << "\n";
-	result << "SpareBlocks: " << p_data->validation_flags_spare_blocks << "\n";
-	result << "PercentUsed: " << p_data->validation_flags_percent_used << "\n";
-	result << "MediaTemp: " << p_data->validation_flags_media_temp << "\n";
-	result << "ControllerTemp: " << p_data->validation_flags_controller_temp << "\n";
-	result << "UnsafeShutdownCounter: " << p_data->validation_flags_unsafe_shutdown_counter << "\n";
-	result << "AitDramStatus: " << p_data->validation_flags_ait_dram_status << "\n";
-	result << "AlarmTrips: " << p_data->validation_flags_alarm_trips << "\n";
-	result << "LastShutdownStatus: " << p_data->validation_flags_last_shutdown_status << "\n";
-	result << "VendorSpecificDataSize: " << p_data->validation_flags_vendor_specific_data_size << "\n";
-
-	result << "HealthStatus: " << (int) p_data->health_status << "\n";	result << "Noncritical: " << p_data->health_status_noncritical << "\n";
-	result << "Critical: " << p_data->health_status_critical << "\n";
-	result << "Fatal: " << p_data->health_status_fatal << "\n";
-
-	result << "SpareBlocks: " << (int) p_data->spare_blocks << "\n";
-	result << "PercentUsed: " << (int) p_data->percent_used << "\n";
-	result << "AlarmTrips: " << (int) p_data->alarm_trips << "\n";	result << "SpareBlockTrip: " << p_data->alarm_trips_spare_block_trip << "\n";
-	result << "MediaTemperatureTrip: " << p_data->alarm_trips_media_temperature_trip << "\n";
-	result << "ControllerTemperatureTrip: " << p_data->alarm_trips_controller_temperature_trip << "\n";
-
-	result << "MediaTemp: " << p_data->media_temp << "\n";
-	result << "ControllerTemp: " << p_data->controller_temp << "\n";
-	result << "UnsafeShutdownCount: " << p_data->unsafe_shutdown_count << "\n";
-	result << "AitDramStatus: " << (int) p_data->ait_dram_status << "\n";
-	result << "LastShutdownStatus: " << (int) p_data->last_shutdown_status << "\n";
-	result << "VendorSpecificDataSize: " << p_data->vendor_specific_data_size << "\n";
-	result << "PowerCycles: " << p_data->power_cycles << "\n";
-	result << "PowerOnTime: " << p_data->power_on_time << "\n";
-	result << "Uptime: " << p_data->uptime << "\n";
-	result << "UnsafeShutdowns: " << p_data->unsafe_shutdowns << "\n";
-	result << "LastShutdownStatusDetails: " << (int) p_data->last_shutdown_status_details << "\n";	result << "PmAdrCommandReceived: " << p_data->last_shutdown_status_details_pm_adr_command_received << "\n";
-	result << "PmS3Received: " << p_data->last_shutdown_status_details_pm_s3_received << "\n";
-	result << "PmS5Received: " << p_data->last_shutdown_status_details_pm_s5_received << "\n";
-	result << "DdrtPowerFailCommandReceived: " << p_data->last_shutdown_status_details_ddrt_power_fail_command_received << "\n";
-	result << "Pmic12vPowerFail: " << p_data->last_shutdown_status_details_pmic_12v_power_fail << "\n";
-	result << "PmWarmResetReceived: " << p_data->last_shutdown_status_details_pm_warm_reset_received << "\n";
-	result << "ThermalShutdownReceived: " << p_data->last_shutdown_status_details_thermal_shutdown_received << "\n";
-	result << "FlushComplete: " << p_data->last_shutdown_status_details_flush_complete << "\n";
-
-	result << "LastShutdownTime: " << p_data->last_shutdown_time << "\n";
-	result << "LastShutdownStatusExtendedDetails: " << (int) p_data->last_shutdown_status_extended_details << "\n";	result << "ViralInterruptReceived: " << p_data->last_shutdown_status_extended_details_viral_interrupt_received << "\n";
-	result << "SurpriseClockStopInterruptReceived: " << p_data->last_shutdown_status_extended_details_surprise_clock_stop_interrupt_received << "\n";
-	result << "WriteDataFlushComplete: " << p_data->last_shutdown_status_extended_details_write_data_flush_complete << "\n";
-	result << "S4PowerStateReceived: " << p_data->last_shutdown_status_extended_details_s4_power_state_received << "\n";
-
-	result << "MediaErrorInjections: " << p_data->media_error_injections << "\n";
-	result << "NonMediaErrorInjections: " << p_data->non_media_error_injections << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_SmartHealthInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_FirmwareImageInfo(const struct fwcmd_firmware_image_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Firmware Image Info");
+	fwPayloadMembersFormat_FirmwareImageInfo(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_FirmwareImageInfo(const struct fwcmd_firmware_image_info_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFirmware Image Info:" << "\n";
-	result << "FirmwareRevision: " << p_data->firmware_revision << "\n";
-	result << "FirmwareType: " << (int) p_data->firmware_type << "\n";
-	result << "StagedFwRevision: " << p_data->staged_fw_revision << "\n";
-	result << "LastFwUpdateStatus: " << (int) p_data->last_fw_update_status << "\n";
-	result << "CommitId: " << p_data->commit_id << "\n";
-	result << "BuildConfiguration: " << p_data->build_configuration << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_FirmwareImageInfo(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_FirmwareDebugLog(const struct fwcmd_firmware_debug_log_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Firmware Debug Log");
+	fwPayloadMembersFormat_FirmwareDebugLog(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_FirmwareDebugLog(const struct fwcmd_firmware_debug_log_data *p_data)
 {
-	std::stringstream result;
-	result << "\nFirmware Debug Log:" << "\n";
-	result << "LogSize: " << (int) p_data->log_size << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_FirmwareDebugLog(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_MemoryInfoPage0(const struct fwcmd_memory_info_page_0_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Memory Info Page 0");
+	fwPayloadMembersFormat_MemoryInfoPage0(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_MemoryInfoPage0(const struct fwcmd_memory_info_page_0_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 0:" << "\n";
-	result << "MediaReads: " << p_data->media_reads << "\n";
-	result << "MediaWrites: " << p_data->media_writes << "\n";
-	result << "ReadRequests: " << p_data->read_requests << "\n";
-	result << "WriteRequests: " << p_data->write_requests << "\n";
-	result << "BlockReadRequests: " << p_data->block_read_requests << "\n";
-	result << "BlockWriteRequests: " << p_data->block_write_requests << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_MemoryInfoPage0(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_MemoryInfoPage1(const struct fwcmd_memory_info_page_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Memory Info Page 1");
+	fwPayloadMembersFormat_MemoryInfoPage1(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_MemoryInfoPage1(const struct fwcmd_memory_info_page_1_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 1:" << "\n";
-	result << "TotalMediaReads: " << p_data->total_media_reads << "\n";
-	result << "TotalMediaWrites: " << p_data->total_media_writes << "\n";
-	result << "TotalReadRequests: " << p_data->total_read_requests << "\n";
-	result << "TotalWriteRequests: " << p_data->total_write_requests << "\n";
-	result << "TotalBlockReadRequests: " << p_data->total_block_read_requests << "\n";
-	result << "TotalBlockWriteRequests: " << p_data->total_block_write_requests << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_MemoryInfoPage1(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_MemoryInfoPage3(const struct fwcmd_memory_info_page_3_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Memory Info Page 3");
+	fwPayloadMembersFormat_MemoryInfoPage3(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_MemoryInfoPage3(const struct fwcmd_memory_info_page_3_data *p_data)
 {
-	std::stringstream result;
-	result << "\nMemory Info Page 3:" << "\n";
-	result << "ErrorInjectionStatus: " << p_data->error_injection_status << "\n";	result << "ErrorInjectionEnabled: " << p_data->error_injection_status_error_injection_enabled << "\n";
-	result << "MediaTemperatureInjectionEnabled: " << p_data->error_injection_status_media_temperature_injection_enabled << "\n";
-	result << "SoftwareTriggersEnabled: " << p_data->error_injection_status_software_triggers_enabled << "\n";
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_MemoryInfoPage3(p_data, formatter);
+	return result;
+}
 
-	result << "PoisonErrorInjectionsCounter: " << p_data->poison_error_injections_counter << "\n";
-	result << "PoisonErrorClearCounter: " << p_data->poison_error_clear_counter << "\n";
-	result << "MediaTemperatureInjectionsCounter: " << p_data->media_temperature_injections_counter << "\n";
-	result << "SoftwareTriggersCounter: " << p_data->software_triggers_counter << "\n";
-	return result.str();
+void FwCommands::fwPayloadFieldsFormat_LongOperationStatus(const struct fwcmd_long_operation_status_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Long Operation Status");
+	fwPayloadMembersFormat_LongOperationStatus(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_LongOperationStatus(const struct fwcmd_long_operation_status_data *p_data)
 {
-	std::stringstream result;
-	result << "\nLong Operation Status:" << "\n";
-	result << "Command: " << p_data->command << "\n";
-	result << "PercentComplete: " << p_data->percent_complete << "\n";
-	result << "EstimateTimeToCompletion: " << p_data->estimate_time_to_completion << "\n";
-	result << "StatusCode: " << (int) p_data->status_code << "\n";
-	result << "CommandSpecificReturnData: " << p_data->command_specific_return_data << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_LongOperationStatus(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadFieldsFormat_Bsr(const struct fwcmd_bsr_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.beginPayload("Bsr");
+	fwPayloadMembersFormat_Bsr(p_data, formatter);
+	formatter.endPayload();
 }
 
 std::string FwCommands::fwPayloadFieldsToString_Bsr(const struct fwcmd_bsr_data *p_data)
 {
-	std::stringstream result;
-	result << "\nBsr:" << "\n";
-	result << "MajorCheckpoint: " << (int) p_data->major_checkpoint << "\n";
-	result << "MinorCheckpoint: " << (int) p_data->minor_checkpoint << "\n";
-	result << "Rest1: " << p_data->rest1 << "\n";	result << "MediaReady1: " << p_data->rest1_media_ready_1 << "\n";
-	result << "MediaReady2: " << p_data->rest1_media_ready_2 << "\n";
-	result << "DdrtIoInitComplete: " << p_data->rest1_ddrt_io_init_complete << "\n";
-	result << "PcrLock: " << p_data->rest1_pcr_lock << "\n";
-	result << "MailboxReady: " << p_data->rest1_mailbox_ready << "\n";
-	result << "WatchDogStatus: " << p_data->rest1_watch_dog_status << "\n";
-	result << "FirstFastRefreshComplete: " << p_data->rest1_first_fast_refresh_complete << "\n";
-	result << "CreditReady: " << p_data->rest1_credit_ready << "\n";
-	result << "MediaDisabled: " << p_data->rest1_media_disabled << "\n";
-	result << "OptInEnabled: " << p_data->rest1_opt_in_enabled << "\n";
-	result << "OptInWasEnabled: " << p_data->rest1_opt_in_was_enabled << "\n";
-	result << "Assertion: " << p_data->rest1_assertion << "\n";
-	result << "MiStall: " << p_data->rest1_mi_stall << "\n";
-	result << "AitDramReady: " << p_data->rest1_ait_dram_ready << "\n";
-
-	result << "Rest2: " << p_data->rest2 << "\n";
-	return result.str();
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFieldsFormat_Bsr(p_data, formatter);
+	return result;
+}
+
+void FwCommands::fwPayloadMembersFormat_IdentifyDimm(const struct fwcmd_identify_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("VendorId", p_data->vendor_id);
+	formatter.field("DeviceId", p_data->device_id);
+	formatter.field("RevisionId", p_data->revision_id);
+	formatter.field("InterfaceFormatCode", p_data->interface_format_code);
+	formatter.field("FirmwareRevision", p_data->firmware_revision);
+	formatter.field("ReservedOldApi", p_data->reserved_old_api);
+	formatter.field("FeatureSwRequiredMask", p_data->feature_sw_required_mask);	formatter.field("InvalidateBeforeBlockRead", p_data->feature_sw_required_mask_invalidate_before_block_read);
+	formatter.field("ReadbackOfBwAddressRegisterRequiredBeforeUse", p_data->feature_sw_required_mask_readback_of_bw_address_register_required_before_use);
+
+	formatter.field("NumberOfBlockWindows", p_data->number_of_block_windows);
+	formatter.field("OffsetOfBlockModeControlRegion", p_data->offset_of_block_mode_control_region);
+	formatter.field("RawCapacity", p_data->raw_capacity);
+	formatter.field("Manufacturer", p_data->manufacturer);
+	formatter.field("SerialNumber", p_data->serial_number);
+	formatter.field("PartNumber", p_data->part_number);
+	formatter.field("DimmSku", p_data->dimm_sku);	formatter.field("MemoryModeEnabled", p_data->dimm_sku_memory_mode_enabled);
+	formatter.field("StorageModeEnabled", p_data->dimm_sku_storage_mode_enabled);
+	formatter.field("AppDirectModeEnabled", p_data->dimm_sku_app_direct_mode_enabled);
+	formatter.field("DieSparingCapable", p_data->dimm_sku_die_sparing_capable);
+	formatter.field("SoftProgrammableSku", p_data->dimm_sku_soft_programmable_sku);
+	formatter.field("EncryptionEnabled", p_data->dimm_sku_encryption_enabled);
+
+	formatter.field("InterfaceFormatCodeExtra", p_data->interface_format_code_extra);
+	formatter.field("ApiVer", p_data->api_ver);
+}
+
+void FwCommands::fwPayloadMembersFormat_IdentifyDimmCharacteristics(const struct fwcmd_identify_dimm_characteristics_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("ControllerTempShutdownThreshold", p_data->controller_temp_shutdown_threshold);
+	formatter.field("MediaTempShutdownThreshold", p_data->media_temp_shutdown_threshold);
+	formatter.field("ThrottlingStartThreshold", p_data->throttling_start_threshold);
+	formatter.field("ThrottlingStopThreshold", p_data->throttling_stop_threshold);
+}
+
+void FwCommands::fwPayloadMembersFormat_GetSecurityState(const struct fwcmd_get_security_state_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("SecurityState", p_data->security_state);	formatter.field("Enabled", p_data->security_state_enabled);
+	formatter.field("Locked", p_data->security_state_locked);
+	formatter.field("Frozen", p_data->security_state_frozen);
+	formatter.field("CountExpired", p_data->security_state_count_expired);
+	formatter.field("NotSupported", p_data->security_state_not_supported);
+}
+
+void FwCommands::fwPayloadMembersFormat_GetAlarmThreshold(const struct fwcmd_get_alarm_threshold_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Enable", p_data->enable);	formatter.field("SpareBlock", p_data->enable_spare_block);
+	formatter.field("MediaTemp", p_data->enable_media_temp);
+	formatter.field("ControllerTemp", p_data->enable_controller_temp);
+
+	formatter.field("SpareBlockThreshold", p_data->spare_block_threshold);
+	formatter.field("MediaTempThreshold", p_data->media_temp_threshold);
+	formatter.field("ControllerTempThreshold", p_data->controller_temp_threshold);
+}
+
+void FwCommands::fwPayloadMembersFormat_PowerManagementPolicy(const struct fwcmd_power_management_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Enable", p_data->enable);
+	formatter.field("PeakPowerBudget", p_data->peak_power_budget);
+	formatter.field("AveragePowerBudget", p_data->average_power_budget);
+	formatter.field("MaxPower", p_data->max_power);
+}
+
+void FwCommands::fwPayloadMembersFormat_DieSparingPolicy(const struct fwcmd_die_sparing_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Enable", p_data->enable);
+	formatter.field("Aggressiveness", p_data->aggressiveness);
+	formatter.field("Supported", p_data->supported);	formatter.field("Rank0", p_data->supported_rank_0);
+	formatter.field("Rank1", p_data->supported_rank_1);
+	formatter.field("Rank2", p_data->supported_rank_2);
+	formatter.field("Rank3", p_data->supported_rank_3);
+}
+
+void FwCommands::fwPayloadMembersFormat_AddressRangeScrub(const struct fwcmd_address_range_scrub_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Enable", p_data->enable);
+	formatter.field("DpaStartAddress", p_data->dpa_start_address);
+	formatter.field("DpaEndAddress", p_data->dpa_end_address);
+	formatter.field("DpaCurrentAddress", p_data->dpa_current_address);
+}
+
+void FwCommands::fwPayloadMembersFormat_OptionalConfigurationDataPolicy(const struct fwcmd_optional_configuration_data_policy_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("FirstFastRefresh", p_data->first_fast_refresh);
+	formatter.field("ViralPolicyEnabled", p_data->viral_policy_enabled);
+	formatter.field("ViralStatus", p_data->viral_status);
+}
+
+void FwCommands::fwPayloadMembersFormat_PmonRegisters(const struct fwcmd_pmon_registers_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("PmonRetreiveMask", p_data->pmon_retreive_mask);
+	formatter.field("Pmon0Counter", p_data->pmon_0_counter);
+	formatter.field("Pmon0Control", p_data->pmon_0_control);
+	formatter.field("Pmon1Counter", p_data->pmon_1_counter);
+	formatter.field("Pmon1Control", p_data->pmon_1_control);
+	formatter.field("Pmon2Counter", p_data->pmon_2_counter);
+	formatter.field("Pmon2Control", p_data->pmon_2_control);
+	formatter.field("Pmon3Counter", p_data->pmon_3_counter);
+	formatter.field("Pmon3Control", p_data->pmon_3_control);
+	formatter.field("Pmon4Counter", p_data->pmon_4_counter);
+	formatter.field("Pmon4Control", p_data->pmon_4_control);
+	formatter.field("Pmon5Counter", p_data->pmon_5_counter);
+	formatter.field("Pmon5Control", p_data->pmon_5_control);
+	formatter.field("Pmon6Counter", p_data->pmon_6_counter);
+	formatter.field("Pmon6Control", p_data->pmon_6_control);
+	formatter.field("Pmon7Counter", p_data->pmon_7_counter);
+	formatter.field("Pmon7Control", p_data->pmon_7_control);
+	formatter.field("Pmon8Counter", p_data->pmon_8_counter);
+	formatter.field("Pmon8Control", p_data->pmon_8_control);
+	formatter.field("Pmon9Counter", p_data->pmon_9_counter);
+	formatter.field("Pmon9Control", p_data->pmon_9_control);
+	formatter.field("Pmon10Counter", p_data->pmon_10_counter);
+	formatter.field("Pmon10Control", p_data->pmon_10_control);
+	formatter.field("Pmon11Counter", p_data->pmon_11_counter);
+	formatter.field("Pmon11Control", p_data->pmon_11_control);
+	formatter.field("Pmon14Counter", p_data->pmon_14_counter);
+	formatter.field("Pmon14Control", p_data->pmon_14_control);
+}
+
+void FwCommands::fwPayloadMembersFormat_SystemTime(const struct fwcmd_system_time_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("UnixTime", p_data->unix_time);
+}
+
+void FwCommands::fwPayloadMembersFormat_DeviceIdentificationV1(const struct fwcmd_device_identification_v1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("ManufacturerId", p_data->manufacturer_id);
+	formatter.field("SerialNumber", p_data->serial_number);
+	formatter.field("ModelNumber", p_data->model_number);
+}
+
+void FwCommands::fwPayloadMembersFormat_DeviceIdentificationV2(const struct fwcmd_device_identification_v2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Uid", p_data->uid);
+}
+
+void FwCommands::fwPayloadMembersFormat_IdInfoTable(const struct fwcmd_id_info_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	fwPayloadFormat_DeviceIdentificationV1(&p_data->device_identification.device_identification_v1, formatter);
+	fwPayloadFormat_DeviceIdentificationV2(&p_data->device_identification.device_identification_v2, formatter);
+
+	formatter.field("PartitionOffset", p_data->partition_offset);
+	formatter.field("PartitionSize", p_data->partition_size);
+}
+
+void FwCommands::fwPayloadMembersFormat_InterleaveInformationTable(const struct fwcmd_interleave_information_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Type", p_data->type);
+	formatter.field("Length", p_data->length);
+	formatter.field("Index", p_data->index);
+	formatter.field("NumberOfDimms", p_data->number_of_dimms);
+	formatter.field("MemoryType", p_data->memory_type);
+	formatter.field("Format", p_data->format);
+	formatter.field("MirrorEnabled", p_data->mirror_enabled);
+	formatter.field("ChangeStatus", p_data->change_status);
+	formatter.field("MemorySpare", p_data->memory_spare);
+}
+
+void FwCommands::fwPayloadMembersFormat_PartitionSizeChangeTable(const struct fwcmd_partition_size_change_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Type", p_data->type);
+	formatter.field("Length", p_data->length);
+	formatter.field("PlatformConfigDataPartitionSizeChangeTable", p_data->platform_config_data_partition_size_change_table);
+	formatter.field("PersistentMemoryPartitionSize", p_data->persistent_memory_partition_size);
+}
+
+void FwCommands::fwPayloadMembersFormat_CurrentConfigTable(const struct fwcmd_current_config_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Signature", p_data->signature);
+	formatter.field("Length", p_data->length);
+	formatter.field("Revision", p_data->revision);
+	formatter.field("Checksum", p_data->checksum);
+	formatter.field("OemId", p_data->oem_id);
+	formatter.field("OemTableId", p_data->oem_table_id);
+	formatter.field("OemRevision", p_data->oem_revision);
+	formatter.field("CreatorId", p_data->creator_id);
+	formatter.field("CreatorRevision", p_data->creator_revision);
+	formatter.field("ConfigStatus", p_data->config_status);
+	formatter.field("VolatileMemorySize", p_data->volatile_memory_size);
+	formatter.field("PersistentMemorySize", p_data->persistent_memory_size);
+}
+
+void FwCommands::fwPayloadMembersFormat_ConfigInputTable(const struct fwcmd_config_input_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Signature", p_data->signature);
+	formatter.field("Length", p_data->length);
+	formatter.field("Revision", p_data->revision);
+	formatter.field("Checksum", p_data->checksum);
+	formatter.field("OemId", p_data->oem_id);
+	formatter.field("OemTableId", p_data->oem_table_id);
+	formatter.field("OemRevision", p_data->oem_revision);
+	formatter.field("CreatorId", p_data->creator_id);
+	formatter.field("CreatorRevision", p_data->creator_revision);
+	formatter.field("SequenceNumber", p_data->sequence_number);
+}
+
+void FwCommands::fwPayloadMembersFormat_ConfigOutputTable(const struct fwcmd_config_output_table_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Signature", p_data->signature);
+	formatter.field("Length", p_data->length);
+	formatter.field("Revision", p_data->revision);
+	formatter.field("Checksum", p_data->checksum);
+	formatter.field("OemId", p_data->oem_id);
+	formatter.field("OemTableId", p_data->oem_table_id);
+	formatter.field("OemRevision", p_data->oem_revision);
+	formatter.field("CreatorId", p_data->creator_id);
+	formatter.field("CreatorRevision", p_data->creator_revision);
+	formatter.field("SequenceNumber", p_data->sequence_number);
+	formatter.field("ValidationStatus", p_data->validation_status);
+}
+
+void FwCommands::fwPayloadMembersFormat_PlatformConfigData(const struct fwcmd_platform_config_data_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Signature", p_data->signature);
+	formatter.field("Length", p_data->length);
+	formatter.field("Revision", p_data->revision);
+	formatter.field("Checksum", p_data->checksum);
+	formatter.field("OemId", p_data->oem_id);
+	formatter.field("OemTableId", p_data->oem_table_id);
+	formatter.field("OemRevision", p_data->oem_revision);
+	formatter.field("CreatorId", p_data->creator_id);
+	formatter.field("CreatorRevision", p_data->creator_revision);
+	formatter.field("CurrentConfigSize", p_data->current_config_size);
+	formatter.field("CurrentConfigOffset", p_data->current_config_offset);
+	formatter.field("InputConfigSize", p_data->input_config_size);
+	formatter.field("InputConfigOffset", p_data->input_config_offset);
+	formatter.field("OutputConfigSize", p_data->output_config_size);
+	formatter.field("OutputConfigOffset", p_data->output_config_offset);
+}
+
+void FwCommands::fwPayloadMembersFormat_NsIndex(const struct fwcmd_ns_index_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Signature", p_data->signature);
+	formatter.field("Flags", p_data->flags);
+	formatter.field("Sequence", p_data->sequence);
+	formatter.field("MyOffset", p_data->my_offset);
+	formatter.field("MySize", p_data->my_size);
+	formatter.field("OtherOffset", p_data->other_offset);
+	formatter.field("LabelOffset", p_data->label_offset);
+	formatter.field("Nlabel", p_data->nlabel);
+	formatter.field("LabelMajorVersion", p_data->label_major_version);
+	formatter.field("LabelMinorVersion", p_data->label_minor_version);
+	formatter.field("Checksum", p_data->checksum);
+}
+
+void FwCommands::fwPayloadMembersFormat_NsLabel(const struct fwcmd_ns_label_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Uuid", p_data->uuid);
+	formatter.field("Name", p_data->name);
+	formatter.field("Flags", p_data->flags);	formatter.field("ReadOnly", p_data->flags_read_only);
+	formatter.field("Local", p_data->flags_local);
+	formatter.field("Updating", p_data->flags_updating);
+
+	formatter.field("Nlabel", p_data->nlabel);
+	formatter.field("Position", p_data->position);
+	formatter.field("IsetCookie", p_data->iset_cookie);
+	formatter.field("LbaSize", p_data->lba_size);
+	formatter.field("Dpa", p_data->dpa);
+	formatter.field("Rawsize", p_data->rawsize);
+	formatter.field("Slot", p_data->slot);
+}
+
+void FwCommands::fwPayloadMembersFormat_NsLabelV11(const struct fwcmd_ns_label_v1_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	fwPayloadFormat_NsLabel(&p_data->label, formatter);
+
+	formatter.field("Unused", p_data->unused);
+}
+
+void FwCommands::fwPayloadMembersFormat_NsLabelV12(const struct fwcmd_ns_label_v1_2_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	fwPayloadFormat_NsLabel(&p_data->label, formatter);
+
+	formatter.field("Alignment", p_data->alignment);
+	formatter.field("Reserved", p_data->reserved);
+	formatter.field("TypeGuid", p_data->type_guid);
+	formatter.field("AddressAbstractionGuid", p_data->address_abstraction_guid);
+	formatter.field("Reserved1", p_data->reserved1);
+	formatter.field("Checksum", p_data->checksum);
+}
+
+void FwCommands::fwPayloadMembersFormat_NamespaceLabels(const struct fwcmd_namespace_labels_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	fwPayloadFormat_NsIndex(&p_data->index1, formatter);
+
+	fwPayloadFormat_NsIndex(&p_data->index2, formatter);
+}
+
+void FwCommands::fwPayloadMembersFormat_DimmPartitionInfo(const struct fwcmd_dimm_partition_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("VolatileCapacity", p_data->volatile_capacity);
+	formatter.field("VolatileStart", p_data->volatile_start);
+	formatter.field("PmCapacity", p_data->pm_capacity);
+	formatter.field("PmStart", p_data->pm_start);
+	formatter.field("RawCapacity", p_data->raw_capacity);
+	formatter.field("EnabledCapacity", p_data->enabled_capacity);
+}
+
+void FwCommands::fwPayloadMembersFormat_FwDebugLogLevel(const struct fwcmd_fw_debug_log_level_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("LogLevel", p_data->log_level);
+	formatter.field("Logs", p_data->logs);
+}
+
+void FwCommands::fwPayloadMembersFormat_FwLoadFlag(const struct fwcmd_fw_load_flag_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("LoadFlag", p_data->load_flag);
+}
+
+void FwCommands::fwPayloadMembersFormat_ConfigLockdown(const struct fwcmd_config_lockdown_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Locked", p_data->locked);
+}
+
+void FwCommands::fwPayloadMembersFormat_DdrtIoInitInfo(const struct fwcmd_ddrt_io_init_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("DdrtIoInfo", p_data->ddrt_io_info);
+	formatter.field("DdrtTrainingStatus", p_data->ddrt_training_status);
+}
+
+void FwCommands::fwPayloadMembersFormat_GetSupportedSkuFeatures(const struct fwcmd_get_supported_sku_features_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("DimmSku", p_data->dimm_sku);
+}
+
+void FwCommands::fwPayloadMembersFormat_EnableDimm(const struct fwcmd_enable_dimm_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Enable", p_data->enable);
+}
+
+void FwCommands::fwPayloadMembersFormat_SmartHealthInfo(const struct fwcmd_smart_health_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("ValidationFlags", p_data->validation_flags);	formatter.field("HealthStatus", p_data->validation_flags_health_status);
+	formatter.field("SpareBlocks", p_data->validation_flags_spare_blocks);
+	formatter.field("PercentUsed", p_data->validation_flags_percent_used);
+	formatter.field("MediaTemp", p_data->validation_flags_media_temp);
+	formatter.field("ControllerTemp", p_data->validation_flags_controller_temp);
+	formatter.field("UnsafeShutdownCounter", p_data->validation_flags_unsafe_shutdown_counter);
+	formatter.field("AitDramStatus", p_data->validation_flags_ait_dram_status);
+	formatter.field("AlarmTrips", p_data->validation_flags_alarm_trips);
+	formatter.field("LastShutdownStatus", p_data->validation_flags_last_shutdown_status);
+	formatter.field("VendorSpecificDataSize", p_data->validation_flags_vendor_specific_data_size);
+
+	formatter.field("HealthStatus", p_data->health_status);	formatter.field("Noncritical", p_data->health_status_noncritical);
+	formatter.field("Critical", p_data->health_status_critical);
+	formatter.field("Fatal", p_data->health_status_fatal);
+
+	formatter.field("SpareBlocks", p_data->spare_blocks);
+	formatter.field("PercentUsed", p_data->percent_used);
+	formatter.field("AlarmTrips", p_data->alarm_trips);	formatter.field("SpareBlockTrip", p_data->alarm_trips_spare_block_trip);
+	formatter.field("MediaTemperatureTrip", p_data->alarm_trips_media_temperature_trip);
+	formatter.field("ControllerTemperatureTrip", p_data->alarm_trips_controller_temperature_trip);
+
+	formatter.field("MediaTemp", p_data->media_temp);
+	formatter.field("ControllerTemp", p_data->controller_temp);
+	formatter.field("UnsafeShutdownCount", p_data->unsafe_shutdown_count);
+	formatter.field("AitDramStatus", p_data->ait_dram_status);
+	formatter.field("LastShutdownStatus", p_data->last_shutdown_status);
+	formatter.field("VendorSpecificDataSize", p_data->vendor_specific_data_size);
+	formatter.field("PowerCycles", p_data->power_cycles);
+	formatter.field("PowerOnTime", p_data->power_on_time);
+	formatter.field("Uptime", p_data->uptime);
+	formatter.field("UnsafeShutdowns", p_data->unsafe_shutdowns);
+	formatter.field("LastShutdownStatusDetails", p_data->last_shutdown_status_details);	formatter.field("PmAdrCommandReceived", p_data->last_shutdown_status_details_pm_adr_command_received);
+	formatter.field("PmS3Received", p_data->last_shutdown_status_details_pm_s3_received);
+	formatter.field("PmS5Received", p_data->last_shutdown_status_details_pm_s5_received);
+	formatter.field("DdrtPowerFailCommandReceived", p_data->last_shutdown_status_details_ddrt_power_fail_command_received);
+	formatter.field("Pmic12vPowerFail", p_data->last_shutdown_status_details_pmic_12v_power_fail);
+	formatter.field("PmWarmResetReceived", p_data->last_shutdown_status_details_pm_warm_reset_received);
+	formatter.field("ThermalShutdownReceived", p_data->last_shutdown_status_details_thermal_shutdown_received);
+	formatter.field("FlushComplete", p_data->last_shutdown_status_details_flush_complete);
+
+	formatter.field("LastShutdownTime", p_data->last_shutdown_time);
+	formatter.field("LastShutdownStatusExtendedDetails", p_data->last_shutdown_status_extended_details);	formatter.field("ViralInterruptReceived", p_data->last_shutdown_status_extended_details_viral_interrupt_received);
+	formatter.field("SurpriseClockStopInterruptReceived", p_data->last_shutdown_status_extended_details_surprise_clock_stop_interrupt_received);
+	formatter.field("WriteDataFlushComplete", p_data->last_shutdown_status_extended_details_write_data_flush_complete);
+	formatter.field("S4PowerStateReceived", p_data->last_shutdown_status_extended_details_s4_power_state_received);
+
+	formatter.field("MediaErrorInjections", p_data->media_error_injections);
+	formatter.field("NonMediaErrorInjections", p_data->non_media_error_injections);
+}
+
+void FwCommands::fwPayloadMembersFormat_FirmwareImageInfo(const struct fwcmd_firmware_image_info_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("FirmwareRevision", p_data->firmware_revision);
+	formatter.field("FirmwareType", p_data->firmware_type);
+	formatter.field("StagedFwRevision", p_data->staged_fw_revision);
+	formatter.field("LastFwUpdateStatus", p_data->last_fw_update_status);
+	formatter.field("CommitId", p_data->commit_id);
+	formatter.field("BuildConfiguration", p_data->build_configuration);
+}
+
+void FwCommands::fwPayloadMembersFormat_FirmwareDebugLog(const struct fwcmd_firmware_debug_log_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("LogSize", p_data->log_size);
+}
+
+void FwCommands::fwPayloadMembersFormat_MemoryInfoPage0(const struct fwcmd_memory_info_page_0_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("MediaReads", p_data->media_reads);
+	formatter.field("MediaWrites", p_data->media_writes);
+	formatter.field("ReadRequests", p_data->read_requests);
+	formatter.field("WriteRequests", p_data->write_requests);
+	formatter.field("BlockReadRequests", p_data->block_read_requests);
+	formatter.field("BlockWriteRequests", p_data->block_write_requests);
+}
+
+void FwCommands::fwPayloadMembersFormat_MemoryInfoPage1(const struct fwcmd_memory_info_page_1_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("TotalMediaReads", p_data->total_media_reads);
+	formatter.field("TotalMediaWrites", p_data->total_media_writes);
+	formatter.field("TotalReadRequests", p_data->total_read_requests);
+	formatter.field("TotalWriteRequests", p_data->total_write_requests);
+	formatter.field("TotalBlockReadRequests", p_data->total_block_read_requests);
+	formatter.field("TotalBlockWriteRequests", p_data->total_block_write_requests);
+}
+
+void FwCommands::fwPayloadMembersFormat_MemoryInfoPage3(const struct fwcmd_memory_info_page_3_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("ErrorInjectionStatus", p_data->error_injection_status);	formatter.field("ErrorInjectionEnabled", p_data->error_injection_status_error_injection_enabled);
+	formatter.field("MediaTemperatureInjectionEnabled", p_data->error_injection_status_media_temperature_injection_enabled);
+	formatter.field("SoftwareTriggersEnabled", p_data->error_injection_status_software_triggers_enabled);
+
+	formatter.field("PoisonErrorInjectionsCounter", p_data->poison_error_injections_counter);
+	formatter.field("PoisonErrorClearCounter", p_data->poison_error_clear_counter);
+	formatter.field("MediaTemperatureInjectionsCounter", p_data->media_temperature_injections_counter);
+	formatter.field("SoftwareTriggersCounter", p_data->software_triggers_counter);
+}
+
+void FwCommands::fwPayloadMembersFormat_LongOperationStatus(const struct fwcmd_long_operation_status_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("Command", p_data->command);
+	formatter.field("PercentComplete", p_data->percent_complete);
+	formatter.field("EstimateTimeToCompletion", p_data->estimate_time_to_completion);
+	formatter.field("StatusCode", p_data->status_code);
+	formatter.field("CommandSpecificReturnData", p_data->command_specific_return_data);
+}
+
+void FwCommands::fwPayloadMembersFormat_Bsr(const struct fwcmd_bsr_data *p_data,
+	FwPayloadFormatter &formatter)
+{
+	formatter.field("MajorCheckpoint", p_data->major_checkpoint);
+	formatter.field("MinorCheckpoint", p_data->minor_checkpoint);
+	formatter.field("Rest1", p_data->rest1);	formatter.field("MediaReady1", p_data->rest1_media_ready_1);
+	formatter.field("MediaReady2", p_data->rest1_media_ready_2);
+	formatter.field("DdrtIoInitComplete", p_data->rest1_ddrt_io_init_complete);
+	formatter.field("PcrLock", p_data->rest1_pcr_lock);
+	formatter.field("MailboxReady", p_data->rest1_mailbox_ready);
+	formatter.field("WatchDogStatus", p_data->rest1_watch_dog_status);
+	formatter.field("FirstFastRefreshComplete", p_data->rest1_first_fast_refresh_complete);
+	formatter.field("CreditReady", p_data->rest1_credit_ready);
+	formatter.field("MediaDisabled", p_data->rest1_media_disabled);
+	formatter.field("OptInEnabled", p_data->rest1_opt_in_enabled);
+	formatter.field("OptInWasEnabled", p_data->rest1_opt_in_was_enabled);
+	formatter.field("Assertion", p_data->rest1_assertion);
+	formatter.field("MiStall", p_data->rest1_mi_stall);
+	formatter.field("AitDramReady", p_data->rest1_ait_dram_ready);
+
+	formatter.field("Rest2", p_data->rest2);
 }
 
 enum return_code FwCommands::dsm_err_to_nvm_lib_err(pt_result result)
@@ -29,6 +29,7 @@
 #define FWCOMMANDS_H_
 
 #include "FwCommandsWrapper.h"
+#include "FwPayloadFormatter.h"
 #include "string"
 #include <nvm_types.h>
 #include "firmware_interface/fw_commands.h"
@@ -52,129 +53,254 @@ FwCommands &operator=(const FwCommands &other);
 static FwCommands &getFwCommands();
 
 virtual std::string fwPayloadToString_Custom_PlatformConfigData(fwcmd_platform_config_data_data *pData);
+virtual void fwPayloadFormat_Custom_PlatformConfigData(fwcmd_platform_config_data_data *pData,
+	FwPayloadFormatter &formatter);
 virtual enum return_code fwGetPayload_IdentifyDimm(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_IdentifyDimm(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_IdentifyDimmCharacteristics(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_IdentifyDimmCharacteristics(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_GetSecurityState(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_GetSecurityState(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_SetPassphrase(unsigned int handle,
 	const char current_passphrase[33],
 	const char new_passphrase[33],
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_SetPassphrase(unsigned int handle,
+	const char current_passphrase[33],
+	const char new_passphrase[33],
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_DisablePassphrase(unsigned int handle,
 	const char current_passphrase[33],
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_DisablePassphrase(unsigned int handle,
+	const char current_passphrase[33],
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_UnlockUnit(unsigned int handle,
 	const char current_passphrase[33],
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_UnlockUnit(unsigned int handle,
+	const char current_passphrase[33],
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_SecureErase(unsigned int handle,
 	const char current_passphrase[33],
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_SecureErase(unsigned int handle,
+	const char current_passphrase[33],
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_FreezeLock(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_FreezeLock(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_GetAlarmThreshold(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_GetAlarmThreshold(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_PowerManagementPolicy(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_PowerManagementPolicy(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_DieSparingPolicy(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_DieSparingPolicy(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_AddressRangeScrub(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_AddressRangeScrub(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_OptionalConfigurationDataPolicy(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_OptionalConfigurationDataPolicy(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_PmonRegisters(unsigned int handle,
 	const unsigned short pmon_retreive_mask,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_PmonRegisters(unsigned int handle,
+	const unsigned short pmon_retreive_mask,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_SetAlarmThreshold(unsigned int handle,
 	const unsigned char enable,
 	const unsigned short peak_power_budget,
 	const unsigned short avg_power_budget,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_SetAlarmThreshold(unsigned int handle,
+	const unsigned char enable,
+	const unsigned short peak_power_budget,
+	const unsigned short avg_power_budget,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_SystemTime(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_SystemTime(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_PlatformConfigData(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
 	const unsigned int offset,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_PlatformConfigData(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_NamespaceLabels(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
 	const unsigned int offset,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_NamespaceLabels(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_DimmPartitionInfo(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_DimmPartitionInfo(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_FwDebugLogLevel(unsigned int handle,
 	const unsigned char log_id,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_FwDebugLogLevel(unsigned int handle,
+	const unsigned char log_id,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_FwLoadFlag(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_FwLoadFlag(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_ConfigLockdown(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_ConfigLockdown(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_DdrtIoInitInfo(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_DdrtIoInitInfo(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_GetSupportedSkuFeatures(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_GetSupportedSkuFeatures(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_EnableDimm(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_EnableDimm(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_SmartHealthInfo(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_SmartHealthInfo(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_FirmwareImageInfo(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_FirmwareImageInfo(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_FirmwareDebugLog(unsigned int handle,
 	const unsigned char log_action,
 	const unsigned int log_page_offset,
 	const unsigned char log_id,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_FirmwareDebugLog(unsigned int handle,
+	const unsigned char log_action,
+	const unsigned int log_page_offset,
+	const unsigned char log_id,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_MemoryInfoPage0(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_MemoryInfoPage0(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_MemoryInfoPage1(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_MemoryInfoPage1(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_MemoryInfoPage3(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_MemoryInfoPage3(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_LongOperationStatus(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_LongOperationStatus(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_Bsr(unsigned int handle,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_Bsr(unsigned int handle,
+	FwPayloadFormatter &formatter);
+
 virtual enum return_code fwGetPayload_Format(unsigned int handle,
 	const unsigned char fill_pattern,
 	const unsigned char preserve_pdas_write_count,
 	std::string &resultString);
 
+virtual enum return_code fwGetPayload_Format(unsigned int handle,
+	const unsigned char fill_pattern,
+	const unsigned char preserve_pdas_write_count,
+	FwPayloadFormatter &formatter);
+
 virtual std::string fwPayloadToString_IdentifyDimm(
 	const struct fwcmd_identify_dimm_data *p_data);
 
@@ -409,6 +535,279 @@ virtual std::string fwPayloadFieldsToString_LongOperationStatus(
 virtual std::string fwPayloadFieldsToString_Bsr(
 	const struct fwcmd_bsr_data *p_data);
 
+virtual void fwPayloadFormat_IdentifyDimm(
+	const struct fwcmd_identify_dimm_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_IdentifyDimm(
+	const struct fwcmd_identify_dimm_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_IdentifyDimm(
+	const struct fwcmd_identify_dimm_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_IdentifyDimmCharacteristics(
+	const struct fwcmd_identify_dimm_characteristics_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_IdentifyDimmCharacteristics(
+	const struct fwcmd_identify_dimm_characteristics_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_IdentifyDimmCharacteristics(
+	const struct fwcmd_identify_dimm_characteristics_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_GetSecurityState(
+	const struct fwcmd_get_security_state_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_GetSecurityState(
+	const struct fwcmd_get_security_state_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_GetSecurityState(
+	const struct fwcmd_get_security_state_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_GetAlarmThreshold(
+	const struct fwcmd_get_alarm_threshold_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_GetAlarmThreshold(
+	const struct fwcmd_get_alarm_threshold_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_GetAlarmThreshold(
+	const struct fwcmd_get_alarm_threshold_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_PowerManagementPolicy(
+	const struct fwcmd_power_management_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_PowerManagementPolicy(
+	const struct fwcmd_power_management_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_PowerManagementPolicy(
+	const struct fwcmd_power_management_policy_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_DieSparingPolicy(
+	const struct fwcmd_die_sparing_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_DieSparingPolicy(
+	const struct fwcmd_die_sparing_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_DieSparingPolicy(
+	const struct fwcmd_die_sparing_policy_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_AddressRangeScrub(
+	const struct fwcmd_address_range_scrub_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_AddressRangeScrub(
+	const struct fwcmd_address_range_scrub_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_AddressRangeScrub(
+	const struct fwcmd_address_range_scrub_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_OptionalConfigurationDataPolicy(
+	const struct fwcmd_optional_configuration_data_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_OptionalConfigurationDataPolicy(
+	const struct fwcmd_optional_configuration_data_policy_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_OptionalConfigurationDataPolicy(
+	const struct fwcmd_optional_configuration_data_policy_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_PmonRegisters(
+	const struct fwcmd_pmon_registers_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_PmonRegisters(
+	const struct fwcmd_pmon_registers_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_PmonRegisters(
+	const struct fwcmd_pmon_registers_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_SystemTime(
+	const struct fwcmd_system_time_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_SystemTime(
+	const struct fwcmd_system_time_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_SystemTime(
+	const struct fwcmd_system_time_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_DeviceIdentificationV1(
+	const struct fwcmd_device_identification_v1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_DeviceIdentificationV1(
+	const struct fwcmd_device_identification_v1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_DeviceIdentificationV1(
+	const struct fwcmd_device_identification_v1_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_DeviceIdentificationV2(
+	const struct fwcmd_device_identification_v2_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_DeviceIdentificationV2(
+	const struct fwcmd_device_identification_v2_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_DeviceIdentificationV2(
+	const struct fwcmd_device_identification_v2_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_IdInfoTable(
+	const struct fwcmd_id_info_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_IdInfoTable(
+	const struct fwcmd_id_info_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_IdInfoTable(
+	const struct fwcmd_id_info_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_InterleaveInformationTable(
+	const struct fwcmd_interleave_information_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_InterleaveInformationTable(
+	const struct fwcmd_interleave_information_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_InterleaveInformationTable(
+	const struct fwcmd_interleave_information_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_PartitionSizeChangeTable(
+	const struct fwcmd_partition_size_change_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_PartitionSizeChangeTable(
+	const struct fwcmd_partition_size_change_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_PartitionSizeChangeTable(
+	const struct fwcmd_partition_size_change_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_CurrentConfigTable(
+	const struct fwcmd_current_config_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_CurrentConfigTable(
+	const struct fwcmd_current_config_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_CurrentConfigTable(
+	const struct fwcmd_current_config_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_ConfigInputTable(
+	const struct fwcmd_config_input_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_ConfigInputTable(
+	const struct fwcmd_config_input_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_ConfigInputTable(
+	const struct fwcmd_config_input_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_ConfigOutputTable(
+	const struct fwcmd_config_output_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_ConfigOutputTable(
+	const struct fwcmd_config_output_table_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_ConfigOutputTable(
+	const struct fwcmd_config_output_table_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_PlatformConfigData(
+	const struct fwcmd_platform_config_data_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_PlatformConfigData(
+	const struct fwcmd_platform_config_data_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_PlatformConfigData(
+	const struct fwcmd_platform_config_data_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_NsIndex(
+	const struct fwcmd_ns_index_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_NsIndex(
+	const struct fwcmd_ns_index_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_NsIndex(
+	const struct fwcmd_ns_index_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_NsLabel(
+	const struct fwcmd_ns_label_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_NsLabel(
+	const struct fwcmd_ns_label_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_NsLabel(
+	const struct fwcmd_ns_label_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_NsLabelV11(
+	const struct fwcmd_ns_label_v1_1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_NsLabelV11(
+	const struct fwcmd_ns_label_v1_1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_NsLabelV11(
+	const struct fwcmd_ns_label_v1_1_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_NsLabelV12(
+	const struct fwcmd_ns_label_v1_2_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_NsLabelV12(
+	const struct fwcmd_ns_label_v1_2_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_NsLabelV12(
+	const struct fwcmd_ns_label_v1_2_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_NamespaceLabels(
+	const struct fwcmd_namespace_labels_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_NamespaceLabels(
+	const struct fwcmd_namespace_labels_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_NamespaceLabels(
+	const struct fwcmd_namespace_labels_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_DimmPartitionInfo(
+	const struct fwcmd_dimm_partition_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_DimmPartitionInfo(
+	const struct fwcmd_dimm_partition_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_DimmPartitionInfo(
+	const struct fwcmd_dimm_partition_info_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_FwDebugLogLevel(
+	const struct fwcmd_fw_debug_log_level_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_FwDebugLogLevel(
+	const struct fwcmd_fw_debug_log_level_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_FwDebugLogLevel(
+	const struct fwcmd_fw_debug_log_level_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_FwLoadFlag(
+	const struct fwcmd_fw_load_flag_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_FwLoadFlag(
+	const struct fwcmd_fw_load_flag_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_FwLoadFlag(
+	const struct fwcmd_fw_load_flag_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_ConfigLockdown(
+	const struct fwcmd_config_lockdown_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_ConfigLockdown(
+	const struct fwcmd_config_lockdown_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_ConfigLockdown(
+	const struct fwcmd_config_lockdown_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_DdrtIoInitInfo(
+	const struct fwcmd_ddrt_io_init_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_DdrtIoInitInfo(
+	const struct fwcmd_ddrt_io_init_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_DdrtIoInitInfo(
+	const struct fwcmd_ddrt_io_init_info_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_GetSupportedSkuFeatures(
+	const struct fwcmd_get_supported_sku_features_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_GetSupportedSkuFeatures(
+	const struct fwcmd_get_supported_sku_features_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_GetSupportedSkuFeatures(
+	const struct fwcmd_get_supported_sku_features_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_EnableDimm(
+	const struct fwcmd_enable_dimm_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_EnableDimm(
+	const struct fwcmd_enable_dimm_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_EnableDimm(
+	const struct fwcmd_enable_dimm_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_SmartHealthInfo(
+	const struct fwcmd_smart_health_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_SmartHealthInfo(
+	const struct fwcmd_smart_health_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_SmartHealthInfo(
+	const struct fwcmd_smart_health_info_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_FirmwareImageInfo(
+	const struct fwcmd_firmware_image_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_FirmwareImageInfo(
+	const struct fwcmd_firmware_image_info_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_FirmwareImageInfo(
+	const struct fwcmd_firmware_image_info_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_FirmwareDebugLog(
+	const struct fwcmd_firmware_debug_log_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_FirmwareDebugLog(
+	const struct fwcmd_firmware_debug_log_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_FirmwareDebugLog(
+	const struct fwcmd_firmware_debug_log_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_MemoryInfoPage0(
+	const struct fwcmd_memory_info_page_0_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_MemoryInfoPage0(
+	const struct fwcmd_memory_info_page_0_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_MemoryInfoPage0(
+	const struct fwcmd_memory_info_page_0_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_MemoryInfoPage1(
+	const struct fwcmd_memory_info_page_1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_MemoryInfoPage1(
+	const struct fwcmd_memory_info_page_1_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_MemoryInfoPage1(
+	const struct fwcmd_memory_info_page_1_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_MemoryInfoPage3(
+	const struct fwcmd_memory_info_page_3_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_MemoryInfoPage3(
+	const struct fwcmd_memory_info_page_3_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_MemoryInfoPage3(
+	const struct fwcmd_memory_info_page_3_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_LongOperationStatus(
+	const struct fwcmd_long_operation_status_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_LongOperationStatus(
+	const struct fwcmd_long_operation_status_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_LongOperationStatus(
+	const struct fwcmd_long_operation_status_data *p_data, FwPayloadFormatter &formatter);
+
+virtual void fwPayloadFormat_Bsr(
+	const struct fwcmd_bsr_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadFieldsFormat_Bsr(
+	const struct fwcmd_bsr_data *p_data, FwPayloadFormatter &formatter);
+virtual void fwPayloadMembersFormat_Bsr(
+	const struct fwcmd_bsr_data *p_data, FwPayloadFormatter &formatter);
+
 virtual enum return_code dsm_err_to_nvm_lib_err(pt_result result);
 
 virtual enum return_code fw_mb_err_to_nvm_lib_err(int extended_status);
@@ -26,96 +26,117 @@
  */
 #include "FwCommands.h"
 
-#include <sstream>
+#include <stdio.h>
 
 namespace core
 {
 namespace firmware_interface
 {
 
-void addInterleaveInfoTable(FwCommands *p_fwCmd, std::stringstream &result,
+void addInterleaveInfoTable(FwCommands *p_fwCmd, FwPayloadFormatter &formatter,
 	int pDataCount, const struct fwcmd_interleave_information_table_data *pData, int revision)
 {
 	for (int i = 0; i < pDataCount; i++)
 	{
-		result << p_fwCmd->fwPayloadFieldsToString_InterleaveInformationTable(&pData[i]);
+		formatter.beginPayload("Platform Config Data Interleave Information Table");
+		p_fwCmd->fwPayloadMembersFormat_InterleaveInformationTable(&pData[i], formatter);
 
 		for (int j = 0; j < pData[i].id_info_table_count; j++)
 		{
 			fwcmd_id_info_table_data *pInfoTableData = &pData->id_info_table[j];
-			result << "\nPlatform Config Data Identification Information Table:" << "\n";
+			formatter.beginPayload("Platform Config Data Identification Information Table");
 
 			if (revision == 1)
 			{
 				fwcmd_device_identification_v1_data &v1Data = pInfoTableData->device_identification.device_identification_v1;
-				result << "ManufacturerId: " << v1Data.manufacturer_id << "\n";
-				result << "SerialNumber: " << v1Data.serial_number << "\n";
-				result << "ModelNumber: " << v1Data.model_number << "\n";
+				formatter.field("ManufacturerId", v1Data.manufacturer_id);
+				formatter.field("SerialNumber", v1Data.serial_number);
+				formatter.field("ModelNumber", v1Data.model_number);
 			}
 			else if (revision == 2)
 			{
 				fwcmd_device_identification_v2_data &v2Data = pInfoTableData->device_identification.device_identification_v2;
-				result << "Uid: ";
+				std::string uid;
 				for (int u = 0; u < 9; u++)
 				{
-					result << std::hex << (int)v2Data.uid[u];
+					char hex[4];
+					snprintf(hex, sizeof (hex), "%x", (int)v2Data.uid[u]);
+					uid += hex;
 				}
-				result << "\n";
+				formatter.field("Uid", uid);
 			}
 
-			result << "PartitionOffset: " << pInfoTableData->partition_offset << "\n";
-			result << "PartitionSize: " << pInfoTableData->partition_size << "\n";
+			formatter.field("PartitionOffset", pInfoTableData->partition_offset);
+			formatter.field("PartitionSize", pInfoTableData->partition_size);
+			formatter.endPayload();
 		}
+		formatter.endPayload();
 	}
 }
 
-void addPartitionSizeChangeTable(FwCommands *pCmds, std::stringstream &result,
+void addPartitionSizeChangeTable(FwCommands *pCmds, FwPayloadFormatter &formatter,
 	fwcmd_partition_size_change_table_data *table_data, int tableCount)
 {
 	for (int j = 0; j < tableCount; j++)
 	{
-		result << pCmds->fwPayloadFieldsToString_PartitionSizeChangeTable(&table_data[j]);
+		pCmds->fwPayloadFieldsFormat_PartitionSizeChangeTable(&table_data[j], formatter);
 	}
 }
 
-std::string FwCommands::fwPayloadToString_Custom_PlatformConfigData(
-	fwcmd_platform_config_data_data *pData)
+void FwCommands::fwPayloadFormat_Custom_PlatformConfigData(
+	fwcmd_platform_config_data_data *pData, FwPayloadFormatter &formatter)
 {
-	std::stringstream result;
-	result << fwPayloadFieldsToString_PlatformConfigData(pData);
+	// the tables nest under the header, which only shows in JSON
+	formatter.beginPayload("Platform Config Data Configuration Header Table");
+	fwPayloadMembersFormat_PlatformConfigData(pData, formatter);
 
 	// Add Current
 	fwcmd_current_config_table_data *pCurrent = &(pData->current_config_table);
-	result << fwPayloadFieldsToString_CurrentConfigTable(pCurrent);
-	addInterleaveInfoTable(this, result,
+	formatter.beginPayload("Platform Config Data Current Config Table");
+	fwPayloadMembersFormat_CurrentConfigTable(pCurrent, formatter);
+	addInterleaveInfoTable(this, formatter,
 		pCurrent->interleave_information_table_count,
 		pCurrent->interleave_information_table,
 		pCurrent->revision);
+	formatter.endPayload();
 
 	// Add Input
 	fwcmd_config_input_table_data *pInput = &(pData->config_input_table);
-	result << fwPayloadFieldsToString_ConfigInputTable(pInput);
-	addInterleaveInfoTable(this, result,
+	formatter.beginPayload("Platform Config Data Config Input Table");
+	fwPayloadMembersFormat_ConfigInputTable(pInput, formatter);
+	addInterleaveInfoTable(this, formatter,
 		pInput->interleave_information_table_count,
 		pInput->interleave_information_table,
 		pInput->revision);
-	addPartitionSizeChangeTable(this, result,
+	addPartitionSizeChangeTable(this, formatter,
 		pInput->partition_size_change_table,
 		pInput->partition_size_change_table_count);
+	formatter.endPayload();
 
 	// Add Output
 	fwcmd_config_output_table_data *pOutput = &(pData->config_output_table);
-	result << fwPayloadFieldsToString_ConfigOutputTable(pOutput);
-	addInterleaveInfoTable(this, result,
+	formatter.beginPayload("Platform Config Data Config Output Table");
+	fwPayloadMembersFormat_ConfigOutputTable(pOutput, formatter);
+	addInterleaveInfoTable(this, formatter,
 		pOutput->interleave_information_table_count,
 		pOutput->interleave_information_table,
 		pOutput->revision);
-	addPartitionSizeChangeTable(this, result,
+	addPartitionSizeChangeTable(this, formatter,
 		pOutput->partition_size_change_table,
 		pOutput->partition_size_change_table_count);
+	formatter.endPayload();
+
+	formatter.endPayload();
+}
 
-	return result.str();
+std::string FwCommands::fwPayloadToString_Custom_PlatformConfigData(
+	fwcmd_platform_config_data_data *pData)
+{
+	std::string result;
+	FwPayloadFormatter formatter(result);
+	fwPayloadFormat_Custom_PlatformConfigData(pData, formatter);
+	return result;
 }
 
 }
-}
\ No newline at end of file
+}
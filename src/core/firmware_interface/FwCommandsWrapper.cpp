@@ -64,6 +64,24 @@ void FwCommandsWrapper::FwcmdFreeIdentifyDimm(struct fwcmd_identify_dimm_result
 	fwcmd_free_identify_dimm(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetIdentifyDimmInto(unsigned int handle,
+struct fwcmd_identify_dimm_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_identify_dimm_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeIdentifyDimmData(struct fwcmd_identify_dimm_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_identify_dimm_data(p_data);
+}
+
 struct fwcmd_identify_dimm_characteristics_result FwCommandsWrapper::FwcmdAllocIdentifyDimmCharacteristics(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -78,6 +96,24 @@ void FwCommandsWrapper::FwcmdFreeIdentifyDimmCharacteristics(struct fwcmd_identi
 	fwcmd_free_identify_dimm_characteristics(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetIdentifyDimmCharacteristicsInto(unsigned int handle,
+struct fwcmd_identify_dimm_characteristics_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_identify_dimm_characteristics_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeIdentifyDimmCharacteristicsData(struct fwcmd_identify_dimm_characteristics_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_identify_dimm_characteristics_data(p_data);
+}
+
 struct fwcmd_get_security_state_result FwCommandsWrapper::FwcmdAllocGetSecurityState(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -92,6 +128,24 @@ void FwCommandsWrapper::FwcmdFreeGetSecurityState(struct fwcmd_get_security_stat
 	fwcmd_free_get_security_state(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetGetSecurityStateInto(unsigned int handle,
+struct fwcmd_get_security_state_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_get_security_state_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeGetSecurityStateData(struct fwcmd_get_security_state_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_get_security_state_data(p_data);
+}
+
 struct fwcmd_set_passphrase_result FwCommandsWrapper::FwcmdCallSetPassphrase(unsigned int handle,
 const char current_passphrase[33],
 const char new_passphrase[33]) const
@@ -151,6 +205,24 @@ void FwCommandsWrapper::FwcmdFreeGetAlarmThreshold(struct fwcmd_get_alarm_thresh
 	fwcmd_free_get_alarm_threshold(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetGetAlarmThresholdInto(unsigned int handle,
+struct fwcmd_get_alarm_threshold_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_get_alarm_threshold_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeGetAlarmThresholdData(struct fwcmd_get_alarm_threshold_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_get_alarm_threshold_data(p_data);
+}
+
 struct fwcmd_power_management_policy_result FwCommandsWrapper::FwcmdAllocPowerManagementPolicy(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -165,6 +237,24 @@ void FwCommandsWrapper::FwcmdFreePowerManagementPolicy(struct fwcmd_power_manage
 	fwcmd_free_power_management_policy(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetPowerManagementPolicyInto(unsigned int handle,
+struct fwcmd_power_management_policy_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_power_management_policy_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreePowerManagementPolicyData(struct fwcmd_power_management_policy_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_power_management_policy_data(p_data);
+}
+
 struct fwcmd_die_sparing_policy_result FwCommandsWrapper::FwcmdAllocDieSparingPolicy(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -179,6 +269,24 @@ void FwCommandsWrapper::FwcmdFreeDieSparingPolicy(struct fwcmd_die_sparing_polic
 	fwcmd_free_die_sparing_policy(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetDieSparingPolicyInto(unsigned int handle,
+struct fwcmd_die_sparing_policy_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_die_sparing_policy_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeDieSparingPolicyData(struct fwcmd_die_sparing_policy_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_die_sparing_policy_data(p_data);
+}
+
 struct fwcmd_address_range_scrub_result FwCommandsWrapper::FwcmdAllocAddressRangeScrub(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -193,6 +301,24 @@ void FwCommandsWrapper::FwcmdFreeAddressRangeScrub(struct fwcmd_address_range_sc
 	fwcmd_free_address_range_scrub(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetAddressRangeScrubInto(unsigned int handle,
+struct fwcmd_address_range_scrub_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_address_range_scrub_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeAddressRangeScrubData(struct fwcmd_address_range_scrub_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_address_range_scrub_data(p_data);
+}
+
 struct fwcmd_optional_configuration_data_policy_result FwCommandsWrapper::FwcmdAllocOptionalConfigurationDataPolicy(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -207,6 +333,24 @@ void FwCommandsWrapper::FwcmdFreeOptionalConfigurationDataPolicy(struct fwcmd_op
 	fwcmd_free_optional_configuration_data_policy(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetOptionalConfigurationDataPolicyInto(unsigned int handle,
+struct fwcmd_optional_configuration_data_policy_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_optional_configuration_data_policy_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeOptionalConfigurationDataPolicyData(struct fwcmd_optional_configuration_data_policy_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_optional_configuration_data_policy_data(p_data);
+}
+
 struct fwcmd_pmon_registers_result FwCommandsWrapper::FwcmdAllocPmonRegisters(unsigned int handle,
 const unsigned short pmon_retreive_mask) const
 {
@@ -223,6 +367,26 @@ void FwCommandsWrapper::FwcmdFreePmonRegisters(struct fwcmd_pmon_registers_resul
 	fwcmd_free_pmon_registers(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetPmonRegistersInto(unsigned int handle,
+const unsigned short pmon_retreive_mask,
+struct fwcmd_pmon_registers_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_pmon_registers_into(handle,
+	pmon_retreive_mask,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreePmonRegistersData(struct fwcmd_pmon_registers_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_pmon_registers_data(p_data);
+}
+
 struct fwcmd_set_alarm_threshold_result FwCommandsWrapper::FwcmdCallSetAlarmThreshold(unsigned int handle,
 const unsigned char enable,
 const unsigned short peak_power_budget,
@@ -250,6 +414,24 @@ void FwCommandsWrapper::FwcmdFreeSystemTime(struct fwcmd_system_time_result *p_r
 	fwcmd_free_system_time(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetSystemTimeInto(unsigned int handle,
+struct fwcmd_system_time_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_system_time_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeSystemTimeData(struct fwcmd_system_time_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_system_time_data(p_data);
+}
+
 struct fwcmd_platform_config_data_result FwCommandsWrapper::FwcmdAllocPlatformConfigData(unsigned int handle,
 const unsigned char partition_id,
 const unsigned char command_option,
@@ -270,6 +452,30 @@ void FwCommandsWrapper::FwcmdFreePlatformConfigData(struct fwcmd_platform_config
 	fwcmd_free_platform_config_data(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetPlatformConfigDataInto(unsigned int handle,
+const unsigned char partition_id,
+const unsigned char command_option,
+const unsigned int offset,
+struct fwcmd_platform_config_data_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_platform_config_data_into(handle,
+	partition_id,
+	command_option,
+	offset,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreePlatformConfigDataData(struct fwcmd_platform_config_data_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_platform_config_data_data(p_data);
+}
+
 struct fwcmd_namespace_labels_result FwCommandsWrapper::FwcmdAllocNamespaceLabels(unsigned int handle,
 const unsigned char partition_id,
 const unsigned char command_option,
@@ -290,6 +496,30 @@ void FwCommandsWrapper::FwcmdFreeNamespaceLabels(struct fwcmd_namespace_labels_r
 	fwcmd_free_namespace_labels(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetNamespaceLabelsInto(unsigned int handle,
+const unsigned char partition_id,
+const unsigned char command_option,
+const unsigned int offset,
+struct fwcmd_namespace_labels_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_namespace_labels_into(handle,
+	partition_id,
+	command_option,
+	offset,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeNamespaceLabelsData(struct fwcmd_namespace_labels_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_namespace_labels_data(p_data);
+}
+
 struct fwcmd_dimm_partition_info_result FwCommandsWrapper::FwcmdAllocDimmPartitionInfo(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -304,6 +534,24 @@ void FwCommandsWrapper::FwcmdFreeDimmPartitionInfo(struct fwcmd_dimm_partition_i
 	fwcmd_free_dimm_partition_info(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetDimmPartitionInfoInto(unsigned int handle,
+struct fwcmd_dimm_partition_info_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_dimm_partition_info_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeDimmPartitionInfoData(struct fwcmd_dimm_partition_info_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_dimm_partition_info_data(p_data);
+}
+
 struct fwcmd_fw_debug_log_level_result FwCommandsWrapper::FwcmdAllocFwDebugLogLevel(unsigned int handle,
 const unsigned char log_id) const
 {
@@ -320,6 +568,26 @@ void FwCommandsWrapper::FwcmdFreeFwDebugLogLevel(struct fwcmd_fw_debug_log_level
 	fwcmd_free_fw_debug_log_level(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetFwDebugLogLevelInto(unsigned int handle,
+const unsigned char log_id,
+struct fwcmd_fw_debug_log_level_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_fw_debug_log_level_into(handle,
+	log_id,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeFwDebugLogLevelData(struct fwcmd_fw_debug_log_level_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_fw_debug_log_level_data(p_data);
+}
+
 struct fwcmd_fw_load_flag_result FwCommandsWrapper::FwcmdAllocFwLoadFlag(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -334,6 +602,24 @@ void FwCommandsWrapper::FwcmdFreeFwLoadFlag(struct fwcmd_fw_load_flag_result *p_
 	fwcmd_free_fw_load_flag(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetFwLoadFlagInto(unsigned int handle,
+struct fwcmd_fw_load_flag_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_fw_load_flag_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeFwLoadFlagData(struct fwcmd_fw_load_flag_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_fw_load_flag_data(p_data);
+}
+
 struct fwcmd_config_lockdown_result FwCommandsWrapper::FwcmdAllocConfigLockdown(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -348,6 +634,24 @@ void FwCommandsWrapper::FwcmdFreeConfigLockdown(struct fwcmd_config_lockdown_res
 	fwcmd_free_config_lockdown(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetConfigLockdownInto(unsigned int handle,
+struct fwcmd_config_lockdown_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_config_lockdown_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeConfigLockdownData(struct fwcmd_config_lockdown_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_config_lockdown_data(p_data);
+}
+
 struct fwcmd_ddrt_io_init_info_result FwCommandsWrapper::FwcmdAllocDdrtIoInitInfo(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -362,6 +666,24 @@ void FwCommandsWrapper::FwcmdFreeDdrtIoInitInfo(struct fwcmd_ddrt_io_init_info_r
 	fwcmd_free_ddrt_io_init_info(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetDdrtIoInitInfoInto(unsigned int handle,
+struct fwcmd_ddrt_io_init_info_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_ddrt_io_init_info_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeDdrtIoInitInfoData(struct fwcmd_ddrt_io_init_info_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_ddrt_io_init_info_data(p_data);
+}
+
 struct fwcmd_get_supported_sku_features_result FwCommandsWrapper::FwcmdAllocGetSupportedSkuFeatures(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -376,6 +698,24 @@ void FwCommandsWrapper::FwcmdFreeGetSupportedSkuFeatures(struct fwcmd_get_suppor
 	fwcmd_free_get_supported_sku_features(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetGetSupportedSkuFeaturesInto(unsigned int handle,
+struct fwcmd_get_supported_sku_features_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_get_supported_sku_features_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeGetSupportedSkuFeaturesData(struct fwcmd_get_supported_sku_features_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_get_supported_sku_features_data(p_data);
+}
+
 struct fwcmd_enable_dimm_result FwCommandsWrapper::FwcmdAllocEnableDimm(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -390,6 +730,24 @@ void FwCommandsWrapper::FwcmdFreeEnableDimm(struct fwcmd_enable_dimm_result *p_r
 	fwcmd_free_enable_dimm(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetEnableDimmInto(unsigned int handle,
+struct fwcmd_enable_dimm_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_enable_dimm_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeEnableDimmData(struct fwcmd_enable_dimm_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_enable_dimm_data(p_data);
+}
+
 struct fwcmd_smart_health_info_result FwCommandsWrapper::FwcmdAllocSmartHealthInfo(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -404,6 +762,24 @@ void FwCommandsWrapper::FwcmdFreeSmartHealthInfo(struct fwcmd_smart_health_info_
 	fwcmd_free_smart_health_info(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetSmartHealthInfoInto(unsigned int handle,
+struct fwcmd_smart_health_info_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_smart_health_info_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeSmartHealthInfoData(struct fwcmd_smart_health_info_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_smart_health_info_data(p_data);
+}
+
 struct fwcmd_firmware_image_info_result FwCommandsWrapper::FwcmdAllocFirmwareImageInfo(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -418,6 +794,24 @@ void FwCommandsWrapper::FwcmdFreeFirmwareImageInfo(struct fwcmd_firmware_image_i
 	fwcmd_free_firmware_image_info(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetFirmwareImageInfoInto(unsigned int handle,
+struct fwcmd_firmware_image_info_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_firmware_image_info_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeFirmwareImageInfoData(struct fwcmd_firmware_image_info_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_firmware_image_info_data(p_data);
+}
+
 struct fwcmd_firmware_debug_log_result FwCommandsWrapper::FwcmdAllocFirmwareDebugLog(unsigned int handle,
 const unsigned char log_action,
 const unsigned int log_page_offset,
@@ -438,6 +832,30 @@ void FwCommandsWrapper::FwcmdFreeFirmwareDebugLog(struct fwcmd_firmware_debug_lo
 	fwcmd_free_firmware_debug_log(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetFirmwareDebugLogInto(unsigned int handle,
+const unsigned char log_action,
+const unsigned int log_page_offset,
+const unsigned char log_id,
+struct fwcmd_firmware_debug_log_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_firmware_debug_log_into(handle,
+	log_action,
+	log_page_offset,
+	log_id,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeFirmwareDebugLogData(struct fwcmd_firmware_debug_log_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_firmware_debug_log_data(p_data);
+}
+
 struct fwcmd_memory_info_page_0_result FwCommandsWrapper::FwcmdAllocMemoryInfoPage0(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -452,6 +870,24 @@ void FwCommandsWrapper::FwcmdFreeMemoryInfoPage0(struct fwcmd_memory_info_page_0
 	fwcmd_free_memory_info_page_0(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetMemoryInfoPage0Into(unsigned int handle,
+struct fwcmd_memory_info_page_0_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_memory_info_page_0_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeMemoryInfoPage0Data(struct fwcmd_memory_info_page_0_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_memory_info_page_0_data(p_data);
+}
+
 struct fwcmd_memory_info_page_1_result FwCommandsWrapper::FwcmdAllocMemoryInfoPage1(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -466,6 +902,24 @@ void FwCommandsWrapper::FwcmdFreeMemoryInfoPage1(struct fwcmd_memory_info_page_1
 	fwcmd_free_memory_info_page_1(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetMemoryInfoPage1Into(unsigned int handle,
+struct fwcmd_memory_info_page_1_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_memory_info_page_1_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeMemoryInfoPage1Data(struct fwcmd_memory_info_page_1_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_memory_info_page_1_data(p_data);
+}
+
 struct fwcmd_memory_info_page_3_result FwCommandsWrapper::FwcmdAllocMemoryInfoPage3(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -480,6 +934,24 @@ void FwCommandsWrapper::FwcmdFreeMemoryInfoPage3(struct fwcmd_memory_info_page_3
 	fwcmd_free_memory_info_page_3(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetMemoryInfoPage3Into(unsigned int handle,
+struct fwcmd_memory_info_page_3_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_memory_info_page_3_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeMemoryInfoPage3Data(struct fwcmd_memory_info_page_3_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_memory_info_page_3_data(p_data);
+}
+
 struct fwcmd_long_operation_status_result FwCommandsWrapper::FwcmdAllocLongOperationStatus(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -494,6 +966,24 @@ void FwCommandsWrapper::FwcmdFreeLongOperationStatus(struct fwcmd_long_operation
 	fwcmd_free_long_operation_status(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetLongOperationStatusInto(unsigned int handle,
+struct fwcmd_long_operation_status_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_long_operation_status_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeLongOperationStatusData(struct fwcmd_long_operation_status_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_long_operation_status_data(p_data);
+}
+
 struct fwcmd_bsr_result FwCommandsWrapper::FwcmdAllocBsr(unsigned int handle) const
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
@@ -508,6 +998,24 @@ void FwCommandsWrapper::FwcmdFreeBsr(struct fwcmd_bsr_result *p_result) const
 	fwcmd_free_bsr(p_result);
 }
 
+int FwCommandsWrapper::FwcmdGetBsrInto(unsigned int handle,
+struct fwcmd_bsr_data *p_data,
+struct fwcmd_error_code *p_error) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	return fwcmd_get_bsr_into(handle,
+	p_data,
+	p_error);
+}
+
+void FwCommandsWrapper::FwcmdFreeBsrData(struct fwcmd_bsr_data *p_data) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	fwcmd_free_bsr_data(p_data);
+}
+
 struct fwcmd_format_result FwCommandsWrapper::FwcmdCallFormat(unsigned int handle,
 const unsigned char fill_pattern,
 const unsigned char preserve_pdas_write_count) const
@@ -48,14 +48,32 @@ public:
 
 	virtual void FwcmdFreeIdentifyDimm(struct fwcmd_identify_dimm_result *p_result) const;
 
+	virtual int FwcmdGetIdentifyDimmInto(unsigned int handle,
+	struct fwcmd_identify_dimm_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeIdentifyDimmData(struct fwcmd_identify_dimm_data *p_data) const;
+
 	virtual struct fwcmd_identify_dimm_characteristics_result FwcmdAllocIdentifyDimmCharacteristics(unsigned int handle) const;
 
 	virtual void FwcmdFreeIdentifyDimmCharacteristics(struct fwcmd_identify_dimm_characteristics_result *p_result) const;
 
+	virtual int FwcmdGetIdentifyDimmCharacteristicsInto(unsigned int handle,
+	struct fwcmd_identify_dimm_characteristics_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeIdentifyDimmCharacteristicsData(struct fwcmd_identify_dimm_characteristics_data *p_data) const;
+
 	virtual struct fwcmd_get_security_state_result FwcmdAllocGetSecurityState(unsigned int handle) const;
 
 	virtual void FwcmdFreeGetSecurityState(struct fwcmd_get_security_state_result *p_result) const;
 
+	virtual int FwcmdGetGetSecurityStateInto(unsigned int handle,
+	struct fwcmd_get_security_state_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeGetSecurityStateData(struct fwcmd_get_security_state_data *p_data) const;
+
 	virtual struct fwcmd_set_passphrase_result FwcmdCallSetPassphrase(unsigned int handle,
 	const char current_passphrase[33],
 	const char new_passphrase[33]) const;
@@ -75,27 +93,64 @@ public:
 
 	virtual void FwcmdFreeGetAlarmThreshold(struct fwcmd_get_alarm_threshold_result *p_result) const;
 
+	virtual int FwcmdGetGetAlarmThresholdInto(unsigned int handle,
+	struct fwcmd_get_alarm_threshold_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeGetAlarmThresholdData(struct fwcmd_get_alarm_threshold_data *p_data) const;
+
 	virtual struct fwcmd_power_management_policy_result FwcmdAllocPowerManagementPolicy(unsigned int handle) const;
 
 	virtual void FwcmdFreePowerManagementPolicy(struct fwcmd_power_management_policy_result *p_result) const;
 
+	virtual int FwcmdGetPowerManagementPolicyInto(unsigned int handle,
+	struct fwcmd_power_management_policy_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreePowerManagementPolicyData(struct fwcmd_power_management_policy_data *p_data) const;
+
 	virtual struct fwcmd_die_sparing_policy_result FwcmdAllocDieSparingPolicy(unsigned int handle) const;
 
 	virtual void FwcmdFreeDieSparingPolicy(struct fwcmd_die_sparing_policy_result *p_result) const;
 
+	virtual int FwcmdGetDieSparingPolicyInto(unsigned int handle,
+	struct fwcmd_die_sparing_policy_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeDieSparingPolicyData(struct fwcmd_die_sparing_policy_data *p_data) const;
+
 	virtual struct fwcmd_address_range_scrub_result FwcmdAllocAddressRangeScrub(unsigned int handle) const;
 
 	virtual void FwcmdFreeAddressRangeScrub(struct fwcmd_address_range_scrub_result *p_result) const;
 
+	virtual int FwcmdGetAddressRangeScrubInto(unsigned int handle,
+	struct fwcmd_address_range_scrub_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeAddressRangeScrubData(struct fwcmd_address_range_scrub_data *p_data) const;
+
 	virtual struct fwcmd_optional_configuration_data_policy_result FwcmdAllocOptionalConfigurationDataPolicy(unsigned int handle) const;
 
 	virtual void FwcmdFreeOptionalConfigurationDataPolicy(struct fwcmd_optional_configuration_data_policy_result *p_result) const;
 
+	virtual int FwcmdGetOptionalConfigurationDataPolicyInto(unsigned int handle,
+	struct fwcmd_optional_configuration_data_policy_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeOptionalConfigurationDataPolicyData(struct fwcmd_optional_configuration_data_policy_data *p_data) const;
+
 	virtual struct fwcmd_pmon_registers_result FwcmdAllocPmonRegisters(unsigned int handle,
 	const unsigned short pmon_retreive_mask) const;
 
 	virtual void FwcmdFreePmonRegisters(struct fwcmd_pmon_registers_result *p_result) const;
 
+	virtual int FwcmdGetPmonRegistersInto(unsigned int handle,
+	const unsigned short pmon_retreive_mask,
+	struct fwcmd_pmon_registers_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreePmonRegistersData(struct fwcmd_pmon_registers_data *p_data) const;
+
 	virtual struct fwcmd_set_alarm_threshold_result FwcmdCallSetAlarmThreshold(unsigned int handle,
 	const unsigned char enable,
 	const unsigned short peak_power_budget,
@@ -105,6 +160,12 @@ public:
 
 	virtual void FwcmdFreeSystemTime(struct fwcmd_system_time_result *p_result) const;
 
+	virtual int FwcmdGetSystemTimeInto(unsigned int handle,
+	struct fwcmd_system_time_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeSystemTimeData(struct fwcmd_system_time_data *p_data) const;
+
 	virtual struct fwcmd_platform_config_data_result FwcmdAllocPlatformConfigData(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
@@ -112,6 +173,15 @@ public:
 
 	virtual void FwcmdFreePlatformConfigData(struct fwcmd_platform_config_data_result *p_result) const;
 
+	virtual int FwcmdGetPlatformConfigDataInto(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	struct fwcmd_platform_config_data_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreePlatformConfigDataData(struct fwcmd_platform_config_data_data *p_data) const;
+
 	virtual struct fwcmd_namespace_labels_result FwcmdAllocNamespaceLabels(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
@@ -119,43 +189,107 @@ public:
 
 	virtual void FwcmdFreeNamespaceLabels(struct fwcmd_namespace_labels_result *p_result) const;
 
+	virtual int FwcmdGetNamespaceLabelsInto(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	struct fwcmd_namespace_labels_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeNamespaceLabelsData(struct fwcmd_namespace_labels_data *p_data) const;
+
 	virtual struct fwcmd_dimm_partition_info_result FwcmdAllocDimmPartitionInfo(unsigned int handle) const;
 
 	virtual void FwcmdFreeDimmPartitionInfo(struct fwcmd_dimm_partition_info_result *p_result) const;
 
+	virtual int FwcmdGetDimmPartitionInfoInto(unsigned int handle,
+	struct fwcmd_dimm_partition_info_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeDimmPartitionInfoData(struct fwcmd_dimm_partition_info_data *p_data) const;
+
 	virtual struct fwcmd_fw_debug_log_level_result FwcmdAllocFwDebugLogLevel(unsigned int handle,
 	const unsigned char log_id) const;
 
 	virtual void FwcmdFreeFwDebugLogLevel(struct fwcmd_fw_debug_log_level_result *p_result) const;
 
+	virtual int FwcmdGetFwDebugLogLevelInto(unsigned int handle,
+	const unsigned char log_id,
+	struct fwcmd_fw_debug_log_level_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeFwDebugLogLevelData(struct fwcmd_fw_debug_log_level_data *p_data) const;
+
 	virtual struct fwcmd_fw_load_flag_result FwcmdAllocFwLoadFlag(unsigned int handle) const;
 
 	virtual void FwcmdFreeFwLoadFlag(struct fwcmd_fw_load_flag_result *p_result) const;
 
+	virtual int FwcmdGetFwLoadFlagInto(unsigned int handle,
+	struct fwcmd_fw_load_flag_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeFwLoadFlagData(struct fwcmd_fw_load_flag_data *p_data) const;
+
 	virtual struct fwcmd_config_lockdown_result FwcmdAllocConfigLockdown(unsigned int handle) const;
 
 	virtual void FwcmdFreeConfigLockdown(struct fwcmd_config_lockdown_result *p_result) const;
 
+	virtual int FwcmdGetConfigLockdownInto(unsigned int handle,
+	struct fwcmd_config_lockdown_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeConfigLockdownData(struct fwcmd_config_lockdown_data *p_data) const;
+
 	virtual struct fwcmd_ddrt_io_init_info_result FwcmdAllocDdrtIoInitInfo(unsigned int handle) const;
 
 	virtual void FwcmdFreeDdrtIoInitInfo(struct fwcmd_ddrt_io_init_info_result *p_result) const;
 
+	virtual int FwcmdGetDdrtIoInitInfoInto(unsigned int handle,
+	struct fwcmd_ddrt_io_init_info_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeDdrtIoInitInfoData(struct fwcmd_ddrt_io_init_info_data *p_data) const;
+
 	virtual struct fwcmd_get_supported_sku_features_result FwcmdAllocGetSupportedSkuFeatures(unsigned int handle) const;
 
 	virtual void FwcmdFreeGetSupportedSkuFeatures(struct fwcmd_get_supported_sku_features_result *p_result) const;
 
+	virtual int FwcmdGetGetSupportedSkuFeaturesInto(unsigned int handle,
+	struct fwcmd_get_supported_sku_features_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeGetSupportedSkuFeaturesData(struct fwcmd_get_supported_sku_features_data *p_data) const;
+
 	virtual struct fwcmd_enable_dimm_result FwcmdAllocEnableDimm(unsigned int handle) const;
 
 	virtual void FwcmdFreeEnableDimm(struct fwcmd_enable_dimm_result *p_result) const;
 
+	virtual int FwcmdGetEnableDimmInto(unsigned int handle,
+	struct fwcmd_enable_dimm_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeEnableDimmData(struct fwcmd_enable_dimm_data *p_data) const;
+
 	virtual struct fwcmd_smart_health_info_result FwcmdAllocSmartHealthInfo(unsigned int handle) const;
 
 	virtual void FwcmdFreeSmartHealthInfo(struct fwcmd_smart_health_info_result *p_result) const;
 
+	virtual int FwcmdGetSmartHealthInfoInto(unsigned int handle,
+	struct fwcmd_smart_health_info_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeSmartHealthInfoData(struct fwcmd_smart_health_info_data *p_data) const;
+
 	virtual struct fwcmd_firmware_image_info_result FwcmdAllocFirmwareImageInfo(unsigned int handle) const;
 
 	virtual void FwcmdFreeFirmwareImageInfo(struct fwcmd_firmware_image_info_result *p_result) const;
 
+	virtual int FwcmdGetFirmwareImageInfoInto(unsigned int handle,
+	struct fwcmd_firmware_image_info_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeFirmwareImageInfoData(struct fwcmd_firmware_image_info_data *p_data) const;
+
 	virtual struct fwcmd_firmware_debug_log_result FwcmdAllocFirmwareDebugLog(unsigned int handle,
 	const unsigned char log_action,
 	const unsigned int log_page_offset,
@@ -163,26 +297,65 @@ public:
 
 	virtual void FwcmdFreeFirmwareDebugLog(struct fwcmd_firmware_debug_log_result *p_result) const;
 
+	virtual int FwcmdGetFirmwareDebugLogInto(unsigned int handle,
+	const unsigned char log_action,
+	const unsigned int log_page_offset,
+	const unsigned char log_id,
+	struct fwcmd_firmware_debug_log_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeFirmwareDebugLogData(struct fwcmd_firmware_debug_log_data *p_data) const;
+
 	virtual struct fwcmd_memory_info_page_0_result FwcmdAllocMemoryInfoPage0(unsigned int handle) const;
 
 	virtual void FwcmdFreeMemoryInfoPage0(struct fwcmd_memory_info_page_0_result *p_result) const;
 
+	virtual int FwcmdGetMemoryInfoPage0Into(unsigned int handle,
+	struct fwcmd_memory_info_page_0_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeMemoryInfoPage0Data(struct fwcmd_memory_info_page_0_data *p_data) const;
+
 	virtual struct fwcmd_memory_info_page_1_result FwcmdAllocMemoryInfoPage1(unsigned int handle) const;
 
 	virtual void FwcmdFreeMemoryInfoPage1(struct fwcmd_memory_info_page_1_result *p_result) const;
 
+	virtual int FwcmdGetMemoryInfoPage1Into(unsigned int handle,
+	struct fwcmd_memory_info_page_1_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeMemoryInfoPage1Data(struct fwcmd_memory_info_page_1_data *p_data) const;
+
 	virtual struct fwcmd_memory_info_page_3_result FwcmdAllocMemoryInfoPage3(unsigned int handle) const;
 
 	virtual void FwcmdFreeMemoryInfoPage3(struct fwcmd_memory_info_page_3_result *p_result) const;
 
+	virtual int FwcmdGetMemoryInfoPage3Into(unsigned int handle,
+	struct fwcmd_memory_info_page_3_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeMemoryInfoPage3Data(struct fwcmd_memory_info_page_3_data *p_data) const;
+
 	virtual struct fwcmd_long_operation_status_result FwcmdAllocLongOperationStatus(unsigned int handle) const;
 
 	virtual void FwcmdFreeLongOperationStatus(struct fwcmd_long_operation_status_result *p_result) const;
 
+	virtual int FwcmdGetLongOperationStatusInto(unsigned int handle,
+	struct fwcmd_long_operation_status_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeLongOperationStatusData(struct fwcmd_long_operation_status_data *p_data) const;
+
 	virtual struct fwcmd_bsr_result FwcmdAllocBsr(unsigned int handle) const;
 
 	virtual void FwcmdFreeBsr(struct fwcmd_bsr_result *p_result) const;
 
+	virtual int FwcmdGetBsrInto(unsigned int handle,
+	struct fwcmd_bsr_data *p_data,
+	struct fwcmd_error_code *p_error) const;
+
+	virtual void FwcmdFreeBsrData(struct fwcmd_bsr_data *p_data) const;
+
 	virtual struct fwcmd_format_result FwcmdCallFormat(unsigned int handle,
 	const unsigned char fill_pattern,
 	const unsigned char preserve_pdas_write_count) const;
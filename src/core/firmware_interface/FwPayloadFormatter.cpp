@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "FwPayloadFormatter.h"
+
+#include <stdio.h>
+
+namespace core
+{
+namespace firmware_interface
+{
+
+FwPayloadFormatter::FwPayloadFormatter(std::string &buffer, Format format) :
+	m_buffer(buffer), m_format(format), m_depth(0)
+{
+}
+
+FwPayloadFormatter::Format FwPayloadFormatter::getFormat() const
+{
+	return m_format;
+}
+
+void FwPayloadFormatter::beginPayload(const char *name)
+{
+	if (m_format == FORMAT_JSON)
+	{
+		if (m_depth == m_payloads.size())
+		{
+			m_payloads.push_back(PayloadState());
+		}
+		PayloadState &state = m_payloads[m_depth++];
+		state.fields = "{\"Payload\": ";
+		appendJsonString(state.fields, name, strlen(name));
+		state.nested.clear();
+	}
+	else
+	{
+		heading(name);
+	}
+}
+
+void FwPayloadFormatter::endPayload()
+{
+	if (m_format == FORMAT_JSON && m_depth > 0)
+	{
+		PayloadState &state = m_payloads[--m_depth];
+		std::string *p_out;
+		if (m_depth > 0)
+		{
+			p_out = &m_payloads[m_depth - 1].nested;
+			if (!p_out->empty())
+			{
+				*p_out += ", ";
+			}
+		}
+		else
+		{
+			p_out = &m_buffer;
+		}
+
+		*p_out += state.fields;
+		if (!state.nested.empty())
+		{
+			*p_out += ", \"Payloads\": [";
+			*p_out += state.nested;
+			*p_out += ']';
+		}
+		*p_out += '}';
+		if (m_depth == 0)
+		{
+			*p_out += '\n';
+		}
+	}
+}
+
+void FwPayloadFormatter::heading(const char *name)
+{
+	if (m_format == FORMAT_TEXT)
+	{
+		m_buffer += '\n';
+		m_buffer += name;
+		m_buffer += ":\n";
+	}
+}
+
+void FwPayloadFormatter::field(const char *name, unsigned long long value)
+{
+	char number[24];
+	snprintf(number, sizeof (number), "%llu", value);
+	numberField(name, number);
+}
+
+void FwPayloadFormatter::field(const char *name, long long value)
+{
+	char number[24];
+	snprintf(number, sizeof (number), "%lld", value);
+	numberField(name, number);
+}
+
+void FwPayloadFormatter::field(const char *name, const std::string &value)
+{
+	stringField(name, value.c_str(), value.size());
+}
+
+void FwPayloadFormatter::numberField(const char *name, const char *number)
+{
+	std::string &out = beginMember(name);
+	out += number;
+	endMember();
+}
+
+void FwPayloadFormatter::stringField(const char *name, const char *value, size_t length)
+{
+	std::string &out = beginMember(name);
+	if (m_format == FORMAT_JSON)
+	{
+		appendJsonString(out, value, length);
+	}
+	else
+	{
+		out.append(value, length);
+	}
+	endMember();
+}
+
+/*
+ * Write the name of a field and return where its value goes
+ */
+std::string &FwPayloadFormatter::beginMember(const char *name)
+{
+	if (m_format == FORMAT_JSON)
+	{
+		std::string *p_out;
+		if (m_depth > 0)
+		{
+			p_out = &m_payloads[m_depth - 1].fields;
+			*p_out += ", ";
+		}
+		else
+		{
+			p_out = &m_buffer;
+			*p_out += '{';
+		}
+		appendJsonString(*p_out, name, strlen(name));
+		*p_out += ": ";
+		return *p_out;
+	}
+	else
+	{
+		m_buffer += name;
+		m_buffer += ": ";
+		return m_buffer;
+	}
+}
+
+void FwPayloadFormatter::endMember()
+{
+	if (m_format == FORMAT_TEXT)
+	{
+		m_buffer += '\n';
+	}
+	else if (m_depth == 0)
+	{
+		m_buffer += "}\n";
+	}
+}
+
+void FwPayloadFormatter::appendJsonString(std::string &out, const char *value, size_t length)
+{
+	out += '"';
+	for (size_t i = 0; i < length; i++)
+	{
+		unsigned char c = (unsigned char)value[i];
+		if (c == '"' || c == '\\')
+		{
+			out += '\\';
+			out += (char)c;
+		}
+		// control characters, and bytes that are not valid UTF-8 on their own
+		// such as 0xFF filled serial and part numbers
+		else if (c < 0x20 || c >= 0x7f)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof (escaped), "\\u%04x", c);
+			out += escaped;
+		}
+		else
+		{
+			out += (char)c;
+		}
+	}
+	out += '"';
+}
+
+} /* namespace firmware_interface */
+} /* namespace core */
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_CORE_FIRMWARE_INTERFACE_FWPAYLOADFORMATTER_H_
+#define SRC_CORE_FIRMWARE_INTERFACE_FWPAYLOADFORMATTER_H_
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <core/ExportCore.h>
+
+namespace core
+{
+namespace firmware_interface
+{
+
+/*
+ * Appends firmware payloads to a caller owned string as text or JSON.
+ * The string is appended to rather than replaced, so one buffer can be
+ * reused across commands and DIMMs.
+ *
+ * In JSON each top level payload is written as an object on its own line:
+ * {"Payload": "<name>", "<field>": <value>, ..., "Payloads": [<nested>]}
+ * Fields always come before the nested payloads, in whatever order they
+ * were written. Fields written outside any payload are an object of their own.
+ */
+class NVM_CORE_API FwPayloadFormatter
+{
+public:
+	enum Format
+	{
+		FORMAT_TEXT,
+		FORMAT_JSON
+	};
+
+	FwPayloadFormatter(std::string &buffer, Format format = FORMAT_TEXT);
+
+	Format getFormat() const;
+
+	// Every beginPayload needs a matching endPayload
+	void beginPayload(const char *name);
+	void endPayload();
+
+	// A header line in the text format, nothing in JSON
+	void heading(const char *name);
+
+	void field(const char *name, unsigned long long value);
+	void field(const char *name, long long value);
+	void field(const char *name, unsigned int value) { field(name, (unsigned long long)value); }
+	void field(const char *name, unsigned short value) { field(name, (unsigned long long)value); }
+	void field(const char *name, unsigned char value) { field(name, (unsigned long long)value); }
+	void field(const char *name, int value) { field(name, (long long)value); }
+	void field(const char *name, const std::string &value);
+
+	// Character arrays are written up to the first null or the array size
+	template <size_t N>
+	void field(const char *name, const char (&value)[N])
+	{
+		stringField(name, value, strnlen(value, N));
+	}
+
+	template <size_t N>
+	void field(const char *name, const unsigned char (&value)[N])
+	{
+		const char *p_value = (const char *)value;
+		stringField(name, p_value, strnlen(p_value, N));
+	}
+
+private:
+	void numberField(const char *name, const char *number);
+	void stringField(const char *name, const char *value, size_t length);
+	std::string &beginMember(const char *name);
+	void endMember();
+	static void appendJsonString(std::string &out, const char *value, size_t length);
+
+	std::string &m_buffer;
+	Format m_format;
+
+	// JSON of an open payload. Nested payloads are kept apart from the
+	// fields until the payload ends so each key is only written once.
+	struct PayloadState
+	{
+		std::string fields; // "{"Payload": ..." and the fields so far
+		std::string nested; // the finished nested payloads, comma separated
+	};
+	// open payloads are m_payloads[0, m_depth), the rest keep their
+	// capacity for the next payloads
+	std::vector<PayloadState> m_payloads;
+	size_t m_depth;
+};
+
+} /* namespace firmware_interface */
+} /* namespace core */
+
+#endif /* SRC_CORE_FIRMWARE_INTERFACE_FWPAYLOADFORMATTER_H_ */
@@ -0,0 +1,1852 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Read-only views over the raw output payloads of FIS commands. The
+ * fis_parse_* functions decode a whole payload; a view reads individual
+ * fields in place, which is cheaper when only a few fields of a large
+ * payload are needed. Values are returned as the firmware reported them,
+ * without the conversions the parser applies, and every read is checked
+ * against the size the view was created with.
+ */
+
+#ifndef CR_MGMT_FIS_VIEWS_H
+#define CR_MGMT_FIS_VIEWS_H
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <string.h>
+#include "fis_commands.h"
+
+struct fis_payload_view
+{
+	const unsigned char *p_payload;
+	size_t size;
+};
+
+static inline struct fis_payload_view fis_payload_view_init(const void *p_payload, size_t size)
+{
+	struct fis_payload_view view;
+	view.p_payload = (const unsigned char *)p_payload;
+	view.size = p_payload ? size : 0;
+	return view;
+}
+
+/*
+ * View of length bytes at offset into p_view, or an empty view if they
+ * are not all in p_view. Reads from an empty view fail.
+ */
+static inline struct fis_payload_view fis_view_at(const struct fis_payload_view *p_view,
+	size_t offset, size_t length)
+{
+	if (p_view && p_view->p_payload &&
+		offset <= p_view->size && length <= p_view->size - offset)
+	{
+		return fis_payload_view_init(p_view->p_payload + offset, length);
+	}
+	return fis_payload_view_init(NULL, 0);
+}
+
+static inline const unsigned char *fis_view_bytes(const struct fis_payload_view *p_view,
+	size_t offset, size_t length)
+{
+	return fis_view_at(p_view, offset, length).p_payload;
+}
+
+/*
+ * Copy length bytes at offset into p_value, the payload is packed so
+ * fields may not be aligned. Returns 1 on success, 0 if out of bounds.
+ */
+static inline int fis_view_read(const struct fis_payload_view *p_view,
+	size_t offset, void *p_value, size_t length)
+{
+	const unsigned char *p_field = fis_view_bytes(p_view, offset, length);
+	if (p_field)
+	{
+		memmove(p_value, p_field, length);
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * Views of pt_output_identify_dimm
+ */
+static inline int fis_view_identify_dimm_vendor_id(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, vendor_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_device_id(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, device_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_revision_id(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, revision_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_interface_format_code(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, interface_format_code),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_identify_dimm_firmware_revision(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_identify_dimm, firmware_revision),
+		5);
+}
+
+static inline int fis_view_identify_dimm_reserved_old_api(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, reserved_old_api),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_feature_sw_required_mask(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, feature_sw_required_mask),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_number_of_block_windows(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, number_of_block_windows),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_offset_of_block_mode_control_region(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, offset_of_block_mode_control_region),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_raw_capacity(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, raw_capacity),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_manufacturer(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, manufacturer),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_serial_number(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, serial_number),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_identify_dimm_part_number(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_identify_dimm, part_number),
+		20);
+}
+
+static inline int fis_view_identify_dimm_dimm_sku(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, dimm_sku),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_interface_format_code_extra(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, interface_format_code_extra),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_api_ver(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm, api_ver),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_identify_dimm_characteristics
+ */
+static inline int fis_view_identify_dimm_characteristics_controller_temp_shutdown_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm_characteristics, controller_temp_shutdown_threshold),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_characteristics_media_temp_shutdown_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm_characteristics, media_temp_shutdown_threshold),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_characteristics_throttling_start_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm_characteristics, throttling_start_threshold),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_identify_dimm_characteristics_throttling_stop_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_identify_dimm_characteristics, throttling_stop_threshold),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_get_security_state
+ */
+static inline int fis_view_get_security_state_security_state(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_security_state, security_state),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_get_alarm_threshold
+ */
+static inline int fis_view_get_alarm_threshold_enable(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_alarm_threshold, enable),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_get_alarm_threshold_spare_block_threshold(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_alarm_threshold, spare_block_threshold),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_get_alarm_threshold_media_temp_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_alarm_threshold, media_temp_threshold),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_get_alarm_threshold_controller_temp_threshold(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_alarm_threshold, controller_temp_threshold),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_power_management_policy
+ */
+static inline int fis_view_power_management_policy_enable(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_power_management_policy, enable),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_power_management_policy_peak_power_budget(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_power_management_policy, peak_power_budget),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_power_management_policy_average_power_budget(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_power_management_policy, average_power_budget),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_power_management_policy_max_power(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_power_management_policy, max_power),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_die_sparing_policy
+ */
+static inline int fis_view_die_sparing_policy_enable(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_die_sparing_policy, enable),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_die_sparing_policy_aggressiveness(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_die_sparing_policy, aggressiveness),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_die_sparing_policy_supported(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_die_sparing_policy, supported),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_address_range_scrub
+ */
+static inline int fis_view_address_range_scrub_enable(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_address_range_scrub, enable),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_address_range_scrub_dpa_start_address(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_address_range_scrub, dpa_start_address),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_address_range_scrub_dpa_end_address(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_address_range_scrub, dpa_end_address),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_address_range_scrub_dpa_current_address(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_address_range_scrub, dpa_current_address),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_optional_configuration_data_policy
+ */
+static inline int fis_view_optional_configuration_data_policy_first_fast_refresh(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_optional_configuration_data_policy, first_fast_refresh),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_optional_configuration_data_policy_viral_policy_enabled(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_optional_configuration_data_policy, viral_policy_enabled),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_optional_configuration_data_policy_viral_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_optional_configuration_data_policy, viral_status),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_pmon_registers
+ */
+static inline int fis_view_pmon_registers_pmon_retreive_mask(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_retreive_mask),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_0_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_0_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_0_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_0_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_1_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_1_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_1_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_1_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_2_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_2_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_2_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_2_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_3_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_3_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_3_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_3_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_4_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_4_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_4_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_4_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_5_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_5_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_5_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_5_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_6_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_6_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_6_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_6_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_7_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_7_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_7_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_7_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_8_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_8_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_8_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_8_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_9_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_9_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_9_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_9_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_10_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_10_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_10_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_10_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_11_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_11_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_11_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_11_control),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_14_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_14_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_pmon_registers_pmon_14_control(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_pmon_registers, pmon_14_control),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_system_time
+ */
+static inline int fis_view_system_time_unix_time(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_system_time, unix_time),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_device_identification_v1
+ */
+static inline int fis_view_device_identification_v1_manufacturer_id(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_device_identification_v1, manufacturer_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_device_identification_v1_serial_number(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_device_identification_v1, serial_number),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_device_identification_v1_model_number(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_device_identification_v1, model_number),
+		20);
+}
+
+
+/*
+ * Views of pt_output_device_identification_v2
+ */
+static inline const unsigned char *fis_view_device_identification_v2_uid(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_device_identification_v2, uid),
+		9);
+}
+
+
+/*
+ * Views of pt_output_id_info_table
+ */
+static inline const unsigned char *fis_view_id_info_table_device_identification(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_id_info_table, device_identification),
+		32);
+}
+
+static inline int fis_view_id_info_table_partition_offset(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_id_info_table, partition_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_id_info_table_partition_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_id_info_table, partition_size),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_interleave_information_table
+ */
+static inline int fis_view_interleave_information_table_type(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, type),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_length(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_index(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, index),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_number_of_dimms(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, number_of_dimms),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_memory_type(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, memory_type),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_format(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, format),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_mirror_enabled(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, mirror_enabled),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_change_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, change_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_interleave_information_table_memory_spare(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_interleave_information_table, memory_spare),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_partition_size_change_table
+ */
+static inline int fis_view_partition_size_change_table_type(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_partition_size_change_table, type),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_partition_size_change_table_length(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_partition_size_change_table, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_partition_size_change_table_platform_config_data_partition_size_change_table(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_partition_size_change_table, platform_config_data_partition_size_change_table),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_partition_size_change_table_persistent_memory_partition_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_partition_size_change_table, persistent_memory_partition_size),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_current_config_table
+ */
+static inline const unsigned char *fis_view_current_config_table_signature(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_current_config_table, signature),
+		4);
+}
+
+static inline int fis_view_current_config_table_length(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_revision(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_checksum(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, checksum),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_current_config_table_oem_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_current_config_table, oem_id),
+		6);
+}
+
+static inline const unsigned char *fis_view_current_config_table_oem_table_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_current_config_table, oem_table_id),
+		8);
+}
+
+static inline int fis_view_current_config_table_oem_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, oem_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_creator_id(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, creator_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_creator_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, creator_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_config_status(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, config_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_volatile_memory_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, volatile_memory_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_current_config_table_persistent_memory_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_current_config_table, persistent_memory_size),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_config_input_table
+ */
+static inline const unsigned char *fis_view_config_input_table_signature(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_input_table, signature),
+		4);
+}
+
+static inline int fis_view_config_input_table_length(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_input_table_revision(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_input_table_checksum(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, checksum),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_config_input_table_oem_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_input_table, oem_id),
+		6);
+}
+
+static inline const unsigned char *fis_view_config_input_table_oem_table_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_input_table, oem_table_id),
+		8);
+}
+
+static inline int fis_view_config_input_table_oem_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, oem_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_input_table_creator_id(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, creator_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_input_table_creator_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, creator_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_input_table_sequence_number(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_input_table, sequence_number),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_config_output_table
+ */
+static inline const unsigned char *fis_view_config_output_table_signature(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_output_table, signature),
+		4);
+}
+
+static inline int fis_view_config_output_table_length(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_revision(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_checksum(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, checksum),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_config_output_table_oem_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_output_table, oem_id),
+		6);
+}
+
+static inline const unsigned char *fis_view_config_output_table_oem_table_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_config_output_table, oem_table_id),
+		8);
+}
+
+static inline int fis_view_config_output_table_oem_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, oem_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_creator_id(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, creator_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_creator_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, creator_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_sequence_number(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, sequence_number),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_config_output_table_validation_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_output_table, validation_status),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_platform_config_data
+ */
+static inline const unsigned char *fis_view_platform_config_data_signature(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_platform_config_data, signature),
+		4);
+}
+
+static inline int fis_view_platform_config_data_length(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, length),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_revision(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_checksum(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, checksum),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_platform_config_data_oem_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_platform_config_data, oem_id),
+		6);
+}
+
+static inline const unsigned char *fis_view_platform_config_data_oem_table_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_platform_config_data, oem_table_id),
+		8);
+}
+
+static inline int fis_view_platform_config_data_oem_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, oem_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_creator_id(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, creator_id),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_creator_revision(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, creator_revision),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_current_config_size(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, current_config_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_current_config_offset(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, current_config_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_input_config_size(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, input_config_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_input_config_offset(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, input_config_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_output_config_size(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, output_config_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_platform_config_data_output_config_offset(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_platform_config_data, output_config_offset),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_ns_index
+ */
+static inline const unsigned char *fis_view_ns_index_signature(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_index, signature),
+		16);
+}
+
+static inline int fis_view_ns_index_flags(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, flags),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_sequence(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, sequence),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_my_offset(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, my_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_my_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, my_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_other_offset(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, other_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_label_offset(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, label_offset),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_nlabel(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, nlabel),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_label_major_version(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, label_major_version),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_label_minor_version(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, label_minor_version),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_index_checksum(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_index, checksum),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_ns_label
+ */
+static inline const unsigned char *fis_view_ns_label_uuid(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label, uuid),
+		16);
+}
+
+static inline const unsigned char *fis_view_ns_label_name(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label, name),
+		64);
+}
+
+static inline int fis_view_ns_label_flags(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, flags),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_nlabel(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, nlabel),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_position(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, position),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_iset_cookie(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, iset_cookie),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_lba_size(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, lba_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_dpa(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, dpa),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_rawsize(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, rawsize),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ns_label_slot(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label, slot),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_ns_label_v1_1
+ */
+static inline struct fis_payload_view fis_view_ns_label_v1_1_label(const struct fis_payload_view *p_view)
+{
+	return fis_view_at(p_view, offsetof(struct pt_output_ns_label_v1_1, label),
+		sizeof (struct pt_output_ns_label));
+}
+
+static inline int fis_view_ns_label_v1_1_unused(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label_v1_1, unused),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_ns_label_v1_2
+ */
+static inline struct fis_payload_view fis_view_ns_label_v1_2_label(const struct fis_payload_view *p_view)
+{
+	return fis_view_at(p_view, offsetof(struct pt_output_ns_label_v1_2, label),
+		sizeof (struct pt_output_ns_label));
+}
+
+static inline int fis_view_ns_label_v1_2_alignment(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label_v1_2, alignment),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_ns_label_v1_2_reserved(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label_v1_2, reserved),
+		3);
+}
+
+static inline const unsigned char *fis_view_ns_label_v1_2_type_guid(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label_v1_2, type_guid),
+		16);
+}
+
+static inline const unsigned char *fis_view_ns_label_v1_2_address_abstraction_guid(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label_v1_2, address_abstraction_guid),
+		16);
+}
+
+static inline const unsigned char *fis_view_ns_label_v1_2_reserved1(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_ns_label_v1_2, reserved1),
+		88);
+}
+
+static inline int fis_view_ns_label_v1_2_checksum(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ns_label_v1_2, checksum),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_namespace_labels
+ */
+static inline struct fis_payload_view fis_view_namespace_labels_index1(const struct fis_payload_view *p_view)
+{
+	return fis_view_at(p_view, offsetof(struct pt_output_namespace_labels, index1),
+		sizeof (struct pt_output_ns_index));
+}
+
+static inline struct fis_payload_view fis_view_namespace_labels_index2(const struct fis_payload_view *p_view)
+{
+	return fis_view_at(p_view, offsetof(struct pt_output_namespace_labels, index2),
+		sizeof (struct pt_output_ns_index));
+}
+
+
+/*
+ * Views of pt_output_dimm_partition_info
+ */
+static inline int fis_view_dimm_partition_info_volatile_capacity(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, volatile_capacity),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_dimm_partition_info_volatile_start(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, volatile_start),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_dimm_partition_info_pm_capacity(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, pm_capacity),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_dimm_partition_info_pm_start(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, pm_start),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_dimm_partition_info_raw_capacity(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, raw_capacity),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_dimm_partition_info_enabled_capacity(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_dimm_partition_info, enabled_capacity),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_fw_debug_log_level
+ */
+static inline int fis_view_fw_debug_log_level_log_level(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_fw_debug_log_level, log_level),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_fw_debug_log_level_logs(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_fw_debug_log_level, logs),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_fw_load_flag
+ */
+static inline int fis_view_fw_load_flag_load_flag(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_fw_load_flag, load_flag),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_config_lockdown
+ */
+static inline int fis_view_config_lockdown_locked(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_config_lockdown, locked),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_ddrt_io_init_info
+ */
+static inline int fis_view_ddrt_io_init_info_ddrt_io_info(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ddrt_io_init_info, ddrt_io_info),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_ddrt_io_init_info_ddrt_training_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_ddrt_io_init_info, ddrt_training_status),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_get_supported_sku_features
+ */
+static inline int fis_view_get_supported_sku_features_dimm_sku(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_get_supported_sku_features, dimm_sku),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_enable_dimm
+ */
+static inline int fis_view_enable_dimm_enable(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_enable_dimm, enable),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_smart_health_info
+ */
+static inline int fis_view_smart_health_info_validation_flags(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, validation_flags),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_health_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, health_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_spare_blocks(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, spare_blocks),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_percent_used(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, percent_used),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_alarm_trips(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, alarm_trips),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_media_temp(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, media_temp),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_controller_temp(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, controller_temp),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_unsafe_shutdown_count(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, unsafe_shutdown_count),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_ait_dram_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, ait_dram_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_last_shutdown_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, last_shutdown_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_vendor_specific_data_size(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, vendor_specific_data_size),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_power_cycles(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, power_cycles),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_power_on_time(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, power_on_time),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_uptime(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, uptime),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_unsafe_shutdowns(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, unsafe_shutdowns),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_last_shutdown_status_details(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, last_shutdown_status_details),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_last_shutdown_time(const struct fis_payload_view *p_view,
+	unsigned long long *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, last_shutdown_time),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_last_shutdown_status_extended_details(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, last_shutdown_status_extended_details),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_media_error_injections(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, media_error_injections),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_smart_health_info_non_media_error_injections(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_smart_health_info, non_media_error_injections),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_firmware_image_info
+ */
+static inline const unsigned char *fis_view_firmware_image_info_firmware_revision(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_firmware_image_info, firmware_revision),
+		5);
+}
+
+static inline int fis_view_firmware_image_info_firmware_type(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_firmware_image_info, firmware_type),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_firmware_image_info_staged_fw_revision(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_firmware_image_info, staged_fw_revision),
+		5);
+}
+
+static inline int fis_view_firmware_image_info_last_fw_update_status(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_firmware_image_info, last_fw_update_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_firmware_image_info_commit_id(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_firmware_image_info, commit_id),
+		40);
+}
+
+static inline const unsigned char *fis_view_firmware_image_info_build_configuration(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_firmware_image_info, build_configuration),
+		16);
+}
+
+
+/*
+ * Views of pt_output_firmware_debug_log
+ */
+static inline int fis_view_firmware_debug_log_log_size(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_firmware_debug_log, log_size),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_memory_info_page_0
+ */
+static inline const unsigned char *fis_view_memory_info_page_0_media_reads(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, media_reads),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_0_media_writes(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, media_writes),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_0_read_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, read_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_0_write_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, write_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_0_block_read_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, block_read_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_0_block_write_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_0, block_write_requests),
+		16);
+}
+
+
+/*
+ * Views of pt_output_memory_info_page_1
+ */
+static inline const unsigned char *fis_view_memory_info_page_1_total_media_reads(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_media_reads),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_1_total_media_writes(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_media_writes),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_1_total_read_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_read_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_1_total_write_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_write_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_1_total_block_read_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_block_read_requests),
+		16);
+}
+
+static inline const unsigned char *fis_view_memory_info_page_1_total_block_write_requests(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_memory_info_page_1, total_block_write_requests),
+		16);
+}
+
+
+/*
+ * Views of pt_output_memory_info_page_3
+ */
+static inline int fis_view_memory_info_page_3_error_injection_status(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_memory_info_page_3, error_injection_status),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_memory_info_page_3_poison_error_injections_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_memory_info_page_3, poison_error_injections_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_memory_info_page_3_poison_error_clear_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_memory_info_page_3, poison_error_clear_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_memory_info_page_3_media_temperature_injections_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_memory_info_page_3, media_temperature_injections_counter),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_memory_info_page_3_software_triggers_counter(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_memory_info_page_3, software_triggers_counter),
+		p_value, sizeof (*p_value));
+}
+
+
+/*
+ * Views of pt_output_long_operation_status
+ */
+static inline int fis_view_long_operation_status_command(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_long_operation_status, command),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_long_operation_status_percent_complete(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_long_operation_status, percent_complete),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_long_operation_status_estimate_time_to_completion(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_long_operation_status, estimate_time_to_completion),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_long_operation_status_status_code(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_long_operation_status, status_code),
+		p_value, sizeof (*p_value));
+}
+
+static inline const unsigned char *fis_view_long_operation_status_command_specific_return_data(const struct fis_payload_view *p_view)
+{
+	return fis_view_bytes(p_view, offsetof(struct pt_output_long_operation_status, command_specific_return_data),
+		119);
+}
+
+
+/*
+ * Views of pt_output_bsr
+ */
+static inline int fis_view_bsr_major_checkpoint(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_bsr, major_checkpoint),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_bsr_minor_checkpoint(const struct fis_payload_view *p_view,
+	unsigned char *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_bsr, minor_checkpoint),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_bsr_rest1(const struct fis_payload_view *p_view,
+	unsigned int *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_bsr, rest1),
+		p_value, sizeof (*p_value));
+}
+
+static inline int fis_view_bsr_rest2(const struct fis_payload_view *p_view,
+	unsigned short *p_value)
+{
+	return fis_view_read(p_view, offsetof(struct pt_output_bsr, rest2),
+		p_value, sizeof (*p_value));
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CR_MGMT_FIS_VIEWS_H
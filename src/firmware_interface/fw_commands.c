@@ -36,10 +36,14 @@
 #include <stdlib.h>
 
 /* BEGIN identify_dimm */
-struct fwcmd_identify_dimm_result fwcmd_alloc_identify_dimm(unsigned int handle)
-{
-	struct fwcmd_identify_dimm_result result;
-	memset(&result, 0, sizeof (struct fwcmd_identify_dimm_result));
+int fwcmd_get_identify_dimm_into(unsigned int handle,
+	struct fwcmd_identify_dimm_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_identify_dimm_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_identify_dimm output_payload;
@@ -47,29 +51,49 @@ struct fwcmd_identify_dimm_result fwcmd_alloc_identify_dimm(unsigned int handle)
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_identify_dimm_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_identify_dimm(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_identify_dimm(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_identify_dimm_result fwcmd_alloc_identify_dimm(unsigned int handle)
+{
+	struct fwcmd_identify_dimm_result result;
+	memset(&result, 0, sizeof (struct fwcmd_identify_dimm_result));
+
+	result.p_data = (struct fwcmd_identify_dimm_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_identify_dimm_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_identify_dimm_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -88,10 +112,14 @@ void fwcmd_free_identify_dimm(struct fwcmd_identify_dimm_result *p_result)
 /* END identify_dimm */
 
 /* BEGIN identify_dimm_characteristics */
-struct fwcmd_identify_dimm_characteristics_result fwcmd_alloc_identify_dimm_characteristics(unsigned int handle)
-{
-	struct fwcmd_identify_dimm_characteristics_result result;
-	memset(&result, 0, sizeof (struct fwcmd_identify_dimm_characteristics_result));
+int fwcmd_get_identify_dimm_characteristics_into(unsigned int handle,
+	struct fwcmd_identify_dimm_characteristics_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_identify_dimm_characteristics_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_identify_dimm_characteristics output_payload;
@@ -99,29 +127,49 @@ struct fwcmd_identify_dimm_characteristics_result fwcmd_alloc_identify_dimm_char
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_identify_dimm_characteristics_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_identify_dimm_characteristics(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_identify_dimm_characteristics(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_identify_dimm_characteristics_result fwcmd_alloc_identify_dimm_characteristics(unsigned int handle)
+{
+	struct fwcmd_identify_dimm_characteristics_result result;
+	memset(&result, 0, sizeof (struct fwcmd_identify_dimm_characteristics_result));
+
+	result.p_data = (struct fwcmd_identify_dimm_characteristics_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_identify_dimm_characteristics_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_identify_dimm_characteristics_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -140,10 +188,14 @@ void fwcmd_free_identify_dimm_characteristics(struct fwcmd_identify_dimm_charact
 /* END identify_dimm_characteristics */
 
 /* BEGIN get_security_state */
-struct fwcmd_get_security_state_result fwcmd_alloc_get_security_state(unsigned int handle)
-{
-	struct fwcmd_get_security_state_result result;
-	memset(&result, 0, sizeof (struct fwcmd_get_security_state_result));
+int fwcmd_get_get_security_state_into(unsigned int handle,
+	struct fwcmd_get_security_state_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_get_security_state_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_get_security_state output_payload;
@@ -151,29 +203,49 @@ struct fwcmd_get_security_state_result fwcmd_alloc_get_security_state(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_get_security_state_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_get_security_state(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_get_security_state(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_get_security_state_result fwcmd_alloc_get_security_state(unsigned int handle)
+{
+	struct fwcmd_get_security_state_result result;
+	memset(&result, 0, sizeof (struct fwcmd_get_security_state_result));
+
+	result.p_data = (struct fwcmd_get_security_state_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_get_security_state_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_get_security_state_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -320,10 +392,14 @@ struct fwcmd_freeze_lock_result fwcmd_call_freeze_lock(unsigned int handle)
 /* END freeze_lock */
 
 /* BEGIN get_alarm_threshold */
-struct fwcmd_get_alarm_threshold_result fwcmd_alloc_get_alarm_threshold(unsigned int handle)
-{
-	struct fwcmd_get_alarm_threshold_result result;
-	memset(&result, 0, sizeof (struct fwcmd_get_alarm_threshold_result));
+int fwcmd_get_get_alarm_threshold_into(unsigned int handle,
+	struct fwcmd_get_alarm_threshold_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_get_alarm_threshold_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_get_alarm_threshold output_payload;
@@ -331,29 +407,49 @@ struct fwcmd_get_alarm_threshold_result fwcmd_alloc_get_alarm_threshold(unsigned
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_get_alarm_threshold_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_get_alarm_threshold(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_get_alarm_threshold(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_get_alarm_threshold_result fwcmd_alloc_get_alarm_threshold(unsigned int handle)
+{
+	struct fwcmd_get_alarm_threshold_result result;
+	memset(&result, 0, sizeof (struct fwcmd_get_alarm_threshold_result));
+
+	result.p_data = (struct fwcmd_get_alarm_threshold_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_get_alarm_threshold_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_get_alarm_threshold_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -372,10 +468,14 @@ void fwcmd_free_get_alarm_threshold(struct fwcmd_get_alarm_threshold_result *p_r
 /* END get_alarm_threshold */
 
 /* BEGIN power_management_policy */
-struct fwcmd_power_management_policy_result fwcmd_alloc_power_management_policy(unsigned int handle)
-{
-	struct fwcmd_power_management_policy_result result;
-	memset(&result, 0, sizeof (struct fwcmd_power_management_policy_result));
+int fwcmd_get_power_management_policy_into(unsigned int handle,
+	struct fwcmd_power_management_policy_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_power_management_policy_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_power_management_policy output_payload;
@@ -383,29 +483,49 @@ struct fwcmd_power_management_policy_result fwcmd_alloc_power_management_policy(
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_power_management_policy_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_power_management_policy(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_power_management_policy(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_power_management_policy_result fwcmd_alloc_power_management_policy(unsigned int handle)
+{
+	struct fwcmd_power_management_policy_result result;
+	memset(&result, 0, sizeof (struct fwcmd_power_management_policy_result));
+
+	result.p_data = (struct fwcmd_power_management_policy_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_power_management_policy_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_power_management_policy_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -424,10 +544,14 @@ void fwcmd_free_power_management_policy(struct fwcmd_power_management_policy_res
 /* END power_management_policy */
 
 /* BEGIN die_sparing_policy */
-struct fwcmd_die_sparing_policy_result fwcmd_alloc_die_sparing_policy(unsigned int handle)
-{
-	struct fwcmd_die_sparing_policy_result result;
-	memset(&result, 0, sizeof (struct fwcmd_die_sparing_policy_result));
+int fwcmd_get_die_sparing_policy_into(unsigned int handle,
+	struct fwcmd_die_sparing_policy_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_die_sparing_policy_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_die_sparing_policy output_payload;
@@ -435,29 +559,49 @@ struct fwcmd_die_sparing_policy_result fwcmd_alloc_die_sparing_policy(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_die_sparing_policy_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_die_sparing_policy(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_die_sparing_policy(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_die_sparing_policy_result fwcmd_alloc_die_sparing_policy(unsigned int handle)
+{
+	struct fwcmd_die_sparing_policy_result result;
+	memset(&result, 0, sizeof (struct fwcmd_die_sparing_policy_result));
+
+	result.p_data = (struct fwcmd_die_sparing_policy_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_die_sparing_policy_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_die_sparing_policy_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -476,10 +620,14 @@ void fwcmd_free_die_sparing_policy(struct fwcmd_die_sparing_policy_result *p_res
 /* END die_sparing_policy */
 
 /* BEGIN address_range_scrub */
-struct fwcmd_address_range_scrub_result fwcmd_alloc_address_range_scrub(unsigned int handle)
-{
-	struct fwcmd_address_range_scrub_result result;
-	memset(&result, 0, sizeof (struct fwcmd_address_range_scrub_result));
+int fwcmd_get_address_range_scrub_into(unsigned int handle,
+	struct fwcmd_address_range_scrub_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_address_range_scrub_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_address_range_scrub output_payload;
@@ -487,29 +635,49 @@ struct fwcmd_address_range_scrub_result fwcmd_alloc_address_range_scrub(unsigned
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_address_range_scrub_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_address_range_scrub(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_address_range_scrub(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_address_range_scrub_result fwcmd_alloc_address_range_scrub(unsigned int handle)
+{
+	struct fwcmd_address_range_scrub_result result;
+	memset(&result, 0, sizeof (struct fwcmd_address_range_scrub_result));
+
+	result.p_data = (struct fwcmd_address_range_scrub_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_address_range_scrub_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_address_range_scrub_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -528,10 +696,14 @@ void fwcmd_free_address_range_scrub(struct fwcmd_address_range_scrub_result *p_r
 /* END address_range_scrub */
 
 /* BEGIN optional_configuration_data_policy */
-struct fwcmd_optional_configuration_data_policy_result fwcmd_alloc_optional_configuration_data_policy(unsigned int handle)
-{
-	struct fwcmd_optional_configuration_data_policy_result result;
-	memset(&result, 0, sizeof (struct fwcmd_optional_configuration_data_policy_result));
+int fwcmd_get_optional_configuration_data_policy_into(unsigned int handle,
+	struct fwcmd_optional_configuration_data_policy_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_optional_configuration_data_policy_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_optional_configuration_data_policy output_payload;
@@ -539,29 +711,49 @@ struct fwcmd_optional_configuration_data_policy_result fwcmd_alloc_optional_conf
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_optional_configuration_data_policy_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_optional_configuration_data_policy(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_optional_configuration_data_policy(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_optional_configuration_data_policy_result fwcmd_alloc_optional_configuration_data_policy(unsigned int handle)
+{
+	struct fwcmd_optional_configuration_data_policy_result result;
+	memset(&result, 0, sizeof (struct fwcmd_optional_configuration_data_policy_result));
+
+	result.p_data = (struct fwcmd_optional_configuration_data_policy_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_optional_configuration_data_policy_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_optional_configuration_data_policy_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -580,11 +772,15 @@ void fwcmd_free_optional_configuration_data_policy(struct fwcmd_optional_configu
 /* END optional_configuration_data_policy */
 
 /* BEGIN pmon_registers */
-struct fwcmd_pmon_registers_result fwcmd_alloc_pmon_registers(unsigned int handle,
-	const unsigned short pmon_retreive_mask)
-{
-	struct fwcmd_pmon_registers_result result;
-	memset(&result, 0, sizeof (struct fwcmd_pmon_registers_result));
+int fwcmd_get_pmon_registers_into(unsigned int handle,
+	const unsigned short pmon_retreive_mask,
+	struct fwcmd_pmon_registers_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_pmon_registers_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_pmon_registers input_payload;
@@ -595,29 +791,50 @@ struct fwcmd_pmon_registers_result fwcmd_alloc_pmon_registers(unsigned int handl
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_pmon_registers_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_pmon_registers(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_pmon_registers(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_pmon_registers_result fwcmd_alloc_pmon_registers(unsigned int handle,
+	const unsigned short pmon_retreive_mask)
+{
+	struct fwcmd_pmon_registers_result result;
+	memset(&result, 0, sizeof (struct fwcmd_pmon_registers_result));
+
+	result.p_data = (struct fwcmd_pmon_registers_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_pmon_registers_into(handle, pmon_retreive_mask,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_pmon_registers_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -666,10 +883,14 @@ struct fwcmd_set_alarm_threshold_result fwcmd_call_set_alarm_threshold(unsigned
 /* END set_alarm_threshold */
 
 /* BEGIN system_time */
-struct fwcmd_system_time_result fwcmd_alloc_system_time(unsigned int handle)
-{
-	struct fwcmd_system_time_result result;
-	memset(&result, 0, sizeof (struct fwcmd_system_time_result));
+int fwcmd_get_system_time_into(unsigned int handle,
+	struct fwcmd_system_time_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_system_time_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_system_time output_payload;
@@ -677,29 +898,49 @@ struct fwcmd_system_time_result fwcmd_alloc_system_time(unsigned int handle)
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_system_time_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_system_time(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_system_time(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_system_time_result fwcmd_alloc_system_time(unsigned int handle)
+{
+	struct fwcmd_system_time_result result;
+	memset(&result, 0, sizeof (struct fwcmd_system_time_result));
+
+	result.p_data = (struct fwcmd_system_time_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_system_time_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_system_time_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -718,13 +959,17 @@ void fwcmd_free_system_time(struct fwcmd_system_time_result *p_result)
 /* END system_time */
 
 /* BEGIN platform_config_data */
-struct fwcmd_platform_config_data_result fwcmd_alloc_platform_config_data(unsigned int handle,
+int fwcmd_get_platform_config_data_into(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
-	const unsigned int offset)
-{
-	struct fwcmd_platform_config_data_result result;
-	memset(&result, 0, sizeof (struct fwcmd_platform_config_data_result));
+	const unsigned int offset,
+	struct fwcmd_platform_config_data_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_platform_config_data_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_platform_config_data input_payload;
@@ -742,33 +987,56 @@ struct fwcmd_platform_config_data_result fwcmd_alloc_platform_config_data(unsign
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_platform_config_data_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
-		{
-			rc = fis_parse_platform_config_data(output_payload, result.p_data
+		rc = fis_parse_platform_config_data(output_payload, p_data
 		, pcd_size);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+		if (FWCMD_PARSE_SUCCESS(rc))
+		{
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
 	}
 	free(output_payload);
 	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_platform_config_data_result fwcmd_alloc_platform_config_data(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset)
+{
+	struct fwcmd_platform_config_data_result result;
+	memset(&result, 0, sizeof (struct fwcmd_platform_config_data_result));
+
+	result.p_data = (struct fwcmd_platform_config_data_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_platform_config_data_into(handle, partition_id, command_option, offset,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_platform_config_data_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
+	}
 	return result;
 }
 void fwcmd_free_device_identification_v1_data(struct fwcmd_device_identification_v1_data *p_data)
@@ -881,13 +1149,17 @@ void fwcmd_free_platform_config_data(struct fwcmd_platform_config_data_result *p
 /* END platform_config_data */
 
 /* BEGIN namespace_labels */
-struct fwcmd_namespace_labels_result fwcmd_alloc_namespace_labels(unsigned int handle,
+int fwcmd_get_namespace_labels_into(unsigned int handle,
 	const unsigned char partition_id,
 	const unsigned char command_option,
-	const unsigned int offset)
-{
-	struct fwcmd_namespace_labels_result result;
-	memset(&result, 0, sizeof (struct fwcmd_namespace_labels_result));
+	const unsigned int offset,
+	struct fwcmd_namespace_labels_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_namespace_labels_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_namespace_labels input_payload;
@@ -900,29 +1172,52 @@ struct fwcmd_namespace_labels_result fwcmd_alloc_namespace_labels(unsigned int h
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_namespace_labels_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_namespace_labels(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_namespace_labels(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_namespace_labels_result fwcmd_alloc_namespace_labels(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset)
+{
+	struct fwcmd_namespace_labels_result result;
+	memset(&result, 0, sizeof (struct fwcmd_namespace_labels_result));
+
+	result.p_data = (struct fwcmd_namespace_labels_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_namespace_labels_into(handle, partition_id, command_option, offset,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_namespace_labels_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -969,10 +1264,14 @@ void fwcmd_free_namespace_labels(struct fwcmd_namespace_labels_result *p_result)
 /* END namespace_labels */
 
 /* BEGIN dimm_partition_info */
-struct fwcmd_dimm_partition_info_result fwcmd_alloc_dimm_partition_info(unsigned int handle)
-{
-	struct fwcmd_dimm_partition_info_result result;
-	memset(&result, 0, sizeof (struct fwcmd_dimm_partition_info_result));
+int fwcmd_get_dimm_partition_info_into(unsigned int handle,
+	struct fwcmd_dimm_partition_info_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_dimm_partition_info_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_dimm_partition_info output_payload;
@@ -980,29 +1279,49 @@ struct fwcmd_dimm_partition_info_result fwcmd_alloc_dimm_partition_info(unsigned
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_dimm_partition_info_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_dimm_partition_info(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_dimm_partition_info(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_dimm_partition_info_result fwcmd_alloc_dimm_partition_info(unsigned int handle)
+{
+	struct fwcmd_dimm_partition_info_result result;
+	memset(&result, 0, sizeof (struct fwcmd_dimm_partition_info_result));
+
+	result.p_data = (struct fwcmd_dimm_partition_info_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_dimm_partition_info_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_dimm_partition_info_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1021,11 +1340,15 @@ void fwcmd_free_dimm_partition_info(struct fwcmd_dimm_partition_info_result *p_r
 /* END dimm_partition_info */
 
 /* BEGIN fw_debug_log_level */
-struct fwcmd_fw_debug_log_level_result fwcmd_alloc_fw_debug_log_level(unsigned int handle,
-	const unsigned char log_id)
-{
-	struct fwcmd_fw_debug_log_level_result result;
-	memset(&result, 0, sizeof (struct fwcmd_fw_debug_log_level_result));
+int fwcmd_get_fw_debug_log_level_into(unsigned int handle,
+	const unsigned char log_id,
+	struct fwcmd_fw_debug_log_level_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_fw_debug_log_level_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_fw_debug_log_level input_payload;
@@ -1036,29 +1359,50 @@ struct fwcmd_fw_debug_log_level_result fwcmd_alloc_fw_debug_log_level(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_fw_debug_log_level_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_fw_debug_log_level(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_fw_debug_log_level(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_fw_debug_log_level_result fwcmd_alloc_fw_debug_log_level(unsigned int handle,
+	const unsigned char log_id)
+{
+	struct fwcmd_fw_debug_log_level_result result;
+	memset(&result, 0, sizeof (struct fwcmd_fw_debug_log_level_result));
+
+	result.p_data = (struct fwcmd_fw_debug_log_level_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_fw_debug_log_level_into(handle, log_id,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_fw_debug_log_level_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1077,10 +1421,14 @@ void fwcmd_free_fw_debug_log_level(struct fwcmd_fw_debug_log_level_result *p_res
 /* END fw_debug_log_level */
 
 /* BEGIN fw_load_flag */
-struct fwcmd_fw_load_flag_result fwcmd_alloc_fw_load_flag(unsigned int handle)
-{
-	struct fwcmd_fw_load_flag_result result;
-	memset(&result, 0, sizeof (struct fwcmd_fw_load_flag_result));
+int fwcmd_get_fw_load_flag_into(unsigned int handle,
+	struct fwcmd_fw_load_flag_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_fw_load_flag_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_fw_load_flag output_payload;
@@ -1088,29 +1436,49 @@ struct fwcmd_fw_load_flag_result fwcmd_alloc_fw_load_flag(unsigned int handle)
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_fw_load_flag_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_fw_load_flag(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_fw_load_flag(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_fw_load_flag_result fwcmd_alloc_fw_load_flag(unsigned int handle)
+{
+	struct fwcmd_fw_load_flag_result result;
+	memset(&result, 0, sizeof (struct fwcmd_fw_load_flag_result));
+
+	result.p_data = (struct fwcmd_fw_load_flag_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_fw_load_flag_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_fw_load_flag_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1129,10 +1497,14 @@ void fwcmd_free_fw_load_flag(struct fwcmd_fw_load_flag_result *p_result)
 /* END fw_load_flag */
 
 /* BEGIN config_lockdown */
-struct fwcmd_config_lockdown_result fwcmd_alloc_config_lockdown(unsigned int handle)
-{
-	struct fwcmd_config_lockdown_result result;
-	memset(&result, 0, sizeof (struct fwcmd_config_lockdown_result));
+int fwcmd_get_config_lockdown_into(unsigned int handle,
+	struct fwcmd_config_lockdown_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_config_lockdown_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_config_lockdown output_payload;
@@ -1140,29 +1512,49 @@ struct fwcmd_config_lockdown_result fwcmd_alloc_config_lockdown(unsigned int han
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_config_lockdown_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_config_lockdown(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_config_lockdown(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_config_lockdown_result fwcmd_alloc_config_lockdown(unsigned int handle)
+{
+	struct fwcmd_config_lockdown_result result;
+	memset(&result, 0, sizeof (struct fwcmd_config_lockdown_result));
+
+	result.p_data = (struct fwcmd_config_lockdown_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_config_lockdown_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_config_lockdown_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1181,10 +1573,14 @@ void fwcmd_free_config_lockdown(struct fwcmd_config_lockdown_result *p_result)
 /* END config_lockdown */
 
 /* BEGIN ddrt_io_init_info */
-struct fwcmd_ddrt_io_init_info_result fwcmd_alloc_ddrt_io_init_info(unsigned int handle)
-{
-	struct fwcmd_ddrt_io_init_info_result result;
-	memset(&result, 0, sizeof (struct fwcmd_ddrt_io_init_info_result));
+int fwcmd_get_ddrt_io_init_info_into(unsigned int handle,
+	struct fwcmd_ddrt_io_init_info_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_ddrt_io_init_info_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_ddrt_io_init_info output_payload;
@@ -1192,29 +1588,49 @@ struct fwcmd_ddrt_io_init_info_result fwcmd_alloc_ddrt_io_init_info(unsigned int
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_ddrt_io_init_info_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_ddrt_io_init_info(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_ddrt_io_init_info(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_ddrt_io_init_info_result fwcmd_alloc_ddrt_io_init_info(unsigned int handle)
+{
+	struct fwcmd_ddrt_io_init_info_result result;
+	memset(&result, 0, sizeof (struct fwcmd_ddrt_io_init_info_result));
+
+	result.p_data = (struct fwcmd_ddrt_io_init_info_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_ddrt_io_init_info_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_ddrt_io_init_info_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1233,10 +1649,14 @@ void fwcmd_free_ddrt_io_init_info(struct fwcmd_ddrt_io_init_info_result *p_resul
 /* END ddrt_io_init_info */
 
 /* BEGIN get_supported_sku_features */
-struct fwcmd_get_supported_sku_features_result fwcmd_alloc_get_supported_sku_features(unsigned int handle)
-{
-	struct fwcmd_get_supported_sku_features_result result;
-	memset(&result, 0, sizeof (struct fwcmd_get_supported_sku_features_result));
+int fwcmd_get_get_supported_sku_features_into(unsigned int handle,
+	struct fwcmd_get_supported_sku_features_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_get_supported_sku_features_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_get_supported_sku_features output_payload;
@@ -1244,29 +1664,49 @@ struct fwcmd_get_supported_sku_features_result fwcmd_alloc_get_supported_sku_fea
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_get_supported_sku_features_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_get_supported_sku_features(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_get_supported_sku_features(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_get_supported_sku_features_result fwcmd_alloc_get_supported_sku_features(unsigned int handle)
+{
+	struct fwcmd_get_supported_sku_features_result result;
+	memset(&result, 0, sizeof (struct fwcmd_get_supported_sku_features_result));
+
+	result.p_data = (struct fwcmd_get_supported_sku_features_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_get_supported_sku_features_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_get_supported_sku_features_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1285,10 +1725,14 @@ void fwcmd_free_get_supported_sku_features(struct fwcmd_get_supported_sku_featur
 /* END get_supported_sku_features */
 
 /* BEGIN enable_dimm */
-struct fwcmd_enable_dimm_result fwcmd_alloc_enable_dimm(unsigned int handle)
-{
-	struct fwcmd_enable_dimm_result result;
-	memset(&result, 0, sizeof (struct fwcmd_enable_dimm_result));
+int fwcmd_get_enable_dimm_into(unsigned int handle,
+	struct fwcmd_enable_dimm_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_enable_dimm_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_enable_dimm output_payload;
@@ -1296,29 +1740,49 @@ struct fwcmd_enable_dimm_result fwcmd_alloc_enable_dimm(unsigned int handle)
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_enable_dimm_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_enable_dimm(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_enable_dimm(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_enable_dimm_result fwcmd_alloc_enable_dimm(unsigned int handle)
+{
+	struct fwcmd_enable_dimm_result result;
+	memset(&result, 0, sizeof (struct fwcmd_enable_dimm_result));
+
+	result.p_data = (struct fwcmd_enable_dimm_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_enable_dimm_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_enable_dimm_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1337,10 +1801,14 @@ void fwcmd_free_enable_dimm(struct fwcmd_enable_dimm_result *p_result)
 /* END enable_dimm */
 
 /* BEGIN smart_health_info */
-struct fwcmd_smart_health_info_result fwcmd_alloc_smart_health_info(unsigned int handle)
-{
-	struct fwcmd_smart_health_info_result result;
-	memset(&result, 0, sizeof (struct fwcmd_smart_health_info_result));
+int fwcmd_get_smart_health_info_into(unsigned int handle,
+	struct fwcmd_smart_health_info_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_smart_health_info_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_smart_health_info output_payload;
@@ -1348,29 +1816,49 @@ struct fwcmd_smart_health_info_result fwcmd_alloc_smart_health_info(unsigned int
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_smart_health_info_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_smart_health_info(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_smart_health_info(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_smart_health_info_result fwcmd_alloc_smart_health_info(unsigned int handle)
+{
+	struct fwcmd_smart_health_info_result result;
+	memset(&result, 0, sizeof (struct fwcmd_smart_health_info_result));
+
+	result.p_data = (struct fwcmd_smart_health_info_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_smart_health_info_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_smart_health_info_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1389,10 +1877,14 @@ void fwcmd_free_smart_health_info(struct fwcmd_smart_health_info_result *p_resul
 /* END smart_health_info */
 
 /* BEGIN firmware_image_info */
-struct fwcmd_firmware_image_info_result fwcmd_alloc_firmware_image_info(unsigned int handle)
-{
-	struct fwcmd_firmware_image_info_result result;
-	memset(&result, 0, sizeof (struct fwcmd_firmware_image_info_result));
+int fwcmd_get_firmware_image_info_into(unsigned int handle,
+	struct fwcmd_firmware_image_info_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_firmware_image_info_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_firmware_image_info output_payload;
@@ -1400,29 +1892,49 @@ struct fwcmd_firmware_image_info_result fwcmd_alloc_firmware_image_info(unsigned
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_firmware_image_info_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_firmware_image_info(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_firmware_image_info(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_firmware_image_info_result fwcmd_alloc_firmware_image_info(unsigned int handle)
+{
+	struct fwcmd_firmware_image_info_result result;
+	memset(&result, 0, sizeof (struct fwcmd_firmware_image_info_result));
+
+	result.p_data = (struct fwcmd_firmware_image_info_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_firmware_image_info_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_firmware_image_info_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1441,13 +1953,17 @@ void fwcmd_free_firmware_image_info(struct fwcmd_firmware_image_info_result *p_r
 /* END firmware_image_info */
 
 /* BEGIN firmware_debug_log */
-struct fwcmd_firmware_debug_log_result fwcmd_alloc_firmware_debug_log(unsigned int handle,
+int fwcmd_get_firmware_debug_log_into(unsigned int handle,
 	const unsigned char log_action,
 	const unsigned int log_page_offset,
-	const unsigned char log_id)
-{
-	struct fwcmd_firmware_debug_log_result result;
-	memset(&result, 0, sizeof (struct fwcmd_firmware_debug_log_result));
+	const unsigned char log_id,
+	struct fwcmd_firmware_debug_log_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_firmware_debug_log_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_firmware_debug_log input_payload;
@@ -1460,29 +1976,52 @@ struct fwcmd_firmware_debug_log_result fwcmd_alloc_firmware_debug_log(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_firmware_debug_log_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_firmware_debug_log(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_firmware_debug_log(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_firmware_debug_log_result fwcmd_alloc_firmware_debug_log(unsigned int handle,
+	const unsigned char log_action,
+	const unsigned int log_page_offset,
+	const unsigned char log_id)
+{
+	struct fwcmd_firmware_debug_log_result result;
+	memset(&result, 0, sizeof (struct fwcmd_firmware_debug_log_result));
+
+	result.p_data = (struct fwcmd_firmware_debug_log_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_firmware_debug_log_into(handle, log_action, log_page_offset, log_id,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_firmware_debug_log_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1501,10 +2040,14 @@ void fwcmd_free_firmware_debug_log(struct fwcmd_firmware_debug_log_result *p_res
 /* END firmware_debug_log */
 
 /* BEGIN memory_info_page_0 */
-struct fwcmd_memory_info_page_0_result fwcmd_alloc_memory_info_page_0(unsigned int handle)
-{
-	struct fwcmd_memory_info_page_0_result result;
-	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_0_result));
+int fwcmd_get_memory_info_page_0_into(unsigned int handle,
+	struct fwcmd_memory_info_page_0_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_memory_info_page_0_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_memory_info_page_0 input_payload;
@@ -1515,29 +2058,49 @@ struct fwcmd_memory_info_page_0_result fwcmd_alloc_memory_info_page_0(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_memory_info_page_0_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_memory_info_page_0(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_memory_info_page_0(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_memory_info_page_0_result fwcmd_alloc_memory_info_page_0(unsigned int handle)
+{
+	struct fwcmd_memory_info_page_0_result result;
+	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_0_result));
+
+	result.p_data = (struct fwcmd_memory_info_page_0_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_memory_info_page_0_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_memory_info_page_0_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1556,10 +2119,14 @@ void fwcmd_free_memory_info_page_0(struct fwcmd_memory_info_page_0_result *p_res
 /* END memory_info_page_0 */
 
 /* BEGIN memory_info_page_1 */
-struct fwcmd_memory_info_page_1_result fwcmd_alloc_memory_info_page_1(unsigned int handle)
-{
-	struct fwcmd_memory_info_page_1_result result;
-	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_1_result));
+int fwcmd_get_memory_info_page_1_into(unsigned int handle,
+	struct fwcmd_memory_info_page_1_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_memory_info_page_1_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_memory_info_page_1 input_payload;
@@ -1570,29 +2137,49 @@ struct fwcmd_memory_info_page_1_result fwcmd_alloc_memory_info_page_1(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_memory_info_page_1_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_memory_info_page_1(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_memory_info_page_1(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_memory_info_page_1_result fwcmd_alloc_memory_info_page_1(unsigned int handle)
+{
+	struct fwcmd_memory_info_page_1_result result;
+	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_1_result));
+
+	result.p_data = (struct fwcmd_memory_info_page_1_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_memory_info_page_1_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_memory_info_page_1_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1611,10 +2198,14 @@ void fwcmd_free_memory_info_page_1(struct fwcmd_memory_info_page_1_result *p_res
 /* END memory_info_page_1 */
 
 /* BEGIN memory_info_page_3 */
-struct fwcmd_memory_info_page_3_result fwcmd_alloc_memory_info_page_3(unsigned int handle)
-{
-	struct fwcmd_memory_info_page_3_result result;
-	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_3_result));
+int fwcmd_get_memory_info_page_3_into(unsigned int handle,
+	struct fwcmd_memory_info_page_3_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_memory_info_page_3_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_input_memory_info_page_3 input_payload;
@@ -1625,29 +2216,49 @@ struct fwcmd_memory_info_page_3_result fwcmd_alloc_memory_info_page_3(unsigned i
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_memory_info_page_3_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_memory_info_page_3(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_memory_info_page_3(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_memory_info_page_3_result fwcmd_alloc_memory_info_page_3(unsigned int handle)
+{
+	struct fwcmd_memory_info_page_3_result result;
+	memset(&result, 0, sizeof (struct fwcmd_memory_info_page_3_result));
+
+	result.p_data = (struct fwcmd_memory_info_page_3_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_memory_info_page_3_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_memory_info_page_3_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1666,10 +2277,14 @@ void fwcmd_free_memory_info_page_3(struct fwcmd_memory_info_page_3_result *p_res
 /* END memory_info_page_3 */
 
 /* BEGIN long_operation_status */
-struct fwcmd_long_operation_status_result fwcmd_alloc_long_operation_status(unsigned int handle)
-{
-	struct fwcmd_long_operation_status_result result;
-	memset(&result, 0, sizeof (struct fwcmd_long_operation_status_result));
+int fwcmd_get_long_operation_status_into(unsigned int handle,
+	struct fwcmd_long_operation_status_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_long_operation_status_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_long_operation_status output_payload;
@@ -1677,29 +2292,49 @@ struct fwcmd_long_operation_status_result fwcmd_alloc_long_operation_status(unsi
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_long_operation_status_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_long_operation_status(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_long_operation_status(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_long_operation_status_result fwcmd_alloc_long_operation_status(unsigned int handle)
+{
+	struct fwcmd_long_operation_status_result result;
+	memset(&result, 0, sizeof (struct fwcmd_long_operation_status_result));
+
+	result.p_data = (struct fwcmd_long_operation_status_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_long_operation_status_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_long_operation_status_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -1718,10 +2353,14 @@ void fwcmd_free_long_operation_status(struct fwcmd_long_operation_status_result
 /* END long_operation_status */
 
 /* BEGIN bsr */
-struct fwcmd_bsr_result fwcmd_alloc_bsr(unsigned int handle)
-{
-	struct fwcmd_bsr_result result;
-	memset(&result, 0, sizeof (struct fwcmd_bsr_result));
+int fwcmd_get_bsr_into(unsigned int handle,
+	struct fwcmd_bsr_data *p_data,
+	struct fwcmd_error_code *p_error)
+{
+	struct fwcmd_error_code error_code;
+	memset(&error_code, 0, sizeof (struct fwcmd_error_code));
+	memset(p_data, 0, sizeof (struct fwcmd_bsr_data));
+	int success = 0;
 	unsigned int rc  = FIS_ERR_SUCCESS;
 
 	struct pt_output_bsr output_payload;
@@ -1729,29 +2368,49 @@ struct fwcmd_bsr_result fwcmd_alloc_bsr(unsigned int handle)
 
 	if (PT_IS_SUCCESS(rc))
 	{
-		result.p_data = (struct fwcmd_bsr_data *)malloc(sizeof(*result.p_data));
-		if (result.p_data)
+		rc = fis_parse_bsr(&output_payload, p_data);
+		if (FWCMD_PARSE_SUCCESS(rc))
 		{
-			rc = fis_parse_bsr(&output_payload, result.p_data);
-			if (FWCMD_PARSE_SUCCESS(rc))
-			{
-				result.success = 1;
-			}
-			else
-			{
-				result.error_code.type = FWCMD_ERROR_TYPE_PARSE;
-				result.error_code.code = rc;
-			}
+			success = 1;
 		}
 		else
 		{
-			result.error_code.code = FWCMD_ERR_NOMEMORY;
+			error_code.type = FWCMD_ERROR_TYPE_PARSE;
+			error_code.code = rc;
 		}
 	}
 	else
 	{
-		result.error_code.type = FWCMD_ERROR_TYPE_PT;
-		result.error_code.code = rc;
+		error_code.type = FWCMD_ERROR_TYPE_PT;
+		error_code.code = rc;
+	}
+	if (p_error)
+	{
+		*p_error = error_code;
+	}
+	return success;
+}
+
+struct fwcmd_bsr_result fwcmd_alloc_bsr(unsigned int handle)
+{
+	struct fwcmd_bsr_result result;
+	memset(&result, 0, sizeof (struct fwcmd_bsr_result));
+
+	result.p_data = (struct fwcmd_bsr_data *)malloc(sizeof(*result.p_data));
+	if (result.p_data)
+	{
+		result.success = fwcmd_get_bsr_into(handle,
+			result.p_data, &result.error_code);
+		if (!result.success)
+		{
+			fwcmd_free_bsr_data(result.p_data);
+			free(result.p_data);
+			result.p_data = NULL;
+		}
+	}
+	else
+	{
+		result.error_code.code = FWCMD_ERR_NOMEMORY;
 	}
 	return result;
 }
@@ -113,6 +113,16 @@ struct fwcmd_identify_dimm_result
 struct fwcmd_identify_dimm_result fwcmd_alloc_identify_dimm(unsigned int handle);
 
 void fwcmd_free_identify_dimm(struct fwcmd_identify_dimm_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_identify_dimm but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_identify_dimm_data.
+ */
+int fwcmd_get_identify_dimm_into(unsigned int handle,
+	struct fwcmd_identify_dimm_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_identify_dimm_data(struct fwcmd_identify_dimm_data *p_data);
 /*
  * Data Structures for identify_dimm_characteristics
  */
@@ -139,6 +149,16 @@ struct fwcmd_identify_dimm_characteristics_result
 struct fwcmd_identify_dimm_characteristics_result fwcmd_alloc_identify_dimm_characteristics(unsigned int handle);
 
 void fwcmd_free_identify_dimm_characteristics(struct fwcmd_identify_dimm_characteristics_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_identify_dimm_characteristics but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_identify_dimm_characteristics_data.
+ */
+int fwcmd_get_identify_dimm_characteristics_into(unsigned int handle,
+	struct fwcmd_identify_dimm_characteristics_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_identify_dimm_characteristics_data(struct fwcmd_identify_dimm_characteristics_data *p_data);
 /*
  * Data Structures for get_security_state
  */
@@ -167,6 +187,16 @@ struct fwcmd_get_security_state_result
 struct fwcmd_get_security_state_result fwcmd_alloc_get_security_state(unsigned int handle);
 
 void fwcmd_free_get_security_state(struct fwcmd_get_security_state_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_get_security_state but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_get_security_state_data.
+ */
+int fwcmd_get_get_security_state_into(unsigned int handle,
+	struct fwcmd_get_security_state_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_get_security_state_data(struct fwcmd_get_security_state_data *p_data);
 /*
  * Data Structures for set_passphrase
  */
@@ -276,6 +306,16 @@ struct fwcmd_get_alarm_threshold_result
 struct fwcmd_get_alarm_threshold_result fwcmd_alloc_get_alarm_threshold(unsigned int handle);
 
 void fwcmd_free_get_alarm_threshold(struct fwcmd_get_alarm_threshold_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_get_alarm_threshold but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_get_alarm_threshold_data.
+ */
+int fwcmd_get_get_alarm_threshold_into(unsigned int handle,
+	struct fwcmd_get_alarm_threshold_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_get_alarm_threshold_data(struct fwcmd_get_alarm_threshold_data *p_data);
 /*
  * Data Structures for power_management_policy
  */
@@ -302,6 +342,16 @@ struct fwcmd_power_management_policy_result
 struct fwcmd_power_management_policy_result fwcmd_alloc_power_management_policy(unsigned int handle);
 
 void fwcmd_free_power_management_policy(struct fwcmd_power_management_policy_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_power_management_policy but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_power_management_policy_data.
+ */
+int fwcmd_get_power_management_policy_into(unsigned int handle,
+	struct fwcmd_power_management_policy_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_power_management_policy_data(struct fwcmd_power_management_policy_data *p_data);
 /*
  * Data Structures for die_sparing_policy
  */
@@ -331,6 +381,16 @@ struct fwcmd_die_sparing_policy_result
 struct fwcmd_die_sparing_policy_result fwcmd_alloc_die_sparing_policy(unsigned int handle);
 
 void fwcmd_free_die_sparing_policy(struct fwcmd_die_sparing_policy_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_die_sparing_policy but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_die_sparing_policy_data.
+ */
+int fwcmd_get_die_sparing_policy_into(unsigned int handle,
+	struct fwcmd_die_sparing_policy_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_die_sparing_policy_data(struct fwcmd_die_sparing_policy_data *p_data);
 /*
  * Data Structures for address_range_scrub
  */
@@ -357,6 +417,16 @@ struct fwcmd_address_range_scrub_result
 struct fwcmd_address_range_scrub_result fwcmd_alloc_address_range_scrub(unsigned int handle);
 
 void fwcmd_free_address_range_scrub(struct fwcmd_address_range_scrub_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_address_range_scrub but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_address_range_scrub_data.
+ */
+int fwcmd_get_address_range_scrub_into(unsigned int handle,
+	struct fwcmd_address_range_scrub_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_address_range_scrub_data(struct fwcmd_address_range_scrub_data *p_data);
 /*
  * Data Structures for optional_configuration_data_policy
  */
@@ -382,6 +452,16 @@ struct fwcmd_optional_configuration_data_policy_result
 struct fwcmd_optional_configuration_data_policy_result fwcmd_alloc_optional_configuration_data_policy(unsigned int handle);
 
 void fwcmd_free_optional_configuration_data_policy(struct fwcmd_optional_configuration_data_policy_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_optional_configuration_data_policy but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_optional_configuration_data_policy_data.
+ */
+int fwcmd_get_optional_configuration_data_policy_into(unsigned int handle,
+	struct fwcmd_optional_configuration_data_policy_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_optional_configuration_data_policy_data(struct fwcmd_optional_configuration_data_policy_data *p_data);
 /*
  * Data Structures for pmon_registers
  */
@@ -432,6 +512,17 @@ struct fwcmd_pmon_registers_result fwcmd_alloc_pmon_registers(unsigned int handl
 	const unsigned short pmon_retreive_mask);
 
 void fwcmd_free_pmon_registers(struct fwcmd_pmon_registers_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_pmon_registers but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_pmon_registers_data.
+ */
+int fwcmd_get_pmon_registers_into(unsigned int handle,
+	const unsigned short pmon_retreive_mask,
+	struct fwcmd_pmon_registers_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_pmon_registers_data(struct fwcmd_pmon_registers_data *p_data);
 /*
  * Data Structures for set_alarm_threshold
  */
@@ -473,6 +564,16 @@ struct fwcmd_system_time_result
 struct fwcmd_system_time_result fwcmd_alloc_system_time(unsigned int handle);
 
 void fwcmd_free_system_time(struct fwcmd_system_time_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_system_time but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_system_time_data.
+ */
+int fwcmd_get_system_time_into(unsigned int handle,
+	struct fwcmd_system_time_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_system_time_data(struct fwcmd_system_time_data *p_data);
 /*
  * Data Structures for platform_config_data
  */
@@ -640,6 +741,19 @@ struct fwcmd_platform_config_data_result fwcmd_alloc_platform_config_data(unsign
 	const unsigned int offset);
 
 void fwcmd_free_platform_config_data(struct fwcmd_platform_config_data_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_platform_config_data but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_platform_config_data_data.
+ */
+int fwcmd_get_platform_config_data_into(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	struct fwcmd_platform_config_data_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_platform_config_data_data(struct fwcmd_platform_config_data_data *p_data);
 /*
  * Data Structures for namespace_labels
  */
@@ -724,6 +838,19 @@ struct fwcmd_namespace_labels_result fwcmd_alloc_namespace_labels(unsigned int h
 	const unsigned int offset);
 
 void fwcmd_free_namespace_labels(struct fwcmd_namespace_labels_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_namespace_labels but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_namespace_labels_data.
+ */
+int fwcmd_get_namespace_labels_into(unsigned int handle,
+	const unsigned char partition_id,
+	const unsigned char command_option,
+	const unsigned int offset,
+	struct fwcmd_namespace_labels_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_namespace_labels_data(struct fwcmd_namespace_labels_data *p_data);
 /*
  * Data Structures for dimm_partition_info
  */
@@ -752,6 +879,16 @@ struct fwcmd_dimm_partition_info_result
 struct fwcmd_dimm_partition_info_result fwcmd_alloc_dimm_partition_info(unsigned int handle);
 
 void fwcmd_free_dimm_partition_info(struct fwcmd_dimm_partition_info_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_dimm_partition_info but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_dimm_partition_info_data.
+ */
+int fwcmd_get_dimm_partition_info_into(unsigned int handle,
+	struct fwcmd_dimm_partition_info_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_dimm_partition_info_data(struct fwcmd_dimm_partition_info_data *p_data);
 /*
  * Data Structures for fw_debug_log_level
  */
@@ -777,6 +914,17 @@ struct fwcmd_fw_debug_log_level_result fwcmd_alloc_fw_debug_log_level(unsigned i
 	const unsigned char log_id);
 
 void fwcmd_free_fw_debug_log_level(struct fwcmd_fw_debug_log_level_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_fw_debug_log_level but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_fw_debug_log_level_data.
+ */
+int fwcmd_get_fw_debug_log_level_into(unsigned int handle,
+	const unsigned char log_id,
+	struct fwcmd_fw_debug_log_level_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_fw_debug_log_level_data(struct fwcmd_fw_debug_log_level_data *p_data);
 /*
  * Data Structures for fw_load_flag
  */
@@ -800,6 +948,16 @@ struct fwcmd_fw_load_flag_result
 struct fwcmd_fw_load_flag_result fwcmd_alloc_fw_load_flag(unsigned int handle);
 
 void fwcmd_free_fw_load_flag(struct fwcmd_fw_load_flag_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_fw_load_flag but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_fw_load_flag_data.
+ */
+int fwcmd_get_fw_load_flag_into(unsigned int handle,
+	struct fwcmd_fw_load_flag_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_fw_load_flag_data(struct fwcmd_fw_load_flag_data *p_data);
 /*
  * Data Structures for config_lockdown
  */
@@ -823,6 +981,16 @@ struct fwcmd_config_lockdown_result
 struct fwcmd_config_lockdown_result fwcmd_alloc_config_lockdown(unsigned int handle);
 
 void fwcmd_free_config_lockdown(struct fwcmd_config_lockdown_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_config_lockdown but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_config_lockdown_data.
+ */
+int fwcmd_get_config_lockdown_into(unsigned int handle,
+	struct fwcmd_config_lockdown_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_config_lockdown_data(struct fwcmd_config_lockdown_data *p_data);
 /*
  * Data Structures for ddrt_io_init_info
  */
@@ -847,6 +1015,16 @@ struct fwcmd_ddrt_io_init_info_result
 struct fwcmd_ddrt_io_init_info_result fwcmd_alloc_ddrt_io_init_info(unsigned int handle);
 
 void fwcmd_free_ddrt_io_init_info(struct fwcmd_ddrt_io_init_info_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_ddrt_io_init_info but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_ddrt_io_init_info_data.
+ */
+int fwcmd_get_ddrt_io_init_info_into(unsigned int handle,
+	struct fwcmd_ddrt_io_init_info_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_ddrt_io_init_info_data(struct fwcmd_ddrt_io_init_info_data *p_data);
 /*
  * Data Structures for get_supported_sku_features
  */
@@ -870,6 +1048,16 @@ struct fwcmd_get_supported_sku_features_result
 struct fwcmd_get_supported_sku_features_result fwcmd_alloc_get_supported_sku_features(unsigned int handle);
 
 void fwcmd_free_get_supported_sku_features(struct fwcmd_get_supported_sku_features_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_get_supported_sku_features but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_get_supported_sku_features_data.
+ */
+int fwcmd_get_get_supported_sku_features_into(unsigned int handle,
+	struct fwcmd_get_supported_sku_features_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_get_supported_sku_features_data(struct fwcmd_get_supported_sku_features_data *p_data);
 /*
  * Data Structures for enable_dimm
  */
@@ -893,6 +1081,16 @@ struct fwcmd_enable_dimm_result
 struct fwcmd_enable_dimm_result fwcmd_alloc_enable_dimm(unsigned int handle);
 
 void fwcmd_free_enable_dimm(struct fwcmd_enable_dimm_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_enable_dimm but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_enable_dimm_data.
+ */
+int fwcmd_get_enable_dimm_into(unsigned int handle,
+	struct fwcmd_enable_dimm_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_enable_dimm_data(struct fwcmd_enable_dimm_data *p_data);
 /*
  * Data Structures for smart_health_info
  */
@@ -963,6 +1161,16 @@ struct fwcmd_smart_health_info_result
 struct fwcmd_smart_health_info_result fwcmd_alloc_smart_health_info(unsigned int handle);
 
 void fwcmd_free_smart_health_info(struct fwcmd_smart_health_info_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_smart_health_info but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_smart_health_info_data.
+ */
+int fwcmd_get_smart_health_info_into(unsigned int handle,
+	struct fwcmd_smart_health_info_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_smart_health_info_data(struct fwcmd_smart_health_info_data *p_data);
 /*
  * Data Structures for firmware_image_info
  */
@@ -991,6 +1199,16 @@ struct fwcmd_firmware_image_info_result
 struct fwcmd_firmware_image_info_result fwcmd_alloc_firmware_image_info(unsigned int handle);
 
 void fwcmd_free_firmware_image_info(struct fwcmd_firmware_image_info_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_firmware_image_info but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_firmware_image_info_data.
+ */
+int fwcmd_get_firmware_image_info_into(unsigned int handle,
+	struct fwcmd_firmware_image_info_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_firmware_image_info_data(struct fwcmd_firmware_image_info_data *p_data);
 /*
  * Data Structures for firmware_debug_log
  */
@@ -1017,6 +1235,19 @@ struct fwcmd_firmware_debug_log_result fwcmd_alloc_firmware_debug_log(unsigned i
 	const unsigned char log_id);
 
 void fwcmd_free_firmware_debug_log(struct fwcmd_firmware_debug_log_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_firmware_debug_log but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_firmware_debug_log_data.
+ */
+int fwcmd_get_firmware_debug_log_into(unsigned int handle,
+	const unsigned char log_action,
+	const unsigned int log_page_offset,
+	const unsigned char log_id,
+	struct fwcmd_firmware_debug_log_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_firmware_debug_log_data(struct fwcmd_firmware_debug_log_data *p_data);
 /*
  * Data Structures for memory_info_page_0
  */
@@ -1045,6 +1276,16 @@ struct fwcmd_memory_info_page_0_result
 struct fwcmd_memory_info_page_0_result fwcmd_alloc_memory_info_page_0(unsigned int handle);
 
 void fwcmd_free_memory_info_page_0(struct fwcmd_memory_info_page_0_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_memory_info_page_0 but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_memory_info_page_0_data.
+ */
+int fwcmd_get_memory_info_page_0_into(unsigned int handle,
+	struct fwcmd_memory_info_page_0_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_memory_info_page_0_data(struct fwcmd_memory_info_page_0_data *p_data);
 /*
  * Data Structures for memory_info_page_1
  */
@@ -1073,6 +1314,16 @@ struct fwcmd_memory_info_page_1_result
 struct fwcmd_memory_info_page_1_result fwcmd_alloc_memory_info_page_1(unsigned int handle);
 
 void fwcmd_free_memory_info_page_1(struct fwcmd_memory_info_page_1_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_memory_info_page_1 but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_memory_info_page_1_data.
+ */
+int fwcmd_get_memory_info_page_1_into(unsigned int handle,
+	struct fwcmd_memory_info_page_1_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_memory_info_page_1_data(struct fwcmd_memory_info_page_1_data *p_data);
 /*
  * Data Structures for memory_info_page_3
  */
@@ -1103,6 +1354,16 @@ struct fwcmd_memory_info_page_3_result
 struct fwcmd_memory_info_page_3_result fwcmd_alloc_memory_info_page_3(unsigned int handle);
 
 void fwcmd_free_memory_info_page_3(struct fwcmd_memory_info_page_3_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_memory_info_page_3 but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_memory_info_page_3_data.
+ */
+int fwcmd_get_memory_info_page_3_into(unsigned int handle,
+	struct fwcmd_memory_info_page_3_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_memory_info_page_3_data(struct fwcmd_memory_info_page_3_data *p_data);
 /*
  * Data Structures for long_operation_status
  */
@@ -1130,6 +1391,16 @@ struct fwcmd_long_operation_status_result
 struct fwcmd_long_operation_status_result fwcmd_alloc_long_operation_status(unsigned int handle);
 
 void fwcmd_free_long_operation_status(struct fwcmd_long_operation_status_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_long_operation_status but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_long_operation_status_data.
+ */
+int fwcmd_get_long_operation_status_into(unsigned int handle,
+	struct fwcmd_long_operation_status_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_long_operation_status_data(struct fwcmd_long_operation_status_data *p_data);
 /*
  * Data Structures for bsr
  */
@@ -1170,6 +1441,16 @@ struct fwcmd_bsr_result
 struct fwcmd_bsr_result fwcmd_alloc_bsr(unsigned int handle);
 
 void fwcmd_free_bsr(struct fwcmd_bsr_result *p_result);
+
+/*
+ * Same as fwcmd_alloc_bsr but parses into caller storage. Returns 1 on
+ * success. Release anything p_data refers to with fwcmd_free_bsr_data.
+ */
+int fwcmd_get_bsr_into(unsigned int handle,
+	struct fwcmd_bsr_data *p_data,
+	struct fwcmd_error_code *p_error);
+
+void fwcmd_free_bsr_data(struct fwcmd_bsr_data *p_data);
 /*
  * Data Structures for format
  */
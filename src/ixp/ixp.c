@@ -28,8 +28,10 @@
 #include <string.h>
 #include <stdio.h>
 #include <common_types.h>
+#include <os/os_adapter.h>
 #include "ixp.h"
 #include "ixp_prv.h"
+#include "ixp_properties.h"
 
 
 int ixp_create_ctx_nfit_handle(struct ixp_context **ctx, const NVM_NFIT_DEVICE_HANDLE handle, void *user_data)
@@ -43,6 +45,9 @@ int ixp_create_ctx_nfit_handle(struct ixp_context **ctx, const NVM_NFIT_DEVICE_H
 	struct ixp_context *pctx = (struct ixp_context*)*ctx;
 	pctx->handle = handle;
 	pctx->user_data = user_data;
+	pctx->arena = NULL;
+	pctx->fwcmd_cache_device_changes = get_device_change_count();
+	pctx->fwcmd_cache_count = 0;
 	return IXP_SUCCESS;
 }
 
@@ -65,6 +70,27 @@ int ixp_get_ctx_user_data(struct ixp_context *ctx, void **user_data)
 	else return IXP_NULL_INPUT_PARAM;
 }
 
+static void free_fwcmd_cache(struct ixp_context *ctx)
+{
+	for (unsigned int i = 0; i < ctx->fwcmd_cache_count; i++)
+	{
+		ctx->fwcmd_cache[i].fwcmd_free(&ctx->fwcmd_cache[i].result);
+	}
+	ctx->fwcmd_cache_count = 0;
+}
+
+static void free_arena(struct ixp_context *ctx)
+{
+	struct ixp_arena_block *block = ctx->arena;
+	while (block)
+	{
+		struct ixp_arena_block *next = block->next;
+		free(block);
+		block = next;
+	}
+	ctx->arena = NULL;
+}
+
 int ixp_free_ctx(struct ixp_context *ctx)
 {
 	if (!ctx)
@@ -73,8 +99,231 @@ int ixp_free_ctx(struct ixp_context *ctx)
 	}
 	else
 	{
+		free_fwcmd_cache(ctx);
+		free_arena(ctx);
 		free(ctx);
 	}
 	return IXP_SUCCESS;
 }
 
+void *ixp_arena_alloc(struct ixp_context *ctx, size_t size)
+{
+	// keep every value aligned for any scalar type
+	size = (size + sizeof (long long) - 1) & ~(sizeof (long long) - 1);
+
+	struct ixp_arena_block *block = ctx->arena;
+	if (!block || block->size - block->used < size)
+	{
+		size_t block_size = size > IXP_ARENA_BLOCK_SIZE ? size : IXP_ARENA_BLOCK_SIZE;
+		if (NULL == (block = (struct ixp_arena_block *)malloc(
+			sizeof (struct ixp_arena_block) + block_size)))
+		{
+			return NULL;
+		}
+		block->size = block_size;
+		block->used = 0;
+		block->next = ctx->arena;
+		ctx->arena = block;
+	}
+
+	void *value = (unsigned char *)(block + 1) + block->used;
+	block->used += size;
+	return value;
+}
+
+struct fwcmd_result ixp_get_fwcmd_result(struct ixp_context *ctx,
+	ixp_fwcmd_fn fwcmd, ixp_fwcmd_free_fn fwcmd_free, int *owned)
+{
+	*owned = 0;
+
+	// results read before a FW update, security change, etc. are stale
+	unsigned int device_changes = get_device_change_count();
+	if (device_changes != ctx->fwcmd_cache_device_changes)
+	{
+		free_fwcmd_cache(ctx);
+		ctx->fwcmd_cache_device_changes = device_changes;
+	}
+
+	for (unsigned int i = 0; i < ctx->fwcmd_cache_count; i++)
+	{
+		if (ctx->fwcmd_cache[i].fwcmd == fwcmd)
+		{
+			return ctx->fwcmd_cache[i].result;
+		}
+	}
+
+	struct fwcmd_result result = (*fwcmd)((unsigned int)ctx->handle.handle);
+	// only successful results are worth keeping, a failure may be transient
+	if (result.success && ctx->fwcmd_cache_count < IXP_FWCMD_CACHE_MAX)
+	{
+		struct ixp_fwcmd_cache_entry *entry = &ctx->fwcmd_cache[ctx->fwcmd_cache_count++];
+		entry->fwcmd = fwcmd;
+		entry->fwcmd_free = fwcmd_free;
+		entry->result = result;
+	}
+	else
+	{
+		*owned = 1;
+	}
+	return result;
+}
+
+// State shared by the threads populating an ixp_prop_table
+struct ixp_multi_work
+{
+	struct ixp_prop_table *table;
+	// Each FIS command needed for the requested properties, once
+	unsigned int num_populate;
+	ixp_populate_fn populate[IXP_PROP_KEY_MAX];
+};
+
+static int populate_prop_table_row(struct ixp_multi_work *work, unsigned int handle_index)
+{
+	struct ixp_prop_table *table = work->table;
+	struct ixp_context *ctx = table->contexts[handle_index];
+
+	// The populate functions fill a contiguous array of properties, so
+	// gather the handle's row and scatter it back into the columns
+	struct ixp_prop_info *row = (struct ixp_prop_info *)ixp_arena_alloc(ctx,
+		sizeof (struct ixp_prop_info) * table->num_props);
+	if (!row)
+	{
+		return IXP_NO_MEM_RESOURCES;
+	}
+	for (unsigned int p = 0; p < table->num_props; p++)
+	{
+		row[p] = table->props[p * table->num_handles + handle_index];
+	}
+
+	int rc = IXP_SUCCESS;
+	for (unsigned int f = 0; f < work->num_populate && rc == IXP_SUCCESS; f++)
+	{
+		rc = (work->populate[f])(ctx, row, table->num_props);
+	}
+	if (rc != IXP_SUCCESS)
+	{
+		ixp_free_props(row, table->num_props);
+	}
+
+	for (unsigned int p = 0; p < table->num_props; p++)
+	{
+		table->props[p * table->num_handles + handle_index] = row[p];
+	}
+	return rc;
+}
+
+static void populate_prop_table_rows(void *arg, COMMON_UINT32 handle_index)
+{
+	struct ixp_multi_work *work = (struct ixp_multi_work *)arg;
+	work->table->handle_status[handle_index] =
+		populate_prop_table_row(work, handle_index);
+}
+
+int ixp_get_props_multi(const NVM_NFIT_DEVICE_HANDLE *handles, unsigned int num_handles,
+	const IXP_PROP_KEY *prop_keys, unsigned int num_props, struct ixp_prop_table **table)
+{
+	if (!handles || !prop_keys || !table)
+	{
+		return IXP_NULL_INPUT_PARAM;
+	}
+	*table = NULL;
+
+	struct ixp_multi_work *work = (struct ixp_multi_work *)calloc(1, sizeof (struct ixp_multi_work));
+	if (!work)
+	{
+		return IXP_NO_MEM_RESOURCES;
+	}
+
+	// Reduce the requested properties to the FIS commands that populate them
+	int rc = IXP_SUCCESS;
+	for (unsigned int p = 0; p < num_props && rc == IXP_SUCCESS; p++)
+	{
+		struct ixp_lookup_t entry;
+		if (IXP_SUCCESS == (rc = ixp_get_g_ixp_lookup_entry(prop_keys[p], &entry)))
+		{
+			unsigned int f = 0;
+			while (f < work->num_populate && work->populate[f] != entry.f_populate)
+			{
+				f++;
+			}
+			if (f == work->num_populate)
+			{
+				work->populate[work->num_populate++] = entry.f_populate;
+			}
+		}
+	}
+
+	struct ixp_prop_table *p_table = NULL;
+	if (rc == IXP_SUCCESS)
+	{
+		p_table = (struct ixp_prop_table *)calloc(1, sizeof (struct ixp_prop_table));
+		if (!p_table)
+		{
+			rc = IXP_NO_MEM_RESOURCES;
+		}
+	}
+	if (rc == IXP_SUCCESS)
+	{
+		p_table->num_handles = num_handles;
+		p_table->num_props = num_props;
+		p_table->handle_status = (int *)calloc(num_handles, sizeof (int));
+		p_table->props = (struct ixp_prop_info *)calloc(
+			(size_t)num_handles * num_props, sizeof (struct ixp_prop_info));
+		p_table->contexts = (struct ixp_context **)calloc(num_handles,
+			sizeof (struct ixp_context *));
+		if ((num_handles && (!p_table->handle_status || !p_table->contexts)) ||
+			(num_handles && num_props && !p_table->props))
+		{
+			rc = IXP_NO_MEM_RESOURCES;
+		}
+	}
+	for (unsigned int h = 0; h < num_handles && rc == IXP_SUCCESS; h++)
+	{
+		rc = ixp_create_ctx_nfit_handle(&p_table->contexts[h], handles[h], NULL);
+		for (unsigned int p = 0; p < num_props && rc == IXP_SUCCESS; p++)
+		{
+			rc = ixp_init_prop(&p_table->props[p * num_handles + h], prop_keys[p]);
+		}
+	}
+
+	if (rc == IXP_SUCCESS)
+	{
+		work->table = p_table;
+
+		// The DIMMs are independent, each has its own context
+		run_parallel(num_handles, PARALLEL_MAX_THREADS, populate_prop_table_rows, work);
+
+		*table = p_table;
+	}
+	else
+	{
+		ixp_free_prop_table(p_table);
+	}
+
+	free(work);
+	return rc;
+}
+
+int ixp_free_prop_table(struct ixp_prop_table *table)
+{
+	if (!table)
+	{
+		return IXP_NULL_INPUT_PARAM;
+	}
+
+	if (table->contexts)
+	{
+		for (unsigned int h = 0; h < table->num_handles; h++)
+		{
+			if (table->contexts[h])
+			{
+				ixp_free_ctx(table->contexts[h]);
+			}
+		}
+	}
+	free(table->contexts);
+	free(table->props);
+	free(table->handle_status);
+	free(table);
+	return IXP_SUCCESS;
+}
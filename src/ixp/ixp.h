@@ -51,6 +51,20 @@ struct ixp_prop_info
 	int prop_value_size;
 };
 
+// Properties gathered from several DIMMs by ixp_get_props_multi. Each
+// requested property is a column of num_handles entries, so the value for
+// handle h of property p is props[p * num_handles + h].
+struct ixp_prop_table
+{
+	unsigned int num_handles;
+	unsigned int num_props;
+	// IXP_SUCCESS or the error that stopped each handle's row from populating
+	int *handle_status;
+	struct ixp_prop_info *props;
+	// The property values belong to these, one per handle
+	struct ixp_context **contexts;
+};
+
 
 int ixp_create_ctx_nfit_handle(struct ixp_context **ctx, const NVM_NFIT_DEVICE_HANDLE handle, void *user_data);
 int ixp_create_ctx_uid(struct ixp_context **ctx, const NVM_UID uid, void *user_data);
@@ -65,6 +79,9 @@ int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned
 int ixp_free_props(struct ixp_prop_info *props, unsigned int num_props);
 int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned int num_props);
 int ixp_get_prop_key_by_name(char * name, unsigned int length, IXP_PROP_KEY * key);
+int ixp_get_props_multi(const NVM_NFIT_DEVICE_HANDLE *handles, unsigned int num_handles,
+	const IXP_PROP_KEY *prop_keys, unsigned int num_props, struct ixp_prop_table **table);
+int ixp_free_prop_table(struct ixp_prop_table *table);
 
 #ifdef __cplusplus
 }
@@ -30,6 +30,7 @@
 #include "ixp_fis_properties.h"
 #include <fw_commands.h>
 #include <ixp.h>
+#include <ixp_prv.h>
 
 
 
@@ -260,20 +261,27 @@ static const struct ixp_fw_lookup_t g_ixp_fw_lookup[] = {
 };
 
 
-// Get result from lower-level fwcmd and then populate any relevant properties
-// in the props array
+// Get result from lower-level fwcmd, once per context, and then populate any
+// relevant properties in the props array. Values are allocated from the
+// context arena and live until the context is freed.
 int get_fw_cmd(struct fwcmd_result (* fwcmd)(unsigned int),
 void (* fwcmd_free)(struct fwcmd_result *),
-unsigned int prop_key_first, unsigned int prop_key_length, unsigned int handle,
+unsigned int prop_key_first, unsigned int prop_key_length, struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props, const struct ixp_fw_lookup_t ixp_fw_lookup[])
 {
-	struct fwcmd_result result = (*fwcmd)(handle);
+	int owned;
+	struct fwcmd_result result = ixp_get_fwcmd_result(ctx, fwcmd, fwcmd_free, &owned);
 	if (!result.success)
 	{
+		if (owned)
+		{
+			fwcmd_free(&result);
+		}
 		// TODO: Convert fw error code into IXP error code
 		return IXP_INTERNAL_ERROR;
 	}
 
+	int rc = IXP_SUCCESS;
 	struct ixp_prop_info * prop;
 	for (int props_index = 0; props_index < num_props; props_index++)
 	{
@@ -286,10 +294,11 @@ struct ixp_prop_info props[], unsigned int num_props, const struct ixp_fw_lookup
 		}
 
 		prop->prop_value_size = ixp_fw_lookup[prop->prop_key].size;
-		prop->prop_value = malloc(ixp_fw_lookup[prop->prop_key].size);
+		prop->prop_value = ixp_arena_alloc(ctx, ixp_fw_lookup[prop->prop_key].size);
 		if (NULL == prop->prop_value)
 		{
-			return IXP_NO_MEM_RESOURCES;
+			rc = IXP_NO_MEM_RESOURCES;
+			break;
 		}
 
 		// TODO: Linux doesn't have memcpy_s??
@@ -305,440 +314,259 @@ struct ixp_prop_info props[], unsigned int num_props, const struct ixp_fw_lookup
 		if (snprintf(prop->prop_name, IXP_MAX_PROPERTY_NAME_SZ,
 		"%s", ixp_fw_lookup[prop->prop_key].name) >= IXP_MAX_PROPERTY_NAME_SZ)
 		{
-			fwcmd_free(&result);
 			// Pretty print string name is >= IXP_MAX_PROPERTY_NAME_SZ
-			return IXP_INTERNAL_ERROR;
+			rc = IXP_INTERNAL_ERROR;
+			break;
 		}
 	}
 
-	fwcmd_free(&result);
-	return IXP_SUCCESS;
-}
-
-void free_fw_cmd(unsigned int prop_key_first, unsigned int prop_key_length,
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	struct ixp_prop_info * prop;
-	// Only need to free the data portion of struct
-	for (int props_index = 0; props_index < num_props; props_index++)
+	if (owned)
 	{
-		prop = &(props[props_index]);
-
-		if (prop->prop_key < prop_key_first ||
-		prop->prop_key >= prop_key_first + prop_key_length ||
-		prop->prop_value == NULL)
-		{
-			continue;
-		}
-
-		free(prop->prop_value);
-		prop->prop_value = NULL;
-		prop->prop_value_size = 0;
+		fwcmd_free(&result);
 	}
+	return rc;
 }
 
-int get_fis_identify_dimm_properties(unsigned int handle,
+int get_fis_identify_dimm_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_identify_dimm,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_identify_dimm,
-	0, 24, handle, props, num_props, g_ixp_fw_lookup);
+	0, 24, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_identify_dimm_characteristics_properties(unsigned int handle,
+int get_fis_identify_dimm_characteristics_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_identify_dimm_characteristics,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_identify_dimm_characteristics,
-	24, 4, handle, props, num_props, g_ixp_fw_lookup);
+	24, 4, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_get_security_state_properties(unsigned int handle,
+int get_fis_get_security_state_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_security_state,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_security_state,
-	28, 6, handle, props, num_props, g_ixp_fw_lookup);
+	28, 6, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_get_alarm_threshold_properties(unsigned int handle,
+int get_fis_get_alarm_threshold_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_alarm_threshold,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_alarm_threshold,
-	34, 7, handle, props, num_props, g_ixp_fw_lookup);
+	34, 7, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_power_management_policy_properties(unsigned int handle,
+int get_fis_power_management_policy_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_power_management_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_power_management_policy,
-	41, 4, handle, props, num_props, g_ixp_fw_lookup);
+	41, 4, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_die_sparing_policy_properties(unsigned int handle,
+int get_fis_die_sparing_policy_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_die_sparing_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_die_sparing_policy,
-	45, 7, handle, props, num_props, g_ixp_fw_lookup);
+	45, 7, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_address_range_scrub_properties(unsigned int handle,
+int get_fis_address_range_scrub_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_address_range_scrub,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_address_range_scrub,
-	52, 4, handle, props, num_props, g_ixp_fw_lookup);
+	52, 4, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_optional_configuration_data_policy_properties(unsigned int handle,
+int get_fis_optional_configuration_data_policy_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_optional_configuration_data_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_optional_configuration_data_policy,
-	56, 3, handle, props, num_props, g_ixp_fw_lookup);
+	56, 3, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_pmon_registers_properties(unsigned int handle,
+int get_fis_pmon_registers_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_pmon_registers,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_pmon_registers,
-	59, 27, handle, props, num_props, g_ixp_fw_lookup);
+	59, 27, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_system_time_properties(unsigned int handle,
+int get_fis_system_time_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_system_time,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_system_time,
-	86, 1, handle, props, num_props, g_ixp_fw_lookup);
+	86, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_platform_config_data_properties(unsigned int handle,
+int get_fis_platform_config_data_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_platform_config_data,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_platform_config_data,
-	87, 15, handle, props, num_props, g_ixp_fw_lookup);
+	87, 15, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_namespace_labels_properties(unsigned int handle,
+int get_fis_namespace_labels_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_namespace_labels,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_namespace_labels,
-	102, 0, handle, props, num_props, g_ixp_fw_lookup);
+	102, 0, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_dimm_partition_info_properties(unsigned int handle,
+int get_fis_dimm_partition_info_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_dimm_partition_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_dimm_partition_info,
-	102, 6, handle, props, num_props, g_ixp_fw_lookup);
+	102, 6, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_fw_debug_log_level_properties(unsigned int handle,
+int get_fis_fw_debug_log_level_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_fw_debug_log_level,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_fw_debug_log_level,
-	108, 2, handle, props, num_props, g_ixp_fw_lookup);
+	108, 2, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_fw_load_flag_properties(unsigned int handle,
+int get_fis_fw_load_flag_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_fw_load_flag,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_fw_load_flag,
-	110, 1, handle, props, num_props, g_ixp_fw_lookup);
+	110, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_config_lockdown_properties(unsigned int handle,
+int get_fis_config_lockdown_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_config_lockdown,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_config_lockdown,
-	111, 1, handle, props, num_props, g_ixp_fw_lookup);
+	111, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_ddrt_io_init_info_properties(unsigned int handle,
+int get_fis_ddrt_io_init_info_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_ddrt_io_init_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_ddrt_io_init_info,
-	112, 2, handle, props, num_props, g_ixp_fw_lookup);
+	112, 2, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_get_supported_sku_features_properties(unsigned int handle,
+int get_fis_get_supported_sku_features_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_supported_sku_features,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_supported_sku_features,
-	114, 1, handle, props, num_props, g_ixp_fw_lookup);
+	114, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_enable_dimm_properties(unsigned int handle,
+int get_fis_enable_dimm_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_enable_dimm,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_enable_dimm,
-	115, 1, handle, props, num_props, g_ixp_fw_lookup);
+	115, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_smart_health_info_properties(unsigned int handle,
+int get_fis_smart_health_info_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_smart_health_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_smart_health_info,
-	116, 48, handle, props, num_props, g_ixp_fw_lookup);
+	116, 48, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_firmware_image_info_properties(unsigned int handle,
+int get_fis_firmware_image_info_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_firmware_image_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_firmware_image_info,
-	164, 6, handle, props, num_props, g_ixp_fw_lookup);
+	164, 6, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_firmware_debug_log_properties(unsigned int handle,
+int get_fis_firmware_debug_log_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_firmware_debug_log,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_firmware_debug_log,
-	170, 1, handle, props, num_props, g_ixp_fw_lookup);
+	170, 1, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_memory_info_page_0_properties(unsigned int handle,
+int get_fis_memory_info_page_0_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_0,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_0,
-	171, 6, handle, props, num_props, g_ixp_fw_lookup);
+	171, 6, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_memory_info_page_1_properties(unsigned int handle,
+int get_fis_memory_info_page_1_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_1,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_1,
-	177, 6, handle, props, num_props, g_ixp_fw_lookup);
+	177, 6, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_memory_info_page_3_properties(unsigned int handle,
+int get_fis_memory_info_page_3_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_3,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_3,
-	183, 8, handle, props, num_props, g_ixp_fw_lookup);
+	183, 8, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_long_operation_status_properties(unsigned int handle,
+int get_fis_long_operation_status_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_long_operation_status,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_long_operation_status,
-	191, 5, handle, props, num_props, g_ixp_fw_lookup);
+	191, 5, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
-int get_fis_bsr_properties(unsigned int handle,
+int get_fis_bsr_properties(struct ixp_context *ctx,
 struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_bsr,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_bsr,
-	196, 18, handle, props, num_props, g_ixp_fw_lookup);
-}
-
-void free_fis_identify_dimm_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(0, 24, props, num_props);
-}
-
-void free_fis_identify_dimm_characteristics_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(24, 4, props, num_props);
-}
-
-void free_fis_get_security_state_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(28, 6, props, num_props);
-}
-
-void free_fis_get_alarm_threshold_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(34, 7, props, num_props);
-}
-
-void free_fis_power_management_policy_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(41, 4, props, num_props);
-}
-
-void free_fis_die_sparing_policy_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(45, 7, props, num_props);
-}
-
-void free_fis_address_range_scrub_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(52, 4, props, num_props);
-}
-
-void free_fis_optional_configuration_data_policy_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(56, 3, props, num_props);
-}
-
-void free_fis_pmon_registers_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(59, 27, props, num_props);
-}
-
-void free_fis_system_time_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(86, 1, props, num_props);
-}
-
-void free_fis_platform_config_data_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(87, 15, props, num_props);
-}
-
-void free_fis_namespace_labels_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(102, 0, props, num_props);
-}
-
-void free_fis_dimm_partition_info_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(102, 6, props, num_props);
-}
-
-void free_fis_fw_debug_log_level_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(108, 2, props, num_props);
-}
-
-void free_fis_fw_load_flag_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(110, 1, props, num_props);
-}
-
-void free_fis_config_lockdown_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(111, 1, props, num_props);
-}
-
-void free_fis_ddrt_io_init_info_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(112, 2, props, num_props);
-}
-
-void free_fis_get_supported_sku_features_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(114, 1, props, num_props);
-}
-
-void free_fis_enable_dimm_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(115, 1, props, num_props);
-}
-
-void free_fis_smart_health_info_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(116, 48, props, num_props);
-}
-
-void free_fis_firmware_image_info_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(164, 6, props, num_props);
-}
-
-void free_fis_firmware_debug_log_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(170, 1, props, num_props);
-}
-
-void free_fis_memory_info_page_0_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(171, 6, props, num_props);
-}
-
-void free_fis_memory_info_page_1_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(177, 6, props, num_props);
-}
-
-void free_fis_memory_info_page_3_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(183, 8, props, num_props);
-}
-
-void free_fis_long_operation_status_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(191, 5, props, num_props);
-}
-
-void free_fis_bsr_properties(
-struct ixp_prop_info props[], unsigned int num_props)
-{
-	free_fw_cmd(196, 18, props, num_props);
+	196, 18, ctx, props, num_props, g_ixp_fw_lookup);
 }
 
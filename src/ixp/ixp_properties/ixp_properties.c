@@ -25,6 +25,7 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <ixp.h>
 #include <ixp_prv.h>
@@ -32,225 +33,449 @@
 #include "ixp_properties.h"
 
 // TODO: Add more types of entries in here, not just fw
-// TODO: Change passing a handle to passing ... something else (not context)
-//       Will probably require a conversion function
 // An array indexed by ixp_prop_key properties that contains useful information
 // defined in the ixp_lookup_t struct
 static struct ixp_lookup_t g_ixp_lookup[] = {
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "VendorId"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "DeviceId"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "RevisionId"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "InterfaceFormatCode"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "FirmwareRevision"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "ReservedOldApi"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "FeatureSwRequiredMask"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "InvalidateBeforeBlockRead"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "ReadbackOfBwAddressRegisterRequiredBeforeUse"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "NumberOfBlockWindows"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "OffsetOfBlockModeControlRegion"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "RawCapacity"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "Manufacturer"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "SerialNumber"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "PartNumber"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "DimmSku"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "MemoryModeEnabled"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "StorageModeEnabled"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "AppDirectModeEnabled"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "DieSparingCapable"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "SoftProgrammableSku"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "EncryptionEnabled"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "InterfaceFormatCodeExtra"},
-	{get_fis_identify_dimm_properties, free_fis_identify_dimm_properties, "ApiVer"},
-	{get_fis_identify_dimm_characteristics_properties, free_fis_identify_dimm_characteristics_properties, "ControllerTempShutdownThreshold"},
-	{get_fis_identify_dimm_characteristics_properties, free_fis_identify_dimm_characteristics_properties, "MediaTempShutdownThreshold"},
-	{get_fis_identify_dimm_characteristics_properties, free_fis_identify_dimm_characteristics_properties, "ThrottlingStartThreshold"},
-	{get_fis_identify_dimm_characteristics_properties, free_fis_identify_dimm_characteristics_properties, "ThrottlingStopThreshold"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "SecurityState"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "Enabled"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "Locked"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "Frozen"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "CountExpired"},
-	{get_fis_get_security_state_properties, free_fis_get_security_state_properties, "NotSupported"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "Enable"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "SpareBlock"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "MediaTemp"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "ControllerTemp"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "SpareBlockThreshold"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "MediaTempThreshold"},
-	{get_fis_get_alarm_threshold_properties, free_fis_get_alarm_threshold_properties, "ControllerTempThreshold"},
-	{get_fis_power_management_policy_properties, free_fis_power_management_policy_properties, "Enable"},
-	{get_fis_power_management_policy_properties, free_fis_power_management_policy_properties, "PeakPowerBudget"},
-	{get_fis_power_management_policy_properties, free_fis_power_management_policy_properties, "AveragePowerBudget"},
-	{get_fis_power_management_policy_properties, free_fis_power_management_policy_properties, "MaxPower"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Enable"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Aggressiveness"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Supported"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Rank0"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Rank1"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Rank2"},
-	{get_fis_die_sparing_policy_properties, free_fis_die_sparing_policy_properties, "Rank3"},
-	{get_fis_address_range_scrub_properties, free_fis_address_range_scrub_properties, "Enable"},
-	{get_fis_address_range_scrub_properties, free_fis_address_range_scrub_properties, "DpaStartAddress"},
-	{get_fis_address_range_scrub_properties, free_fis_address_range_scrub_properties, "DpaEndAddress"},
-	{get_fis_address_range_scrub_properties, free_fis_address_range_scrub_properties, "DpaCurrentAddress"},
-	{get_fis_optional_configuration_data_policy_properties, free_fis_optional_configuration_data_policy_properties, "FirstFastRefresh"},
-	{get_fis_optional_configuration_data_policy_properties, free_fis_optional_configuration_data_policy_properties, "ViralPolicyEnabled"},
-	{get_fis_optional_configuration_data_policy_properties, free_fis_optional_configuration_data_policy_properties, "ViralStatus"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "PmonRetreiveMask"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon0Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon0Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon1Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon1Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon2Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon2Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon3Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon3Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon4Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon4Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon5Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon5Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon6Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon6Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon7Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon7Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon8Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon8Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon9Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon9Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon10Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon10Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon11Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon11Control"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon14Counter"},
-	{get_fis_pmon_registers_properties, free_fis_pmon_registers_properties, "Pmon14Control"},
-	{get_fis_system_time_properties, free_fis_system_time_properties, "UnixTime"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "Signature"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "Length"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "Revision"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "Checksum"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "OemId"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "OemTableId"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "OemRevision"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "CreatorId"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "CreatorRevision"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "CurrentConfigSize"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "CurrentConfigOffset"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "InputConfigSize"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "InputConfigOffset"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "OutputConfigSize"},
-	{get_fis_platform_config_data_properties, free_fis_platform_config_data_properties, "OutputConfigOffset"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "VolatileCapacity"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "VolatileStart"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "PmCapacity"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "PmStart"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "RawCapacity"},
-	{get_fis_dimm_partition_info_properties, free_fis_dimm_partition_info_properties, "EnabledCapacity"},
-	{get_fis_fw_debug_log_level_properties, free_fis_fw_debug_log_level_properties, "LogLevel"},
-	{get_fis_fw_debug_log_level_properties, free_fis_fw_debug_log_level_properties, "Logs"},
-	{get_fis_fw_load_flag_properties, free_fis_fw_load_flag_properties, "LoadFlag"},
-	{get_fis_config_lockdown_properties, free_fis_config_lockdown_properties, "Locked"},
-	{get_fis_ddrt_io_init_info_properties, free_fis_ddrt_io_init_info_properties, "DdrtIoInfo"},
-	{get_fis_ddrt_io_init_info_properties, free_fis_ddrt_io_init_info_properties, "DdrtTrainingStatus"},
-	{get_fis_get_supported_sku_features_properties, free_fis_get_supported_sku_features_properties, "DimmSku"},
-	{get_fis_enable_dimm_properties, free_fis_enable_dimm_properties, "Enable"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ValidationFlags"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "HealthStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "SpareBlocks"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PercentUsed"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "MediaTemp"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ControllerTemp"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "UnsafeShutdownCounter"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "AitDramStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "AlarmTrips"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "LastShutdownStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "VendorSpecificDataSize"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "HealthStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "Noncritical"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "Critical"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "Fatal"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "SpareBlocks"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PercentUsed"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "AlarmTrips"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "SpareBlockTrip"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "MediaTemperatureTrip"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ControllerTemperatureTrip"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "MediaTemp"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ControllerTemp"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "UnsafeShutdownCount"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "AitDramStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "LastShutdownStatus"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "VendorSpecificDataSize"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PowerCycles"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PowerOnTime"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "Uptime"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "UnsafeShutdowns"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "LastShutdownStatusDetails"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PmAdrCommandReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PmS3Received"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PmS5Received"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "DdrtPowerFailCommandReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "Pmic12vPowerFail"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "PmWarmResetReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ThermalShutdownReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "FlushComplete"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "LastShutdownTime"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "LastShutdownStatusExtendedDetails"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "ViralInterruptReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "SurpriseClockStopInterruptReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "WriteDataFlushComplete"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "S4PowerStateReceived"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "MediaErrorInjections"},
-	{get_fis_smart_health_info_properties, free_fis_smart_health_info_properties, "NonMediaErrorInjections"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "FirmwareRevision"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "FirmwareType"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "StagedFwRevision"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "LastFwUpdateStatus"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "CommitId"},
-	{get_fis_firmware_image_info_properties, free_fis_firmware_image_info_properties, "BuildConfiguration"},
-	{get_fis_firmware_debug_log_properties, free_fis_firmware_debug_log_properties, "LogSize"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "MediaReads"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "MediaWrites"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "ReadRequests"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "WriteRequests"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "BlockReadRequests"},
-	{get_fis_memory_info_page_0_properties, free_fis_memory_info_page_0_properties, "BlockWriteRequests"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalMediaReads"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalMediaWrites"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalReadRequests"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalWriteRequests"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalBlockReadRequests"},
-	{get_fis_memory_info_page_1_properties, free_fis_memory_info_page_1_properties, "TotalBlockWriteRequests"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "ErrorInjectionStatus"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "ErrorInjectionEnabled"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "MediaTemperatureInjectionEnabled"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "SoftwareTriggersEnabled"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "PoisonErrorInjectionsCounter"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "PoisonErrorClearCounter"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "MediaTemperatureInjectionsCounter"},
-	{get_fis_memory_info_page_3_properties, free_fis_memory_info_page_3_properties, "SoftwareTriggersCounter"},
-	{get_fis_long_operation_status_properties, free_fis_long_operation_status_properties, "Command"},
-	{get_fis_long_operation_status_properties, free_fis_long_operation_status_properties, "PercentComplete"},
-	{get_fis_long_operation_status_properties, free_fis_long_operation_status_properties, "EstimateTimeToCompletion"},
-	{get_fis_long_operation_status_properties, free_fis_long_operation_status_properties, "StatusCode"},
-	{get_fis_long_operation_status_properties, free_fis_long_operation_status_properties, "CommandSpecificReturnData"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MajorCheckpoint"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MinorCheckpoint"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "Rest1"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MediaReady1"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MediaReady2"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "DdrtIoInitComplete"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "PcrLock"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MailboxReady"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "WatchDogStatus"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "FirstFastRefreshComplete"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "CreditReady"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MediaDisabled"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "OptInEnabled"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "OptInWasEnabled"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "Assertion"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "MiStall"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "AitDramReady"},
-	{get_fis_bsr_properties, free_fis_bsr_properties, "Rest2"},
+	{get_fis_identify_dimm_properties, "VendorId", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "DeviceId", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "RevisionId", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "InterfaceFormatCode", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "FirmwareRevision", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "ReservedOldApi", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "FeatureSwRequiredMask", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "InvalidateBeforeBlockRead", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "ReadbackOfBwAddressRegisterRequiredBeforeUse", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "NumberOfBlockWindows", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "OffsetOfBlockModeControlRegion", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "RawCapacity", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "Manufacturer", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "SerialNumber", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "PartNumber", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "DimmSku", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "MemoryModeEnabled", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "StorageModeEnabled", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "AppDirectModeEnabled", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "DieSparingCapable", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "SoftProgrammableSku", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "EncryptionEnabled", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "InterfaceFormatCodeExtra", "IdentifyDimm"},
+	{get_fis_identify_dimm_properties, "ApiVer", "IdentifyDimm"},
+	{get_fis_identify_dimm_characteristics_properties, "ControllerTempShutdownThreshold", "IdentifyDimmCharacteristics"},
+	{get_fis_identify_dimm_characteristics_properties, "MediaTempShutdownThreshold", "IdentifyDimmCharacteristics"},
+	{get_fis_identify_dimm_characteristics_properties, "ThrottlingStartThreshold", "IdentifyDimmCharacteristics"},
+	{get_fis_identify_dimm_characteristics_properties, "ThrottlingStopThreshold", "IdentifyDimmCharacteristics"},
+	{get_fis_get_security_state_properties, "SecurityState", "GetSecurityState"},
+	{get_fis_get_security_state_properties, "Enabled", "GetSecurityState"},
+	{get_fis_get_security_state_properties, "Locked", "GetSecurityState"},
+	{get_fis_get_security_state_properties, "Frozen", "GetSecurityState"},
+	{get_fis_get_security_state_properties, "CountExpired", "GetSecurityState"},
+	{get_fis_get_security_state_properties, "NotSupported", "GetSecurityState"},
+	{get_fis_get_alarm_threshold_properties, "Enable", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "SpareBlock", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "MediaTemp", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "ControllerTemp", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "SpareBlockThreshold", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "MediaTempThreshold", "GetAlarmThreshold"},
+	{get_fis_get_alarm_threshold_properties, "ControllerTempThreshold", "GetAlarmThreshold"},
+	{get_fis_power_management_policy_properties, "Enable", "PowerManagementPolicy"},
+	{get_fis_power_management_policy_properties, "PeakPowerBudget", "PowerManagementPolicy"},
+	{get_fis_power_management_policy_properties, "AveragePowerBudget", "PowerManagementPolicy"},
+	{get_fis_power_management_policy_properties, "MaxPower", "PowerManagementPolicy"},
+	{get_fis_die_sparing_policy_properties, "Enable", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Aggressiveness", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Supported", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Rank0", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Rank1", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Rank2", "DieSparingPolicy"},
+	{get_fis_die_sparing_policy_properties, "Rank3", "DieSparingPolicy"},
+	{get_fis_address_range_scrub_properties, "Enable", "AddressRangeScrub"},
+	{get_fis_address_range_scrub_properties, "DpaStartAddress", "AddressRangeScrub"},
+	{get_fis_address_range_scrub_properties, "DpaEndAddress", "AddressRangeScrub"},
+	{get_fis_address_range_scrub_properties, "DpaCurrentAddress", "AddressRangeScrub"},
+	{get_fis_optional_configuration_data_policy_properties, "FirstFastRefresh", "OptionalConfigurationDataPolicy"},
+	{get_fis_optional_configuration_data_policy_properties, "ViralPolicyEnabled", "OptionalConfigurationDataPolicy"},
+	{get_fis_optional_configuration_data_policy_properties, "ViralStatus", "OptionalConfigurationDataPolicy"},
+	{get_fis_pmon_registers_properties, "PmonRetreiveMask", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon0Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon0Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon1Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon1Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon2Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon2Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon3Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon3Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon4Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon4Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon5Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon5Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon6Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon6Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon7Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon7Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon8Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon8Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon9Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon9Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon10Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon10Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon11Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon11Control", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon14Counter", "PmonRegisters"},
+	{get_fis_pmon_registers_properties, "Pmon14Control", "PmonRegisters"},
+	{get_fis_system_time_properties, "UnixTime", "SystemTime"},
+	{get_fis_platform_config_data_properties, "Signature", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "Length", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "Revision", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "Checksum", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "OemId", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "OemTableId", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "OemRevision", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "CreatorId", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "CreatorRevision", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "CurrentConfigSize", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "CurrentConfigOffset", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "InputConfigSize", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "InputConfigOffset", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "OutputConfigSize", "PlatformConfigData"},
+	{get_fis_platform_config_data_properties, "OutputConfigOffset", "PlatformConfigData"},
+	{get_fis_dimm_partition_info_properties, "VolatileCapacity", "DimmPartitionInfo"},
+	{get_fis_dimm_partition_info_properties, "VolatileStart", "DimmPartitionInfo"},
+	{get_fis_dimm_partition_info_properties, "PmCapacity", "DimmPartitionInfo"},
+	{get_fis_dimm_partition_info_properties, "PmStart", "DimmPartitionInfo"},
+	{get_fis_dimm_partition_info_properties, "RawCapacity", "DimmPartitionInfo"},
+	{get_fis_dimm_partition_info_properties, "EnabledCapacity", "DimmPartitionInfo"},
+	{get_fis_fw_debug_log_level_properties, "LogLevel", "FwDebugLogLevel"},
+	{get_fis_fw_debug_log_level_properties, "Logs", "FwDebugLogLevel"},
+	{get_fis_fw_load_flag_properties, "LoadFlag", "FwLoadFlag"},
+	{get_fis_config_lockdown_properties, "Locked", "ConfigLockdown"},
+	{get_fis_ddrt_io_init_info_properties, "DdrtIoInfo", "DdrtIoInitInfo"},
+	{get_fis_ddrt_io_init_info_properties, "DdrtTrainingStatus", "DdrtIoInitInfo"},
+	{get_fis_get_supported_sku_features_properties, "DimmSku", "GetSupportedSkuFeatures"},
+	{get_fis_enable_dimm_properties, "Enable", "EnableDimm"},
+	{get_fis_smart_health_info_properties, "ValidationFlags", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "HealthStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "SpareBlocks", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PercentUsed", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "MediaTemp", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "ControllerTemp", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "UnsafeShutdownCounter", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "AitDramStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "AlarmTrips", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "LastShutdownStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "VendorSpecificDataSize", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "HealthStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "Noncritical", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "Critical", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "Fatal", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "SpareBlocks", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PercentUsed", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "AlarmTrips", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "SpareBlockTrip", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "MediaTemperatureTrip", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "ControllerTemperatureTrip", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "MediaTemp", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "ControllerTemp", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "UnsafeShutdownCount", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "AitDramStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "LastShutdownStatus", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "VendorSpecificDataSize", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PowerCycles", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PowerOnTime", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "Uptime", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "UnsafeShutdowns", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "LastShutdownStatusDetails", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PmAdrCommandReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PmS3Received", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PmS5Received", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "DdrtPowerFailCommandReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "Pmic12vPowerFail", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "PmWarmResetReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "ThermalShutdownReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "FlushComplete", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "LastShutdownTime", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "LastShutdownStatusExtendedDetails", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "ViralInterruptReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "SurpriseClockStopInterruptReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "WriteDataFlushComplete", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "S4PowerStateReceived", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "MediaErrorInjections", "SmartHealthInfo"},
+	{get_fis_smart_health_info_properties, "NonMediaErrorInjections", "SmartHealthInfo"},
+	{get_fis_firmware_image_info_properties, "FirmwareRevision", "FirmwareImageInfo"},
+	{get_fis_firmware_image_info_properties, "FirmwareType", "FirmwareImageInfo"},
+	{get_fis_firmware_image_info_properties, "StagedFwRevision", "FirmwareImageInfo"},
+	{get_fis_firmware_image_info_properties, "LastFwUpdateStatus", "FirmwareImageInfo"},
+	{get_fis_firmware_image_info_properties, "CommitId", "FirmwareImageInfo"},
+	{get_fis_firmware_image_info_properties, "BuildConfiguration", "FirmwareImageInfo"},
+	{get_fis_firmware_debug_log_properties, "LogSize", "FirmwareDebugLog"},
+	{get_fis_memory_info_page_0_properties, "MediaReads", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_0_properties, "MediaWrites", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_0_properties, "ReadRequests", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_0_properties, "WriteRequests", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_0_properties, "BlockReadRequests", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_0_properties, "BlockWriteRequests", "MemoryInfoPage0"},
+	{get_fis_memory_info_page_1_properties, "TotalMediaReads", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_1_properties, "TotalMediaWrites", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_1_properties, "TotalReadRequests", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_1_properties, "TotalWriteRequests", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_1_properties, "TotalBlockReadRequests", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_1_properties, "TotalBlockWriteRequests", "MemoryInfoPage1"},
+	{get_fis_memory_info_page_3_properties, "ErrorInjectionStatus", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "ErrorInjectionEnabled", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "MediaTemperatureInjectionEnabled", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "SoftwareTriggersEnabled", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "PoisonErrorInjectionsCounter", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "PoisonErrorClearCounter", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "MediaTemperatureInjectionsCounter", "MemoryInfoPage3"},
+	{get_fis_memory_info_page_3_properties, "SoftwareTriggersCounter", "MemoryInfoPage3"},
+	{get_fis_long_operation_status_properties, "Command", "LongOperationStatus"},
+	{get_fis_long_operation_status_properties, "PercentComplete", "LongOperationStatus"},
+	{get_fis_long_operation_status_properties, "EstimateTimeToCompletion", "LongOperationStatus"},
+	{get_fis_long_operation_status_properties, "StatusCode", "LongOperationStatus"},
+	{get_fis_long_operation_status_properties, "CommandSpecificReturnData", "LongOperationStatus"},
+	{get_fis_bsr_properties, "MajorCheckpoint", "Bsr"},
+	{get_fis_bsr_properties, "MinorCheckpoint", "Bsr"},
+	{get_fis_bsr_properties, "Rest1", "Bsr"},
+	{get_fis_bsr_properties, "MediaReady1", "Bsr"},
+	{get_fis_bsr_properties, "MediaReady2", "Bsr"},
+	{get_fis_bsr_properties, "DdrtIoInitComplete", "Bsr"},
+	{get_fis_bsr_properties, "PcrLock", "Bsr"},
+	{get_fis_bsr_properties, "MailboxReady", "Bsr"},
+	{get_fis_bsr_properties, "WatchDogStatus", "Bsr"},
+	{get_fis_bsr_properties, "FirstFastRefreshComplete", "Bsr"},
+	{get_fis_bsr_properties, "CreditReady", "Bsr"},
+	{get_fis_bsr_properties, "MediaDisabled", "Bsr"},
+	{get_fis_bsr_properties, "OptInEnabled", "Bsr"},
+	{get_fis_bsr_properties, "OptInWasEnabled", "Bsr"},
+	{get_fis_bsr_properties, "Assertion", "Bsr"},
+	{get_fis_bsr_properties, "MiStall", "Bsr"},
+	{get_fis_bsr_properties, "AitDramReady", "Bsr"},
+	{get_fis_bsr_properties, "Rest2", "Bsr"},
+};
+
+// g_ixp_lookup names sorted by name, then command, for ixp_get_prop_key_by_name.
+// The table is generated in order, so lookups only ever read it.
+struct ixp_prop_name_entry
+{
+	const char *prop_name;
+	const char *command_name;
+	IXP_PROP_KEY key;
+};
+
+static const struct ixp_prop_name_entry g_ixp_prop_names[IXP_PROP_KEY_MAX] = {
+	{"Aggressiveness", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_AGGRESSIVENESS},
+	{"AitDramReady", "Bsr", FIS_BSR_REST1_AIT_DRAM_READY},
+	{"AitDramStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_AIT_DRAM_STATUS},
+	{"AitDramStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_AIT_DRAM_STATUS},
+	{"AlarmTrips", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_ALARM_TRIPS},
+	{"AlarmTrips", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_ALARM_TRIPS},
+	{"ApiVer", "IdentifyDimm", FIS_IDENTIFY_DIMM_API_VER},
+	{"AppDirectModeEnabled", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_APP_DIRECT_MODE_ENABLED},
+	{"Assertion", "Bsr", FIS_BSR_REST1_ASSERTION},
+	{"AveragePowerBudget", "PowerManagementPolicy", FIS_POWER_MANAGEMENT_POLICY_AVERAGE_POWER_BUDGET},
+	{"BlockReadRequests", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_BLOCK_READ_REQUESTS},
+	{"BlockWriteRequests", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_BLOCK_WRITE_REQUESTS},
+	{"BuildConfiguration", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_BUILD_CONFIGURATION},
+	{"Checksum", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_CHECKSUM},
+	{"Command", "LongOperationStatus", FIS_LONG_OPERATION_STATUS_COMMAND},
+	{"CommandSpecificReturnData", "LongOperationStatus", FIS_LONG_OPERATION_STATUS_COMMAND_SPECIFIC_RETURN_DATA},
+	{"CommitId", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_COMMIT_ID},
+	{"ControllerTemp", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_ENABLE_CONTROLLER_TEMP},
+	{"ControllerTemp", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_CONTROLLER_TEMP},
+	{"ControllerTemp", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_CONTROLLER_TEMP},
+	{"ControllerTempShutdownThreshold", "IdentifyDimmCharacteristics", FIS_IDENTIFY_DIMM_CHARACTERISTICS_CONTROLLER_TEMP_SHUTDOWN_THRESHOLD},
+	{"ControllerTempThreshold", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_CONTROLLER_TEMP_THRESHOLD},
+	{"ControllerTemperatureTrip", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_CONTROLLER_TEMPERATURE_TRIP},
+	{"CountExpired", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE_COUNT_EXPIRED},
+	{"CreatorId", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_CREATOR_ID},
+	{"CreatorRevision", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_CREATOR_REVISION},
+	{"CreditReady", "Bsr", FIS_BSR_REST1_CREDIT_READY},
+	{"Critical", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_CRITICAL},
+	{"CurrentConfigOffset", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_OFFSET},
+	{"CurrentConfigSize", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_SIZE},
+	{"DdrtIoInfo", "DdrtIoInitInfo", FIS_DDRT_IO_INIT_INFO_DDRT_IO_INFO},
+	{"DdrtIoInitComplete", "Bsr", FIS_BSR_REST1_DDRT_IO_INIT_COMPLETE},
+	{"DdrtPowerFailCommandReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_DDRT_POWER_FAIL_COMMAND_RECEIVED},
+	{"DdrtTrainingStatus", "DdrtIoInitInfo", FIS_DDRT_IO_INIT_INFO_DDRT_TRAINING_STATUS},
+	{"DeviceId", "IdentifyDimm", FIS_IDENTIFY_DIMM_DEVICE_ID},
+	{"DieSparingCapable", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_DIE_SPARING_CAPABLE},
+	{"DimmSku", "GetSupportedSkuFeatures", FIS_GET_SUPPORTED_SKU_FEATURES_DIMM_SKU},
+	{"DimmSku", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU},
+	{"DpaCurrentAddress", "AddressRangeScrub", FIS_ADDRESS_RANGE_SCRUB_DPA_CURRENT_ADDRESS},
+	{"DpaEndAddress", "AddressRangeScrub", FIS_ADDRESS_RANGE_SCRUB_DPA_END_ADDRESS},
+	{"DpaStartAddress", "AddressRangeScrub", FIS_ADDRESS_RANGE_SCRUB_DPA_START_ADDRESS},
+	{"Enable", "AddressRangeScrub", FIS_ADDRESS_RANGE_SCRUB_ENABLE},
+	{"Enable", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_ENABLE},
+	{"Enable", "EnableDimm", FIS_ENABLE_DIMM_ENABLE},
+	{"Enable", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_ENABLE},
+	{"Enable", "PowerManagementPolicy", FIS_POWER_MANAGEMENT_POLICY_ENABLE},
+	{"Enabled", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE_ENABLED},
+	{"EnabledCapacity", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_ENABLED_CAPACITY},
+	{"EncryptionEnabled", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_ENCRYPTION_ENABLED},
+	{"ErrorInjectionEnabled", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_ERROR_INJECTION_ENABLED},
+	{"ErrorInjectionStatus", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS},
+	{"EstimateTimeToCompletion", "LongOperationStatus", FIS_LONG_OPERATION_STATUS_ESTIMATE_TIME_TO_COMPLETION},
+	{"Fatal", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_FATAL},
+	{"FeatureSwRequiredMask", "IdentifyDimm", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK},
+	{"FirmwareRevision", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_FIRMWARE_REVISION},
+	{"FirmwareRevision", "IdentifyDimm", FIS_IDENTIFY_DIMM_FIRMWARE_REVISION},
+	{"FirmwareType", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_FIRMWARE_TYPE},
+	{"FirstFastRefresh", "OptionalConfigurationDataPolicy", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_FIRST_FAST_REFRESH},
+	{"FirstFastRefreshComplete", "Bsr", FIS_BSR_REST1_FIRST_FAST_REFRESH_COMPLETE},
+	{"FlushComplete", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_FLUSH_COMPLETE},
+	{"Frozen", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE_FROZEN},
+	{"HealthStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_HEALTH_STATUS},
+	{"HealthStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_HEALTH_STATUS},
+	{"InputConfigOffset", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_OFFSET},
+	{"InputConfigSize", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_SIZE},
+	{"InterfaceFormatCode", "IdentifyDimm", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE},
+	{"InterfaceFormatCodeExtra", "IdentifyDimm", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE_EXTRA},
+	{"InvalidateBeforeBlockRead", "IdentifyDimm", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_INVALIDATE_BEFORE_BLOCK_READ},
+	{"LastFwUpdateStatus", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_LAST_FW_UPDATE_STATUS},
+	{"LastShutdownStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS},
+	{"LastShutdownStatus", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_LAST_SHUTDOWN_STATUS},
+	{"LastShutdownStatusDetails", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS},
+	{"LastShutdownStatusExtendedDetails", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS},
+	{"LastShutdownTime", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_TIME},
+	{"Length", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_LENGTH},
+	{"LoadFlag", "FwLoadFlag", FIS_FW_LOAD_FLAG_LOAD_FLAG},
+	{"Locked", "ConfigLockdown", FIS_CONFIG_LOCKDOWN_LOCKED},
+	{"Locked", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE_LOCKED},
+	{"LogLevel", "FwDebugLogLevel", FIS_FW_DEBUG_LOG_LEVEL_LOG_LEVEL},
+	{"LogSize", "FirmwareDebugLog", FIS_FIRMWARE_DEBUG_LOG_LOG_SIZE},
+	{"Logs", "FwDebugLogLevel", FIS_FW_DEBUG_LOG_LEVEL_LOGS},
+	{"MailboxReady", "Bsr", FIS_BSR_REST1_MAILBOX_READY},
+	{"MajorCheckpoint", "Bsr", FIS_BSR_MAJOR_CHECKPOINT},
+	{"Manufacturer", "IdentifyDimm", FIS_IDENTIFY_DIMM_MANUFACTURER},
+	{"MaxPower", "PowerManagementPolicy", FIS_POWER_MANAGEMENT_POLICY_MAX_POWER},
+	{"MediaDisabled", "Bsr", FIS_BSR_REST1_MEDIA_DISABLED},
+	{"MediaErrorInjections", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_MEDIA_ERROR_INJECTIONS},
+	{"MediaReads", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_MEDIA_READS},
+	{"MediaReady1", "Bsr", FIS_BSR_REST1_MEDIA_READY_1},
+	{"MediaReady2", "Bsr", FIS_BSR_REST1_MEDIA_READY_2},
+	{"MediaTemp", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_ENABLE_MEDIA_TEMP},
+	{"MediaTemp", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_MEDIA_TEMP},
+	{"MediaTemp", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_MEDIA_TEMP},
+	{"MediaTempShutdownThreshold", "IdentifyDimmCharacteristics", FIS_IDENTIFY_DIMM_CHARACTERISTICS_MEDIA_TEMP_SHUTDOWN_THRESHOLD},
+	{"MediaTempThreshold", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_MEDIA_TEMP_THRESHOLD},
+	{"MediaTemperatureInjectionEnabled", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_MEDIA_TEMPERATURE_INJECTION_ENABLED},
+	{"MediaTemperatureInjectionsCounter", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_MEDIA_TEMPERATURE_INJECTIONS_COUNTER},
+	{"MediaTemperatureTrip", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_MEDIA_TEMPERATURE_TRIP},
+	{"MediaWrites", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_MEDIA_WRITES},
+	{"MemoryModeEnabled", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_MEMORY_MODE_ENABLED},
+	{"MiStall", "Bsr", FIS_BSR_REST1_MI_STALL},
+	{"MinorCheckpoint", "Bsr", FIS_BSR_MINOR_CHECKPOINT},
+	{"NonMediaErrorInjections", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_NON_MEDIA_ERROR_INJECTIONS},
+	{"Noncritical", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_NONCRITICAL},
+	{"NotSupported", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE_NOT_SUPPORTED},
+	{"NumberOfBlockWindows", "IdentifyDimm", FIS_IDENTIFY_DIMM_NUMBER_OF_BLOCK_WINDOWS},
+	{"OemId", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_OEM_ID},
+	{"OemRevision", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_OEM_REVISION},
+	{"OemTableId", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_OEM_TABLE_ID},
+	{"OffsetOfBlockModeControlRegion", "IdentifyDimm", FIS_IDENTIFY_DIMM_OFFSET_OF_BLOCK_MODE_CONTROL_REGION},
+	{"OptInEnabled", "Bsr", FIS_BSR_REST1_OPT_IN_ENABLED},
+	{"OptInWasEnabled", "Bsr", FIS_BSR_REST1_OPT_IN_WAS_ENABLED},
+	{"OutputConfigOffset", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_OFFSET},
+	{"OutputConfigSize", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_SIZE},
+	{"PartNumber", "IdentifyDimm", FIS_IDENTIFY_DIMM_PART_NUMBER},
+	{"PcrLock", "Bsr", FIS_BSR_REST1_PCR_LOCK},
+	{"PeakPowerBudget", "PowerManagementPolicy", FIS_POWER_MANAGEMENT_POLICY_PEAK_POWER_BUDGET},
+	{"PercentComplete", "LongOperationStatus", FIS_LONG_OPERATION_STATUS_PERCENT_COMPLETE},
+	{"PercentUsed", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_PERCENT_USED},
+	{"PercentUsed", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_PERCENT_USED},
+	{"PmAdrCommandReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_ADR_COMMAND_RECEIVED},
+	{"PmCapacity", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_PM_CAPACITY},
+	{"PmS3Received", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S3_RECEIVED},
+	{"PmS5Received", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S5_RECEIVED},
+	{"PmStart", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_PM_START},
+	{"PmWarmResetReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_WARM_RESET_RECEIVED},
+	{"Pmic12vPowerFail", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PMIC_12V_POWER_FAIL},
+	{"Pmon0Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_0_CONTROL},
+	{"Pmon0Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_0_COUNTER},
+	{"Pmon10Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_10_CONTROL},
+	{"Pmon10Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_10_COUNTER},
+	{"Pmon11Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_11_CONTROL},
+	{"Pmon11Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_11_COUNTER},
+	{"Pmon14Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_14_CONTROL},
+	{"Pmon14Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_14_COUNTER},
+	{"Pmon1Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_1_CONTROL},
+	{"Pmon1Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_1_COUNTER},
+	{"Pmon2Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_2_CONTROL},
+	{"Pmon2Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_2_COUNTER},
+	{"Pmon3Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_3_CONTROL},
+	{"Pmon3Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_3_COUNTER},
+	{"Pmon4Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_4_CONTROL},
+	{"Pmon4Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_4_COUNTER},
+	{"Pmon5Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_5_CONTROL},
+	{"Pmon5Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_5_COUNTER},
+	{"Pmon6Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_6_CONTROL},
+	{"Pmon6Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_6_COUNTER},
+	{"Pmon7Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_7_CONTROL},
+	{"Pmon7Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_7_COUNTER},
+	{"Pmon8Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_8_CONTROL},
+	{"Pmon8Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_8_COUNTER},
+	{"Pmon9Control", "PmonRegisters", FIS_PMON_REGISTERS_PMON_9_CONTROL},
+	{"Pmon9Counter", "PmonRegisters", FIS_PMON_REGISTERS_PMON_9_COUNTER},
+	{"PmonRetreiveMask", "PmonRegisters", FIS_PMON_REGISTERS_PMON_RETREIVE_MASK},
+	{"PoisonErrorClearCounter", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_CLEAR_COUNTER},
+	{"PoisonErrorInjectionsCounter", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_INJECTIONS_COUNTER},
+	{"PowerCycles", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_POWER_CYCLES},
+	{"PowerOnTime", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_POWER_ON_TIME},
+	{"Rank0", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_0},
+	{"Rank1", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_1},
+	{"Rank2", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_2},
+	{"Rank3", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_3},
+	{"RawCapacity", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_RAW_CAPACITY},
+	{"RawCapacity", "IdentifyDimm", FIS_IDENTIFY_DIMM_RAW_CAPACITY},
+	{"ReadRequests", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_READ_REQUESTS},
+	{"ReadbackOfBwAddressRegisterRequiredBeforeUse", "IdentifyDimm", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_READBACK_OF_BW_ADDRESS_REGISTER_REQUIRED_BEFORE_USE},
+	{"ReservedOldApi", "IdentifyDimm", FIS_IDENTIFY_DIMM_RESERVED_OLD_API},
+	{"Rest1", "Bsr", FIS_BSR_REST1},
+	{"Rest2", "Bsr", FIS_BSR_REST2},
+	{"Revision", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_REVISION},
+	{"RevisionId", "IdentifyDimm", FIS_IDENTIFY_DIMM_REVISION_ID},
+	{"S4PowerStateReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_S4_POWER_STATE_RECEIVED},
+	{"SecurityState", "GetSecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE},
+	{"SerialNumber", "IdentifyDimm", FIS_IDENTIFY_DIMM_SERIAL_NUMBER},
+	{"Signature", "PlatformConfigData", FIS_PLATFORM_CONFIG_DATA_SIGNATURE},
+	{"SoftProgrammableSku", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_SOFT_PROGRAMMABLE_SKU},
+	{"SoftwareTriggersCounter", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_SOFTWARE_TRIGGERS_COUNTER},
+	{"SoftwareTriggersEnabled", "MemoryInfoPage3", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_SOFTWARE_TRIGGERS_ENABLED},
+	{"SpareBlock", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_ENABLE_SPARE_BLOCK},
+	{"SpareBlockThreshold", "GetAlarmThreshold", FIS_GET_ALARM_THRESHOLD_SPARE_BLOCK_THRESHOLD},
+	{"SpareBlockTrip", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_SPARE_BLOCK_TRIP},
+	{"SpareBlocks", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_SPARE_BLOCKS},
+	{"SpareBlocks", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_SPARE_BLOCKS},
+	{"StagedFwRevision", "FirmwareImageInfo", FIS_FIRMWARE_IMAGE_INFO_STAGED_FW_REVISION},
+	{"StatusCode", "LongOperationStatus", FIS_LONG_OPERATION_STATUS_STATUS_CODE},
+	{"StorageModeEnabled", "IdentifyDimm", FIS_IDENTIFY_DIMM_DIMM_SKU_STORAGE_MODE_ENABLED},
+	{"Supported", "DieSparingPolicy", FIS_DIE_SPARING_POLICY_SUPPORTED},
+	{"SurpriseClockStopInterruptReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_SURPRISE_CLOCK_STOP_INTERRUPT_RECEIVED},
+	{"ThermalShutdownReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_THERMAL_SHUTDOWN_RECEIVED},
+	{"ThrottlingStartThreshold", "IdentifyDimmCharacteristics", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_START_THRESHOLD},
+	{"ThrottlingStopThreshold", "IdentifyDimmCharacteristics", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_STOP_THRESHOLD},
+	{"TotalBlockReadRequests", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_READ_REQUESTS},
+	{"TotalBlockWriteRequests", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_WRITE_REQUESTS},
+	{"TotalMediaReads", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_READS},
+	{"TotalMediaWrites", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_WRITES},
+	{"TotalReadRequests", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_READ_REQUESTS},
+	{"TotalWriteRequests", "MemoryInfoPage1", FIS_MEMORY_INFO_PAGE_1_TOTAL_WRITE_REQUESTS},
+	{"UnixTime", "SystemTime", FIS_SYSTEM_TIME_UNIX_TIME},
+	{"UnsafeShutdownCount", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWN_COUNT},
+	{"UnsafeShutdownCounter", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_UNSAFE_SHUTDOWN_COUNTER},
+	{"UnsafeShutdowns", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWNS},
+	{"Uptime", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_UPTIME},
+	{"ValidationFlags", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS},
+	{"VendorId", "IdentifyDimm", FIS_IDENTIFY_DIMM_VENDOR_ID},
+	{"VendorSpecificDataSize", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_VENDOR_SPECIFIC_DATA_SIZE},
+	{"VendorSpecificDataSize", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_VENDOR_SPECIFIC_DATA_SIZE},
+	{"ViralInterruptReceived", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_VIRAL_INTERRUPT_RECEIVED},
+	{"ViralPolicyEnabled", "OptionalConfigurationDataPolicy", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_POLICY_ENABLED},
+	{"ViralStatus", "OptionalConfigurationDataPolicy", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_STATUS},
+	{"VolatileCapacity", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_VOLATILE_CAPACITY},
+	{"VolatileStart", "DimmPartitionInfo", FIS_DIMM_PARTITION_INFO_VOLATILE_START},
+	{"WatchDogStatus", "Bsr", FIS_BSR_REST1_WATCH_DOG_STATUS},
+	{"WriteDataFlushComplete", "SmartHealthInfo", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_WRITE_DATA_FLUSH_COMPLETE},
+	{"WriteRequests", "MemoryInfoPage0", FIS_MEMORY_INFO_PAGE_0_WRITE_REQUESTS},
 };
 
 int ixp_init_prop(struct ixp_prop_info *prop, IXP_PROP_KEY prop_key)
@@ -335,7 +560,7 @@ int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned
 		// If property value is uninitialized, call the associated function to populate it
 		// NOTE: The callee will populate all possible properties in props
 		if (IXP_SUCCESS != (status = (g_ixp_lookup[props[index].prop_key].f_populate)(
-			(unsigned int)ctx->handle.handle, props, num_props)))
+			ctx, props, num_props)))
 		{
 			// TODO: How should we deal with errors? Continue on? Free all and return?
 			ixp_free_props(props, num_props);
@@ -352,39 +577,105 @@ int ixp_free_props(struct ixp_prop_info *props, unsigned int num_props)
 		return IXP_NULL_INPUT_PARAM;
 	}
 
+	// Property values belong to the context arena and are released with
+	// the context, so only the references need to be dropped
 	for (int index = 0; index < num_props; index++)
 	{
-		// Check if already freed
-		if (NULL == props[index].prop_value)
-		{
-			continue;
-		}
-
-		g_ixp_lookup[props[index].prop_key].f_free(props, num_props);
+		props[index].prop_value = NULL;
+		props[index].prop_value_size = 0;
 	}
 
 	return IXP_SUCCESS;
 }
 
+// Compare a null terminated name against one of the given length
+static int compare_prop_name(const char *stored_name, const char *name, unsigned int length)
+{
+	int rc = strncmp(stored_name, name, length);
+	if (rc == 0 && stored_name[length] != '\0')
+	{
+		rc = 1;
+	}
+	return rc;
+}
+
+/*
+ * Look up a property key by its name. Property names are only unique
+ * within the command that populates them, so a name may be qualified by
+ * the command, e.g. "GetAlarmThreshold.Enable". A name that still matches
+ * more than one property is rejected as ambiguous rather than resolved to
+ * whichever happens to come first.
+ */
 int ixp_get_prop_key_by_name(char * name, unsigned int length, IXP_PROP_KEY * key)
 {
-	// TODO: Can optimize by making large string of all props and running
-	//       strstr on it
-	// TODO: There are duplicate key user string names still. Need to make
-	//       them appropriately unique
-	// TODO: Currently only doing mem info page keys to avoid duplicating
-	//       properties already done by normal C++ show dimm flow
-	for (int i = FIS_MEMORY_INFO_PAGE_0_MEDIA_READS;
-		i < FIS_MEMORY_INFO_PAGE_3_SOFTWARE_TRIGGERS_COUNTER; i++)
+	if (!name || !key)
+	{
+		return IXP_NULL_INPUT_PARAM;
+	}
+
+	// Stop at an embedded terminator so comparisons stay within both names
+	const char *p_end = memchr(name, '\0', length);
+	if (p_end)
+	{
+		length = (unsigned int)(p_end - name);
+	}
+
+	const char *prop_name = name;
+	unsigned int prop_name_length = length;
+	const char *command_name = NULL;
+	unsigned int command_name_length = 0;
+	const char *p_separator = memchr(name, '.', length);
+	if (p_separator)
 	{
-		if (length == strlen(g_ixp_lookup[i].prop_name) &&
-		strncmp(g_ixp_lookup[i].prop_name, name, length) == 0)
+		command_name = name;
+		command_name_length = (unsigned int)(p_separator - name);
+		prop_name = p_separator + 1;
+		prop_name_length = length - command_name_length - 1;
+	}
+
+	// Binary search for the first entry with the property name
+	unsigned int low = 0;
+	unsigned int high = IXP_PROP_KEY_MAX;
+	while (low < high)
+	{
+		unsigned int mid = low + (high - low) / 2;
+		if (compare_prop_name(g_ixp_prop_names[mid].prop_name,
+			prop_name, prop_name_length) < 0)
 		{
-			*key = i;
-			return IXP_SUCCESS;
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	// Matching entries are adjacent, check them all for duplicates
+	int matches = 0;
+	IXP_PROP_KEY found_key = IXP_PROP_KEY_MAX;
+	for (unsigned int i = low; i < IXP_PROP_KEY_MAX &&
+		compare_prop_name(g_ixp_prop_names[i].prop_name,
+			prop_name, prop_name_length) == 0; i++)
+	{
+		if (command_name && compare_prop_name(g_ixp_prop_names[i].command_name,
+			command_name, command_name_length) != 0)
+		{
+			continue;
 		}
+		found_key = g_ixp_prop_names[i].key;
+		matches++;
 	}
-	return IXP_INVALID_PROP_KEY;
+
+	if (matches == 0)
+	{
+		return IXP_INVALID_PROP_KEY;
+	}
+	if (matches > 1)
+	{
+		return IXP_AMBIGUOUS_PROP_NAME;
+	}
+	*key = found_key;
+	return IXP_SUCCESS;
 }
 
 int ixp_get_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t * entry)
@@ -399,6 +690,12 @@ int ixp_get_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t * entry)
 
 int ixp_set_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t entry)
 {
-	g_ixp_lookup[key] = entry;
+	if (!PROP_KEY_VALID(key))
+	{
+		return IXP_INVALID_PROP_KEY;
+	}
+	// Names are looked up in the generated g_ixp_prop_names, so only the
+	// populate function can be replaced
+	g_ixp_lookup[key].f_populate = entry.f_populate;
 	return IXP_SUCCESS;
 }
\ No newline at end of file
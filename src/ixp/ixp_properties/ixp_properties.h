@@ -39,15 +39,17 @@ extern "C"
 
 #define PROP_KEY_VALID(k) (k >= 0 && k < IXP_PROP_KEY_MAX)
 
+typedef int (* ixp_populate_fn)(struct ixp_context *ctx, struct ixp_prop_info props[], unsigned int num_props);
+
 struct ixp_lookup_t
 {
 	// For the fis call associated with this ixp_prop_key, populate all
 	// relevant properties in props
-	int (* f_populate)(unsigned int handle, struct ixp_prop_info props[], unsigned int num_props);
-	// For the fis call associated with this ixp_prop_key, free all
-	// relevant properties in props
-	void (* f_free)(struct ixp_prop_info props[], unsigned int num_props);
+	int (* f_populate)(struct ixp_context *ctx, struct ixp_prop_info props[], unsigned int num_props);
 	char prop_name[IXP_MAX_PROPERTY_NAME_SZ];
+	// Name of the command that populates the property, used to qualify
+	// property names that are not unique
+	const char *command_name;
 };
 
 int ixp_set_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t entry);
@@ -28,20 +28,63 @@
 
 #ifndef SRC_IXP_PRV_H_
 #define	SRC_IXP_PRV_H_
+#include <stddef.h>
 #include <nvm_types.h>
 #include <ixp_types.h>
+#include <fw_commands.h>
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+// Minimum size of a block in a context's property value arena
+#define IXP_ARENA_BLOCK_SIZE	4096
+
+// Maximum number of firmware command results cached in a context
+#define IXP_FWCMD_CACHE_MAX	32
+
+typedef struct fwcmd_result (* ixp_fwcmd_fn)(unsigned int);
+typedef void (* ixp_fwcmd_free_fn)(struct fwcmd_result *);
+
+// A block of the property value arena, the values follow the header
+struct ixp_arena_block
+{
+	struct ixp_arena_block *next;
+	size_t size;
+	size_t used;
+};
+
+// A decoded firmware command result, kept for the life of the context
+struct ixp_fwcmd_cache_entry
+{
+	ixp_fwcmd_fn fwcmd;
+	ixp_fwcmd_free_fn fwcmd_free;
+	struct fwcmd_result result;
+};
+
 struct ixp_context
 {
 	NVM_NFIT_DEVICE_HANDLE handle;
 	void * user_data;
+	// property values, released all at once by ixp_free_ctx
+	struct ixp_arena_block *arena;
+	// the device change count the cached results were read at
+	unsigned int fwcmd_cache_device_changes;
+	unsigned int fwcmd_cache_count;
+	struct ixp_fwcmd_cache_entry fwcmd_cache[IXP_FWCMD_CACHE_MAX];
 };
 
+// Allocate size bytes from the context arena, NULL if out of memory
+void *ixp_arena_alloc(struct ixp_context *ctx, size_t size);
+
+// Issue a firmware command once per context and return its result.
+// The result is owned by the context; if the cache is full the caller
+// owns it and *owned is set. Cached results are dropped once the devices
+// have changed (see notify_device_change).
+struct fwcmd_result ixp_get_fwcmd_result(struct ixp_context *ctx,
+	ixp_fwcmd_fn fwcmd, ixp_fwcmd_free_fn fwcmd_free, int *owned);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,7 +42,8 @@ enum ixp_status
 	IXP_NULL_INPUT_PARAM,
 	IXP_NO_MEM_RESOURCES,
 	IXP_INTERNAL_ERROR,
-	IXP_INVALID_PROP_KEY
+	IXP_INVALID_PROP_KEY,
+	IXP_AMBIGUOUS_PROP_NAME
 };
 
 // NOTE: For simplicity in ixp_fis_properties.c, put fis properties first
@@ -1370,6 +1370,74 @@ int nvm_get_device_details(const NVM_UID device_uid,
 	return rc;
 }
 
+/*
+ * State shared by the threads retrieving details for nvm_get_devices_details
+ */
+struct device_details_work
+{
+	const NVM_UID *p_device_uids;
+	struct device_details *p_details;
+	int *p_results;
+};
+
+static void get_devices_details_worker(void *arg, COMMON_UINT32 index)
+{
+	struct device_details_work *p_work = (struct device_details_work *)arg;
+	p_work->p_results[index] = nvm_get_device_details(
+			p_work->p_device_uids[index], &p_work->p_details[index]);
+}
+
+/*
+ * Retrieve the details of several devices, querying the devices in parallel.
+ */
+int nvm_get_devices_details(const NVM_UID *p_device_uids,
+		struct device_details *p_details, int *p_results, const NVM_UINT32 device_count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if ((rc = IS_NVM_FEATURE_SUPPORTED(get_devices)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("Retrieving device details is not supported.");
+	}
+	else if (p_device_uids == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_device_uids is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (p_details == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_details is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (p_results == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_results is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		struct device_details_work work;
+		work.p_device_uids = p_device_uids;
+		work.p_details = p_details;
+		work.p_results = p_results;
+
+		// each device is independent
+		run_parallel(device_count, PARALLEL_MAX_THREADS, get_devices_details_worker, &work);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Retrieve a snapshot of the performance metrics for the device specified.
  */
@@ -122,6 +122,26 @@ int fw_get_bsr(const NVM_NFIT_DEVICE_HANDLE device_handle, unsigned long long *p
 	return rc;
 }
 
+int fw_get_large_payload_size(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		struct pt_bios_get_size *p_size)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct fw_cmd cmd;
+	memset(&cmd, 0, sizeof (struct fw_cmd));
+	memset(p_size, 0, sizeof (struct pt_bios_get_size));
+	cmd.device_handle = device_handle.handle;
+	cmd.opcode = BIOS_EMULATED_COMMAND;
+	cmd.sub_opcode = SUBOP_GET_PAYLOAD_SIZE;
+	cmd.output_payload_size = sizeof (struct pt_bios_get_size);
+	cmd.output_payload = p_size;
+	rc = ioctl_passthrough_cmd(&cmd);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 int fw_get_identify_dimm(const NVM_UINT32 device_handle,
 		struct pt_payload_identify_dimm *p_id_dimm)
 {
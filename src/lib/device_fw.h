@@ -41,6 +41,9 @@ NVM_API int fw_mb_err_to_nvm_lib_err(int status);
 
 NVM_API int fw_get_bsr(const NVM_NFIT_DEVICE_HANDLE device_handle, unsigned long long *p_bsr);
 
+NVM_API int fw_get_large_payload_size(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		struct pt_bios_get_size *p_size);
+
 NVM_API int dsm_err_to_nvm_lib_err(unsigned int status);
 
 NVM_API void set_ioctl_passthrough_function(int (*f)(struct fw_cmd *p_cmd));
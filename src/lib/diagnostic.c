@@ -34,10 +34,15 @@
 #include "diagnostic.h"
 #include <persistence/logging.h>
 #include <persistence/lib_persistence.h>
+#include <persistence/event.h>
 #include <string/s_str.h>
 #include <uid/uid.h>
+#include <stdlib.h>
 #include "system.h"
 #include "device_adapter.h"
+#include "device_fw.h"
+
+#define	DIAG_INITIAL_RESULTS	8
 
 int nvm_get_fw_error_log_entry_cmd(const NVM_UID device_uid,
 	const unsigned short seq_num, const unsigned char log_level, const unsigned char log_type, void *buffer, unsigned int buffer_size)
@@ -59,7 +64,8 @@ int nvm_get_fw_error_log_entry_cmd(const NVM_UID device_uid,
 }
 
 /*
- * Run a diagnostic test on the device specified.
+ * Run a diagnostic test on the device specified, or on all devices if
+ * device_uid is NULL.
  */
 int nvm_run_diagnostic(const NVM_UID device_uid,
 		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
@@ -91,7 +97,14 @@ int nvm_run_diagnostic(const NVM_UID device_uid,
 		switch (p_diagnostic->test)
 		{
 			case DIAG_TYPE_QUICK:
-				rc = diag_quick_health_check(device_uid, p_diagnostic, p_results);
+				if (device_uid == NULL)
+				{
+					rc = diag_quick_health_check_all(p_diagnostic, p_results);
+				}
+				else
+				{
+					rc = diag_quick_health_check(device_uid, p_diagnostic, p_results);
+				}
 				break;
 			case DIAG_TYPE_PLATFORM_CONFIG:
 				rc = diag_platform_config_check(p_diagnostic, p_results);
@@ -109,6 +122,68 @@ int nvm_run_diagnostic(const NVM_UID device_uid,
 	return rc;
 }
 
+/*
+ * Start an empty set of FW data for the DIMM specified.
+ */
+void diag_init_dimm_data(const struct device_discovery *p_discovery,
+		struct diag_dimm_data *p_data)
+{
+	memset(p_data, 0, sizeof (struct diag_dimm_data));
+	p_data->p_discovery = p_discovery;
+}
+
+/*
+ * Fetch the requested payloads that haven't been fetched yet.
+ */
+void diag_fetch_dimm_data(struct diag_dimm_data *p_data, const NVM_UINT32 payloads)
+{
+	COMMON_LOG_ENTRY();
+
+	NVM_UINT32 needed = payloads & ~p_data->fetched;
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_data->p_discovery->device_handle;
+
+	if (needed & DIAG_PAYLOAD_BSR)
+	{
+		p_data->bsr_rc = fw_get_bsr(device_handle, &p_data->bsr);
+	}
+	if (needed & DIAG_PAYLOAD_SMART_HEALTH)
+	{
+		p_data->smart_health_rc = fw_get_smart_health(device_handle.handle,
+				&p_data->smart_health);
+	}
+	if (needed & DIAG_PAYLOAD_ALARM_THRESHOLDS)
+	{
+		p_data->alarm_thresholds_rc = fw_get_alarm_thresholds(device_handle.handle,
+				&p_data->alarm_thresholds);
+	}
+	if (needed & DIAG_PAYLOAD_CONFIG_DATA_POLICY)
+	{
+		p_data->config_data_policy_rc = fw_get_config_data_policy(device_handle.handle,
+				&p_data->config_data_policy);
+	}
+	if (needed & DIAG_PAYLOAD_FW_IMAGE_INFO)
+	{
+		p_data->fw_image_info_rc = fw_get_fw_image_info(device_handle.handle,
+				&p_data->fw_image_info);
+	}
+	if (needed & DIAG_PAYLOAD_DDRT_IO_INIT)
+	{
+		// DDRT IO init info was added in FIS 1.6
+		if (atof(p_data->p_discovery->fw_api_version) >= 1.6)
+		{
+			p_data->ddrt_io_init_rc = fw_get_ddrt_io_init(device_handle.handle,
+					&p_data->ddrt_io_init);
+		}
+		else
+		{
+			p_data->ddrt_io_init_rc = NVM_ERR_NOTSUPPORTED;
+		}
+	}
+	p_data->fetched |= needed;
+
+	COMMON_LOG_EXIT();
+}
+
 /*
  * Perform an integer value compare as part of a diagnostic test
  */
@@ -261,7 +336,12 @@ void diag_clear_results(const enum diagnostic_test type,
 {
 	int event_count;
 	PersistentStore *p_store = get_lib_store();
-	if (p_store)
+	if (p_store && !clear_specific_device)
+	{
+		// no need to look at the results, remove them all at once
+		db_delete_event_by_event_type_type(p_store, type);
+	}
+	else if (p_store)
 	{
 		db_get_event_count_by_event_type_type(p_store, type, &event_count);
 		struct db_event *events = malloc(event_count * sizeof(struct db_event));
@@ -287,3 +367,85 @@ void diag_clear_results(const enum diagnostic_test type,
         free(events);
 	}
 }
+
+/*
+ * Start an empty list of results of the diagnostic event type specified.
+ */
+void diag_init_results(const enum event_type type, struct diag_results *p_results)
+{
+	memset(p_results, 0, sizeof (struct diag_results));
+	p_results->type = type;
+}
+
+/*
+ * Add a result to the list, growing it as needed.
+ */
+void diag_add_result(struct diag_results *p_results,
+		const enum event_severity severity, const NVM_UINT16 code,
+		const NVM_UID device_uid, const NVM_BOOL action_required,
+		const NVM_EVENT_ARG arg1, const NVM_EVENT_ARG arg2, const NVM_EVENT_ARG arg3,
+		const enum diagnostic_result result)
+{
+	if (p_results->event_count == p_results->event_capacity)
+	{
+		NVM_UINT32 capacity = p_results->event_capacity ?
+				p_results->event_capacity * 2 : DIAG_INITIAL_RESULTS;
+		struct event *p_events = realloc(p_results->p_events,
+				capacity * sizeof (struct event));
+		if (p_events)
+		{
+			p_results->p_events = p_events;
+			p_results->event_capacity = capacity;
+		}
+	}
+
+	if (p_results->event_count < p_results->event_capacity)
+	{
+		struct event *p_event = &p_results->p_events[p_results->event_count++];
+		memset(p_event, 0, sizeof (struct event));
+		params_to_event(p_results->type, severity, code, device_uid,
+				action_required, arg1, arg2, arg3, result, p_event);
+	}
+	else
+	{
+		// can't hold on to it, store it right away instead
+		COMMON_LOG_ERROR("Failed to allocate memory for the diagnostic results");
+		store_event_by_parts(p_results->type, severity, code, device_uid,
+				action_required, arg1, arg2, arg3, result);
+	}
+	p_results->count++;
+}
+
+/*
+ * Move the results of one DIMM onto the end of the results of the run.
+ */
+void diag_append_results(struct diag_results *p_results,
+		struct diag_results *p_dimm_results)
+{
+	for (NVM_UINT32 i = 0; i < p_dimm_results->event_count; i++)
+	{
+		struct event *p_event = &p_dimm_results->p_events[i];
+		diag_add_result(p_results, p_event->severity, p_event->code,
+				p_event->uid, p_event->action_required,
+				p_event->args[0], p_event->args[1], p_event->args[2],
+				p_event->diag_result);
+	}
+	// results already stored by the DIMM still count
+	p_results->count += p_dimm_results->count - p_dimm_results->event_count;
+
+	free(p_dimm_results->p_events);
+	diag_init_results(p_dimm_results->type, p_dimm_results);
+}
+
+/*
+ * Store the collected results in a single transaction and free the list.
+ */
+int diag_store_results(struct diag_results *p_results)
+{
+	int rc = store_events(p_results->p_events, p_results->event_count, 1);
+	free(p_results->p_events);
+	p_results->p_events = NULL;
+	p_results->event_count = 0;
+	p_results->event_capacity = 0;
+	return rc;
+}
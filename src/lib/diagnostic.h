@@ -33,6 +33,7 @@
 #define	DIAGNOSTIC_H_
 
 #include "nvm_management.h"
+#include "fis_types.h"
 
 /*
  * Used in diagnostic helper functions to indicate relationship between
@@ -76,11 +77,98 @@ NVM_BOOL diag_check_str(const struct diagnostic *p_diagnostic,
 void diag_clear_results(const enum diagnostic_test type,
 		const NVM_BOOL clear_specific_device, const NVM_UID device_uid);
 
+/*
+ * Results found by a diagnostic. They are collected here and stored all at
+ * once so that the DIMMs can be checked in parallel without writing to the
+ * event table from several threads.
+ */
+struct diag_results
+{
+	enum event_type type;
+	NVM_UINT32 count; // number of results found
+	struct event *p_events;
+	NVM_UINT32 event_count;
+	NVM_UINT32 event_capacity;
+};
+
+/*
+ * Start an empty list of results of the diagnostic event type specified.
+ */
+void diag_init_results(const enum event_type type, struct diag_results *p_results);
+
+/*
+ * Add a result to the list, growing it as needed.
+ */
+void diag_add_result(struct diag_results *p_results,
+		const enum event_severity severity, const NVM_UINT16 code,
+		const NVM_UID device_uid, const NVM_BOOL action_required,
+		const NVM_EVENT_ARG arg1, const NVM_EVENT_ARG arg2, const NVM_EVENT_ARG arg3,
+		const enum diagnostic_result result);
+
+/*
+ * Move the results of one DIMM onto the end of the results of the run.
+ */
+void diag_append_results(struct diag_results *p_results,
+		struct diag_results *p_dimm_results);
+
+/*
+ * Store the collected results in a single transaction and free the list.
+ */
+int diag_store_results(struct diag_results *p_results);
+
+/*
+ * FW payloads read by the per-DIMM diagnostic checks
+ */
+enum diag_dimm_payload
+{
+	DIAG_PAYLOAD_BSR = 0x01,
+	DIAG_PAYLOAD_SMART_HEALTH = 0x02,
+	DIAG_PAYLOAD_ALARM_THRESHOLDS = 0x04,
+	DIAG_PAYLOAD_CONFIG_DATA_POLICY = 0x08,
+	DIAG_PAYLOAD_FW_IMAGE_INFO = 0x10,
+	DIAG_PAYLOAD_DDRT_IO_INIT = 0x20
+};
+
+/*
+ * FW data for one DIMM, shared by all of the checks of a diagnostic run.
+ * Each payload is fetched at most once and keeps the return code of its fetch.
+ */
+struct diag_dimm_data
+{
+	const struct device_discovery *p_discovery;
+	NVM_UINT32 fetched; // diag_dimm_payload flags already fetched
+	int bsr_rc;
+	unsigned long long bsr;
+	int smart_health_rc;
+	struct pt_payload_smart_health smart_health;
+	int alarm_thresholds_rc;
+	struct pt_payload_alarm_thresholds alarm_thresholds;
+	int config_data_policy_rc;
+	struct pt_payload_get_config_data_policy config_data_policy;
+	int fw_image_info_rc;
+	struct pt_payload_fw_image_info fw_image_info;
+	int ddrt_io_init_rc;
+	struct pt_payload_ddrt_init_info ddrt_io_init;
+};
+
+/*
+ * Start an empty set of FW data for the DIMM specified.
+ */
+void diag_init_dimm_data(const struct device_discovery *p_discovery,
+		struct diag_dimm_data *p_data);
+
+/*
+ * Fetch the requested payloads that haven't been fetched yet.
+ */
+void diag_fetch_dimm_data(struct diag_dimm_data *p_data, const NVM_UINT32 payloads);
+
 /*
  * Available diagnostics
  */
 int diag_quick_health_check(const NVM_UID device_uid,
 		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
+int diag_quick_health_check_all(const struct diagnostic *p_diagnostic,
+		NVM_UINT32 *p_results);
 int diag_security_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
 int diag_firmware_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
 int diag_platform_config_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
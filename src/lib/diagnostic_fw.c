@@ -43,6 +43,8 @@
 #include <uid/uid.h>
 #include "device_utilities.h"
 #include "capabilities.h"
+#include <stdlib.h>
+#include <os/os_adapter.h>
 
 /*
  * Used in firmware consistency and settings check diagnostic to display
@@ -51,8 +53,53 @@
 static const char *fw_log_level_strings[] =
 { "Disabled", "Error", "Warning", "Info", "Debug", "Unknown" };
 
-void find_optimal_fw_revision(char *optimal_fw_revision, NVM_UINT16 subsys_dev_id,
-		const struct device_discovery *p_dimms, int dev_count);
+
+/*
+ * Best practice settings every DIMM is compared against, read once per run
+ */
+struct fw_diag_config
+{
+	float max_media_temp_threshold;
+	float max_controller_temp_threshold;
+	NVM_UINT64 min_spare_block_threshold;
+	char expected_spare_block_threshold_str[NVM_EVENT_ARG_LEN];
+	int default_log_level;
+	char default_log_level_str[NVM_EVENT_ARG_LEN];
+	int default_time_drift;
+	NVM_UINT64 default_peak_power_budget_min;
+	NVM_UINT64 default_peak_power_budget_max;
+	char expected_peak_power_budget_range_str[NVM_EVENT_ARG_LEN];
+	NVM_UINT64 default_avg_power_budget_min;
+	NVM_UINT64 default_avg_power_budget_max;
+	char expected_avg_power_budget_range_str[NVM_EVENT_ARG_LEN];
+	NVM_UINT64 default_die_sparing_level;
+	char expected_die_sparing_aggressiveness_str[NVM_EVENT_ARG_LEN];
+};
+
+/*
+ * The DIMMs of one subsystem device ID and the newest FW revision among them
+ */
+struct fw_revision_group
+{
+	NVM_UINT64 optimal_revision;
+	int optimal_dimm; // index of a DIMM running the optimal revision
+	int dimm_count;
+};
+
+struct fw_diag_work
+{
+	const struct device_discovery *p_devices;
+	const struct diagnostic *p_diagnostic;
+	const struct fw_diag_config *p_config;
+	struct diag_results *p_results;
+	int *p_rcs;
+};
+
+void check_fw_consistency(const struct device_discovery *p_dimms, const int dev_count,
+		struct diag_results *p_results);
+int check_dimm_fw_settings(const struct device_discovery *p_dimm,
+		const struct diagnostic *p_diagnostic, const struct fw_diag_config *p_config,
+		struct diag_results *p_results);
 int get_fw_system_time(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 		struct pt_payload_system_time *payload);
 
@@ -61,6 +108,133 @@ extern int get_fw_power_mgmt_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 extern int get_fw_die_spare_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 		struct pt_get_die_spare_policy *payload);
 
+static void get_fw_diag_config(struct fw_diag_config *p_config)
+{
+	memset(p_config, 0, sizeof (struct fw_diag_config));
+
+	// get default temperature and spare capacity thresholds
+	char max_threshold_str[CONFIG_VALUE_LEN];
+	get_config_value(SQL_KEY_DEFAULT_MEDIA_TEMPERATURE_THRESHOLD,
+		max_threshold_str);
+	p_config->max_media_temp_threshold = strtof(max_threshold_str, NULL);
+	get_config_value(SQL_KEY_DEFAULT_CONTROLLER_TEMPERATURE_THRESHOLD,
+		max_threshold_str);
+	p_config->max_controller_temp_threshold = strtof(max_threshold_str, NULL);
+
+	int min_spare_block_threshold_config = 0;
+	get_config_value_int(SQL_KEY_DEFAULT_SPARE_BLOCK_THRESHOLD,
+			&min_spare_block_threshold_config);
+	s_snprintf(p_config->expected_spare_block_threshold_str, NVM_EVENT_ARG_LEN, "%u",
+			min_spare_block_threshold_config);
+	p_config->min_spare_block_threshold = min_spare_block_threshold_config;
+
+	// get default FW debug log level
+	get_config_value_int(SQL_KEY_FW_LOG_LEVEL, &p_config->default_log_level);
+	if (p_config->default_log_level <= FW_LOG_LEVEL_UNKNOWN)
+	{
+		s_snprintf(p_config->default_log_level_str, NVM_EVENT_ARG_LEN, "%s",
+				fw_log_level_strings[p_config->default_log_level]);
+	}
+	else
+	{
+		s_strcpy(p_config->default_log_level_str,
+				fw_log_level_strings[FW_LOG_LEVEL_UNKNOWN],
+				NVM_EVENT_ARG_LEN);
+	}
+
+	// get default reasonable time drift
+	get_config_value_int(SQL_KEY_DEFAULT_TIME_DRIFT, &p_config->default_time_drift);
+
+	// get default peak power budget, avg power budget min/max's
+	int default_peak_power_budget_min_config = 0;
+	int default_peak_power_budget_max_config = 0;
+	get_config_value_int(SQL_KEY_DEFAULT_PEAK_POW_BUDGET_MIN,
+			&default_peak_power_budget_min_config);
+	get_config_value_int(SQL_KEY_DEFAULT_PEAK_POW_BUDGET_MAX,
+			&default_peak_power_budget_max_config);
+	s_snprintf(p_config->expected_peak_power_budget_range_str, NVM_EVENT_ARG_LEN,
+			"[%d - %d] mW.",
+			default_peak_power_budget_min_config, default_peak_power_budget_max_config);
+	p_config->default_peak_power_budget_min = default_peak_power_budget_min_config;
+	p_config->default_peak_power_budget_max = default_peak_power_budget_max_config;
+
+	int default_avg_power_budget_min_config = 0;
+	int default_avg_power_budget_max_config = 0;
+	get_config_value_int(SQL_KEY_DEFAULT_AVG_POW_BUDGET_MIN,
+			&default_avg_power_budget_min_config);
+	get_config_value_int(SQL_KEY_DEFAULT_AVG_POW_BUDGET_MAX,
+			&default_avg_power_budget_max_config);
+	s_snprintf(p_config->expected_avg_power_budget_range_str, NVM_EVENT_ARG_LEN,
+			"[%d - %d] mW.",
+			default_avg_power_budget_min_config, default_avg_power_budget_max_config);
+	p_config->default_avg_power_budget_min = default_avg_power_budget_min_config;
+	p_config->default_avg_power_budget_max = default_avg_power_budget_max_config;
+
+	// get default die sparing policy aggressiveness
+	int default_die_sparing_level_config = 0;
+	get_config_value_int(SQL_KEY_DEFAULT_DIE_SPARING_AGGRESSIVENESS,
+			&default_die_sparing_level_config);
+	s_snprintf(p_config->expected_die_sparing_aggressiveness_str, NVM_EVENT_ARG_LEN, "%d",
+			default_die_sparing_level_config);
+	p_config->default_die_sparing_level = default_die_sparing_level_config;
+}
+
+static void fw_settings_check_worker(void *arg, COMMON_UINT32 index)
+{
+	struct fw_diag_work *p_work = (struct fw_diag_work *)arg;
+	p_work->p_rcs[index] = check_dimm_fw_settings(&p_work->p_devices[index],
+			p_work->p_diagnostic, p_work->p_config, &p_work->p_results[index]);
+}
+
+/*
+ * Check the FW settings of every DIMM, reading the DIMMs in parallel
+ * and keeping their results in DIMM order
+ */
+static int check_all_fw_settings(const struct device_discovery *p_dimms, const int dev_count,
+		const struct diagnostic *p_diagnostic, struct diag_results *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct diag_results *p_dimm_results = calloc(dev_count, sizeof (struct diag_results));
+	int *p_rcs = calloc(dev_count, sizeof (int));
+	if (!p_dimm_results || !p_rcs)
+	{
+		COMMON_LOG_ERROR("Failed to allocate memory for the firmware diagnostic");
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		struct fw_diag_config config;
+		get_fw_diag_config(&config);
+		for (int i = 0; i < dev_count; i++)
+		{
+			diag_init_results(EVENT_TYPE_DIAG_FW_CONSISTENCY, &p_dimm_results[i]);
+		}
+
+		struct fw_diag_work work;
+		work.p_devices = p_dimms;
+		work.p_diagnostic = p_diagnostic;
+		work.p_config = &config;
+		work.p_results = p_dimm_results;
+		work.p_rcs = p_rcs;
+
+		// the FW commands of each DIMM are independent
+		run_parallel(dev_count, PARALLEL_MAX_THREADS, fw_settings_check_worker, &work);
+
+		for (int i = 0; i < dev_count; i++)
+		{
+			KEEP_ERROR(rc, p_rcs[i]);
+			diag_append_results(p_results, &p_dimm_results[i]);
+		}
+	}
+	free(p_rcs);
+	free(p_dimm_results);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Run the firmware consistency and settings check diagnostic algorithm
  */
@@ -68,6 +242,8 @@ int diag_firmware_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_res
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
+	struct diag_results results;
+	diag_init_results(EVENT_TYPE_DIAG_FW_CONSISTENCY, &results);
 
 	// clear previous results
 	diag_clear_results(EVENT_TYPE_DIAG_FW_CONSISTENCY, 0, NULL);
@@ -82,10 +258,9 @@ int diag_firmware_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_res
 		int dev_count = nvm_get_device_count();
 		if (dev_count == 0)
 		{
-			store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
+			diag_add_result(&results,
 					EVENT_SEVERITY_INFO, EVENT_CODE_DIAG_FW_NO_DIMMS, NULL, 0, NULL,
 					NULL, NULL, DIAGNOSTIC_RESULT_ABORTED);
-			(*p_results)++;
 		}
 		else if (dev_count > 0)
 		{
@@ -97,417 +272,16 @@ int diag_firmware_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_res
 			{
 				if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_CONSISTENT))
 				{
-					// get optimal FW revision per subsystem device ID
-					NVM_VERSION optimal_fw_rev[NUM_SUPPORTED_DEVICE_IDS];
-					for (int current_subsys_dev = 0; current_subsys_dev < NUM_SUPPORTED_DEVICE_IDS;
-							current_subsys_dev++)
-					{
-						find_optimal_fw_revision(optimal_fw_rev[current_subsys_dev],
-								SUPPORTED_DEVICE_IDS[current_subsys_dev], dimms, dev_count);
-					}
-
-					// compare firmware revisions of dimms having the same subsystem device ID
-					char inconsistent_uids_event_str[NVM_EVENT_ARG_LEN] = {0};
-					NVM_BOOL inconsistency_flag = 0;
-					for (int subsys_dev = 0; subsys_dev < NUM_SUPPORTED_DEVICE_IDS; subsys_dev++)
-					{
-						for (int dev_num = 0; dev_num < dev_count; dev_num++)
-						{
-							if (SUPPORTED_DEVICE_IDS[subsys_dev] ==
-									dimms[dev_num].subsystem_device_id)
-							{
-								if (strncmp(optimal_fw_rev[subsys_dev],
-										dimms[dev_num].fw_revision, NVM_VERSION_LEN) != 0)
-								{
-									NVM_UID uid_str;
-									uid_copy(dimms[dev_num].uid, uid_str);
-									s_strcat(uid_str, (NVM_MAX_UID_LEN + 2), ", ");
-									s_strcat(inconsistent_uids_event_str,
-											NVM_EVENT_ARG_LEN, uid_str);
-									inconsistency_flag = 1;
-								}
-							}
-						}
-						// log an event per subsystem device ID if fw version is inconsistent
-						if (inconsistency_flag)
-						{
-							char subsys_dev_string[NVM_EVENT_ARG_LEN] = {0};
-							s_snprintf(subsys_dev_string, NVM_EVENT_ARG_LEN, "%hu",
-									SUPPORTED_DEVICE_IDS[subsys_dev]);
-
-							store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-									EVENT_SEVERITY_WARN,
-									EVENT_CODE_DIAG_FW_INCONSISTENT, NULL, 0,
-									inconsistent_uids_event_str,
-									subsys_dev_string, optimal_fw_rev[subsys_dev],
-									DIAGNOSTIC_RESULT_WARNING);
-							(*p_results)++;
-						}
-						inconsistency_flag = 0;
-					}
+					check_fw_consistency(dimms, dev_count, &results);
 				}
 
-				// get default temperature and spare capacity thresholds
-				char max_threshold_str[CONFIG_VALUE_LEN];
-				get_config_value(SQL_KEY_DEFAULT_MEDIA_TEMPERATURE_THRESHOLD,
-					max_threshold_str);
-				float max_media_temp_threshold_config = strtof(max_threshold_str, NULL);
-				get_config_value(SQL_KEY_DEFAULT_CONTROLLER_TEMPERATURE_THRESHOLD,
-					max_threshold_str);
-				float max_controller_temp_threshold_config = strtof(max_threshold_str, NULL);
-
-				int min_spare_block_threshold_config = 0;
-				get_config_value_int(SQL_KEY_DEFAULT_SPARE_BLOCK_THRESHOLD,
-						&min_spare_block_threshold_config);
-				char expected_spare_block_threshold_str[NVM_EVENT_ARG_LEN];
-				s_snprintf(expected_spare_block_threshold_str, NVM_EVENT_ARG_LEN, "%u",
-						min_spare_block_threshold_config);
-				NVM_UINT64 min_spare_block_threshold = min_spare_block_threshold_config;
-
-				// get default FW debug log level
-				int default_log_level = 0;
-				get_config_value_int(SQL_KEY_FW_LOG_LEVEL, &default_log_level);
-				char default_log_level_str[NVM_EVENT_ARG_LEN];
-				if (default_log_level <= FW_LOG_LEVEL_UNKNOWN)
-				{
-					s_snprintf(default_log_level_str, NVM_EVENT_ARG_LEN, "%s",
-							fw_log_level_strings[default_log_level]);
-				}
-				else
-				{
-					s_strcpy(default_log_level_str,
-							fw_log_level_strings[FW_LOG_LEVEL_UNKNOWN],
-							NVM_EVENT_ARG_LEN);
-				}
+				rc = check_all_fw_settings(dimms, dev_count, p_diagnostic, &results);
 
-				// get default reasonable time drift
-				int default_time_drift = 0;
-				get_config_value_int(SQL_KEY_DEFAULT_TIME_DRIFT, &default_time_drift);
-				char default_time_drift_str[10];
-				s_snprintf(default_time_drift_str, 10, "%u", default_time_drift);
-
-				// get default peak power budget, avg power budget min/max's
-				int default_peak_power_budget_min_config = 0;
-				int default_peak_power_budget_max_config = 0;
-				get_config_value_int(SQL_KEY_DEFAULT_PEAK_POW_BUDGET_MIN,
-						&default_peak_power_budget_min_config);
-				get_config_value_int(SQL_KEY_DEFAULT_PEAK_POW_BUDGET_MAX,
-						&default_peak_power_budget_max_config);
-				char expected_peak_power_budget_range_str[NVM_EVENT_ARG_LEN];
-				s_snprintf(expected_peak_power_budget_range_str, NVM_EVENT_ARG_LEN, "[%d - %d] mW.",
-						default_peak_power_budget_min_config, default_peak_power_budget_max_config);
-				NVM_UINT64 default_peak_power_budget_min = default_peak_power_budget_min_config;
-				NVM_UINT64 default_peak_power_budget_max = default_peak_power_budget_max_config;
-
-				int default_avg_power_budget_min_config = 0;
-				int default_avg_power_budget_max_config = 0;
-				get_config_value_int(SQL_KEY_DEFAULT_AVG_POW_BUDGET_MIN,
-						&default_avg_power_budget_min_config);
-				get_config_value_int(SQL_KEY_DEFAULT_AVG_POW_BUDGET_MAX,
-						&default_avg_power_budget_max_config);
-				char expected_avg_power_budget_range_str[NVM_EVENT_ARG_LEN];
-				s_snprintf(expected_avg_power_budget_range_str, NVM_EVENT_ARG_LEN, "[%d - %d] mW.",
-						default_avg_power_budget_min_config, default_avg_power_budget_max_config);
-				NVM_UINT64 default_avg_power_budget_min = default_avg_power_budget_min_config;
-				NVM_UINT64 default_avg_power_budget_max = default_avg_power_budget_max_config;
-
-				// get default die sparing policy aggressiveness
-				int default_die_sparing_level_config = 0;
-				get_config_value_int(SQL_KEY_DEFAULT_DIE_SPARING_AGGRESSIVENESS,
-						&default_die_sparing_level_config);
-				char expected_die_sparing_aggressiveness_str[NVM_EVENT_ARG_LEN];
-				s_snprintf(expected_die_sparing_aggressiveness_str, NVM_EVENT_ARG_LEN, "%d",
-						default_die_sparing_level_config);
-				NVM_UINT64 default_die_sparing_level = default_die_sparing_level_config;
-
-				struct sensor sensors[NVM_MAX_DEVICE_SENSORS];
-				NVM_UID device_uid_str;
-				struct device_discovery discovery;
-				for (int current_dev = 0; current_dev < dev_count; current_dev++)
+				if ((rc == NVM_SUCCESS) && (results.count == 0)) // No errors/warnings
 				{
-					if ((rc = exists_and_manageable(dimms[current_dev].uid,
-							&discovery, 1)) == NVM_SUCCESS)
-					{
-						NVM_UID uid_str;
-						uid_copy(dimms[current_dev].uid, uid_str);
-						// verify if threshold values of temperature and spare capacity are
-						// in accordance with best practices
-						nvm_get_sensors(dimms[current_dev].uid, sensors, NVM_MAX_DEVICE_SENSORS);
-						uid_copy(dimms[current_dev].uid, device_uid_str);
-						if (!diag_check_real(p_diagnostic,
-							DIAG_THRESHOLD_FW_MEDIA_TEMP,
-							nvm_decode_temperature(
-							sensors[SENSOR_MEDIA_TEMPERATURE].settings.upper_noncritical_threshold),
-							&max_media_temp_threshold_config, EQUALITY_LESSTHANEQUAL))
-						{
-							NVM_UINT64 actual_temp_threshold =
-								sensors[SENSOR_MEDIA_TEMPERATURE].
-									settings.upper_noncritical_threshold;
-							char actual_temp_threshold_str[10];
-							s_snprintf(actual_temp_threshold_str, 10, "%.4f",
-									nvm_decode_temperature(actual_temp_threshold));
-							char expected_temp_threshold_str[NVM_EVENT_ARG_LEN];
-							s_snprintf(expected_temp_threshold_str, NVM_EVENT_ARG_LEN, "%.4f",
-									max_media_temp_threshold_config);
-
-							store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-									EVENT_SEVERITY_WARN,
-									EVENT_CODE_DIAG_FW_BAD_TEMP_MEDIA_THRESHOLD,
-									dimms[current_dev].uid, 0, uid_str, actual_temp_threshold_str,
-									expected_temp_threshold_str,
-									DIAGNOSTIC_RESULT_WARNING);
-						(*p_results)++;
-					}
-
-					NVM_UINT64 actual_temp_threshold =
-						sensors[SENSOR_CONTROLLER_TEMPERATURE].settings.upper_noncritical_threshold;
-					if (!diag_check_real(p_diagnostic,
-							DIAG_THRESHOLD_FW_CORE_TEMP,
-							nvm_decode_temperature(actual_temp_threshold),
-							&max_controller_temp_threshold_config, EQUALITY_LESSTHANEQUAL))
-					{
-						char actual_temp_threshold_str[10];
-						s_snprintf(actual_temp_threshold_str, 10, "%.4f",
-								nvm_decode_temperature(actual_temp_threshold));
-						char expected_temp_threshold_str[NVM_EVENT_ARG_LEN];
-						s_snprintf(expected_temp_threshold_str, NVM_EVENT_ARG_LEN, "%.4f",
-								max_controller_temp_threshold_config);
-						store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-								EVENT_SEVERITY_WARN,
-								EVENT_CODE_DIAG_FW_BAD_TEMP_CONTROLLER_THRESHOLD,
-								dimms[current_dev].uid, 0, uid_str, actual_temp_threshold_str,
-								expected_temp_threshold_str,
-								DIAGNOSTIC_RESULT_WARNING);
-							(*p_results)++;
-						}
-
-						if (!diag_check(p_diagnostic,
-								DIAG_THRESHOLD_FW_SPARE,
-								sensors[SENSOR_SPARECAPACITY].settings.lower_noncritical_threshold,
-								&min_spare_block_threshold, EQUALITY_GREATERTHANEQUAL))
-						{
-							char actual_spare_block_threshold_str[10];
-							s_snprintf(actual_spare_block_threshold_str, 10, "%u",
-								sensors[SENSOR_SPARECAPACITY].settings.lower_noncritical_threshold);
-							store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-									EVENT_SEVERITY_WARN,
-									EVENT_CODE_DIAG_FW_BAD_SPARE_BLOCK,
-									dimms[current_dev].uid, 0, uid_str,
-									expected_spare_block_threshold_str,
-									actual_spare_block_threshold_str,
-									DIAGNOSTIC_RESULT_WARNING);
-							(*p_results)++;
-						}
-
-						// verify FW debug log level is set in accordance with best practices
-						enum fw_log_level log_level;
-						if (NVM_SUCCESS == nvm_get_fw_log_level(dimms[current_dev].uid,
-								&log_level))
-						{
-							if ((!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_DEBUGLOG)) &&
-										(log_level != default_log_level))
-							{
-								char current_log_level_str[NVM_EVENT_ARG_LEN];
-								s_snprintf(current_log_level_str, NVM_EVENT_ARG_LEN, "%s",
-										fw_log_level_strings[log_level]);
-								store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-										EVENT_SEVERITY_WARN,
-										EVENT_CODE_DIAG_FW_BAD_FW_LOG_LEVEL,
-										dimms[current_dev].uid, 0, uid_str, current_log_level_str,
-										default_log_level_str,
-										DIAGNOSTIC_RESULT_WARNING);
-								(*p_results)++;
-							}
-						}
-
-						if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_TIME))
-						{
-							// verify host time and NVM DIMM time are within reasonable window.
-							struct pt_payload_system_time time_payload;
-							memset(&time_payload, 0, sizeof (time_payload));
-							time_t now = time(0); // returns system time in seconds
-							if ((rc = get_fw_system_time(dimms[current_dev].device_handle,
-									&time_payload)) == NVM_SUCCESS)
-							{
-								time_t current_time_drift = now - time_payload.time;
-								char current_time_drift_str[NVM_EVENT_ARG_LEN];
-								char time_drift_lag_str[NVM_EVENT_ARG_LEN];
-								if ((current_time_drift > 0) &&
-										(current_time_drift > default_time_drift))
-								{
-									s_snprintf(current_time_drift_str,
-											NVM_EVENT_ARG_LEN, "%llu",
-											(unsigned long long) current_time_drift);
-									s_snprintf(time_drift_lag_str, NVM_EVENT_ARG_LEN,
-											"%s", "<");
-									store_event_by_parts(
-											EVENT_TYPE_DIAG_FW_CONSISTENCY,
-											EVENT_SEVERITY_WARN,
-											EVENT_CODE_DIAG_FW_SYSTEM_TIME_DRIFT,
-											dimms[current_dev].uid, 0, uid_str,
-											time_drift_lag_str, current_time_drift_str,
-											DIAGNOSTIC_RESULT_WARNING);
-									(*p_results)++;
-								}
-								else if ((current_time_drift < 0) &&
-										(abs(current_time_drift) > default_time_drift))
-								{
-									s_snprintf(current_time_drift_str,
-											NVM_EVENT_ARG_LEN, "%llu", abs(
-													current_time_drift));
-									s_snprintf(time_drift_lag_str, NVM_EVENT_ARG_LEN,
-											"%s", ">");
-									store_event_by_parts(
-											EVENT_TYPE_DIAG_FW_CONSISTENCY,
-											EVENT_SEVERITY_WARN,
-											EVENT_CODE_DIAG_FW_SYSTEM_TIME_DRIFT,
-											dimms[current_dev].uid, 0, uid_str,
-											time_drift_lag_str, current_time_drift_str,
-											DIAGNOSTIC_RESULT_WARNING);
-									(*p_results)++;
-								}
-							}
-						}
-
-						if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_POW_MGMT_POLICY))
-						{
-							// verify power management policies meet best practices
-							struct pt_payload_power_mgmt_policy power_payload;
-							memset(&power_payload, 0, sizeof (power_payload));
-							get_fw_power_mgmt_policy(dimms[current_dev].device_handle,
-									&power_payload);
-
-							char field_str[NVM_EVENT_ARG_LEN];
-							if (power_payload.enabled)
-							{
-
-								if ((diag_check(p_diagnostic,
-										DIAG_THRESHOLD_FW_AVG_POW_BUDGET_MIN,
-										power_payload.average_power_budget,
-										&default_avg_power_budget_min,
-										EQUALITY_LESSTHAN)) ||
-										(diag_check(p_diagnostic,
-										DIAG_THRESHOLD_FW_AVG_POW_BUDGET_MAX,
-										power_payload.average_power_budget,
-										&default_avg_power_budget_max,
-										EQUALITY_GREATHERTHAN)))
-								{
-									s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hu",
-											"average power budget",
-											power_payload.average_power_budget);
-									store_event_by_parts(
-											EVENT_TYPE_DIAG_FW_CONSISTENCY,
-											EVENT_SEVERITY_WARN,
-											EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
-											dimms[current_dev].uid, 0, uid_str,
-											field_str,
-											expected_avg_power_budget_range_str,
-											DIAGNOSTIC_RESULT_WARNING);
-									(*p_results)++;
-								}
-
-								if ((diag_check(p_diagnostic,
-										DIAG_THRESHOLD_FW_PEAK_POW_BUDGET_MIN,
-										power_payload.peak_power_budget,
-										&default_peak_power_budget_min,
-										EQUALITY_LESSTHAN)) ||
-										(diag_check(p_diagnostic,
-										DIAG_THRESHOLD_FW_PEAK_POW_BUDGET_MAX,
-										power_payload.peak_power_budget,
-										&default_peak_power_budget_max,
-										EQUALITY_GREATHERTHAN)))
-								{
-									s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hu",
-											"peak power budget",
-											power_payload.peak_power_budget);
-									store_event_by_parts(
-											EVENT_TYPE_DIAG_FW_CONSISTENCY,
-											EVENT_SEVERITY_WARN,
-											EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
-											dimms[current_dev].uid, 0, uid_str,
-											field_str,
-											expected_peak_power_budget_range_str,
-											DIAGNOSTIC_RESULT_WARNING);
-									(*p_results)++;
-								}
-							}
-							else
-							{
-								s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hhu",
-										"power management policy enable",
-										power_payload.enabled);
-								char expected_power_mgmt_enabled_str[NVM_EVENT_ARG_LEN];
-								s_snprintf(expected_power_mgmt_enabled_str,
-										NVM_EVENT_ARG_LEN, "%u", 1);
-								store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-										EVENT_SEVERITY_WARN,
-										EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
-										dimms[current_dev].uid, 0, uid_str, field_str,
-										expected_power_mgmt_enabled_str,
-										DIAGNOSTIC_RESULT_WARNING);
-								(*p_results)++;
-							}
-						}
-
-						if(!(discovery.device_capabilities.die_sparing_capable))
-						{
-							//not a Die Sparing Capable DIMM, no need to check fw die sparing policy
-							COMMON_LOG_DEBUG("Device is not a Die Sparing Capable DIMM, do not check die sparing policy");
-						}
-						else if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_DIE_SPARING_POLICY))
-						{
-							// verify die sparing policies are in accordance with best practices
-							struct pt_get_die_spare_policy spare_payload;
-							memset(&spare_payload, 0, sizeof (spare_payload));
-							get_fw_die_spare_policy(discovery.device_handle,
-									&spare_payload);
-							char field_str[NVM_EVENT_ARG_LEN];
-							if (spare_payload.enable)
-							{
-								if (!diag_check(p_diagnostic,
-										DIAG_THRESHOLD_FW_DIE_SPARING_LEVEL,
-										spare_payload.aggressiveness,
-										&default_die_sparing_level, EQUALITY_EQUAL))
-								{
-									s_snprintf(field_str, NVM_EVENT_ARG_LEN,
-											"%s: %hhu", "die sparing aggressiveness",
-											spare_payload.aggressiveness);
-									store_event_by_parts(
-											EVENT_TYPE_DIAG_FW_CONSISTENCY,
-											EVENT_SEVERITY_WARN,
-											EVENT_CODE_DIAG_FW_BAD_DIE_SPARING_POLICY,
-											dimms[current_dev].uid, 0, uid_str, field_str,
-											expected_die_sparing_aggressiveness_str,
-											DIAGNOSTIC_RESULT_WARNING);
-									(*p_results)++;
-								}
-							}
-							else
-							{
-								s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hhu",
-										"die sparing policy enable",
-										spare_payload.enable);
-								char expected_die_sparing_enabled_str[NVM_EVENT_ARG_LEN];
-								s_snprintf(expected_die_sparing_enabled_str,
-										NVM_EVENT_ARG_LEN, "%u", 1);
-								store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
-										EVENT_SEVERITY_WARN,
-										EVENT_CODE_DIAG_FW_BAD_DIE_SPARING_POLICY,
-										dimms[current_dev].uid, 0, uid_str, field_str,
-										expected_die_sparing_enabled_str,
-										DIAGNOSTIC_RESULT_WARNING);
-								(*p_results)++;
-							}
-						}
-					}
-				}
-
-				if ((rc == NVM_SUCCESS) && (*p_results == 0)) // No errors/warnings
-				{
-					store_event_by_parts(EVENT_TYPE_DIAG_FW_CONSISTENCY,
+					diag_add_result(&results,
 							EVENT_SEVERITY_INFO, EVENT_CODE_DIAG_FW_SUCCESS, NULL, 0,
 							NULL, NULL, NULL, DIAGNOSTIC_RESULT_OK);
-					(*p_results)++;
 				}
 			}// nvm_get_devices failed
 			else
@@ -523,61 +297,392 @@ int diag_firmware_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_res
 		}
 	}
 
+	*p_results = results.count;
+	diag_store_results(&results);
+
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
 /*
- * Helper function to find the optimal firmware version
+ * Pack a FW revision string into a single value that orders the same way
  */
-void find_optimal_fw_revision(char *optimal_fw_revision, NVM_UINT16  subsys_dev_id,
-		const struct device_discovery *p_dimms, int dev_count)
+static NVM_UINT64 fw_revision_to_uint64(const NVM_VERSION fw_revision)
 {
-	s_strncpy(optimal_fw_revision, NVM_VERSION_LEN,
-							"00.00.00.0000", NVM_VERSION_LEN);
-	for (int i = 0; i < dev_count; i++)
+	NVM_UINT16 major, minor, hotfix, build;
+	parse_main_revision(&major, &minor, &hotfix, &build,
+			fw_revision, NVM_VERSION_LEN);
+	return ((NVM_UINT64)major << 48) | ((NVM_UINT64)minor << 32) |
+			((NVM_UINT64)hotfix << 16) | build;
+}
+
+/*
+ * Compare the FW revisions of DIMMs having the same subsystem device ID
+ * against the newest revision among them. Each DIMM's revision is parsed
+ * once while grouping the DIMMs, instead of once per subsystem device ID.
+ */
+void check_fw_consistency(const struct device_discovery *p_dimms, const int dev_count,
+		struct diag_results *p_results)
+{
+	COMMON_LOG_ENTRY();
+
+	struct fw_revision_group groups[NUM_SUPPORTED_DEVICE_IDS];
+	memset(groups, 0, sizeof (groups));
+	int *p_dimm_groups = malloc(dev_count * sizeof (int));
+	NVM_UINT64 *p_revisions = malloc(dev_count * sizeof (NVM_UINT64));
+	if (!p_dimm_groups || !p_revisions)
 	{
-		if (subsys_dev_id == p_dimms[i].subsystem_device_id)
+		COMMON_LOG_ERROR("Failed to allocate memory for the firmware consistency check");
+	}
+	else
+	{
+		// group the DIMMs by subsystem device ID and find the optimal revision
+		for (int dev_num = 0; dev_num < dev_count; dev_num++)
 		{
-			// parse the version string into parts
-			NVM_UINT16 opt_major, opt_minor, opt_hotfix, opt_build;
-			NVM_UINT16 major, minor, hotfix, build;
-			parse_main_revision(&opt_major, &opt_minor, &opt_hotfix,
-					&opt_build, optimal_fw_revision, NVM_VERSION_LEN);
-			parse_main_revision(&major, &minor, &hotfix, &build,
-					p_dimms[i].fw_revision, NVM_VERSION_LEN);
-
-			if (opt_major < major)
+			p_dimm_groups[dev_num] = -1;
+			for (int subsys_dev = 0; subsys_dev < NUM_SUPPORTED_DEVICE_IDS; subsys_dev++)
 			{
-				s_strncpy(optimal_fw_revision, NVM_VERSION_LEN,
-						p_dimms[i].fw_revision, NVM_VERSION_LEN);
+				if (SUPPORTED_DEVICE_IDS[subsys_dev] == p_dimms[dev_num].subsystem_device_id)
+				{
+					p_dimm_groups[dev_num] = subsys_dev;
+					break;
+				}
 			}
-			else if (opt_major == major)
+
+			if (p_dimm_groups[dev_num] >= 0)
 			{
-				if (opt_minor < minor)
+				struct fw_revision_group *p_group = &groups[p_dimm_groups[dev_num]];
+				p_revisions[dev_num] = fw_revision_to_uint64(p_dimms[dev_num].fw_revision);
+				if (p_group->dimm_count == 0 ||
+						p_revisions[dev_num] > p_group->optimal_revision)
 				{
-					s_strncpy(optimal_fw_revision, NVM_VERSION_LEN,
-							p_dimms[i].fw_revision, NVM_VERSION_LEN);
+					p_group->optimal_revision = p_revisions[dev_num];
+					p_group->optimal_dimm = dev_num;
 				}
-				else if (opt_minor == minor)
+				p_group->dimm_count++;
+			}
+		}
+
+		// collect the DIMMs behind the optimal revision of their group
+		char inconsistent_uids_event_str[NUM_SUPPORTED_DEVICE_IDS][NVM_EVENT_ARG_LEN];
+		memset(inconsistent_uids_event_str, 0, sizeof (inconsistent_uids_event_str));
+		for (int dev_num = 0; dev_num < dev_count; dev_num++)
+		{
+			int subsys_dev = p_dimm_groups[dev_num];
+			if (subsys_dev >= 0 &&
+					p_revisions[dev_num] != groups[subsys_dev].optimal_revision)
+			{
+				NVM_UID uid_str;
+				uid_copy(p_dimms[dev_num].uid, uid_str);
+				s_strcat(uid_str, (NVM_MAX_UID_LEN + 2), ", ");
+				s_strcat(inconsistent_uids_event_str[subsys_dev],
+						NVM_EVENT_ARG_LEN, uid_str);
+			}
+		}
+
+		// log an event per subsystem device ID if fw version is inconsistent
+		for (int subsys_dev = 0; subsys_dev < NUM_SUPPORTED_DEVICE_IDS; subsys_dev++)
+		{
+			if (inconsistent_uids_event_str[subsys_dev][0])
+			{
+				char subsys_dev_string[NVM_EVENT_ARG_LEN] = {0};
+				s_snprintf(subsys_dev_string, NVM_EVENT_ARG_LEN, "%hu",
+						SUPPORTED_DEVICE_IDS[subsys_dev]);
+
+				diag_add_result(p_results,
+						EVENT_SEVERITY_WARN,
+						EVENT_CODE_DIAG_FW_INCONSISTENT, NULL, 0,
+						inconsistent_uids_event_str[subsys_dev],
+						subsys_dev_string,
+						p_dimms[groups[subsys_dev].optimal_dimm].fw_revision,
+						DIAGNOSTIC_RESULT_WARNING);
+			}
+		}
+	}
+	free(p_revisions);
+	free(p_dimm_groups);
+
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Verify the FW settings of one DIMM are in accordance with best practices
+ */
+int check_dimm_fw_settings(const struct device_discovery *p_dimm,
+		const struct diagnostic *p_diagnostic, const struct fw_diag_config *p_config,
+		struct diag_results *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (!IS_DEVICE_MANAGEABLE(p_dimm))
+	{
+		COMMON_LOG_DEBUG("Device is not manageable");
+		rc = NVM_ERR_NOTMANAGEABLE;
+	}
+	else
+	{
+		// the thresholds may be overridden by the diagnostic
+		struct fw_diag_config config = *p_config;
+		struct sensor sensors[NVM_MAX_DEVICE_SENSORS];
+		NVM_UID uid_str;
+		uid_copy(p_dimm->uid, uid_str);
+		// verify if threshold values of temperature and spare capacity are
+		// in accordance with best practices
+		nvm_get_sensors(p_dimm->uid, sensors, NVM_MAX_DEVICE_SENSORS);
+		if (!diag_check_real(p_diagnostic,
+			DIAG_THRESHOLD_FW_MEDIA_TEMP,
+			nvm_decode_temperature(
+			sensors[SENSOR_MEDIA_TEMPERATURE].settings.upper_noncritical_threshold),
+			&config.max_media_temp_threshold, EQUALITY_LESSTHANEQUAL))
+		{
+			NVM_UINT64 actual_temp_threshold =
+				sensors[SENSOR_MEDIA_TEMPERATURE].
+					settings.upper_noncritical_threshold;
+			char actual_temp_threshold_str[10];
+			s_snprintf(actual_temp_threshold_str, 10, "%.4f",
+					nvm_decode_temperature(actual_temp_threshold));
+			char expected_temp_threshold_str[NVM_EVENT_ARG_LEN];
+			s_snprintf(expected_temp_threshold_str, NVM_EVENT_ARG_LEN, "%.4f",
+					config.max_media_temp_threshold);
+
+			diag_add_result(p_results,
+					EVENT_SEVERITY_WARN,
+					EVENT_CODE_DIAG_FW_BAD_TEMP_MEDIA_THRESHOLD,
+					p_dimm->uid, 0, uid_str, actual_temp_threshold_str,
+					expected_temp_threshold_str,
+					DIAGNOSTIC_RESULT_WARNING);
+		}
+
+		NVM_UINT64 actual_temp_threshold =
+			sensors[SENSOR_CONTROLLER_TEMPERATURE].settings.upper_noncritical_threshold;
+		if (!diag_check_real(p_diagnostic,
+				DIAG_THRESHOLD_FW_CORE_TEMP,
+				nvm_decode_temperature(actual_temp_threshold),
+				&config.max_controller_temp_threshold, EQUALITY_LESSTHANEQUAL))
+		{
+			char actual_temp_threshold_str[10];
+			s_snprintf(actual_temp_threshold_str, 10, "%.4f",
+					nvm_decode_temperature(actual_temp_threshold));
+			char expected_temp_threshold_str[NVM_EVENT_ARG_LEN];
+			s_snprintf(expected_temp_threshold_str, NVM_EVENT_ARG_LEN, "%.4f",
+					config.max_controller_temp_threshold);
+			diag_add_result(p_results,
+					EVENT_SEVERITY_WARN,
+					EVENT_CODE_DIAG_FW_BAD_TEMP_CONTROLLER_THRESHOLD,
+					p_dimm->uid, 0, uid_str, actual_temp_threshold_str,
+					expected_temp_threshold_str,
+					DIAGNOSTIC_RESULT_WARNING);
+		}
+
+		if (!diag_check(p_diagnostic,
+				DIAG_THRESHOLD_FW_SPARE,
+				sensors[SENSOR_SPARECAPACITY].settings.lower_noncritical_threshold,
+				&config.min_spare_block_threshold, EQUALITY_GREATERTHANEQUAL))
+		{
+			char actual_spare_block_threshold_str[10];
+			s_snprintf(actual_spare_block_threshold_str, 10, "%u",
+				sensors[SENSOR_SPARECAPACITY].settings.lower_noncritical_threshold);
+			diag_add_result(p_results,
+					EVENT_SEVERITY_WARN,
+					EVENT_CODE_DIAG_FW_BAD_SPARE_BLOCK,
+					p_dimm->uid, 0, uid_str,
+					config.expected_spare_block_threshold_str,
+					actual_spare_block_threshold_str,
+					DIAGNOSTIC_RESULT_WARNING);
+		}
+
+		// verify FW debug log level is set in accordance with best practices
+		enum fw_log_level log_level;
+		if (NVM_SUCCESS == nvm_get_fw_log_level(p_dimm->uid,
+				&log_level))
+		{
+			if ((!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_DEBUGLOG)) &&
+						(log_level != config.default_log_level))
+			{
+				char current_log_level_str[NVM_EVENT_ARG_LEN];
+				s_snprintf(current_log_level_str, NVM_EVENT_ARG_LEN, "%s",
+						fw_log_level_strings[log_level]);
+				diag_add_result(p_results,
+						EVENT_SEVERITY_WARN,
+						EVENT_CODE_DIAG_FW_BAD_FW_LOG_LEVEL,
+						p_dimm->uid, 0, uid_str, current_log_level_str,
+						config.default_log_level_str,
+						DIAGNOSTIC_RESULT_WARNING);
+			}
+		}
+
+		if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_TIME))
+		{
+			// verify host time and NVM DIMM time are within reasonable window.
+			struct pt_payload_system_time time_payload;
+			memset(&time_payload, 0, sizeof (time_payload));
+			time_t now = time(0); // returns system time in seconds
+			if ((rc = get_fw_system_time(p_dimm->device_handle,
+					&time_payload)) == NVM_SUCCESS)
+			{
+				time_t current_time_drift = now - time_payload.time;
+				char current_time_drift_str[NVM_EVENT_ARG_LEN];
+				char time_drift_lag_str[NVM_EVENT_ARG_LEN];
+				if ((current_time_drift > 0) &&
+						(current_time_drift > config.default_time_drift))
+				{
+					s_snprintf(current_time_drift_str,
+							NVM_EVENT_ARG_LEN, "%llu",
+							(unsigned long long) current_time_drift);
+					s_snprintf(time_drift_lag_str, NVM_EVENT_ARG_LEN,
+							"%s", "<");
+					diag_add_result(p_results,
+							EVENT_SEVERITY_WARN,
+							EVENT_CODE_DIAG_FW_SYSTEM_TIME_DRIFT,
+							p_dimm->uid, 0, uid_str,
+							time_drift_lag_str, current_time_drift_str,
+							DIAGNOSTIC_RESULT_WARNING);
+				}
+				else if ((current_time_drift < 0) &&
+						(abs(current_time_drift) > config.default_time_drift))
+				{
+					s_snprintf(current_time_drift_str,
+							NVM_EVENT_ARG_LEN, "%llu", abs(
+									current_time_drift));
+					s_snprintf(time_drift_lag_str, NVM_EVENT_ARG_LEN,
+							"%s", ">");
+					diag_add_result(p_results,
+							EVENT_SEVERITY_WARN,
+							EVENT_CODE_DIAG_FW_SYSTEM_TIME_DRIFT,
+							p_dimm->uid, 0, uid_str,
+							time_drift_lag_str, current_time_drift_str,
+							DIAGNOSTIC_RESULT_WARNING);
+				}
+			}
+		}
+
+		if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_POW_MGMT_POLICY))
+		{
+			// verify power management policies meet best practices
+			struct pt_payload_power_mgmt_policy power_payload;
+			memset(&power_payload, 0, sizeof (power_payload));
+			get_fw_power_mgmt_policy(p_dimm->device_handle,
+					&power_payload);
+
+			char field_str[NVM_EVENT_ARG_LEN];
+			if (power_payload.enabled)
+			{
+
+				if ((diag_check(p_diagnostic,
+						DIAG_THRESHOLD_FW_AVG_POW_BUDGET_MIN,
+						power_payload.average_power_budget,
+						&config.default_avg_power_budget_min,
+						EQUALITY_LESSTHAN)) ||
+						(diag_check(p_diagnostic,
+						DIAG_THRESHOLD_FW_AVG_POW_BUDGET_MAX,
+						power_payload.average_power_budget,
+						&config.default_avg_power_budget_max,
+						EQUALITY_GREATHERTHAN)))
+				{
+					s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hu",
+							"average power budget",
+							power_payload.average_power_budget);
+					diag_add_result(p_results,
+							EVENT_SEVERITY_WARN,
+							EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
+							p_dimm->uid, 0, uid_str,
+							field_str,
+							config.expected_avg_power_budget_range_str,
+							DIAGNOSTIC_RESULT_WARNING);
+				}
+
+				if ((diag_check(p_diagnostic,
+						DIAG_THRESHOLD_FW_PEAK_POW_BUDGET_MIN,
+						power_payload.peak_power_budget,
+						&config.default_peak_power_budget_min,
+						EQUALITY_LESSTHAN)) ||
+						(diag_check(p_diagnostic,
+						DIAG_THRESHOLD_FW_PEAK_POW_BUDGET_MAX,
+						power_payload.peak_power_budget,
+						&config.default_peak_power_budget_max,
+						EQUALITY_GREATHERTHAN)))
+				{
+					s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hu",
+							"peak power budget",
+							power_payload.peak_power_budget);
+					diag_add_result(p_results,
+							EVENT_SEVERITY_WARN,
+							EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
+							p_dimm->uid, 0, uid_str,
+							field_str,
+							config.expected_peak_power_budget_range_str,
+							DIAGNOSTIC_RESULT_WARNING);
+				}
+			}
+			else
+			{
+				s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hhu",
+						"power management policy enable",
+						power_payload.enabled);
+				char expected_power_mgmt_enabled_str[NVM_EVENT_ARG_LEN];
+				s_snprintf(expected_power_mgmt_enabled_str,
+						NVM_EVENT_ARG_LEN, "%u", 1);
+				diag_add_result(p_results,
+						EVENT_SEVERITY_WARN,
+						EVENT_CODE_DIAG_FW_BAD_POWER_MGMT_POLICY,
+						p_dimm->uid, 0, uid_str, field_str,
+						expected_power_mgmt_enabled_str,
+						DIAGNOSTIC_RESULT_WARNING);
+			}
+		}
+
+		if(!(p_dimm->device_capabilities.die_sparing_capable))
+		{
+			//not a Die Sparing Capable DIMM, no need to check fw die sparing policy
+			COMMON_LOG_DEBUG("Device is not a Die Sparing Capable DIMM, do not check die sparing policy");
+		}
+		else if (!(p_diagnostic->excludes & DIAG_THRESHOLD_FW_DIE_SPARING_POLICY))
+		{
+			// verify die sparing policies are in accordance with best practices
+			struct pt_get_die_spare_policy spare_payload;
+			memset(&spare_payload, 0, sizeof (spare_payload));
+			get_fw_die_spare_policy(p_dimm->device_handle,
+					&spare_payload);
+			char field_str[NVM_EVENT_ARG_LEN];
+			if (spare_payload.enable)
+			{
+				if (!diag_check(p_diagnostic,
+						DIAG_THRESHOLD_FW_DIE_SPARING_LEVEL,
+						spare_payload.aggressiveness,
+						&config.default_die_sparing_level, EQUALITY_EQUAL))
 				{
-					if (opt_hotfix < hotfix)
-					{
-						s_strncpy(optimal_fw_revision, NVM_VERSION_LEN,
-								p_dimms[i].fw_revision, NVM_VERSION_LEN);
-					}
-					else if (opt_hotfix == hotfix)
-					{
-						if (opt_build < build)
-						{
-							s_strncpy(optimal_fw_revision, NVM_VERSION_LEN,
-									p_dimms[i].fw_revision, NVM_VERSION_LEN);
-						}
-					}
+					s_snprintf(field_str, NVM_EVENT_ARG_LEN,
+							"%s: %hhu", "die sparing aggressiveness",
+							spare_payload.aggressiveness);
+					diag_add_result(p_results,
+							EVENT_SEVERITY_WARN,
+							EVENT_CODE_DIAG_FW_BAD_DIE_SPARING_POLICY,
+							p_dimm->uid, 0, uid_str, field_str,
+							config.expected_die_sparing_aggressiveness_str,
+							DIAGNOSTIC_RESULT_WARNING);
 				}
 			}
+			else
+			{
+				s_snprintf(field_str, NVM_EVENT_ARG_LEN, "%s: %hhu",
+						"die sparing policy enable",
+						spare_payload.enable);
+				char expected_die_sparing_enabled_str[NVM_EVENT_ARG_LEN];
+				s_snprintf(expected_die_sparing_enabled_str,
+						NVM_EVENT_ARG_LEN, "%u", 1);
+				diag_add_result(p_results,
+						EVENT_SEVERITY_WARN,
+						EVENT_CODE_DIAG_FW_BAD_DIE_SPARING_POLICY,
+						p_dimm->uid, 0, uid_str, field_str,
+						expected_die_sparing_enabled_str,
+						DIAGNOSTIC_RESULT_WARNING);
+			}
 		}
 	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
 }
 
 /*
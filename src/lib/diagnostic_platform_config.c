@@ -41,9 +41,31 @@
 #include "config_goal.h"
 #include "capabilities.h"
 #include "pool_utilities.h"
+#include "platform_capabilities.h"
+#include <acpi/nfit.h>
+#include <stdlib.h>
+#include <guid/guid.h>
+#include <persistence/config_settings.h>
+#include <persistence/lib_persistence.h>
+#include <persistence/schema.h>
 
-int get_nvm_capabilities_from_pcat(NVM_UINT32 *p_results, struct nvm_capabilities *nvm_caps);
-int verify_pcd(int dev_count, const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
+/*
+ * A DIMM and its platform config data, read once per run
+ */
+struct pconfig_diag_dimm
+{
+	struct device_discovery *p_device;
+	struct platform_config_data *p_config;
+	int pcd_rc;
+	COMMON_GUID_STR pcd_digest; // empty if the PCD couldn't be read
+	NVM_BOOL changed; // the stored results can't be reused
+	NVM_UINT32 result_count; // results tagged with the DIMM's uid
+};
+
+int check_nvm_capabilities_from_pcat(NVM_UINT32 *p_results, const int caps_rc);
+int verify_pcd(struct pconfig_diag_dimm *p_dimms, const int dimm_count,
+		const struct diagnostic *p_diagnostic, const int caps_rc,
+		const struct nvm_capabilities *p_caps, NVM_UINT32 *p_results);
 void check_bios_config_support(NVM_UINT32 *p_results, const struct platform_capabilities *p_caps);
 
 #define	MEMORY_EVENT_ARG	"memory"
@@ -52,7 +74,265 @@ void check_bios_config_support(NVM_UINT32 *p_results, const struct platform_capa
 #define	APP_DIRECT_CAP_STR	"App Direct"
 
 /*
- * Run the platform configuration check diagnostic
+ * A DIMM as far as the per DIMM checks are concerned, other than its PCD
+ */
+struct pconfig_diag_device
+{
+	NVM_UID uid;
+	NVM_UINT32 handle;
+	enum manageability_state manageability;
+	struct device_capabilities device_capabilities;
+};
+
+/*
+ * Hash everything other than the PCDs that the per DIMM checks depend on:
+ * the NFIT and PCAT, and the DIMMs and capabilities read from them.
+ * If it changes every DIMM has to be verified again.
+ */
+static int get_pconfig_system_digest(const struct diagnostic *p_diagnostic,
+		const int caps_rc, const struct nvm_capabilities *p_caps,
+		const struct pconfig_diag_dimm *p_dimms, const int dimm_count,
+		COMMON_GUID_STR digest)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	// the NFIT header covers the length and checksum of the whole table
+	struct nfit nfit_header;
+	memset(&nfit_header, 0, sizeof (nfit_header));
+	int nfit_rc = nfit_get_nfit_header(&nfit_header);
+
+	NVM_SIZE overrides_size = p_diagnostic->overrides_len *
+			sizeof (struct diagnostic_threshold);
+	NVM_SIZE size = sizeof (p_diagnostic->excludes) + overrides_size +
+			sizeof (nfit_rc) + sizeof (nfit_header) +
+			sizeof (int) + sizeof (struct bios_capabilities) +
+			sizeof (caps_rc) + sizeof (struct nvm_capabilities) +
+			dimm_count * sizeof (struct pconfig_diag_device);
+	unsigned char *p_buf = calloc(1, size);
+	if (!p_buf)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		unsigned char *p_next = p_buf;
+		memmove(p_next, &p_diagnostic->excludes, sizeof (p_diagnostic->excludes));
+		p_next += sizeof (p_diagnostic->excludes);
+		if (overrides_size)
+		{
+			memmove(p_next, p_diagnostic->p_overrides, overrides_size);
+			p_next += overrides_size;
+		}
+		memmove(p_next, &nfit_rc, sizeof (nfit_rc));
+		p_next += sizeof (nfit_rc);
+		memmove(p_next, &nfit_header, sizeof (nfit_header));
+		p_next += sizeof (nfit_header);
+
+		// the PCAT is read straight into the buffer, zero filled past its length
+		int pcat_rc = get_pcat((struct bios_capabilities *)(p_next + sizeof (pcat_rc)));
+		memmove(p_next, &pcat_rc, sizeof (pcat_rc));
+		p_next += sizeof (pcat_rc) + sizeof (struct bios_capabilities);
+
+		memmove(p_next, &caps_rc, sizeof (caps_rc));
+		p_next += sizeof (caps_rc);
+		memmove(p_next, p_caps, sizeof (struct nvm_capabilities));
+		p_next += sizeof (struct nvm_capabilities);
+		for (int i = 0; i < dimm_count; i++)
+		{
+			struct pconfig_diag_device *p_device = (struct pconfig_diag_device *)p_next;
+			uid_copy(p_dimms[i].p_device->uid, p_device->uid);
+			p_device->handle = p_dimms[i].p_device->device_handle.handle;
+			p_device->manageability = p_dimms[i].p_device->manageability;
+			p_device->device_capabilities = p_dimms[i].p_device->device_capabilities;
+			p_next += sizeof (struct pconfig_diag_device);
+		}
+
+		if (!guid_hash_str(p_buf, size, digest))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		free(p_buf);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+static void get_pcd_digest_key(const NVM_UID uid, char *key)
+{
+	NVM_UID uid_str;
+	uid_copy(uid, uid_str);
+	s_snprintf(key, CONFIG_KEY_LEN, "%s%s", SQL_KEY_PCONFIG_DIAG_PCD_DIGEST, uid_str);
+}
+
+/*
+ * A DIMM's stored value is the digest of its PCD and how many results it had,
+ * so results lost to the event log rolling over are noticed
+ */
+static void get_pcd_digest_value(const struct pconfig_diag_dimm *p_dimm, char *value)
+{
+	s_snprintf(value, CONFIG_VALUE_LEN, "%s %u", p_dimm->pcd_digest, p_dimm->result_count);
+}
+
+static NVM_BOOL digest_matches_config(const char *key, const char *digest)
+{
+	char value[CONFIG_VALUE_LEN];
+	return (get_config_value(key, value) == COMMON_SUCCESS) &&
+			(s_strncmp(value, digest, CONFIG_VALUE_LEN) == 0);
+}
+
+static struct pconfig_diag_dimm *find_pconfig_dimm(struct pconfig_diag_dimm *p_dimms,
+		const int dimm_count, const char *uid)
+{
+	COMMON_UID event_uid;
+	uid_copy(uid, event_uid);
+	for (int i = 0; i < dimm_count; i++)
+	{
+		if (uid_cmp(p_dimms[i].p_device->uid, event_uid))
+		{
+			return &p_dimms[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Read the PCD of each manageable DIMM and decide which DIMMs have to be
+ * verified again. The stored results of the others are kept, everything
+ * else is removed. Returns the number of results kept.
+ */
+static NVM_UINT32 read_pcds(struct pconfig_diag_dimm *p_dimms, const int dimm_count,
+		const NVM_BOOL system_changed)
+{
+	COMMON_LOG_ENTRY();
+	NVM_UINT32 kept_count = 0;
+
+	// per DIMM results are tagged with the DIMM's uid
+	NVM_BOOL reuse = !system_changed;
+	int event_count = 0;
+	struct db_event *p_events = NULL;
+	PersistentStore *p_store = get_lib_store();
+	if (!p_store ||
+		db_get_event_count_by_event_type_type(p_store,
+			EVENT_TYPE_DIAG_PLATFORM_CONFIG, &event_count) != DB_SUCCESS)
+	{
+		event_count = 0;
+	}
+	else if (event_count > 0)
+	{
+		if ((p_events = calloc(event_count, sizeof (struct db_event))) == NULL ||
+			db_get_events_by_event_type_type(p_store, EVENT_TYPE_DIAG_PLATFORM_CONFIG,
+				p_events, event_count) != DB_SUCCESS)
+		{
+			// can't tell whose they are, start over
+			diag_clear_results(EVENT_TYPE_DIAG_PLATFORM_CONFIG, 0, NULL);
+			event_count = 0;
+			reuse = 0;
+		}
+	}
+	for (int e = 0; e < event_count; e++)
+	{
+		struct pconfig_diag_dimm *p_dimm =
+				find_pconfig_dimm(p_dimms, dimm_count, p_events[e].uid);
+		if (p_dimm)
+		{
+			p_dimm->result_count++;
+		}
+	}
+
+	for (int i = 0; i < dimm_count; i++)
+	{
+		struct pconfig_diag_dimm *p_dimm = &p_dimms[i];
+		// don't bother with unmanageable DIMMs
+		if (p_dimm->p_device->manageability == MANAGEMENT_VALIDCONFIG)
+		{
+			NVM_SIZE pcd_size = 0;
+			p_dimm->pcd_rc = get_dimm_platform_config_and_size(
+					p_dimm->p_device->device_handle, &p_dimm->p_config, &pcd_size);
+			if (p_dimm->pcd_rc == NVM_SUCCESS &&
+					guid_hash_str((const unsigned char *)p_dimm->p_config, pcd_size,
+							p_dimm->pcd_digest))
+			{
+				char key[CONFIG_KEY_LEN];
+				char value[CONFIG_VALUE_LEN];
+				get_pcd_digest_key(p_dimm->p_device->uid, key);
+				get_pcd_digest_value(p_dimm, value);
+				p_dimm->changed = !reuse || !digest_matches_config(key, value);
+			}
+			else
+			{
+				// re-verify and report it every time
+				p_dimm->pcd_digest[0] = '\0';
+				p_dimm->changed = 1;
+			}
+		}
+		else
+		{
+			p_dimm->changed = !reuse;
+		}
+		if (p_dimm->changed)
+		{
+			p_dimm->result_count = 0;
+		}
+		else
+		{
+			kept_count += p_dimm->result_count;
+		}
+	}
+
+	// remove the system wide results and those of DIMMs that are verified again
+	if (event_count > 0)
+	{
+		db_begin_transaction(p_store);
+		for (int e = 0; e < event_count; e++)
+		{
+			struct pconfig_diag_dimm *p_dimm =
+					find_pconfig_dimm(p_dimms, dimm_count, p_events[e].uid);
+			if (!p_dimm || p_dimm->changed)
+			{
+				db_delete_event_by_id(p_store, p_events[e].id);
+			}
+		}
+		db_end_transaction(p_store);
+	}
+	free(p_events);
+
+	COMMON_LOG_EXIT_RETURN_I(kept_count);
+	return kept_count;
+}
+
+/*
+ * Keep the digests of the inputs that produced the stored results
+ */
+static void save_pconfig_digests(const struct pconfig_diag_dimm *p_dimms, const int dimm_count,
+		const COMMON_GUID_STR system_digest)
+{
+	for (int i = 0; i < dimm_count; i++)
+	{
+		char key[CONFIG_KEY_LEN];
+		get_pcd_digest_key(p_dimms[i].p_device->uid, key);
+		if (p_dimms[i].pcd_digest[0])
+		{
+			char value[CONFIG_VALUE_LEN];
+			get_pcd_digest_value(&p_dimms[i], value);
+			add_config_value(key, value);
+		}
+		else
+		{
+			rm_config_value(key);
+		}
+	}
+	add_config_value(SQL_KEY_PCONFIG_DIAG_SYSTEM_DIGEST, system_digest);
+}
+
+/*
+ * Run the platform configuration check diagnostic.
+ *
+ * The results are kept along with a digest of each DIMM's PCD and of the
+ * system inputs (NFIT, PCAT and the DIMMs). The NFIT, PCAT and best practice
+ * checks run every time, but the PCD of a DIMM is only verified again if it,
+ * or the system inputs, changed. Otherwise its stored results are reused.
  */
 int diag_platform_config_check(const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
 {
@@ -60,39 +340,73 @@ int diag_platform_config_check(const struct diagnostic *p_diagnostic, NVM_UINT32
 	int rc = NVM_SUCCESS;
 	*p_results = 0;
 
-	// clear previous results
-	diag_clear_results(EVENT_TYPE_DIAG_PLATFORM_CONFIG, 0, NULL);
-
 	if ((rc = IS_NVM_FEATURE_SUPPORTED(platform_config_diagnostic)) != NVM_SUCCESS)
 	{
+		// clear previous results
+		diag_clear_results(EVENT_TYPE_DIAG_PLATFORM_CONFIG, 0, NULL);
 		COMMON_LOG_ERROR("The platform configuration diagnostic is not supported.");
 	}
 	else
 	{
+		// gather the inputs once, every check shares them
+		struct nvm_capabilities nvm_caps;
+		memset(&nvm_caps, 0, sizeof (nvm_caps));
+		int caps_rc = nvm_get_nvm_capabilities(&nvm_caps);
+
+		struct device_discovery *p_devices = NULL;
+		struct pconfig_diag_dimm *p_dimms = NULL;
+		int dimm_count = nvm_get_device_count();
+		if (dimm_count > 0)
+		{
+			p_devices = calloc(dimm_count, sizeof (struct device_discovery));
+			p_dimms = calloc(dimm_count, sizeof (struct pconfig_diag_dimm));
+			if (!p_devices || !p_dimms ||
+					(dimm_count = nvm_get_devices(p_devices, dimm_count)) < 0)
+			{
+				dimm_count = 0;
+			}
+			for (int i = 0; i < dimm_count; i++)
+			{
+				p_dimms[i].p_device = &p_devices[i];
+			}
+		}
+
+		// keep the results of the DIMMs whose inputs haven't changed
+		COMMON_GUID_STR system_digest;
+		NVM_BOOL system_ok = (get_pconfig_system_digest(p_diagnostic, caps_rc, &nvm_caps,
+				p_dimms, dimm_count, system_digest) == NVM_SUCCESS);
+		NVM_BOOL system_changed = !system_ok ||
+				!digest_matches_config(SQL_KEY_PCONFIG_DIAG_SYSTEM_DIGEST, system_digest);
+		*p_results = read_pcds(p_dimms, dimm_count, system_changed);
+
 		// verify existence and format of nfit table
 		int dev_count = 0;
-		struct nvm_capabilities nvm_caps;
+		NVM_BOOL nfit_ok = 1;
 		if (!(p_diagnostic->excludes & DIAG_THRESHOLD_PCONFIG_NFIT))
 		{
-			KEEP_ERROR(rc, verify_nfit(&dev_count, p_results));
+			NVM_UINT32 nfit_results = 0;
+			KEEP_ERROR(rc, verify_nfit(&dev_count, &nfit_results));
+			nfit_ok = (nfit_results == 0);
+			*p_results += nfit_results;
 		}
 
-		if (*p_results == 0) // NFIT is OK
+		if (nfit_ok)
 		{
 			if (!(p_diagnostic->excludes & DIAG_THRESHOLD_PCONFIG_PCAT))
 			{
-				//  verify contents of PCAT and get nvm capabilities
-				if (get_nvm_capabilities_from_pcat(p_results, &nvm_caps) == NVM_SUCCESS)
+				//  verify contents of PCAT
+				if (check_nvm_capabilities_from_pcat(p_results, caps_rc) == NVM_SUCCESS)
 				{
 					//	check if BIOS is set to provisioning using mgmt sw
 					check_bios_config_support(p_results, &nvm_caps.platform_capabilities);
 				}
 			}
 
-			// verify the contents of PCD of all DIMM
-			if (!(p_diagnostic->excludes & DIAG_THRESHOLD_PCONFIG_PCD))
+			// verify the contents of PCD of the DIMMs that changed
+			if (!(p_diagnostic->excludes & DIAG_THRESHOLD_PCONFIG_PCD) && dev_count > 0)
 			{
-				KEEP_ERROR(rc, verify_pcd(dev_count, p_diagnostic, p_results));
+				KEEP_ERROR(rc, verify_pcd(p_dimms, dimm_count,
+						p_diagnostic, caps_rc, &nvm_caps, p_results));
 			}
 
 			// check best practices
@@ -109,6 +423,23 @@ int diag_platform_config_check(const struct diagnostic *p_diagnostic, NVM_UINT32
 					NULL, NULL, NULL, DIAGNOSTIC_RESULT_OK);
 			(*p_results)++;
 		}
+
+		// only a complete run leaves results that are safe to reuse
+		if (rc == NVM_SUCCESS && nfit_ok && system_ok)
+		{
+			save_pconfig_digests(p_dimms, dimm_count, system_digest);
+		}
+		else
+		{
+			rm_config_value(SQL_KEY_PCONFIG_DIAG_SYSTEM_DIGEST);
+		}
+
+		for (int i = 0; i < dimm_count; i++)
+		{
+			free(p_dimms[i].p_config);
+		}
+		free(p_dimms);
+		free(p_devices);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -116,13 +447,13 @@ int diag_platform_config_check(const struct diagnostic *p_diagnostic, NVM_UINT32
 }
 
 /*
- * get nvm capabilities from the CR platform capability table
+ * check the nvm capabilities read from the CR platform capability table
  */
-int get_nvm_capabilities_from_pcat(NVM_UINT32 *p_results, struct nvm_capabilities *p_nvm_caps)
+int check_nvm_capabilities_from_pcat(NVM_UINT32 *p_results, const int caps_rc)
 {
 	COMMON_LOG_ENTRY();
 
-	int rc = nvm_get_nvm_capabilities(p_nvm_caps);
+	int rc = caps_rc;
 	if (rc != NVM_SUCCESS)
 	{
 		// returns success only if the platform capability table is retrieved and
@@ -272,7 +603,7 @@ void check_interleave_sets(struct current_config_table *p_current_config,
 									EVENT_TYPE_DIAG_PLATFORM_CONFIG,
 									EVENT_SEVERITY_WARN,
 									EVENT_CODE_DIAG_PCONFIG_BROKEN_ISET,
-									NULL, 0,
+									dimm_uid, 0,
 									set_index_str,
 									dimm_identifier, NULL,
 									DIAGNOSTIC_RESULT_FAILED);
@@ -622,17 +953,20 @@ void check_goal_sku_violations(NVM_UINT32 *p_results,
 }
 
 int check_platform_config_data_for_device(NVM_UINT32* p_results,
-		struct device_discovery *p_device,
-		const struct diagnostic *p_diagnostic)
+		struct pconfig_diag_dimm *p_dimm,
+		const struct diagnostic *p_diagnostic,
+		const int caps_rc,
+		const struct nvm_capabilities *p_capabilities)
 {
 	COMMON_LOG_ENTRY();
 
+	struct device_discovery *p_device = p_dimm->p_device;
 	NVM_UID uid_str;
 	uid_copy(p_device->uid, uid_str);
 
-	// fetch the platform config tables for the DIMM
-	struct platform_config_data *p_config = NULL;
-	int rc = get_dimm_platform_config(p_device->device_handle, &p_config);
+	// the platform config tables for the DIMM were fetched up front
+	struct platform_config_data *p_config = p_dimm->p_config;
+	int rc = p_dimm->pcd_rc;
 	if (rc != NVM_SUCCESS)
 	{
 		if (!(p_diagnostic->excludes & DIAG_THRESHOLD_PCONFIG_PCD))
@@ -663,69 +997,46 @@ int check_platform_config_data_for_device(NVM_UINT32* p_results,
 
 		check_for_unapplied_config_goal(p_results, p_device, p_config);
 
-		struct nvm_capabilities capabilities;
-		int tmprc = nvm_get_nvm_capabilities(&capabilities);
-		if (tmprc != NVM_SUCCESS)
+		if (caps_rc != NVM_SUCCESS)
 		{
-			KEEP_ERROR(rc, tmprc);
+			KEEP_ERROR(rc, caps_rc);
 		}
 		else
 		{
 			// check for SKU violations
-			check_current_sku_violations(p_results, p_device, p_config, &capabilities);
-			check_goal_sku_violations(p_results, p_device, p_config, &capabilities);
+			check_current_sku_violations(p_results, p_device, p_config, p_capabilities);
+			check_goal_sku_violations(p_results, p_device, p_config, p_capabilities);
 		}
 
 	}
 
-	if (p_config)
-	{
-		free(p_config);
-	}
-
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
 
 /*
- * verify the platform config data
+ * verify the platform config data of the DIMMs whose stored results can't be reused
  */
-int verify_pcd(int dev_count, const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
+int verify_pcd(struct pconfig_diag_dimm *p_dimms, const int dimm_count,
+		const struct diagnostic *p_diagnostic, const int caps_rc,
+		const struct nvm_capabilities *p_caps, NVM_UINT32 *p_results)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	if (dev_count > 0)
+	for (int current_dev = 0; current_dev < dimm_count; current_dev++)
 	{
-		// get device_discovery information of all dimms
-		struct device_discovery *dimms =  malloc(dev_count * sizeof(struct device_discovery));
-		dev_count = nvm_get_devices(dimms, dev_count);
-		if (dev_count > 0)
+		struct pconfig_diag_dimm *p_dimm = &(p_dimms[current_dev]);
+		// don't bother with unmanageable DIMMs, or those with results kept
+		if (p_dimm->p_device->manageability == MANAGEMENT_VALIDCONFIG && p_dimm->changed)
 		{
-			rc = NVM_SUCCESS;
-			for (int current_dev = 0; current_dev < dev_count; current_dev++)
-			{
-				// don't bother with unmanageable DIMMs
-				if (dimms[current_dev].manageability == MANAGEMENT_VALIDCONFIG)
-				{
-					KEEP_ERROR(rc,
-							check_platform_config_data_for_device(p_results,
-								&(dimms[current_dev]),
-								p_diagnostic));
-				}
-			}
-		}
-		else // nvm_get_devices failed
-		{
-			rc = dev_count;
+			NVM_UINT32 results_before = *p_results;
+			KEEP_ERROR(rc,
+					check_platform_config_data_for_device(p_results,
+						p_dimm, p_diagnostic, caps_rc, p_caps));
+			p_dimm->result_count = *p_results - results_before;
 		}
-
-        free(dimms);
-	}
-	else // nvm_get_device_count failed
-	{
-		rc = dev_count;
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
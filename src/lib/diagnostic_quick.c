@@ -44,6 +44,9 @@
 #include "device_utilities.h"
 #include "capabilities.h"
 #include "device_fw.h"
+#include <stdlib.h>
+#include <os/os_adapter.h>
+#include <time/time_utilities.h>
 
 enum major_status_code
 {
@@ -53,23 +56,75 @@ enum major_status_code
 	INIT_MJ_INIT_COMPLETE = 0XF0, // FW initialization complete
 };
 
-void generate_event_for_bad_driver(NVM_UINT32 *p_results);
+/*
+ * Config values used by every DIMM, read once per run
+ */
+struct quick_diag_config
+{
+	int max_health_status;
+	int percent_used_threshold;
+};
+
+struct quick_diag_work
+{
+	const struct device_discovery *p_devices;
+	const struct diagnostic *p_diagnostic;
+	const struct quick_diag_config *p_config;
+	struct diag_results *p_results;
+	int *p_rcs;
+};
+
+void generate_event_for_bad_driver(struct diag_results *p_results);
+int check_dimm_quick_health(const struct device_discovery *p_discovery,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
 int check_dimm_manageability(const NVM_UID device_uid,
-		struct device_discovery *p_discovery,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results);
-int check_dimm_health(const NVM_UID device_uid, const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results);
-int check_ddrt_io_init_done(const NVM_UID device_uid,const NVM_NFIT_DEVICE_HANDLE device_handle,
-	NVM_UINT32 *p_results);
-int check_dimm_bsr(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results);
-int check_dimm_viral_state(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results);
-int check_dimm_fw_update_status(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results);
+		const struct device_discovery *p_discovery,
+		const struct diagnostic *p_diagnostic, struct diag_results *p_results);
+int check_dimm_health(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
+int check_ddrt_io_init_done(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
+int check_dimm_bsr(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
+int check_dimm_viral_state(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
+int check_dimm_fw_update_status(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results);
+
+/*
+ * A per-DIMM check and the FW payloads it reads. The payloads are fetched
+ * before the check runs unless an earlier check already fetched them.
+ */
+struct quick_diag_check
+{
+	const char *name;
+	NVM_UINT32 payloads;
+	int (*check)(const struct diag_dimm_data *p_data,
+			const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+			struct diag_results *p_results);
+};
+
+static const struct quick_diag_check QUICK_DIAG_CHECKS[] =
+{
+	{"BSR", DIAG_PAYLOAD_BSR, check_dimm_bsr},
+	{"health", DIAG_PAYLOAD_SMART_HEALTH | DIAG_PAYLOAD_ALARM_THRESHOLDS, check_dimm_health},
+	{"viral state", DIAG_PAYLOAD_CONFIG_DATA_POLICY, check_dimm_viral_state},
+	{"FW update status", DIAG_PAYLOAD_FW_IMAGE_INFO, check_dimm_fw_update_status},
+	{"DDRT IO init", DIAG_PAYLOAD_DDRT_IO_INIT | DIAG_PAYLOAD_BSR, check_ddrt_io_init_done}
+};
+
+static void get_quick_diag_config(struct quick_diag_config *p_config)
+{
+	memset(p_config, 0, sizeof (struct quick_diag_config));
+	get_config_value_int(SQL_KEY_MAX_HEALTH_STATUS, &p_config->max_health_status);
+	get_config_value_int(SQL_KEY_PERCENT_USED_THRESHOLD, &p_config->percent_used_threshold);
+}
 
 /*
  * Run the quick health check diagnostic algorithm
@@ -79,6 +134,8 @@ int diag_quick_health_check(const NVM_UID device_uid,
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
+	struct diag_results results;
+	diag_init_results(EVENT_TYPE_DIAG_QUICK, &results);
 
 	*p_results = 0;
 
@@ -97,7 +154,7 @@ int diag_quick_health_check(const NVM_UID device_uid,
 		if (!is_supported_driver_available())
 		{
 			rc = NVM_ERR_BADDRIVER;
-			generate_event_for_bad_driver(p_results);
+			generate_event_for_bad_driver(&results);
 		}
 		else if ((rc = IS_NVM_FEATURE_SUPPORTED(quick_diagnostic)) != NVM_SUCCESS)
 		{
@@ -108,71 +165,181 @@ int diag_quick_health_check(const NVM_UID device_uid,
 			struct device_discovery discovery;
 			if ((rc = lookup_dev_uid(device_uid, &discovery)) == NVM_SUCCESS)
 			{
-				rc = check_dimm_manageability(device_uid, &discovery,
-									p_diagnostic, p_results);
+				struct quick_diag_config config;
+				get_quick_diag_config(&config);
+				rc = check_dimm_quick_health(&discovery, p_diagnostic, &config, &results);
+			} // DIMM does not exist
+		}
+
+		*p_results = results.count;
+		diag_store_results(&results);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
 
-				if (IS_DEVICE_MANAGEABLE(&discovery))
-				{
-					int tmp_rc = 0;
-					NVM_NFIT_DEVICE_HANDLE device_handle =
-					discovery.device_handle;
+static void quick_health_check_worker(void *arg, COMMON_UINT32 index)
+{
+	struct quick_diag_work *p_work = (struct quick_diag_work *)arg;
+	p_work->p_rcs[index] = check_dimm_quick_health(&p_work->p_devices[index],
+			p_work->p_diagnostic, p_work->p_config, &p_work->p_results[index]);
+}
+
+/*
+ * Run the quick health check diagnostic on all DIMMs, checking the DIMMs
+ * in parallel and storing all of the results together
+ */
+int diag_quick_health_check_all(const struct diagnostic *p_diagnostic,
+		NVM_UINT32 *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct diag_results results;
+	diag_init_results(EVENT_TYPE_DIAG_QUICK, &results);
+
+	*p_results = 0;
 
-					tmp_rc = check_dimm_bsr(device_uid, device_handle,
+	// every previous result is replaced
+	diag_clear_results(EVENT_TYPE_DIAG_QUICK, 0, NULL);
+
+	int dev_count = 0;
+	if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+		generate_event_for_bad_driver(&results);
+	}
+	else if ((rc = IS_NVM_FEATURE_SUPPORTED(quick_diagnostic)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("The quick health diagnostic is not supported.");
+	}
+	else if ((dev_count = nvm_get_device_count()) < 0)
+	{
+		rc = dev_count;
+	}
+	else if (dev_count > 0)
+	{
+		struct device_discovery *p_devices =
+				calloc(dev_count, sizeof (struct device_discovery));
+		struct diag_results *p_dimm_results =
+				calloc(dev_count, sizeof (struct diag_results));
+		int *p_rcs = calloc(dev_count, sizeof (int));
+		if (!p_devices || !p_dimm_results || !p_rcs)
+		{
+			COMMON_LOG_ERROR("Failed to allocate memory for the quick diagnostic");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if ((dev_count = nvm_get_devices(p_devices, dev_count)) < 0)
+		{
+			rc = dev_count;
+		}
+		else
+		{
+			struct quick_diag_config config;
+			get_quick_diag_config(&config);
+			for (int i = 0; i < dev_count; i++)
+			{
+				diag_init_results(EVENT_TYPE_DIAG_QUICK, &p_dimm_results[i]);
+			}
+
+			struct quick_diag_work work;
+			work.p_devices = p_devices;
+			work.p_diagnostic = p_diagnostic;
+			work.p_config = &config;
+			work.p_results = p_dimm_results;
+			work.p_rcs = p_rcs;
+
+			// each DIMM is independent
+			run_parallel(dev_count, PARALLEL_MAX_THREADS, quick_health_check_worker, &work);
+
+			// keep the results in DIMM order
+			for (int i = 0; i < dev_count; i++)
+			{
+				KEEP_ERROR(rc, p_rcs[i]);
+				diag_append_results(&results, &p_dimm_results[i]);
+			}
+		}
+		free(p_rcs);
+		free(p_dimm_results);
+		free(p_devices);
+	}
+
+	*p_results = results.count;
+	diag_store_results(&results);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Run all of the quick health checks on one DIMM
+ */
+int check_dimm_quick_health(const struct device_discovery *p_discovery,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	NVM_UINT32 result_count = p_results->count;
+
+	rc = check_dimm_manageability(p_discovery->uid, p_discovery,
 						p_diagnostic, p_results);
-					KEEP_ERROR(rc, tmp_rc);
-					tmp_rc = check_dimm_health(device_uid,
-						device_handle, p_diagnostic, p_results);
-					KEEP_ERROR(rc, tmp_rc);
-
-					tmp_rc = check_dimm_viral_state(device_uid,
-						device_handle, p_diagnostic, p_results);
-					KEEP_ERROR(rc, tmp_rc);
-
-					tmp_rc = check_dimm_fw_update_status(device_uid,
-						device_handle, p_diagnostic, p_results);
-					KEEP_ERROR(rc, tmp_rc);
-
-					tmp_rc = check_ddrt_io_init_done(device_uid,
-						device_handle,p_results);
-					KEEP_ERROR(rc, tmp_rc);
-				}
-			} // DIMM does not exist
+
+	if (IS_DEVICE_MANAGEABLE(p_discovery))
+	{
+		struct diag_dimm_data data;
+		diag_init_dimm_data(p_discovery, &data);
+
+		int check_count = sizeof (QUICK_DIAG_CHECKS) / sizeof (QUICK_DIAG_CHECKS[0]);
+		for (int i = 0; i < check_count; i++)
+		{
+			// the time of a check includes fetching any payload it is the first to need
+			unsigned long long start_time = 0;
+			unsigned long long end_time = 0;
+			get_current_time_msec(&start_time);
+
+			diag_fetch_dimm_data(&data, QUICK_DIAG_CHECKS[i].payloads);
+			int tmp_rc = QUICK_DIAG_CHECKS[i].check(&data, p_diagnostic, p_config, p_results);
+			KEEP_ERROR(rc, tmp_rc);
+
+			get_current_time_msec(&end_time);
+			COMMON_LOG_DEBUG_F("Quick diagnostic %s check on DIMM %s took %llu ms, rc %d",
+					QUICK_DIAG_CHECKS[i].name, p_discovery->uid,
+					end_time - start_time, tmp_rc);
 		}
 	}
 
-	if ((rc == NVM_SUCCESS) && (*p_results == 0)) // No errors/warnings
+	if ((rc == NVM_SUCCESS) && (p_results->count == result_count)) // No errors/warnings
 	{
 		// store success event
-		store_event_by_parts(
-			EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(
+			p_results,
 			EVENT_SEVERITY_INFO,
 			EVENT_CODE_DIAG_QUICK_SUCCESS,
-			device_uid,
+			p_discovery->uid,
 			0,
 			NULL,
 			NULL,
 			NULL,
 			DIAGNOSTIC_RESULT_OK);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
-void generate_event_for_bad_driver(NVM_UINT32 *p_results)
+void generate_event_for_bad_driver(struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
-	store_event_by_parts(
-			EVENT_TYPE_DIAG_QUICK,
+	diag_add_result(
+			p_results,
 			EVENT_SEVERITY_CRITICAL,
 			EVENT_CODE_DIAG_QUICK_BAD_DRIVER,
 			NULL,
 			1, // Action required
 			NULL, NULL, NULL,
 			DIAGNOSTIC_RESULT_FAILED);
-	(*p_results)++;
 
 	COMMON_LOG_EXIT();
 }
@@ -180,7 +347,8 @@ void generate_event_for_bad_driver(NVM_UINT32 *p_results)
 void generate_event_for_non_manageable_dimm_with_hex_value(
 		const int event_code,
 		const NVM_UID uid,
-		const NVM_UINT16 hex_value)
+		const NVM_UINT16 hex_value,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
@@ -188,8 +356,8 @@ void generate_event_for_non_manageable_dimm_with_hex_value(
 	s_snprintf(hex_value_str, sizeof (hex_value_str),
 			"0x%X", hex_value);
 
-	store_event_by_parts(
-			EVENT_TYPE_DIAG_QUICK,
+	diag_add_result(
+			p_results,
 			EVENT_SEVERITY_WARN,
 			event_code,
 			uid,
@@ -200,7 +368,7 @@ void generate_event_for_non_manageable_dimm_with_hex_value(
 	COMMON_LOG_EXIT();
 }
 
-NVM_BOOL is_device_fw_api_revision_supported(NVM_VERSION fw_api_version)
+NVM_BOOL is_device_fw_api_revision_supported(const NVM_VERSION fw_api_version)
 {
 	COMMON_LOG_ENTRY();
 
@@ -215,8 +383,8 @@ NVM_BOOL is_device_fw_api_revision_supported(NVM_VERSION fw_api_version)
 }
 
 int check_dimm_manageability(const NVM_UID device_uid,
-		struct device_discovery *p_discovery,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results)
+		const struct device_discovery *p_discovery,
+		const struct diagnostic *p_diagnostic, struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
@@ -227,8 +395,8 @@ int check_dimm_manageability(const NVM_UID device_uid,
 		generate_event_for_non_manageable_dimm_with_hex_value(
 				EVENT_CODE_DIAG_QUICK_NOT_MANAGEABLE_VENDOR_ID,
 				device_uid,
-				p_discovery->subsystem_vendor_id);
-		(*p_results)++;
+				p_discovery->subsystem_vendor_id,
+				p_results);
 	}
 	else if (!is_subsystem_device_id_supported(p_discovery->subsystem_device_id))
 	{
@@ -236,42 +404,41 @@ int check_dimm_manageability(const NVM_UID device_uid,
 		generate_event_for_non_manageable_dimm_with_hex_value(
 				EVENT_CODE_DIAG_QUICK_NOT_MANAGEABLE_DEVICE_ID,
 				device_uid,
-				p_discovery->subsystem_device_id);
-		(*p_results)++;
+				p_discovery->subsystem_device_id,
+				p_results);
 	}
 	else if (!is_device_fw_api_revision_supported(p_discovery->fw_api_version))
 	{
 		rc = NVM_ERR_NOTMANAGEABLE;
-		store_event_by_parts(
-				EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(
+				p_results,
 				EVENT_SEVERITY_WARN,
 				EVENT_CODE_DIAG_QUICK_NOT_MANAGEABLE_FW_API,
 				device_uid,
 				0, // Action required
 				device_uid, p_discovery->fw_api_version, NULL,
 				DIAGNOSTIC_RESULT_ABORTED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
-int check_dimm_alarm_thresholds(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		struct pt_payload_smart_health *p_dimm_smart,
-		const struct diagnostic *p_diagnostic, NVM_UINT32* p_results)
+int check_dimm_alarm_thresholds(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
+	const char *device_uid = p_data->p_discovery->uid;
+	const struct pt_payload_smart_health *p_dimm_smart = &p_data->smart_health;
 
 	// check alarm thresholds
-	struct pt_payload_alarm_thresholds thresholds;
-	if (NVM_SUCCESS
-			== (rc = fw_get_alarm_thresholds(device_handle.handle, &thresholds)))
+	const struct pt_payload_alarm_thresholds *p_thresholds = &p_data->alarm_thresholds;
+	if (NVM_SUCCESS == (rc = p_data->alarm_thresholds_rc))
 	{
 		// check media temperature to alarm threshold
-		NVM_UINT64 media_temp_threshold = thresholds.media_temperature;
+		NVM_UINT64 media_temp_threshold = p_thresholds->media_temperature;
 		if (p_dimm_smart->validation_flags.parts.media_temperature_field &&
 				!diag_check(p_diagnostic, DIAG_THRESHOLD_QUICK_MEDIA_TEMP,
 						p_dimm_smart->media_temperature,
@@ -284,7 +451,7 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 			s_snprintf(actual_temp_str, 10, "%.4f", actual);
 			char expected_temp_str[10];
 			s_snprintf(expected_temp_str, 10, "%.4f", media_threshold);
-			store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+			diag_add_result(p_results,
 					EVENT_SEVERITY_WARN,
 					EVENT_CODE_DIAG_QUICK_BAD_MEDIA_TEMP,
 					device_uid,
@@ -292,11 +459,10 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 					device_uid,
 					actual_temp_str,
 					expected_temp_str, DIAGNOSTIC_RESULT_WARNING);
-			(*p_results)++;
 		}
 
 		// check controller temperature to alarm threshold
-		NVM_UINT64 controller_temp_threshold = thresholds.controller_temperature;
+		NVM_UINT64 controller_temp_threshold = p_thresholds->controller_temperature;
 		if (p_dimm_smart->validation_flags.parts.controller_temperature_field &&
 				!diag_check(p_diagnostic, DIAG_THRESHOLD_QUICK_CONTROLLER_TEMP,
 						p_dimm_smart->controller_temperature,
@@ -311,7 +477,7 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 			s_snprintf(actual_temp_str, 10, "%.4f", actual);
 			char expected_temp_str[10];
 			s_snprintf(expected_temp_str, 10, "%.4f", controller_threshold);
-			store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+			diag_add_result(p_results,
 					EVENT_SEVERITY_WARN,
 					EVENT_CODE_DIAG_QUICK_BAD_CORE_TEMP,
 					device_uid,
@@ -319,11 +485,10 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 					device_uid,
 					actual_temp_str,
 					expected_temp_str, DIAGNOSTIC_RESULT_WARNING);
-			(*p_results)++;
 		}
 
 		// check spare capacity to alarm threshold
-		NVM_UINT64 spare_threshold = thresholds.spare;
+		NVM_UINT64 spare_threshold = p_thresholds->spare;
 		if (p_dimm_smart->validation_flags.parts.spare_block_field &&
 				!diag_check(p_diagnostic, DIAG_THRESHOLD_QUICK_AVAIL_SPARE, p_dimm_smart->spare,
 				&spare_threshold, EQUALITY_GREATERTHANEQUAL))
@@ -332,7 +497,7 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 			s_snprintf(actual_spare_str, 10, "%u", p_dimm_smart->spare);
 			char expected_spare_str[10];
 			s_snprintf(expected_spare_str, 10, "%u", spare_threshold);
-			store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+			diag_add_result(p_results,
 					EVENT_SEVERITY_WARN,
 					EVENT_CODE_DIAG_QUICK_BAD_SPARE,
 					device_uid,
@@ -341,13 +506,10 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 					actual_spare_str,
 					expected_spare_str,
 					DIAGNOSTIC_RESULT_WARNING);
-			(*p_results)++;
 		}
 
 		// check percent used to threshold
-		int percent_used_threshold_config = 0;
-		get_config_value_int(SQL_KEY_PERCENT_USED_THRESHOLD, &percent_used_threshold_config);
-		NVM_UINT64 percent_used_threshold = percent_used_threshold_config;
+		NVM_UINT64 percent_used_threshold = p_config->percent_used_threshold;
 		if (p_dimm_smart->validation_flags.parts.percentage_used_field &&
 				!diag_check(p_diagnostic, DIAG_THRESHOLD_QUICK_PERC_USED,
 				p_dimm_smart->percentage_used, &percent_used_threshold, EQUALITY_LESSTHAN))
@@ -357,7 +519,7 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 			s_snprintf(actual_percent_str, 10, "%u", p_dimm_smart->percentage_used);
 			char expected_percent_str[10];
 			s_snprintf(expected_percent_str, 10, "%u", percent_used_threshold);
-			store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+			diag_add_result(p_results,
 					EVENT_SEVERITY_WARN,
 					EVENT_CODE_DIAG_QUICK_BAD_PERCENT_USED,
 					device_uid,
@@ -366,7 +528,6 @@ int check_dimm_alarm_thresholds(const NVM_UID device_uid,
 					actual_percent_str,
 					expected_percent_str,
 					DIAGNOSTIC_RESULT_WARNING);
-			(*p_results)++;
 		}
 	}
 
@@ -383,11 +544,11 @@ void dimm_smart_health_status_to_string(const enum smart_health_status health_st
 }
 
 void check_dimm_smart_health_status(const struct diagnostic *p_diagnostic,
-		struct pt_payload_smart_health *p_dimm_smart, const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		const struct quick_diag_config *p_config,
+		const struct pt_payload_smart_health *p_dimm_smart, const NVM_UID device_uid,
+		struct diag_results *p_results)
 {
-	int max_health_status_config = 0;
-	get_config_value_int(SQL_KEY_MAX_HEALTH_STATUS, &max_health_status_config);
+	int max_health_status_config = p_config->max_health_status;
 	NVM_UINT64 max_health_status = max_health_status_config;
 	if (p_dimm_smart->validation_flags.parts.health_status_field &&
 			!diag_check(p_diagnostic, DIAG_THRESHOLD_QUICK_HEALTH, p_dimm_smart->health_status,
@@ -400,7 +561,7 @@ void check_dimm_smart_health_status(const struct diagnostic *p_diagnostic,
 		dimm_smart_health_status_to_string(max_health_status_config,
 				expected_health_str, sizeof (expected_health_str));
 
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_WARN,
 				EVENT_CODE_DIAG_QUICK_BAD_HEALTH,
 				device_uid,
@@ -409,20 +570,19 @@ void check_dimm_smart_health_status(const struct diagnostic *p_diagnostic,
 				actual_health_str,
 				expected_health_str,
 				DIAGNOSTIC_RESULT_WARNING);
-		(*p_results)++;
 	}
 }
 
 void check_media_disabled_status(const struct diagnostic *p_diagnostic,
 		const unsigned long long bsr,
 		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
 	if (BSR_MEDIA_DISABLED(bsr))
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_MEDIA_DISABLED,
 				device_uid,
@@ -431,7 +591,6 @@ void check_media_disabled_status(const struct diagnostic *p_diagnostic,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
@@ -440,7 +599,7 @@ void check_media_disabled_status(const struct diagnostic *p_diagnostic,
 void check_media_ready_status(const struct diagnostic *p_diagnostic,
 		const unsigned long long bsr,
 		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
@@ -456,7 +615,7 @@ void check_media_ready_status(const struct diagnostic *p_diagnostic,
 
 	if (code != EVENT_CODE_DIAG_QUICK_UNKNOWN)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				code,
 				device_uid,
@@ -465,7 +624,6 @@ void check_media_ready_status(const struct diagnostic *p_diagnostic,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
@@ -474,7 +632,7 @@ void check_media_ready_status(const struct diagnostic *p_diagnostic,
 void check_fw_boot_status(const struct diagnostic *p_diagnostic,
 		const unsigned long long bsr,
 		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
@@ -501,7 +659,7 @@ void check_fw_boot_status(const struct diagnostic *p_diagnostic,
 
 	if (code != EVENT_CODE_DIAG_QUICK_UNKNOWN)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				code,
 				device_uid,
@@ -510,7 +668,6 @@ void check_fw_boot_status(const struct diagnostic *p_diagnostic,
 				checkpoint_str,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
@@ -519,13 +676,13 @@ void check_fw_boot_status(const struct diagnostic *p_diagnostic,
 void check_fw_assert(const struct diagnostic *p_diagnostic,
 		const unsigned long long bsr,
 		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
 	if (BSR_H_ASSERTION(bsr))
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_FW_HIT_ASSERT,
 				device_uid,
@@ -534,7 +691,6 @@ void check_fw_assert(const struct diagnostic *p_diagnostic,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
@@ -543,13 +699,13 @@ void check_fw_assert(const struct diagnostic *p_diagnostic,
 void check_fw_stalled(const struct diagnostic *p_diagnostic,
 		const unsigned long long bsr,
 		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 
 	if (BSR_H_MI_STALLED(bsr))
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_FW_STALLED,
 				device_uid,
@@ -558,25 +714,23 @@ void check_fw_stalled(const struct diagnostic *p_diagnostic,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
 }
 
-int check_dimm_viral_state(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
+int check_dimm_viral_state(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
+	int rc = p_data->config_data_policy_rc;
+	const char *device_uid = p_data->p_discovery->uid;
 
-	struct pt_payload_get_config_data_policy config_data;
-	rc = fw_get_config_data_policy(device_handle.handle, &config_data);
 	if ((rc == NVM_SUCCESS) &&
-			(config_data.viral_status))
+			(p_data->config_data_policy.viral_status))
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_VIRAL_STATE,
 				device_uid,
@@ -585,7 +739,6 @@ int check_dimm_viral_state(const NVM_UID device_uid,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -593,61 +746,49 @@ int check_dimm_viral_state(const NVM_UID device_uid,
 }
 
 void check_ait_dram_not_ready(const unsigned long long bsr,
-		const NVM_UID device_uid,
-		NVM_UINT32 *p_results)
+		const struct device_discovery *p_discovery,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
-	struct device_discovery discovery;
 	NVM_BOOL ait_dram_ready = 0;
-	NVM_UINT16 event_code = EVENT_CODE_DIAG_QUICK_AIT_DRAM_NOT_READY;
 
-	if (NVM_SUCCESS != nvm_get_device_discovery(device_uid, &discovery))
+	if (atof(p_discovery->fw_api_version) >= FIS_1_5)
 	{
-		event_code = EVENT_CODE_DIAG_QUICK_UNKNOWN;
+		ait_dram_ready = (BSR_H_AIT_DRAM_READY_1_5(bsr) == DEV_FW_BSR_AIT_DRAM_TRAINED_READY) ? 1 : 0;
 	}
 	else
 	{
-		if (atof(discovery.fw_api_version) >= FIS_1_5)
-		{
-			ait_dram_ready = (BSR_H_AIT_DRAM_READY_1_5(bsr) == DEV_FW_BSR_AIT_DRAM_TRAINED_READY) ? 1 : 0;
-		}
-		else
-		{
-			ait_dram_ready = (BSR_H_AIT_DRAM_READY(bsr)) ? 1 : 0;
-		}
+		ait_dram_ready = (BSR_H_AIT_DRAM_READY(bsr)) ? 1 : 0;
 	}
 	if (!ait_dram_ready)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 			EVENT_SEVERITY_CRITICAL,
-			event_code,
-			device_uid,
+			EVENT_CODE_DIAG_QUICK_AIT_DRAM_NOT_READY,
+			p_discovery->uid,
 			1,
-			device_uid,
+			p_discovery->uid,
 			NULL,
 			NULL,
 			DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
 }
 
-int check_ddrt_io_init_done(const NVM_UID device_uid,const NVM_NFIT_DEVICE_HANDLE device_handle,
-	NVM_UINT32 *p_results)
+int check_ddrt_io_init_done(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
-	struct device_discovery discovery;
+	const struct device_discovery *p_discovery = p_data->p_discovery;
 	NVM_BOOL test_passed = 0;
-	struct pt_payload_ddrt_init_info p_ddrt_init_info;
-	unsigned long long bsr = 0;
 	int rc = NVM_SUCCESS;
-	nvm_get_device_discovery(device_uid, &discovery);
-	if (atof(discovery.fw_api_version) >= 1.6)
+	if (atof(p_discovery->fw_api_version) >= 1.6)
 	{
-		if (NVM_SUCCESS == (rc = fw_get_ddrt_io_init(device_handle.handle,&p_ddrt_init_info)))
+		if (NVM_SUCCESS == (rc = p_data->ddrt_io_init_rc))
 		{
-			if(p_ddrt_init_info.ddrt_training_status!=DDRT_TRAINING_COMPLETE)
+			if(p_data->ddrt_io_init.ddrt_training_status!=DDRT_TRAINING_COMPLETE)
 			{
 				test_passed = 0;
 			}
@@ -659,40 +800,39 @@ int check_ddrt_io_init_done(const NVM_UID device_uid,const NVM_NFIT_DEVICE_HANDL
 	}
 	else
 	{
-	    rc = fw_get_bsr(device_handle, &bsr);
-		test_passed = (BSR_DDRT_IO_INIT_STATUS(bsr) == BSR_DDRT_NOT_READY) ? 0 : 1;
+		rc = p_data->bsr_rc;
+		test_passed = (BSR_DDRT_IO_INIT_STATUS(p_data->bsr) == BSR_DDRT_NOT_READY) ? 0 : 1;
 	}
 
 	if (!test_passed)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 			EVENT_SEVERITY_CRITICAL,
 			EVENT_CODE_DIAG_QUICK_DDRT_IO_INIT_FAILED,
-			device_uid,
+			p_discovery->uid,
 			1,
-			device_uid,
+			p_discovery->uid,
 			NULL,
 			NULL,
 			DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT();
     return rc;
 }
 
-int check_dimm_bsr(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
+int check_dimm_bsr(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
+	int rc = p_data->bsr_rc;
+	unsigned long long bsr = p_data->bsr;
+	const char *device_uid = p_data->p_discovery->uid;
 
-	unsigned long long bsr = 0;
-	rc = fw_get_bsr(device_handle, &bsr);
 	if (rc != NVM_SUCCESS)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_UNREADABLE_BSR,
 				device_uid,
@@ -701,7 +841,6 @@ int check_dimm_bsr(const NVM_UID device_uid,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 	else
 	{
@@ -710,21 +849,21 @@ int check_dimm_bsr(const NVM_UID device_uid,
 		check_fw_boot_status(p_diagnostic, bsr, device_uid, p_results);
 		check_fw_assert(p_diagnostic, bsr, device_uid, p_results);
 		check_fw_stalled(p_diagnostic, bsr, device_uid, p_results);
-		check_ait_dram_not_ready(bsr, device_uid, p_results);
+		check_ait_dram_not_ready(bsr, p_data->p_discovery, p_results);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
-void check_dimm_ait_dram_status(struct pt_payload_smart_health *p_dimm_smart,
-		const NVM_UID device_uid, NVM_UINT32 *p_results)
+void check_dimm_ait_dram_status(const struct pt_payload_smart_health *p_dimm_smart,
+		const NVM_UID device_uid, struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 	if (p_dimm_smart->validation_flags.parts.ait_dram_status_field &&
 		p_dimm_smart->ait_dram_status == AIT_DRAM_DISABLED)
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_AIT_DRAM_DISABLED,
 				device_uid,
@@ -732,27 +871,25 @@ void check_dimm_ait_dram_status(struct pt_payload_smart_health *p_dimm_smart,
 				device_uid,
 				NULL,
 				NULL, DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 	COMMON_LOG_EXIT();
 }
 
-int check_dimm_health(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
+int check_dimm_health(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
+	const char *device_uid = p_data->p_discovery->uid;
 
-	struct pt_payload_smart_health dimm_smart;
-	if (NVM_SUCCESS == (rc =
-			fw_get_smart_health(device_handle.handle, &dimm_smart)))
+	if (NVM_SUCCESS == (rc = p_data->smart_health_rc))
 	{
-		check_dimm_smart_health_status(p_diagnostic, &dimm_smart, device_uid, p_results);
-		check_dimm_ait_dram_status(&dimm_smart, device_uid, p_results);
+		check_dimm_smart_health_status(p_diagnostic, p_config, &p_data->smart_health,
+				device_uid, p_results);
+		check_dimm_ait_dram_status(&p_data->smart_health, device_uid, p_results);
 
-		rc = check_dimm_alarm_thresholds(device_uid, device_handle, &dimm_smart,
-				p_diagnostic, p_results);
+		rc = check_dimm_alarm_thresholds(p_data, p_diagnostic, p_config, p_results);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -780,19 +917,18 @@ NVM_BOOL errors_exceed_threshold(const struct diagnostic *p_diagnostic,
 			media_errors, &error_threshold, EQUALITY_LESSTHANEQUAL);
 }
 
-int check_dimm_fw_update_status(const NVM_UID device_uid,
-		const NVM_NFIT_DEVICE_HANDLE device_handle,
-		const struct diagnostic *p_diagnostic, NVM_UINT32 *p_results)
+int check_dimm_fw_update_status(const struct diag_dimm_data *p_data,
+		const struct diagnostic *p_diagnostic, const struct quick_diag_config *p_config,
+		struct diag_results *p_results)
 {
 	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
+	int rc = p_data->fw_image_info_rc;
+	const char *device_uid = p_data->p_discovery->uid;
 
-	struct pt_payload_fw_image_info fw_image_info;
-	rc = fw_get_fw_image_info(device_handle.handle, &fw_image_info);
 	if ((rc == NVM_SUCCESS) &&
-			(fw_image_info.last_fw_update_status == LAST_FW_UPDATE_LOAD_FAILED))
+			(p_data->fw_image_info.last_fw_update_status == LAST_FW_UPDATE_LOAD_FAILED))
 	{
-		store_event_by_parts(EVENT_TYPE_DIAG_QUICK,
+		diag_add_result(p_results,
 				EVENT_SEVERITY_CRITICAL,
 				EVENT_CODE_DIAG_QUICK_FW_LOAD_FAILED,
 				device_uid,
@@ -801,7 +937,6 @@ int check_dimm_fw_update_status(const NVM_UID device_uid,
 				NULL,
 				NULL,
 				DIAGNOSTIC_RESULT_FAILED);
-		(*p_results)++;
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -393,6 +393,10 @@ int nvm_get_error(const enum return_code code, NVM_ERROR_DESCRIPTION description
 				s_strcpy(description, TR("The operation timed out."),
 						description_len);
 				break;
+			case NVM_ERR_CANCELED:
+				s_strcpy(description, TR("The operation was canceled."),
+						description_len);
+				break;
 			default:
 				s_strcpy(description, TR("The return code is not valid."),
 						description_len);
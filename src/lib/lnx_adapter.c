@@ -330,24 +330,22 @@ int get_smbios_inventory_count()
 	COMMON_LOG_ENTRY();
 	int rc = 0;
 
-	NVM_UINT8 *p_smbios_table = NULL;
-	size_t smbios_table_size = 0;
-	rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
+	struct smbios_memory_device_index *p_index = NULL;
+	rc = get_smbios_memory_device_index(&p_index);
 	if (rc == NVM_SUCCESS)
 	{
-		rc = smbios_get_populated_memory_device_count(p_smbios_table, smbios_table_size);
+		rc = p_index->populated_count;
 	}
 
-	if (p_smbios_table)
+	if (p_index)
 	{
-		free(p_smbios_table);
+		free(p_index);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
-
 int get_smbios_inventory(const NVM_UINT8 count, struct nvm_details *p_smbios_inventory)
 {
 	COMMON_LOG_ENTRY();
@@ -362,18 +360,16 @@ int get_smbios_inventory(const NVM_UINT8 count, struct nvm_details *p_smbios_inv
 	{
 		memset(p_smbios_inventory, 0, sizeof (struct nvm_details) * count);
 
-		NVM_UINT8 *p_smbios_table = NULL;
-		size_t smbios_table_size = 0;
-		rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
+		struct smbios_memory_device_index *p_index = NULL;
+		rc = get_smbios_memory_device_index(&p_index);
 		if (rc == NVM_SUCCESS)
 		{
-			rc = smbios_table_to_nvm_details_array(
-					p_smbios_table, smbios_table_size, p_smbios_inventory, count);
+			rc = smbios_index_to_nvm_details_array(p_index, p_smbios_inventory, count);
 		}
 
-		if (p_smbios_table)
+		if (p_index)
 		{
-			free(p_smbios_table);
+			free(p_index);
 		}
 	}
 
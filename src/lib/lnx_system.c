@@ -38,9 +38,12 @@
 #include <smbios/smbios.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 
 #define	EFI_SYSTAB "/sys/firmware/efi/systab"
+#define	SMBIOS_SYSFS_TABLE "/sys/firmware/dmi/tables/DMI"
 
 // Helper function declarations
 int get_numa_nodes(NVM_UINT16 *p_node_id, NVM_UINT16 count);
@@ -746,6 +749,116 @@ int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size
 	return rc;
 }
 
+/*
+ * Read the SMBIOS structure table exported by the kernel into a heap buffer.
+ * Used when the sysfs attribute can't be mapped.
+ */
+int read_smbios_table_from_sysfs_alloc(int fd, size_t size,
+		NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size)
+{
+	int rc = NVM_SUCCESS;
+
+	NVM_UINT8 *p_smbios_table = calloc(1, size);
+	if (p_smbios_table)
+	{
+		size_t offset = 0;
+		ssize_t bytes_read = 0;
+		while (offset < size &&
+			(bytes_read = pread(fd, p_smbios_table + offset, size - offset, offset)) > 0)
+		{
+			offset += bytes_read;
+		}
+
+		if (offset == size)
+		{
+			*pp_smbios_table = p_smbios_table;
+			*p_allocated_size = size;
+		}
+		else
+		{
+			COMMON_LOG_ERROR("couldn't read SMBIOS structure table from "SMBIOS_SYSFS_TABLE);
+			free(p_smbios_table);
+			rc = NVM_ERR_UNKNOWN;
+		}
+	}
+	else
+	{
+		COMMON_LOG_ERROR("couldn't allocate memory for SMBIOS table copy");
+		rc = NVM_ERR_NOMEMORY;
+	}
+
+	return rc;
+}
+
+/*
+ * Prefer the structure table exported by the kernel (DMI sysfs) since it avoids
+ * opening /dev/mem and scanning for the entry point. Falls back to /dev/mem on
+ * kernels that don't export it.
+ */
+int get_smbios_table_view(struct smbios_table_view *p_view)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	memset(p_view, 0, sizeof (*p_view));
+
+	struct stat table_stat;
+	int fd = open(SMBIOS_SYSFS_TABLE, O_RDONLY);
+	if (fd >= 0 && fstat(fd, &table_stat) == 0 && table_stat.st_size > 0)
+	{
+		size_t size = (size_t)table_stat.st_size;
+		void *p_map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p_map != MAP_FAILED)
+		{
+			p_view->p_table = p_map;
+			p_view->size = size;
+			p_view->mapped = 1;
+		}
+		else
+		{
+			NVM_UINT8 *p_smbios_table = NULL;
+			if ((rc = read_smbios_table_from_sysfs_alloc(fd, size,
+					&p_smbios_table, &p_view->size)) == NVM_SUCCESS)
+			{
+				p_view->p_table = p_smbios_table;
+			}
+		}
+	}
+	else
+	{
+		COMMON_LOG_DEBUG("SMBIOS table not exported in sysfs, reading it from /dev/mem");
+		NVM_UINT8 *p_smbios_table = NULL;
+		if ((rc = get_smbios_table_alloc(&p_smbios_table, &p_view->size)) == NVM_SUCCESS)
+		{
+			p_view->p_table = p_smbios_table;
+		}
+	}
+
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+void put_smbios_table_view(struct smbios_table_view *p_view)
+{
+	if (p_view && p_view->p_table)
+	{
+		if (p_view->mapped)
+		{
+			munmap((void *)p_view->p_table, p_view->size);
+		}
+		else
+		{
+			free((void *)p_view->p_table);
+		}
+		memset(p_view, 0, sizeof (*p_view));
+	}
+}
+
 /*
  * Determine if the caller has permission to make changes to the system
  */
@@ -213,7 +213,16 @@ int init_event_notify()
 
 			// start polling
 			NVM_UINT64 thread_id;
-			create_thread(&thread_id, poll_events, NULL);
+			if (create_thread(&thread_id, poll_events, NULL) != COMMON_SUCCESS)
+			{
+				COMMON_LOG_ERROR("Failed to start the event polling thread");
+				rc = NVM_ERR_UNKNOWN;
+				if (mutex_lock(&g_eventmonitor_lock))
+				{
+					g_is_polling = 0;
+					mutex_unlock(&g_eventmonitor_lock);
+				}
+			}
 		}
 		else
 		{
@@ -30,6 +30,7 @@
 #include "device_utilities.h"
 #include "nvm_context.h"
 #include <firmware_interface/fis_commands.h>
+#include <firmware_interface/fis_views.h>
 #include <common_types.h>
 #include <persistence/logging.h>
 #include <uid/uid.h>
@@ -787,22 +788,46 @@ int parse_dimm_ns_labels(struct ns_data **pp_ns_data, const int dimm_index)
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
 
-	struct pt_output_namespace_labels dimm_lsa = (*pp_ns_data)->dimm_nslsa_list[dimm_index];
-	int index_to_use = choose_index_block(&dimm_lsa);
+	// read the LSA in place, it is too large to copy for each DIMM
+	struct pt_output_namespace_labels *p_dimm_lsa = &(*pp_ns_data)->dimm_nslsa_list[dimm_index];
+	int index_to_use = choose_index_block(p_dimm_lsa);
 	if (index_to_use) // 0 index block = no labels
 	{
-		struct pt_output_ns_index ns_index =
-			index_to_use == 1 ? dimm_lsa.index1 : dimm_lsa.index2;
-		for (int i = 0; i < ns_index.nlabel; i++)
+		struct fis_payload_view lsa = fis_payload_view_init(p_dimm_lsa, sizeof (*p_dimm_lsa));
+		struct fis_payload_view ns_index = index_to_use == 1 ?
+			fis_view_namespace_labels_index1(&lsa) : fis_view_namespace_labels_index2(&lsa);
+		struct fis_payload_view labels = fis_view_at(&lsa,
+			offsetof(struct pt_output_namespace_labels, labels), sizeof (p_dimm_lsa->labels));
+		const NVM_UINT8 *free_map = fis_view_bytes(&ns_index,
+			offsetof(struct pt_output_ns_index, free), sizeof (p_dimm_lsa->index1.free));
+
+		unsigned int nlabel = 0;
+		unsigned short label_major_version = 0;
+		unsigned short label_minor_version = 0;
+		if (!free_map ||
+			!fis_view_ns_index_nlabel(&ns_index, &nlabel) ||
+			!fis_view_ns_index_label_major_version(&ns_index, &label_major_version) ||
+			!fis_view_ns_index_label_minor_version(&ns_index, &label_minor_version))
 		{
-			if (!is_slot_free(ns_index.free, i))
+			nlabel = 0;
+		}
+
+		for (int i = 0; i < nlabel; i++)
+		{
+			if (!is_slot_free(free_map, i))
 			{
-				if (ns_index.label_major_version == 1 &&
-					ns_index.label_minor_version == 1)
+				if (label_major_version == 1 &&
+					label_minor_version == 1)
 				{
-					int offset = i * sizeof (struct pt_output_ns_label_v1_1);
-					struct pt_output_ns_label_v1_1 *p_label =
-							(struct pt_output_ns_label_v1_1 *)(dimm_lsa.labels + offset);
+					const struct pt_output_ns_label_v1_1 *p_label =
+						(const struct pt_output_ns_label_v1_1 *)fis_view_bytes(&labels,
+							i * sizeof (struct pt_output_ns_label_v1_1),
+							sizeof (struct pt_output_ns_label_v1_1));
+					if (!p_label)
+					{
+						COMMON_LOG_INFO_F("Namespace label slot %d is outside the LSA", i);
+						break;
+					}
 
 					// convert to a v1.2 label
 					struct pt_output_ns_label_v1_2 label;
@@ -818,12 +843,18 @@ int parse_dimm_ns_labels(struct ns_data **pp_ns_data, const int dimm_index)
 							&label.checksum, 1);
 				    rc = init_namespace_from_label(pp_ns_data, dimm_index, &label);
 				}
-				else if (ns_index.label_major_version == 1 &&
-						ns_index.label_minor_version == 2)
+				else if (label_major_version == 1 &&
+						label_minor_version == 2)
 				{
-					int offset = i * sizeof (struct pt_output_ns_label_v1_2);
-						struct pt_output_ns_label_v1_2 *p_label =
-							(struct pt_output_ns_label_v1_2 *)(dimm_lsa.labels + offset);
+					struct pt_output_ns_label_v1_2 *p_label =
+						(struct pt_output_ns_label_v1_2 *)fis_view_bytes(&labels,
+							i * sizeof (struct pt_output_ns_label_v1_2),
+							sizeof (struct pt_output_ns_label_v1_2));
+					if (!p_label)
+					{
+						COMMON_LOG_INFO_F("Namespace label slot %d is outside the LSA", i);
+						break;
+					}
 				    rc = init_namespace_from_label(pp_ns_data, dimm_index, p_label);
 				}
 			}
@@ -33,10 +33,42 @@
 #include "nfit_utilities.h"
 #include <persistence/logging.h>
 #include <string.h>
+#include <fcntl.h>
 #include "device_utilities.h"
 #include <uid/uid.h>
 #include "nvm_context.h"
 #include "nvm_types.h"
+#include <os/os_adapter.h>
+#include <file_ops/file_ops_adapter.h>
+#include <persistence/lib_persistence.h>
+#include <persistence/config_settings.h>
+#include <string/s_str.h>
+
+#ifdef __WINDOWS__
+#include <Windows.h>
+
+extern HANDLE g_nfit_cache_lock;
+#else
+extern pthread_mutex_t g_nfit_cache_lock;
+#endif
+
+// persisted NFIT cache, kept next to the lib store
+#define	NFIT_CACHE_FILE	"nfit_cache.dat"
+#define	NFIT_CACHE_SIGNATURE	"NFTC"
+#define	NFIT_CACHE_SIGNATURE_LEN	4
+
+/*
+ * Header of the persisted NFIT cache, followed by the parsed NFIT
+ */
+struct nfit_cache_file_header
+{
+	char signature[NFIT_CACHE_SIGNATURE_LEN];
+	NVM_UINT32 parsed_nfit_size; // sizeof (struct parsed_nfit) of the writer
+	NVM_UINT64 arena_size;
+};
+
+// Process wide copy of the parsed NFIT, used when there is no context
+static struct parsed_nfit *g_p_nfit_cache = NULL;
 
 /*
  * Convert NFIT library error the NVM library error
@@ -77,9 +109,234 @@ int nfit_err_to_lib_err(const enum nfit_error err)
 	return rc;
 }
 
+/*
+ * A parsed NFIT is current if it was parsed from an NFIT with the same
+ * header, which covers the length and checksum of the whole table
+ */
+static NVM_BOOL is_parsed_nfit_current(const struct parsed_nfit *p_parsed_nfit,
+		const struct nfit *p_header)
+{
+	return memcmp(&p_parsed_nfit->nfit, p_header, sizeof (struct nfit)) == 0;
+}
+
+/*
+ * Copy a parsed NFIT into a new allocation
+ */
+static struct parsed_nfit *dup_parsed_nfit(const struct parsed_nfit *p_parsed_nfit)
+{
+	struct parsed_nfit *p_copy = malloc(p_parsed_nfit->arena_size);
+	if (p_copy)
+	{
+		nfit_copy_parsed_nfit(p_copy, p_parsed_nfit);
+	}
+	return p_copy;
+}
+
+/*
+ * Whether the parsed NFIT is persisted in the lib store directory
+ */
+static NVM_BOOL is_nfit_cache_persisted()
+{
+	int persist = 0;
+	get_config_value_int(SQL_KEY_NFIT_CACHE_PERSIST, &persist);
+	return persist ? 1 : 0;
+}
+
+/*
+ * Build the path of the persisted NFIT cache from the lib store path
+ */
+static int get_nfit_cache_path(COMMON_PATH path)
+{
+	int rc = NVM_ERR_UNKNOWN;
+	if (get_lib_store_path(path) == COMMON_SUCCESS)
+	{
+		size_t len = s_strnlen(path, COMMON_PATH_LEN);
+		while (len > 0 && path[len - 1] != '/' && path[len - 1] != '\\')
+		{
+			len--;
+		}
+		path[len] = '\0';
+		s_strcat(path, COMMON_PATH_LEN, NFIT_CACHE_FILE);
+		rc = NVM_SUCCESS;
+	}
+	return rc;
+}
+
+/*
+ * Load the persisted parsed NFIT if it was parsed from the current NFIT.
+ * Returns NULL if there is no usable persisted copy.
+ */
+static struct parsed_nfit *load_persisted_nfit(const struct nfit *p_header)
+{
+	COMMON_LOG_ENTRY();
+	struct parsed_nfit *p_parsed_nfit = NULL;
+
+	COMMON_PATH path;
+	void *p_buf = NULL;
+	unsigned int buf_len = 0;
+	if (get_nfit_cache_path(path) == NVM_SUCCESS &&
+		file_exists(path, COMMON_PATH_LEN) &&
+		copy_file_to_buffer(path, COMMON_PATH_LEN, &p_buf, &buf_len) == COMMON_SUCCESS)
+	{
+		struct nfit_cache_file_header *p_file_header = (struct nfit_cache_file_header *)p_buf;
+		size_t arena_size = buf_len - sizeof (struct nfit_cache_file_header);
+		if (buf_len <= sizeof (struct nfit_cache_file_header) ||
+			memcmp(p_file_header->signature, NFIT_CACHE_SIGNATURE,
+				NFIT_CACHE_SIGNATURE_LEN) != 0 ||
+			p_file_header->parsed_nfit_size != sizeof (struct parsed_nfit) ||
+			p_file_header->arena_size != arena_size)
+		{
+			COMMON_LOG_WARN("The persisted NFIT cache is invalid");
+		}
+		else if ((p_parsed_nfit = malloc(arena_size)) == NULL)
+		{
+			COMMON_LOG_ERROR("Not enough memory to load the persisted NFIT cache");
+		}
+		else
+		{
+			memmove(p_parsed_nfit, p_file_header + 1, arena_size);
+			if (!is_parsed_nfit_current(p_parsed_nfit, p_header) ||
+				nfit_restore_parsed_nfit(p_parsed_nfit, arena_size) != NFIT_SUCCESS)
+			{
+				COMMON_LOG_DEBUG("The persisted NFIT cache is out of date");
+				free(p_parsed_nfit);
+				p_parsed_nfit = NULL;
+			}
+		}
+	}
+	if (p_buf)
+	{
+		free(p_buf);
+	}
+
+	COMMON_LOG_EXIT();
+	return p_parsed_nfit;
+}
+
+/*
+ * Persist a parsed NFIT next to the lib store.
+ * Failures are logged but otherwise ignored, the cache is an optimization.
+ */
+static void persist_parsed_nfit(const struct parsed_nfit *p_parsed_nfit)
+{
+	COMMON_LOG_ENTRY();
+
+	COMMON_PATH path;
+	unsigned int buf_len = sizeof (struct nfit_cache_file_header) + p_parsed_nfit->arena_size;
+	struct nfit_cache_file_header *p_file_header = NULL;
+	if (get_nfit_cache_path(path) == NVM_SUCCESS &&
+		(p_file_header = calloc(1, buf_len)) != NULL)
+	{
+		memmove(p_file_header->signature, NFIT_CACHE_SIGNATURE, NFIT_CACHE_SIGNATURE_LEN);
+		p_file_header->parsed_nfit_size = sizeof (struct parsed_nfit);
+		p_file_header->arena_size = p_parsed_nfit->arena_size;
+		memmove(p_file_header + 1, p_parsed_nfit, p_parsed_nfit->arena_size);
+		if (copy_buffer_to_file(p_file_header, buf_len, path, COMMON_PATH_LEN,
+				O_CREAT) != COMMON_SUCCESS)
+		{
+			COMMON_LOG_WARN_F("Unable to persist the NFIT cache to %s", path);
+		}
+		free(p_file_header);
+	}
+
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Retrieve the parsed NFIT from the process wide cache, refreshing the cache
+ * if the NFIT header in ACPI no longer matches it
+ */
+static int get_process_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct nfit header;
+	int nfit_rc = nfit_get_nfit_header(&header);
+	if (nfit_rc != NFIT_SUCCESS)
+	{
+		rc = nfit_err_to_lib_err(nfit_rc);
+	}
+	// lock
+	else if (!mutex_lock(&g_nfit_cache_lock))
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
+	{
+		if (g_p_nfit_cache && !is_parsed_nfit_current(g_p_nfit_cache, &header))
+		{
+			free(g_p_nfit_cache);
+			g_p_nfit_cache = NULL;
+		}
+
+		if (!g_p_nfit_cache)
+		{
+			NVM_BOOL persisted = is_nfit_cache_persisted();
+			if (persisted)
+			{
+				g_p_nfit_cache = load_persisted_nfit(&header);
+			}
+			if (!g_p_nfit_cache)
+			{
+				nfit_rc = nfit_get_parsed_nfit(&g_p_nfit_cache);
+				if (nfit_rc != NFIT_SUCCESS)
+				{
+					g_p_nfit_cache = NULL;
+					rc = nfit_err_to_lib_err(nfit_rc);
+				}
+				else if (persisted)
+				{
+					persist_parsed_nfit(g_p_nfit_cache);
+				}
+			}
+		}
+
+		if (g_p_nfit_cache)
+		{
+			*pp_parsed_nfit = dup_parsed_nfit(g_p_nfit_cache);
+			if (!(*pp_parsed_nfit))
+			{
+				COMMON_LOG_ERROR("Not enough memory to retrieve the NFIT");
+				rc = NVM_ERR_NOMEMORY;
+			}
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_nfit_cache_lock))
+		{
+			COMMON_LOG_ERROR("Failed to release the NFIT cache lock");
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Free the process wide copy of the parsed NFIT
+ */
+void free_nfit_cache()
+{
+	// lock
+	if (mutex_lock(&g_nfit_cache_lock))
+	{
+		if (g_p_nfit_cache)
+		{
+			free(g_p_nfit_cache);
+			g_p_nfit_cache = NULL;
+		}
+		// unlock
+		mutex_unlock(&g_nfit_cache_lock);
+	}
+}
+
 /*
  * Retrieve the NFIT table from ACPI and parse it.
- * The caller is responsible for freeing the parsed_nfit structure.
+ * The context copy is used if there is one, otherwise the process wide
+ * copy as long as the NFIT has not changed.
+ * The caller is responsible for freeing the parsed_nfit structure. It is
+ * a single allocation so free or free_parsed_nfit may be used.
  */
 int get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
 {
@@ -101,14 +358,11 @@ int get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
 	}
 	else
 	{
-		nfit_size = nfit_get_parsed_nfit(pp_parsed_nfit);
-		if (nfit_size && *pp_parsed_nfit)
-		{
-			rc = set_nvm_context_nfit(nfit_size, *pp_parsed_nfit);
-		}
-		else
+		rc = get_process_parsed_nfit(pp_parsed_nfit);
+		if (rc == NVM_SUCCESS)
 		{
-			rc = nfit_err_to_lib_err(nfit_size);
+			// not an error if there is no context to cache it in
+			set_nvm_context_nfit((*pp_parsed_nfit)->arena_size, *pp_parsed_nfit);
 		}
 	}
 	return rc;
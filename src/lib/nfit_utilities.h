@@ -36,6 +36,18 @@
 #include "nvm_management.h"
 #include "adapter_types.h"
 
+/*
+ * Retrieve the NFIT table from ACPI and parse it, from the context or the
+ * process wide cache if the NFIT has not changed.
+ * The caller is responsible for freeing the parsed_nfit structure.
+ */
+int get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit);
+
+/*
+ * Free the process wide copy of the parsed NFIT
+ */
+void free_nfit_cache();
+
 /*
  * Get the number of DIMMS from the NFIT
  */
@@ -34,6 +34,7 @@
 #include <persistence/logging.h>
 #include <uid/uid.h>
 #include <acpi/nfit.h>
+#include "smbios_utilities.h"
 
 #ifdef __WINDOWS__
 #include <Windows.h>
@@ -94,6 +95,8 @@ int nvm_create_context()
 				p_context->p_pcd_namespaces = NULL;
 				p_context->nfit_size = -1;
 				p_context->p_nfit = NULL;
+				p_context->smbios_index_size = -1;
+				p_context->p_smbios_index = NULL;
 			}
 		}
 
@@ -151,11 +154,14 @@ void free_device_list()
 void free_pool_list()
 {
 	COMMON_LOG_ENTRY();
-	// clean up the device list
-	if (p_context && p_context->pool_count > 0 && p_context->p_pools)
+	// clean up the pool list, an empty list is cached too
+	if (p_context && p_context->pool_count >= 0)
 	{
-		free(p_context->p_pools);
-		p_context->p_pools = NULL;
+		if (p_context->p_pools)
+		{
+			free(p_context->p_pools);
+			p_context->p_pools = NULL;
+		}
 		p_context->pool_count = -1;
 	}
 	COMMON_LOG_EXIT();
@@ -224,6 +230,22 @@ void free_nfit()
 	COMMON_LOG_EXIT();
 }
 
+/*
+ * Helper function to free the SMBIOS memory device index
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void free_smbios_index()
+{
+	COMMON_LOG_ENTRY();
+	if (p_context && p_context->smbios_index_size > 0 && p_context->p_smbios_index)
+	{
+		free(p_context->p_smbios_index);
+		p_context->p_smbios_index = NULL;
+		p_context->smbios_index_size = -1;
+	}
+	COMMON_LOG_EXIT();
+}
+
 /*
  * Clean up the resources allocated by nvm_create_context
  * Use the force flag to clear the context regardless of the count
@@ -260,6 +282,7 @@ int nvm_free_context(const NVM_BOOL force)
 				free_namespace_list();
 				free_pcd_namespace_list();
 				free_nfit();
+				free_smbios_index();
 
 				// clean up pointer
 				free(p_context);
@@ -505,6 +528,9 @@ int set_nvm_context_devices(const struct device_discovery *p_devices, const int
 void invalidate_devices()
 {
 	COMMON_LOG_ENTRY();
+	// caches outside the context, such as the IXP FW command results, check this
+	notify_device_change();
+
 	// lock
 	if (!mutex_lock(&g_context_lock))
 	{
@@ -889,8 +915,13 @@ int set_nvm_context_pools(const struct pool *p_pools, const int pool_count)
 			free_pool_list();
 
 			// create new list
-			p_context->p_pools = calloc(pool_count, sizeof (struct pool));
-			if (!p_context->p_pools)
+			if (pool_count == 0)
+			{
+				// remember there are none
+				p_context->pool_count = 0;
+				rc = NVM_SUCCESS;
+			}
+			else if (!(p_context->p_pools = calloc(pool_count, sizeof (struct pool))))
 			{
 				COMMON_LOG_ERROR("Failed to allocate memory for pool list");
 				rc = NVM_ERR_NOMEMORY;
@@ -928,8 +959,10 @@ int get_nvm_context_pool(const NVM_UID pool_uid, struct pool *p_pool)
 	}
 	else
 	{
-		if (p_context && p_context->pool_count > 0 && p_context->p_pools)
+		if (p_context && p_context->pool_count >= 0)
 		{
+			// the list is complete, a pool that isn't in it doesn't exist
+			rc = NVM_ERR_BADPOOL;
 			for (int i = 0; i < p_context->pool_count; i++)
 			{
 				if (uid_cmp(pool_uid, p_context->p_pools[i].pool_uid))
@@ -1424,7 +1457,7 @@ int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit)
 			{
 				if (nfit_size >= p_context->nfit_size)
 				{
-					memmove(p_nfit, p_context->p_nfit, p_context->nfit_size);
+					nfit_copy_parsed_nfit(p_nfit, p_context->p_nfit);
 					rc = NVM_SUCCESS;
 				}
 			}
@@ -1471,7 +1504,7 @@ int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit)
 				else
 				{
 					p_context->nfit_size = nfit_size;
-					memmove(p_context->p_nfit, p_nfit, nfit_size);
+					nfit_copy_parsed_nfit(p_context->p_nfit, p_nfit);
 					rc = NVM_SUCCESS;
 				}
 			}
@@ -1486,3 +1519,148 @@ int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit)
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
+
+int get_nvm_context_smbios_index_size()
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (p_context && p_context->smbios_index_size >= 0)
+		{
+			rc = p_context->smbios_index_size;
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int get_nvm_context_smbios_index(int index_size, struct smbios_memory_device_index *p_index)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	if (index_size && p_index)
+	{
+		// lock
+		if (!mutex_lock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not obtain the context lock");
+			rc = NVM_ERR_CONTEXT;
+		}
+		else
+		{
+			if (p_context && p_context->smbios_index_size > 0 && p_context->p_smbios_index)
+			{
+				if (index_size >= p_context->smbios_index_size)
+				{
+					memmove(p_index, p_context->p_smbios_index, p_context->smbios_index_size);
+					rc = NVM_SUCCESS;
+				}
+			}
+
+			// unlock
+			if (!mutex_unlock(&g_context_lock))
+			{
+				COMMON_LOG_ERROR("Could not release the context lock.");
+				rc = NVM_ERR_CONTEXT;
+			}
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int set_nvm_context_smbios_index(int index_size, const struct smbios_memory_device_index *p_index)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	if (index_size && p_index)
+	{
+		// lock
+		if (!mutex_lock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not obtain the context lock");
+			rc = NVM_ERR_CONTEXT;
+		}
+		else
+		{
+			if (p_context)
+			{
+				// clean up index
+				free_smbios_index();
+
+				p_context->p_smbios_index = calloc(1, index_size);
+				if (!p_context->p_smbios_index)
+				{
+					COMMON_LOG_ERROR("Failed to allocate memory for context structure");
+					rc = NVM_ERR_NOMEMORY;
+				}
+				else
+				{
+					p_context->smbios_index_size = index_size;
+					memmove(p_context->p_smbios_index, p_index, index_size);
+					rc = NVM_SUCCESS;
+				}
+			}
+			// unlock
+			if (!mutex_unlock(&g_context_lock))
+			{
+				COMMON_LOG_ERROR("Could not release the context lock.");
+				rc = NVM_ERR_CONTEXT;
+			}
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Look up a DIMM in the cached SMBIOS index without copying the index out.
+ * Returns NVM_ERR_CONTEXT if the index hasn't been cached.
+ */
+int get_nvm_context_smbios_dimm_details(const NVM_UINT16 physical_id,
+		struct nvm_details *p_dimm_details)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (p_context && p_context->smbios_index_size > 0 && p_context->p_smbios_index)
+		{
+			rc = smbios_index_get_dimm_details(p_context->p_smbios_index,
+					physical_id, p_dimm_details);
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
@@ -42,6 +42,8 @@ extern "C"
 {
 #endif
 
+struct smbios_memory_device_index;
+
 /*
  * The context of an NVM-DIMM
  */
@@ -84,6 +86,10 @@ struct nvm_context
 	// avoid unnecessary calls to retrieve ACPI tables
 	int nfit_size;
 	struct parsed_nfit *p_nfit;
+
+	// avoid re-reading the SMBIOS table for every DIMM
+	int smbios_index_size;
+	struct smbios_memory_device_index *p_smbios_index;
 };
 
 NVM_API extern struct nvm_context *p_context;
@@ -139,6 +145,15 @@ NVM_API int get_nvm_context_nfit_size();
 NVM_API int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit);
 NVM_API int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit);
 
+// SMBIOS
+NVM_API int get_nvm_context_smbios_index_size();
+NVM_API int get_nvm_context_smbios_index(int index_size,
+		struct smbios_memory_device_index *p_index);
+NVM_API int set_nvm_context_smbios_index(int index_size,
+		const struct smbios_memory_device_index *p_index);
+NVM_API int get_nvm_context_smbios_dimm_details(const NVM_UINT16 physical_id,
+		struct nvm_details *p_dimm_details);
+
 #ifdef __cplusplus
 }
 #endif
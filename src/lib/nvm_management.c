@@ -36,6 +36,7 @@
 #include <persistence/lib_persistence.h>
 #include <persistence/config_settings.h>
 #include <persistence/logging.h>
+#include "nfit_utilities.h"
 
 
 #ifdef __WINDOWS__
@@ -45,10 +46,12 @@
 #define	APP_REGISTRY_ENTRY	"SOFTWARE\\Intel\\TBD"
 HANDLE g_eventmonitor_lock;
 HANDLE g_context_lock;
+HANDLE g_nfit_cache_lock;
 #else
 #include <assert.h>
 pthread_mutex_t g_eventmonitor_lock;
 pthread_mutex_t g_context_lock;
+pthread_mutex_t g_nfit_cache_lock;
 #endif
 
 /*
@@ -157,6 +160,14 @@ int nvm_open_lib()
 		{
 			rc = NVM_ERR_UNKNOWN;
 		}
+
+		// initialize the NFIT cache lock
+		// the NFIT cache is per process so no need to be cross-process safe
+		// thus no name on the mutex
+		if (!mutex_init((OS_MUTEX*)&g_nfit_cache_lock, NULL))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
 	}
 	return rc;
 }
@@ -187,6 +198,11 @@ int nvm_close_lib()
 	{
 		rc = NVM_ERR_UNKNOWN;
 	}
+	free_nfit_cache();
+	if (!mutex_delete((OS_MUTEX*)&g_nfit_cache_lock, NULL))
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
 
 	return rc;
 }
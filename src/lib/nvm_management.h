@@ -821,6 +821,36 @@ struct device_fw_info
 	enum fw_update_status fw_update_status; // status of last FW update operation.
 };
 
+/*
+ * Progress of a FW image transfer to a device.
+ */
+struct fw_transfer_progress
+{
+	NVM_UINT32 bytes_transferred; // Bytes of the image sent to the device so far.
+	NVM_UINT32 total_bytes; // Size of the image.
+	NVM_UINT8 percent_complete; // Bytes transferred as a percentage of the image size.
+	NVM_UINT64 bytes_per_second; // Average transfer rate since the transfer started.
+};
+
+/*
+ * Caller-supplied callbacks to follow and cancel FW image transfers.
+ * Devices may be updated in parallel, so the callbacks may be called from
+ * several threads at once.
+ */
+struct fw_update_callbacks
+{
+	// Reports the transfer progress of a device. Reports are coalesced to at most
+	// one per percentage point and reporting interval, plus the final one. May be NULL.
+	void (*progress)(const char *device_uid,
+			const struct fw_transfer_progress *p_progress, void *p_context);
+
+	// Called before each packet is sent. Returning true cancels the transfer to
+	// the device, which then fails with #NVM_ERR_CANCELED. May be NULL.
+	NVM_BOOL (*cancel)(const char *device_uid, void *p_context);
+
+	void *p_context; // Passed unchanged to the callbacks.
+};
+
 /*
  * Detailed information about a device.
  */
@@ -1618,6 +1648,31 @@ extern NVM_API int nvm_modify_device_settings(const NVM_UID device_uid,
 extern NVM_API int nvm_get_device_details(const NVM_UID device_uid,
 		struct device_details *p_details);
 
+/*
+ * Retrieve #device_details information about several devices at once.
+ * The devices are queried in parallel.
+ * @param[in] p_device_uids
+ * 		An array of device_count device identifiers.
+ * @param[in,out] p_details
+ * 		An array of device_count #device_details structures allocated by the caller.
+ * @param[in,out] p_results
+ * 		An array of device_count return codes allocated by the caller. Each is set
+ * 		to the result #nvm_get_device_details gave for the corresponding device.
+ * @param[in] device_count
+ * 		The number of elements in each array.
+ * @pre The caller must have administrative privileges.
+ * @return Returns one of the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_SUCCESS - the details of each device are reported in p_results @n
+ * 		#NVM_ERR_NOTSUPPORTED @n
+ *		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_UNKNOWN @n
+ * 		#NVM_ERR_BADDRIVER @n
+ * 		#NVM_ERR_NOSIMULATOR (Simulated builds only)
+ */
+extern NVM_API int nvm_get_devices_details(const NVM_UID *p_device_uids,
+		struct device_details *p_details, int *p_results, const NVM_UINT32 device_count);
+
 /*
  * Retrieve a current snapshot of the performance metrics for the device specified.
  * @param[in] device_uid
@@ -1708,6 +1763,44 @@ extern NVM_API int nvm_get_device_fw_image_info(const NVM_UID device_uid,
 extern NVM_API int nvm_update_device_fw(const NVM_UID device_uid,
 		const NVM_PATH path, const NVM_SIZE path_len, const NVM_BOOL force);
 
+/*
+ * Push a new FW image to several devices at once.
+ * The image is read and its header checked once, then the devices are updated
+ * in parallel.
+ * @param[in] p_device_uids
+ * 		An array of device_count device identifiers.
+ * @param[in,out] p_results
+ * 		An array of device_count return codes allocated by the caller. Each is set
+ * 		to the result of updating the corresponding device, as
+ * 		#nvm_update_device_fw would return it.
+ * @param[in] device_count
+ * 		The number of elements in each array.
+ * @param[in] path
+ * 		Absolute file path to the new firmware image.
+ * @param[in] path_len
+ * 		String length of path, should be < #NVM_PATH_LEN.
+ * @param[in] force
+ * 		If attempting to downgrade the minor version, force must be true.
+ * @param[in] p_callbacks
+ * 		Optional callbacks to follow or cancel the transfer to each device.
+ * @pre The caller has administrative privileges.
+ * @return Returns one of the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_SUCCESS - the result of each device is reported in p_results, a
+ * 		canceled transfer is reported as #NVM_ERR_CANCELED @n
+ * 		#NVM_ERR_NOTSUPPORTED @n
+ * 		#NVM_ERR_NOMEMORY @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_BADFILE @n
+ * 		#NVM_ERR_BADFIRMWARE @n
+ * 		#NVM_ERR_UNKNOWN @n
+ * 		#NVM_ERR_BADDRIVER @n
+ * 		#NVM_ERR_NOSIMULATOR (Simulated builds only)
+ */
+extern NVM_API int nvm_update_devices_fw(const NVM_UID *p_device_uids, int *p_results,
+		const NVM_UINT32 device_count, const NVM_PATH path, const NVM_SIZE path_len,
+		const NVM_BOOL force, const struct fw_update_callbacks *p_callbacks);
+
 /*
  * Examine the FW image to determine if it is valid for the device specified.
  * @param[in] device_uid
@@ -3074,7 +3167,9 @@ extern NVM_API int nvm_clear_injected_device_error(const NVM_UID device_uid,
 /*
  * Run a diagnostic test on the device specified.
  * @param[in] device_uid
- * 		The device identifier.
+ * 		The device identifier. For the quick health diagnostic, NULL checks
+ * 		every device in parallel and stores their results together. The
+ * 		other diagnostics always cover the whole system.
  * @param[in] p_diagnostic
  * 		A pointer to a #diagnostic structure containing the
  * 		diagnostic to run allocated by the caller.
@@ -236,6 +236,7 @@ enum return_code
 	NVM_ERR_NOFADATAAVAILABLE = -60, // No device support data available from AEP DIMM
 	NVM_ERR_INTERLEAVESET = -61, // Something is wrong with the interleaved set
 	NVM_ERR_CONTEXT = -62,		// Some issue with the shared context
+	NVM_ERR_CANCELED = -63, // The caller canceled the operation.
 
     //Device Format Service Status Codes
 	NVM_FORMAT_BSR_POLL_INCOMPLETE = 0, //BSR Parsing not complete
@@ -872,6 +872,16 @@ int get_hw_dimm_platform_config_alloc(const unsigned int handle, NVM_SIZE *p_pcd
  */
 int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 		struct platform_config_data **pp_config)
+{
+	NVM_SIZE pcd_size = 0;
+	return get_dimm_platform_config_and_size(handle, pp_config, &pcd_size);
+}
+
+/*
+ * Retrieve a copy of the PCD data from the global device table along with its size
+ */
+int get_dimm_platform_config_and_size(const NVM_NFIT_DEVICE_HANDLE handle,
+		struct platform_config_data **pp_config, NVM_SIZE *p_pcd_size)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
@@ -890,6 +900,7 @@ int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 				set_nvm_context_device_pcd(discovery.uid, *pp_config, pcd_size);
 			}
 		}
+		*p_pcd_size = pcd_size;
 	}
 
 	if (*pp_config == NULL)
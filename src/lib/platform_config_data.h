@@ -475,6 +475,14 @@ NVM_API int get_hw_dimm_platform_config_alloc(const unsigned int handle, NVM_SIZ
 NVM_API int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 		struct platform_config_data **pp_config);
 
+/*
+ * Retrieve a copy of the PCD data from the global device table along with its size
+ *
+ * NOTE: Callers must free the platform_config_data structure to avoid memory leaks
+ */
+NVM_API int get_dimm_platform_config_and_size(const NVM_NFIT_DEVICE_HANDLE handle,
+		struct platform_config_data **pp_config, NVM_SIZE *p_pcd_size);
+
 /*
  * Write the platform configuration data to the specified dimm
  */
@@ -47,6 +47,7 @@
 #include "system.h"
 #include "nfit_utilities.h"
 #include "namespace_utils.h"
+#include <os/os_adapter.h>
 
 // defined in device.c
 extern int get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
@@ -265,100 +266,95 @@ int collect_interleave_sets(struct pool_data **pp_pool_data)
 }
 
 /*
- * Retrieve config goal for each manageable DIMM in the pool data struct
- * and store them.
+ * Retrieve the config goal for one manageable DIMM in the pool data struct
  */
-int collect_dimm_goals(struct pool_data **pp_pool_data)
+void collect_dimm_goal(struct pool_data *p_pool_data, const int index)
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
-	if ((*pp_pool_data)->dimm_count > 0)
-	{
-		(*pp_pool_data)->dimm_goal_list = calloc(
-			(*pp_pool_data)->dimm_count, sizeof (struct config_goal));
-		if (!(*pp_pool_data)->dimm_goal_list)
-		{
-			COMMON_LOG_ERROR("No memory to collect pool information");
-			rc = NVM_ERR_NOMEMORY;
-		}
-		else
-		{
-			for (int i = 0; i < (*pp_pool_data)->dimm_count; i++)
-			{
-				// ignore failures because not all dimms have goals
-				nvm_get_config_goal(
-					(*pp_pool_data)->dimm_list[i].uid,
-					&(*pp_pool_data)->dimm_goal_list[i]);
-			}
-		}
-	}
-	COMMON_LOG_EXIT_RETURN_I(rc);
-	return rc;
+	// ignore failures because not all dimms have goals
+	nvm_get_config_goal(p_pool_data->dimm_list[index].uid,
+			&p_pool_data->dimm_goal_list[index]);
 }
 
 /*
- * Retrieve status for each manageable DIMM in the pool data struct
- * and store them.
+ * Retrieve the status for one manageable DIMM in the pool data struct
  */
-int collect_dimm_statuses(struct pool_data **pp_pool_data)
+void collect_dimm_status(struct pool_data *p_pool_data, const int index)
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
-	if ((*pp_pool_data)->dimm_count > 0)
-	{
-		(*pp_pool_data)->dimm_status_list = calloc(
-			(*pp_pool_data)->dimm_count, sizeof (struct device_status));
-		if (!(*pp_pool_data)->dimm_status_list)
-		{
-			COMMON_LOG_ERROR("No memory to collect pool information");
-			rc = NVM_ERR_NOMEMORY;
-		}
-		else
-		{
-			for (int i = 0; i < (*pp_pool_data)->dimm_count; i++)
-			{
-				// ignore failures because not all status can be retrieved
-				get_device_status_by_handle(
-					(*pp_pool_data)->dimm_list[i].device_handle,
-					&(*pp_pool_data)->dimm_status_list[i],
-					&(*pp_pool_data)->capabilities);
-			}
-		}
-	}
-	COMMON_LOG_EXIT_RETURN_I(rc);
-	return rc;
+	// ignore failures because not all status can be retrieved
+	get_device_status_by_handle(p_pool_data->dimm_list[index].device_handle,
+			&p_pool_data->dimm_status_list[index],
+			&p_pool_data->capabilities);
+}
+
+/*
+ * Retrieve the capacities for one manageable DIMM in the pool data struct
+ */
+int collect_dimm_capacity(struct pool_data *p_pool_data, const int index)
+{
+	return get_dimm_capacities(&p_pool_data->dimm_list[index],
+			&p_pool_data->capabilities,
+			&p_pool_data->dimm_capacities_list[index]);
 }
 
 /*
- * Retrieve capacities for each manageable DIMM in the pool data struct
- * and store them.
+ * State shared by the threads collecting the per-DIMM pool data
  */
-int collect_dimm_capacities(struct pool_data **pp_pool_data)
+struct pool_dimm_work
+{
+	struct pool_data *p_pool_data;
+	int *p_capacity_rcs;
+};
+
+static void collect_dimm_data_worker(void *arg, COMMON_UINT32 index)
+{
+	struct pool_dimm_work *p_work = (struct pool_dimm_work *)arg;
+	p_work->p_capacity_rcs[index] = collect_dimm_capacity(p_work->p_pool_data, index);
+	collect_dimm_goal(p_work->p_pool_data, index);
+	collect_dimm_status(p_work->p_pool_data, index);
+}
+
+/*
+ * Retrieve capacities, config goal and status for each manageable DIMM in the
+ * pool data struct and store them. Each DIMM is independent, so they are
+ * read in parallel.
+ */
+int collect_dimm_data(struct pool_data **pp_pool_data)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
-	if ((*pp_pool_data)->dimm_count > 0)
-	{
-		(*pp_pool_data)->dimm_capacities_list = calloc(
-			(*pp_pool_data)->dimm_count, sizeof (struct device_capacities));
-		if (!(*pp_pool_data)->dimm_capacities_list)
+	struct pool_data *p_pool_data = *pp_pool_data;
+	int dimm_count = p_pool_data->dimm_count;
+	if (dimm_count > 0)
+	{
+		int *p_capacity_rcs = calloc(dimm_count, sizeof (int));
+		p_pool_data->dimm_capacities_list =
+				calloc(dimm_count, sizeof (struct device_capacities));
+		p_pool_data->dimm_goal_list = calloc(dimm_count, sizeof (struct config_goal));
+		p_pool_data->dimm_status_list = calloc(dimm_count, sizeof (struct device_status));
+		if (!p_capacity_rcs || !p_pool_data->dimm_capacities_list ||
+				!p_pool_data->dimm_goal_list || !p_pool_data->dimm_status_list)
 		{
 			COMMON_LOG_ERROR("No memory to collect pool information");
 			rc = NVM_ERR_NOMEMORY;
 		}
 		else
 		{
-			for (int i = 0; i < (*pp_pool_data)->dimm_count; i++)
+			struct pool_dimm_work work;
+			work.p_pool_data = p_pool_data;
+			work.p_capacity_rcs = p_capacity_rcs;
+
+			run_parallel(dimm_count, PARALLEL_MAX_THREADS, collect_dimm_data_worker, &work);
+
+			// report the first capacity failure, as the serial collection did
+			for (int i = 0; i < dimm_count; i++)
 			{
-				rc = get_dimm_capacities(&(*pp_pool_data)->dimm_list[i],
-						&(*pp_pool_data)->capabilities,
-						&(*pp_pool_data)->dimm_capacities_list[i]);
-				if (rc != NVM_SUCCESS)
-				{
-					break;
-				}
+				KEEP_ERROR(rc, p_capacity_rcs[i]);
 			}
 		}
+		if (p_capacity_rcs)
+		{
+			free(p_capacity_rcs);
+		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -407,8 +403,7 @@ int collect_host(struct pool_data **pp_pool_data)
 /*
  * Gather all the required data to populate the pool information
  */
-int collect_required_pool_data(struct pool_data **pp_pool_data,
-		const NVM_BOOL count_only)
+int collect_required_pool_data(struct pool_data **pp_pool_data)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
@@ -431,8 +426,8 @@ int collect_required_pool_data(struct pool_data **pp_pool_data,
 		{
 			free_pool_data(*pp_pool_data);
 		}
-		// get DIMM capacities for each manageable DIMM
-		else if ((rc = collect_dimm_capacities(pp_pool_data)) != NVM_SUCCESS)
+		// get DIMM capacities, goal and status for each manageable DIMM
+		else if ((rc = collect_dimm_data(pp_pool_data)) != NVM_SUCCESS)
 		{
 			free_pool_data(*pp_pool_data);
 		}
@@ -441,31 +436,15 @@ int collect_required_pool_data(struct pool_data **pp_pool_data,
 		{
 			free_pool_data(*pp_pool_data);
 		}
-
-
-		// this data is not needed when just counting pools
-		if (rc == NVM_SUCCESS && !count_only)
+		// get the host
+		else if ((rc = collect_host(pp_pool_data)) != NVM_SUCCESS)
 		{
-			// get the host
-			if ((rc = collect_host(pp_pool_data)) != NVM_SUCCESS)
-			{
-				free_pool_data(*pp_pool_data);
-			}
-			// collect DIMM goals
-			else if ((rc = collect_dimm_goals(pp_pool_data)) != NVM_SUCCESS)
-			{
-				free_pool_data(*pp_pool_data);
-			}
-			// get DIMM status for each manageable DIMM
-			else if ((rc = collect_dimm_statuses(pp_pool_data)) != NVM_SUCCESS)
-			{
-				free_pool_data(*pp_pool_data);
-			}
-			// get namespaces
-			else if ((rc = collect_namespaces(pp_pool_data)) != NVM_SUCCESS)
-			{
-				free_pool_data(*pp_pool_data);
-			}
+			free_pool_data(*pp_pool_data);
+		}
+		// get namespaces
+		else if ((rc = collect_namespaces(pp_pool_data)) != NVM_SUCCESS)
+		{
+			free_pool_data(*pp_pool_data);
 		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -991,6 +970,82 @@ int count_pools(struct pool_data *p_pool_data)
 	return pool_count;
 }
 
+/*
+ * Build the list of pools in the system, or copy it from the context if it has
+ * already been built. The pool count, pool list and single pool lookups all
+ * use this, so the pool data is collected once for all of them.
+ *
+ * Returns: Number of pools (integer >= 0) if success, with the list in
+ *          *pp_pools for the caller to free
+ */
+int get_all_pools(struct pool **pp_pools)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+	*pp_pools = NULL;
+
+	int pool_count = get_nvm_context_pool_count();
+	if (pool_count == 0)
+	{
+		rc = 0;
+	}
+	else if (pool_count > 0)
+	{
+		*pp_pools = calloc(pool_count, sizeof (struct pool));
+		if (!(*pp_pools))
+		{
+			COMMON_LOG_ERROR("Not enough memory to allocate pool list");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		// the context may have been invalidated since it was counted
+		else if ((rc = get_nvm_context_pools(*pp_pools, pool_count)) != pool_count)
+		{
+			free(*pp_pools);
+			*pp_pools = NULL;
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+
+	if (rc == NVM_ERR_CONTEXT)
+	{
+		struct pool_data *p_pool_data = NULL;
+		rc = collect_required_pool_data(&p_pool_data);
+		if (rc == NVM_SUCCESS && p_pool_data)
+		{
+			rc = count_pools(p_pool_data);
+			if (rc > 0)
+			{
+				pool_count = rc;
+				*pp_pools = calloc(pool_count, sizeof (struct pool));
+				if (!(*pp_pools))
+				{
+					COMMON_LOG_ERROR("Not enough memory to allocate pool list");
+					rc = NVM_ERR_NOMEMORY;
+				}
+				else
+				{
+					rc = populate_pools(p_pool_data, *pp_pools, pool_count);
+				}
+			}
+
+			// update the context, including when there are no pools
+			if (rc >= 0)
+			{
+				set_nvm_context_pools(*pp_pools, rc);
+			}
+			else if (*pp_pools)
+			{
+				free(*pp_pools);
+				*pp_pools = NULL;
+			}
+			free_pool_data(p_pool_data);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Retrieve the number of configured pools of NVM-DIMM capacity in the host server.
  */
@@ -1011,14 +1066,14 @@ int nvm_get_pool_count()
 	{
 		COMMON_LOG_ERROR("Retrieving pools is not supported.");
 	}
+	// the full list is built and cached, so a following get is served from it
 	else if ((rc = get_nvm_context_pool_count()) < 0)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 1);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_pools = NULL;
+		rc = get_all_pools(&p_pools);
+		if (p_pools)
 		{
-			rc = count_pools(p_pool_data);
-			free_pool_data(p_pool_data);
+			free(p_pools);
 		}
 	}
 
@@ -1061,17 +1116,22 @@ int nvm_get_pools(struct pool *p_pools, const NVM_UINT8 count)
 	else if ((rc = get_nvm_context_pools(p_pools, count)) < 0 &&
 			rc != NVM_ERR_ARRAYTOOSMALL)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 0);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_all_pools = NULL;
+		rc = get_all_pools(&p_all_pools);
+		if (rc > 0)
 		{
-			rc = populate_pools(p_pool_data, p_pools, count);
-			// update the context
-			if (rc > 0)
+			// copy as many as fit, like the context does
+			int copy_count = rc;
+			if (count < copy_count)
 			{
-				set_nvm_context_pools(p_pools, rc);
+				copy_count = count;
+				rc = NVM_ERR_ARRAYTOOSMALL;
 			}
-			free_pool_data(p_pool_data);
+			memmove(p_pools, p_all_pools, copy_count * sizeof (struct pool));
+		}
+		if (p_all_pools)
+		{
+			free(p_all_pools);
 		}
 	}
 
@@ -1109,43 +1169,29 @@ int nvm_get_pool(const NVM_UID pool_uid, struct pool *p_pool)
 		COMMON_LOG_ERROR("Invalid parameter, p_pool is NULL");
 		rc = NVM_ERR_INVALIDPARAMETER;
 	}
-	else if ((rc = get_nvm_context_pool(pool_uid, p_pool)) != NVM_SUCCESS)
+	// a miss in a cached pool list means the pool doesn't exist
+	else if ((rc = get_nvm_context_pool(pool_uid, p_pool)) != NVM_SUCCESS &&
+			rc != NVM_ERR_BADPOOL)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 0);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_pools = NULL;
+		rc = get_all_pools(&p_pools);
+		if (rc >= 0)
 		{
-			rc = count_pools(p_pool_data);
-			if (rc > 0)
+			int pool_count = rc;
+			rc = NVM_ERR_BADPOOL;
+			for (int i = 0; i < pool_count; i++)
 			{
-				int pool_count = rc;
-				struct pool *pools = (struct pool *)calloc(pool_count, sizeof (struct pool));
-				if (!pools)
+				if (uid_cmp(p_pools[i].pool_uid, pool_uid))
 				{
-					COMMON_LOG_ERROR("Not enough memory to allocate pool list");
-					rc = NVM_ERR_NOMEMORY;
-				}
-				else
-				{
-					rc = populate_pools(p_pool_data, pools, pool_count);
-					if (rc > 0)
-					{
-						pool_count = rc;
-						rc = NVM_ERR_BADPOOL;
-						for (int i = 0; i < pool_count; i++)
-						{
-							if (uid_cmp(pools[i].pool_uid, pool_uid))
-							{
-								memmove(p_pool, &pools[i], sizeof (struct pool));
-								rc = NVM_SUCCESS;
-								break;
-							}
-						}
-					}
-					free(pools);
+					memmove(p_pool, &p_pools[i], sizeof (struct pool));
+					rc = NVM_SUCCESS;
+					break;
 				}
 			}
-			free_pool_data(p_pool_data);
+		}
+		if (p_pools)
+		{
+			free(p_pools);
 		}
 	}
 
@@ -32,6 +32,8 @@
 
 #include "smbios_utilities.h"
 #include "nvm_types.h"
+#include "nvm_context.h"
+#include "nfit_utilities.h"
 #include "system.h"
 #include <persistence/logging.h>
 #include <smbios/smbios.h>
@@ -42,36 +44,236 @@ int get_dimm_physical_id_from_handle(const NVM_NFIT_DEVICE_HANDLE device_handle)
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_UNKNOWN;
 
-	rc = get_topology_count();
-	if (rc > 0)
+	struct parsed_nfit *p_nfit = NULL;
+	rc = get_parsed_nfit(&p_nfit);
+	if (rc == NVM_SUCCESS && p_nfit)
 	{
-		int topo_count = rc;
-		struct nvm_topology *topology = malloc(topo_count * sizeof(struct nvm_topology));
-		rc = get_topology(topo_count, topology);
-		if (rc > 0)
+		const struct region_mapping *p_mapping =
+				nfit_get_region_mapping_for_handle(p_nfit, device_handle.handle);
+		if (p_mapping)
 		{
+			rc = p_mapping->physical_id;
+		}
+		else
+		{
+			COMMON_LOG_ERROR_F("No NFIT region mapping for handle 0x%x", device_handle.handle);
 			rc = NVM_ERR_BADDEVICE;
-			for (int i = 0; i < topo_count; i++)
+		}
+		free_parsed_nfit(p_nfit);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+#define	SMBIOS_INDEX_EMPTY_BUCKET	(-1)
+
+static inline struct smbios_memory_device_entry *smbios_index_devices(
+		const struct smbios_memory_device_index *p_index)
+{
+	return (struct smbios_memory_device_entry *)(p_index + 1);
+}
+
+static inline NVM_INT32 *smbios_index_buckets(const struct smbios_memory_device_index *p_index)
+{
+	return (NVM_INT32 *)(smbios_index_devices(p_index) + p_index->device_count);
+}
+
+static inline NVM_UINT32 smbios_index_hash(const struct smbios_memory_device_index *p_index,
+		const NVM_UINT16 physical_id)
+{
+	// Fibonacci hashing: multiply by 2^32 / golden ratio and keep the high bits,
+	// which spreads the mostly sequential handles across the buckets.
+	// The product is widened so a shift of 32 (a single bucket) is defined.
+	NVM_UINT32 product = (NVM_UINT32)physical_id * 2654435769u;
+	return (NVM_UINT32)((NVM_UINT64)product >> p_index->bucket_shift);
+}
+
+int smbios_table_to_memory_device_index(const NVM_UINT8 *p_smbios_table,
+		const size_t smbios_data_length, struct smbios_memory_device_index **pp_index)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	int device_count = smbios_get_structure_count_of_type(SMBIOS_STRUCT_TYPE_MEMORY_DEVICE,
+			(const struct smbios_structure_header *)p_smbios_table, smbios_data_length);
+	if (device_count < 0)
+	{
+		device_count = 0;
+	}
+
+	// keep the table at most half full so probe chains stay short
+	NVM_UINT32 bucket_count = 1;
+	NVM_UINT32 bucket_shift = 32;
+	while (bucket_count < (NVM_UINT32)device_count * 2)
+	{
+		bucket_count <<= 1;
+		bucket_shift--;
+	}
+
+	size_t index_size = sizeof (struct smbios_memory_device_index) +
+			(device_count * sizeof (struct smbios_memory_device_entry)) +
+			(bucket_count * sizeof (NVM_INT32));
+	struct smbios_memory_device_index *p_index = calloc(1, index_size);
+	if (!p_index)
+	{
+		COMMON_LOG_ERROR("couldn't allocate memory for SMBIOS memory device index");
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		p_index->size = index_size;
+		p_index->device_count = device_count;
+		p_index->bucket_count = bucket_count;
+		p_index->bucket_shift = bucket_shift;
+
+		struct smbios_memory_device_entry *p_devices = smbios_index_devices(p_index);
+		NVM_INT32 *p_buckets = smbios_index_buckets(p_index);
+		for (NVM_UINT32 i = 0; i < bucket_count; i++)
+		{
+			p_buckets[i] = SMBIOS_INDEX_EMPTY_BUCKET;
+		}
+
+		// a truncated final structure leaves its entry unpopulated and unhashed
+		NVM_UINT32 count = 0;
+		size_t remaining_length = smbios_data_length;
+		const struct smbios_structure_header *p_header =
+				smbios_get_first_structure_of_type(SMBIOS_STRUCT_TYPE_MEMORY_DEVICE,
+				(struct smbios_structure_header *)p_smbios_table, &remaining_length);
+		while (p_header && count < p_index->device_count &&
+				remaining_length >= sizeof (struct smbios_memory_device))
+		{
+			const struct smbios_memory_device *p_device =
+					(const struct smbios_memory_device *)p_header;
+			smbios_memory_device_to_nvm_details(p_device, remaining_length,
+					&p_devices[count].details);
+			if (p_device->size != SMBIOS_SIZE_EMPTY)
 			{
-				if (topology[i].device_handle.handle == device_handle.handle)
-				{
-					rc = topology[i].id;
-					break;
-				}
+				p_devices[count].populated = 1;
+				p_index->populated_count++;
 			}
+
+			// first structure with a given handle wins, same as a linear scan
+			NVM_UINT32 bucket = smbios_index_hash(p_index, p_header->handle);
+			while (p_buckets[bucket] != SMBIOS_INDEX_EMPTY_BUCKET &&
+					p_devices[p_buckets[bucket]].details.id != p_header->handle)
+			{
+				bucket = (bucket + 1) & (bucket_count - 1);
+			}
+			if (p_buckets[bucket] == SMBIOS_INDEX_EMPTY_BUCKET)
+			{
+				p_buckets[bucket] = count;
+			}
+
+			count++;
+			p_header = smbios_get_next_structure_of_type(SMBIOS_STRUCT_TYPE_MEMORY_DEVICE,
+					p_header, &remaining_length);
+		}
+
+		*pp_index = p_index;
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int get_smbios_memory_device_index(struct smbios_memory_device_index **pp_index)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	int index_size = get_nvm_context_smbios_index_size();
+	if (index_size > 0)
+	{
+		*pp_index = calloc(1, index_size);
+		if (!(*pp_index))
+		{
+			COMMON_LOG_ERROR("Not enough memory to retrieve the SMBIOS memory device index");
+			rc = NVM_ERR_NOMEMORY;
 		}
-		else if (rc == 0)
+		else
 		{
-			COMMON_LOG_ERROR("Empty topology after we got a count");
-			rc = NVM_ERR_UNKNOWN;
+			rc = get_nvm_context_smbios_index(index_size, *pp_index);
 		}
+	}
+	else
+	{
+		struct smbios_table_view table;
+		if ((rc = get_smbios_table_view(&table)) == NVM_SUCCESS)
+		{
+			rc = smbios_table_to_memory_device_index(table.p_table, table.size, pp_index);
+			put_smbios_table_view(&table);
+		}
+
+		if (rc == NVM_SUCCESS)
+		{
+			// not an error if there is no context to cache it in
+			set_nvm_context_smbios_index((*pp_index)->size, *pp_index);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int smbios_index_get_dimm_details(const struct smbios_memory_device_index *p_index,
+		const NVM_UINT16 physical_id, struct nvm_details *p_dimm_details)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_BADDEVICE;
 
-        free(topology);
+	if (p_index->bucket_count > 0)
+	{
+		const struct smbios_memory_device_entry *p_devices = smbios_index_devices(p_index);
+		const NVM_INT32 *p_buckets = smbios_index_buckets(p_index);
+		NVM_UINT32 bucket = smbios_index_hash(p_index, physical_id);
+		while (p_buckets[bucket] != SMBIOS_INDEX_EMPTY_BUCKET)
+		{
+			if (p_devices[p_buckets[bucket]].details.id == physical_id)
+			{
+				memmove(p_dimm_details, &p_devices[p_buckets[bucket]].details,
+						sizeof (struct nvm_details));
+				rc = NVM_SUCCESS;
+				break;
+			}
+			bucket = (bucket + 1) & (p_index->bucket_count - 1);
+		}
 	}
-	else if (rc == 0)
+
+	if (rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR("Asked for a handle, but topology count == 0");
-		rc = NVM_ERR_BADDEVICE;
+		COMMON_LOG_ERROR_F("Memory Device with SMBIOS handle %hu not found", physical_id);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int smbios_index_to_nvm_details_array(const struct smbios_memory_device_index *p_index,
+		struct nvm_details *p_details, const size_t num_details)
+{
+	COMMON_LOG_ENTRY();
+	int rc = 0;
+
+	const struct smbios_memory_device_entry *p_devices = smbios_index_devices(p_index);
+	for (NVM_UINT32 i = 0; i < p_index->device_count; i++)
+	{
+		if (p_devices[i].populated)
+		{
+			if (rc < num_details)
+			{
+				memmove(&p_details[rc], &p_devices[i].details, sizeof (struct nvm_details));
+				rc++;
+			}
+			else
+			{
+				COMMON_LOG_ERROR_F(
+						"Too many SMBIOS type 17 devices for nvm_details array size = %llu",
+						num_details);
+				rc = NVM_ERR_ARRAYTOOSMALL;
+				break;
+			}
+		}
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -84,18 +286,21 @@ int get_dimm_details_for_physical_id(const NVM_UINT16 physical_id,
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	NVM_UINT8 *p_smbios_table = NULL;
-	size_t smbios_table_size = 0;
-	rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-	if (rc == NVM_SUCCESS)
+	// look up in place when the context already holds the index
+	rc = get_nvm_context_smbios_dimm_details(physical_id, p_dimm_details);
+	if (rc == NVM_ERR_CONTEXT)
 	{
-		rc = get_dimm_details_from_smbios_table(p_smbios_table, smbios_table_size,
-				physical_id, p_dimm_details);
-	}
+		struct smbios_memory_device_index *p_index = NULL;
+		rc = get_smbios_memory_device_index(&p_index);
+		if (rc == NVM_SUCCESS)
+		{
+			rc = smbios_index_get_dimm_details(p_index, physical_id, p_dimm_details);
+		}
 
-	if (p_smbios_table)
-	{
-		free(p_smbios_table);
+		if (p_index)
+		{
+			free(p_index);
+		}
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
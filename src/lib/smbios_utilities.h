@@ -38,6 +38,57 @@
 #include "device_adapter.h"
 #include "export_api.h"
 
+/*
+ * SMBIOS Type 17 memory device entry in a memory device index
+ */
+struct smbios_memory_device_entry
+{
+	NVM_BOOL populated;
+	struct nvm_details details;
+};
+
+/*
+ * Index of the SMBIOS Type 17 memory devices keyed by physical ID (structure handle).
+ * The index is built from the raw table once so per-DIMM lookups don't rescan it.
+ * It is a single allocation of size bytes with no internal pointers so it can be
+ * copied with memmove. The header is followed by device_count entries and
+ * bucket_count hash slots.
+ */
+struct smbios_memory_device_index
+{
+	NVM_UINT32 size;
+	NVM_UINT32 device_count;
+	NVM_UINT32 populated_count;
+	NVM_UINT32 bucket_count; // power of 2
+	NVM_UINT32 bucket_shift; // 32 - log2(bucket_count)
+};
+
+/*
+ * Build a memory device index from a raw SMBIOS table.
+ * Caller is responsible for freeing *pp_index.
+ */
+NVM_API int smbios_table_to_memory_device_index(const NVM_UINT8 *p_smbios_table,
+		const size_t smbios_data_length, struct smbios_memory_device_index **pp_index);
+
+/*
+ * Get the memory device index for the system, from the context if one has been built.
+ * Caller is responsible for freeing *pp_index.
+ */
+NVM_API int get_smbios_memory_device_index(struct smbios_memory_device_index **pp_index);
+
+/*
+ * Get DIMM details for a specific DIMM physical ID from a memory device index.
+ */
+NVM_API int smbios_index_get_dimm_details(const struct smbios_memory_device_index *p_index,
+		const NVM_UINT16 physical_id, struct nvm_details *p_dimm_details);
+
+/*
+ * Copy the populated memory devices in the index to an nvm_details array.
+ * Returns count if successful, NVM error code if not.
+ */
+NVM_API int smbios_index_to_nvm_details_array(const struct smbios_memory_device_index *p_index,
+		struct nvm_details *p_details, const size_t num_details);
+
 /*
  * Get the SMBIOS physical ID of a DIMM with a given device handle.
  */
@@ -177,25 +177,18 @@ int nvm_gather_support(const NVM_PATH support_file, const NVM_SIZE support_file_
 
 				if (encrypt)
 				{
-					COMMON_PATH compressed_file;
 					COMMON_PATH encrypted_file;
 
-					// This entire process adds a CRYPTO_FILE_EXT file extension to the filename
-					if ((temp_rc = compress_file(support_file, compressed_file)) != COMMON_SUCCESS)
+					// This entire process adds a COMPRESS_FILE_EXT and CRYPTO_FILE_EXT
+					// file extension to the filename
+					if ((temp_rc = compress_encrypt_file(support_file, encrypted_file,
+							DFLT_COMPRESSION_LEVEL, COMPRESSION_MAX_THREADS)) != NVM_SUCCESS)
 					{
 						// should never get in here
-						COMMON_LOG_ERROR_F("Support file compression failed. rc=%d", temp_rc);
+						COMMON_LOG_ERROR_F("Support file compression and encryption failed. rc=%d",
+								temp_rc);
 						rc = NVM_ERR_BADFILE;
 					}
-					else if ((temp_rc = rsa_encrypt(compressed_file, encrypted_file))
-							!= NVM_SUCCESS)
-					{
-
-						// should never get in here
-						COMMON_LOG_ERROR_F("Support file encryption failed. rc=%d", temp_rc);
-						rc = NVM_ERR_BADFILE;
-
-					}
 				}
 			}
 		}
@@ -153,6 +153,28 @@ int get_socket(NVM_UINT16 socket_id, struct socket *p_socket);
  */
 int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size);
 
+/*
+ * Read-only view of the raw SMBIOS table
+ */
+struct smbios_table_view
+{
+	const NVM_UINT8 *p_table;
+	size_t size;
+	NVM_BOOL mapped; // view is an mmap rather than a heap copy
+};
+
+/*
+ * Fetches a read-only view of the SMBIOS table. Where the OS exports the table as
+ * a file it is mapped directly, otherwise this falls back to get_smbios_table_alloc.
+ * Caller is responsible for releasing the view with put_smbios_table_view.
+ */
+int get_smbios_table_view(struct smbios_table_view *p_view);
+
+/*
+ * Release a view retrieved with get_smbios_table_view.
+ */
+void put_smbios_table_view(struct smbios_table_view *p_view);
+
 /*
  * Retrieves Socket SKU information about a given processor socket.
  * @param[in] p_pcat
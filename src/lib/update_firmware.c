@@ -38,6 +38,29 @@
 #include <persistence/logging.h>
 #include <file_ops/file_ops_adapter.h>
 #include <os/os_adapter.h>
+#include <time/time_utilities.h>
+#include "device_adapter.h"
+
+#define	FW_TRANSFER_REPORT_INTERVAL_MS	250
+
+/*
+ * State of a FW image transfer to one device. The pass through command and
+ * payload are set up once and reused for every packet.
+ */
+struct fw_transfer
+{
+	NVM_NFIT_DEVICE_HANDLE device_handle;
+	const char *device_uid;
+	const struct fw_update_callbacks *p_callbacks;
+	const unsigned char *p_fw_image;
+	unsigned int fw_image_size;
+	struct fw_cmd cmd;
+	struct pt_update_fw_small_payload small_payload;
+	struct fw_transfer_progress progress;
+	unsigned long long start_time;
+	unsigned long long last_report_time;
+	NVM_UINT8 last_reported_percent;
+};
 
 /*
  * Retrieve the firmware image log information from the device specified.
@@ -102,96 +125,193 @@ int nvm_get_device_fw_image_info(const NVM_UID device_uid,
 }
 
 /*
- * Helper function to read all bytes from a file and return an NVM error code
+ * Helper function to map the FW image file read-only and return an NVM error code
  */
-int read_file_bytes(const NVM_PATH path, const NVM_SIZE path_len,
-		unsigned char **pp_buf, unsigned int *p_buf_len)
+int map_fw_image(const NVM_PATH path, const NVM_SIZE path_len,
+		const unsigned char **pp_buf, unsigned int *p_buf_len)
 {
 	int rc;
 
-	switch (copy_file_to_buffer(path, path_len, (void **)pp_buf, p_buf_len))
+	switch (map_file_read_only(path, path_len, (const void **)pp_buf, p_buf_len))
 	{
 		case COMMON_SUCCESS:
 			rc = NVM_SUCCESS;
 			break;
-		case COMMON_ERR_NOMEMORY:
-			COMMON_LOG_ERROR("Not enough memory to copy the FW file to a buffer");
-			rc = NVM_ERR_NOMEMORY;
-			break;
 		case COMMON_ERR_BADFILE:
 			COMMON_LOG_ERROR("The FW image file is not valid.");
 			rc = NVM_ERR_BADFILE;
 			break;
 		default:
-			COMMON_LOG_ERROR("Failed to copy the FW image file to a buffer.");
+			COMMON_LOG_ERROR("Failed to map the FW image file.");
 			rc = NVM_ERR_BADFILE;
 			break;
 	}
 	return rc;
 }
 
-int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
-		unsigned char *p_fw_image, const unsigned int fw_image_size)
+/*
+ * Determine at runtime whether the device can take the FW image as one large payload.
+ * The BIOS has to answer the emulated get payload size command with a large input
+ * mailbox that holds the whole image.
+ */
+NVM_BOOL is_large_payload_fw_transfer_supported(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		const unsigned int fw_image_size)
+{
+	NVM_BOOL supported = 0;
+
+	struct pt_bios_get_size payload_size;
+	int rc = fw_get_large_payload_size(device_handle, &payload_size);
+	if (rc != NVM_SUCCESS)
+	{
+		COMMON_LOG_WARN_F("Unable to retrieve the large payload size of device 0x%x, "
+				"request returned %d, transferring the FW image with small payloads",
+				device_handle.handle, rc);
+	}
+	else if (payload_size.large_input_payload_size < fw_image_size)
+	{
+		COMMON_LOG_WARN_F("The large input payload of device 0x%x holds %u bytes, "
+				"transferring the %u byte FW image with small payloads",
+				device_handle.handle, payload_size.large_input_payload_size, fw_image_size);
+	}
+	else
+	{
+		supported = 1;
+	}
+
+	return supported;
+}
+
+void init_fw_transfer(struct fw_transfer *p_transfer,
+		const NVM_NFIT_DEVICE_HANDLE device_handle, const char *device_uid,
+		const unsigned char *p_fw_image, const unsigned int fw_image_size,
+		const struct fw_update_callbacks *p_callbacks)
+{
+	memset(p_transfer, 0, sizeof (*p_transfer));
+	p_transfer->device_handle = device_handle;
+	p_transfer->device_uid = device_uid;
+	p_transfer->p_callbacks = p_callbacks;
+	p_transfer->p_fw_image = p_fw_image;
+	p_transfer->fw_image_size = fw_image_size;
+
+	p_transfer->cmd.device_handle = device_handle.handle;
+	p_transfer->cmd.opcode = PT_UPDATE_FW;
+	p_transfer->cmd.sub_opcode = SUBOP_UPDATE_FW;
+
+	p_transfer->small_payload.payload_selector = TRANSFER_VIA_SMALL_PAYLOAD;
+
+	p_transfer->progress.total_bytes = fw_image_size;
+	get_current_time_msec(&p_transfer->start_time);
+}
+
+NVM_BOOL is_fw_transfer_canceled(const struct fw_transfer *p_transfer)
+{
+	NVM_BOOL canceled = 0;
+	if (p_transfer->p_callbacks != NULL && p_transfer->p_callbacks->cancel != NULL)
+	{
+		canceled = p_transfer->p_callbacks->cancel(p_transfer->device_uid,
+				p_transfer->p_callbacks->p_context);
+	}
+	return canceled;
+}
+
+/*
+ * Update the progress of the transfer and report it to the caller. Reports are
+ * coalesced to one per percentage point and reporting interval, except the last.
+ */
+void update_fw_transfer_progress(struct fw_transfer *p_transfer,
+		const unsigned int bytes_transferred)
+{
+	unsigned long long now = 0;
+	get_current_time_msec(&now);
+
+	struct fw_transfer_progress *p_progress = &p_transfer->progress;
+	p_progress->bytes_transferred = bytes_transferred;
+	p_progress->percent_complete = (NVM_UINT8)
+			(((unsigned long long)bytes_transferred * 100) / p_transfer->fw_image_size);
+	if (now > p_transfer->start_time)
+	{
+		p_progress->bytes_per_second = ((unsigned long long)bytes_transferred * 1000) /
+				(now - p_transfer->start_time);
+	}
+
+	if (p_transfer->p_callbacks != NULL && p_transfer->p_callbacks->progress != NULL &&
+			(bytes_transferred == p_transfer->fw_image_size ||
+			(p_progress->percent_complete > p_transfer->last_reported_percent &&
+			(now - p_transfer->last_report_time) >= FW_TRANSFER_REPORT_INTERVAL_MS)))
+	{
+		p_transfer->p_callbacks->progress(p_transfer->device_uid, p_progress,
+				p_transfer->p_callbacks->p_context);
+		p_transfer->last_report_time = now;
+		p_transfer->last_reported_percent = p_progress->percent_complete;
+	}
+}
+
+int transfer_fw_large_payload(struct fw_transfer *p_transfer)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-#if __SET_LARGE_FW_UPDATE__
-	// send a pass through command to update the fw
-	struct fw_cmd cmd;
-	memset(&cmd, 0, sizeof (cmd));
-	cmd.device_handle = device_handle.handle;
-	cmd.opcode = PT_UPDATE_FW;
-	cmd.sub_opcode = SUBOP_UPDATE_FW;
-	cmd.large_input_payload_size = fw_image_size;
-	cmd.large_input_payload = p_fw_image;
-
-	rc = ioctl_passthrough_cmd(&cmd);
-#else
-	struct fw_cmd cmd;
-	memset(&cmd, 0, sizeof (cmd));
-	cmd.device_handle = device_handle.handle;
-	cmd.opcode = PT_UPDATE_FW;
-	cmd.sub_opcode = SUBOP_UPDATE_FW;
-
-	struct pt_update_fw_small_payload input_payload;
-	memset(&input_payload, 0, sizeof (input_payload));
-	input_payload.payload_selector = TRANSFER_VIA_SMALL_PAYLOAD;
+	if (is_fw_transfer_canceled(p_transfer))
+	{
+		rc = NVM_ERR_CANCELED;
+	}
+	else
+	{
+		p_transfer->cmd.large_input_payload_size = p_transfer->fw_image_size;
+		// the image is only read by the transfer
+		p_transfer->cmd.large_input_payload = (void *)p_transfer->p_fw_image;
+
+		rc = ioctl_passthrough_cmd(&p_transfer->cmd);
+		if (rc == NVM_SUCCESS)
+		{
+			update_fw_transfer_progress(p_transfer, p_transfer->fw_image_size);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int transfer_fw_small_payload(struct fw_transfer *p_transfer)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct pt_update_fw_small_payload *p_payload = &p_transfer->small_payload;
+	p_transfer->cmd.input_payload = p_payload;
+	p_transfer->cmd.input_payload_size = sizeof (*p_payload);
+
 	NVM_UINT16 packet_number = 0;
 	unsigned int offset = 0;
-	printf("Transferring the firmware to DIMM %u...\n",
-		device_handle.handle);
-	float num_packets = fw_image_size / TRANSFER_SIZE;
-	int old_percent_complete = 0; // print status
-	while (offset < fw_image_size)
-	{
-		// status
-		int size = TRANSFER_SIZE;
+	while (offset < p_transfer->fw_image_size)
+	{
+		if (is_fw_transfer_canceled(p_transfer))
+		{
+			COMMON_LOG_ERROR_F("FW transfer canceled at packet_number %u",
+					packet_number);
+			rc = NVM_ERR_CANCELED;
+			break;
+		}
+
+		unsigned int size = TRANSFER_SIZE;
 		if (offset == 0)
 		{
-			input_payload.transfer_header =
+			p_payload->transfer_header =
 				TRANSFER_HEADER(TRANSFER_TYPE_INITIATE, packet_number);
 		}
-		else if ((offset + TRANSFER_SIZE) < fw_image_size)
+		else if ((offset + TRANSFER_SIZE) < p_transfer->fw_image_size)
 		{
-			input_payload.transfer_header =
+			p_payload->transfer_header =
 				TRANSFER_HEADER(TRANSFER_TYPE_CONTINUE, packet_number);
 		}
-		else if ((offset + TRANSFER_SIZE) == fw_image_size)
-		{
-			input_payload.transfer_header =
-				TRANSFER_HEADER(TRANSFER_TYPE_END, packet_number);
-		}
-		else if ((offset + TRANSFER_SIZE) > fw_image_size)
+		else
 		{
-			size = fw_image_size - offset;
-			input_payload.transfer_header =
+			size = p_transfer->fw_image_size - offset;
+			p_payload->transfer_header =
 				TRANSFER_HEADER(TRANSFER_TYPE_END, packet_number);
 		}
-		memmove(input_payload.data, (void *)p_fw_image + offset, size);
-		cmd.input_payload = &input_payload;
-		cmd.input_payload_size = sizeof (input_payload);
-		rc = ioctl_passthrough_cmd(&cmd);
+		memmove(p_payload->data, p_transfer->p_fw_image + offset, size);
+		rc = ioctl_passthrough_cmd(&p_transfer->cmd);
 		if (rc != NVM_SUCCESS)
 		{
 			COMMON_LOG_ERROR_F("Failed to transfer FW packet_number %u",
@@ -201,16 +321,31 @@ int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
 		offset += size;
 		packet_number++;
 
-		// update status
-		int percent_complete = (int)(((float)packet_number / num_packets) * 100);
-		if (percent_complete > old_percent_complete)
-		{
-			printf(".");
-			old_percent_complete = percent_complete;
-		}
+		update_fw_transfer_progress(p_transfer, offset);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		const char *device_uid, const unsigned char *p_fw_image,
+		const unsigned int fw_image_size, const struct fw_update_callbacks *p_callbacks)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct fw_transfer transfer;
+	init_fw_transfer(&transfer, device_handle, device_uid, p_fw_image, fw_image_size,
+			p_callbacks);
+	if (is_large_payload_fw_transfer_supported(device_handle, fw_image_size))
+	{
+		rc = transfer_fw_large_payload(&transfer);
+	}
+	else
+	{
+		rc = transfer_fw_small_payload(&transfer);
 	}
-	printf("\n");
-#endif
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -264,35 +399,221 @@ int get_firmware_update_status(const NVM_NFIT_DEVICE_HANDLE device_handle)
 	return rc;
 }
 
-int update_firmware(const NVM_NFIT_DEVICE_HANDLE device_handle, const NVM_PATH path,
-		const NVM_SIZE path_len)
+int update_firmware(const NVM_NFIT_DEVICE_HANDLE device_handle, const char *device_uid,
+		const unsigned char *p_fw, const unsigned int fw_size,
+		const struct fw_update_callbacks *p_callbacks)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	// copy the file to the input buffer
-	unsigned int fw_size = 0;
-	unsigned char *p_fw = NULL;
-	if ((rc = read_file_bytes(path, path_len, &p_fw, &fw_size)) == NVM_SUCCESS)
+	rc = send_new_firmware_to_device(device_handle, device_uid, p_fw, fw_size,
+			p_callbacks);
+	if (rc == NVM_SUCCESS)
+	{
+		while ((rc = get_firmware_update_status(device_handle)) == NVM_ERR_DEVICEBUSY)
+		{
+			nvm_sleep(1000); // 1 second
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Check the parts of the FW image header that don't depend on the device
+ */
+int check_fw_image_header(const unsigned char *p_buf, const unsigned int buf_len)
+{
+	int rc = NVM_SUCCESS;
+
+	if (buf_len < sizeof (fwImageHeader))
+	{
+		COMMON_LOG_ERROR("The FW image file is not valid. Image is too small.");
+		rc = NVM_ERR_BADFIRMWARE;
+	}
+	else
 	{
-		rc = send_new_firmware_to_device(device_handle, p_fw, fw_size);
+		const fwImageHeader *p_header = (const fwImageHeader *)p_buf;
+
+		// check some of the header values
+		if (p_header->moduleType != FW_HEADER_MODULETYPE ||
+				p_header->moduleVendor != FW_HEADER_MODULEVENDOR)
+		{
+			COMMON_LOG_ERROR("The FW image file is not valid. ");
+			rc = NVM_ERR_BADFIRMWARE;
+		}
+	}
+
+	return rc;
+}
+
+/*
+ * Determine if an image with a valid header can be loaded onto the device
+ */
+int examine_fw_image(const struct device_discovery *p_discovery, const unsigned char *p_buf,
+		NVM_VERSION image_version, const NVM_SIZE image_version_len)
+{
+	int rc = NVM_SUCCESS;
+	const fwImageHeader *p_header = (const fwImageHeader *)p_buf;
+
+	unsigned short int current_major;
+	unsigned short int current_minor;
+	unsigned short int current_hotfix;
+	unsigned short int current_build;
+	unsigned short int current_fwAPI_major;
+	unsigned short int current_fwAPI_minor;
+	int image_major = p_header->imageVersion.majorVer.version;
+	int image_minor = p_header->imageVersion.minorVer.version;
+	int image_hotfix = p_header->imageVersion.hotfixVer.version;
+	int image_build = p_header->imageVersion.buildVer.build;
+	unsigned int image_fwAPI_major =
+			get_fw_api_major_version(p_header->fwApiVersion);
+	unsigned int image_fwAPI_minor =
+			get_fw_api_minor_version(p_header->fwApiVersion);
+
+	unsigned long long bsr = 0;
+
+	build_revision(image_version, image_version_len, image_major,
+			image_minor, image_hotfix, image_build);
+
+	parse_main_revision(&current_major, &current_minor, &current_hotfix,
+			&current_build, p_discovery->fw_revision, NVM_VERSION_LEN);
+
+	parse_fw_revision(&current_fwAPI_major, &current_fwAPI_minor,
+			p_discovery->fw_api_version, NVM_VERSION_LEN);
+
+	if (image_major != current_major)
+	{
+		COMMON_LOG_ERROR("The FW image file is not valid. "
+				"Product number cannot be changed.");
+		rc = NVM_ERR_BADFIRMWARE;
+	}
+	else if (image_major == current_major && image_minor < current_minor)
+	{
+		COMMON_LOG_ERROR("The FW image file is not valid. "
+				"Revision number cannot be downgraded.");
+		rc = NVM_ERR_BADFIRMWARE;
+	}
+	else if (is_fw_api_version_downgraded(current_fwAPI_major, current_fwAPI_minor,
+					image_fwAPI_major, image_fwAPI_minor))
+	{
+		if (!is_fw_api_version_supported(image_fwAPI_major, image_fwAPI_minor))
+		{
+			COMMON_LOG_ERROR("The firmware image is not compatible with this "
+					"version of software.");
+			rc = NVM_ERR_INCOMPATIBLEFW;
+		}
+		else
+		{
+			rc = NVM_ERR_REQUIRESFORCE;
+		}
+	}
+	else if (image_hotfix < current_hotfix)
+	{
+		rc = fw_get_bsr(p_discovery->device_handle, &bsr);
 		if (rc == NVM_SUCCESS)
 		{
-			while ((rc = get_firmware_update_status(device_handle)) == NVM_ERR_DEVICEBUSY)
+			if (!BSR_OPTIN_ENABLED(bsr))
 			{
-				nvm_sleep(1000); // 1 second
+				COMMON_LOG_ERROR("The FW image file is not valid. "
+						"Svn Downgrade Opt-In is disabled.");
+				rc = NVM_ERR_BADFIRMWARE;
+			}
+			else
+			{
+				rc = NVM_ERR_REQUIRESFORCE;
 			}
-			// Changing the state invalidates the device cache
-			invalidate_devices();
+		}
+		else
+		{
+			COMMON_LOG_ERROR("Could not get the BSR. "
+					"Couldnot determine the Opt-In value");
 		}
 	}
+	else if (image_build < current_build)
+	{
+		rc = NVM_ERR_REQUIRESFORCE;
+	}
+
+	return rc;
+}
 
-	free(p_fw);
+/*
+ * Examine an image with a valid header for the device and, if it can be loaded
+ * (or force allows it), transfer it and wait for the update to finish.
+ */
+int update_device_fw_image(const struct device_discovery *p_discovery,
+		const unsigned char *p_fw, const unsigned int fw_size, const NVM_BOOL force,
+		const struct fw_update_callbacks *p_callbacks, NVM_VERSION fw_version)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	memset(fw_version, 0, NVM_VERSION_LEN);
+	rc = examine_fw_image(p_discovery, p_fw, fw_version, NVM_VERSION_LEN);
+#if __EARLY_HW__ // not sure what header firmware is using currently
+	rc = NVM_SUCCESS;
+#endif
+	if ((rc == NVM_SUCCESS) || (rc == NVM_ERR_REQUIRESFORCE && force == 1))
+	{
+		rc = update_firmware(p_discovery->device_handle, p_discovery->uid, p_fw, fw_size,
+				p_callbacks);
+	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
+/*
+ * Log an event indicating we successfully updated the device
+ */
+void log_fw_update_event(const NVM_UID device_uid, const NVM_VERSION fw_version)
+{
+	NVM_EVENT_ARG uid_arg;
+	uid_to_event_arg(device_uid, uid_arg);
+	NVM_EVENT_ARG version_arg;
+	s_strcpy(version_arg, fw_version, NVM_EVENT_ARG_LEN);
+	log_mgmt_event(EVENT_SEVERITY_INFO,
+			EVENT_CODE_MGMT_FIRMWARE_UPDATE,
+			device_uid,
+			0, // no action required
+			uid_arg, version_arg, NULL);
+}
+
+/*
+ * Check the parameters shared by the FW update functions
+ */
+int check_fw_update_path(const NVM_PATH path, const NVM_SIZE path_len)
+{
+	int rc = NVM_SUCCESS;
+
+	if (path == NULL)
+	{
+		COMMON_LOG_ERROR("File path is NULL");
+		rc = NVM_ERR_BADFILE;
+	}
+	else if (path_len >= NVM_PATH_LEN)
+	{
+		COMMON_LOG_ERROR_F(
+				"Invalid parameter, path length is too big: %d; <= %d",
+				path_len, NVM_PATH_LEN);
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (path_len == 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, path length is 0");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (!file_exists(path, path_len))
+	{
+		COMMON_LOG_ERROR_F("File %s does not exist", path);
+		rc = NVM_ERR_BADFILE;
+	}
+
+	return rc;
+}
+
 /*
  * Push a new FW image to the device specified.
  */
@@ -320,54 +641,145 @@ int nvm_update_device_fw(const NVM_UID device_uid, const NVM_PATH path,
 		COMMON_LOG_ERROR("Invalid parameter, device_uid is NULL");
 		rc = NVM_ERR_INVALIDPARAMETER;
 	}
-	else if (path == NULL)
+	else if ((rc = check_fw_update_path(path, path_len)) != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR("File path is NULL");
-		rc = NVM_ERR_BADFILE;
+		// error already logged
 	}
-	else if (path_len >= NVM_PATH_LEN)
+	else if ((rc = exists_and_manageable(device_uid, &discovery, 1)) == NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F(
-				"Invalid parameter, path length is too big: %d; <= %d",
-				path_len, NVM_PATH_LEN);
+		const unsigned char *p_fw = NULL;
+		unsigned int fw_size = 0;
+		if ((rc = map_fw_image(path, path_len, &p_fw, &fw_size)) == NVM_SUCCESS)
+		{
+			NVM_VERSION fw_version;
+			if ((rc = check_fw_image_header(p_fw, fw_size)) == NVM_SUCCESS)
+			{
+				rc = update_device_fw_image(&discovery, p_fw, fw_size, force,
+						NULL, fw_version);
+				// Changing the state invalidates the device cache
+				invalidate_devices();
+			}
+			unmap_file(p_fw, fw_size);
+
+			if (rc == NVM_SUCCESS)
+			{
+				log_fw_update_event(device_uid, fw_version);
+			}
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+struct fw_update_work
+{
+	const NVM_UID *p_device_uids;
+	int *p_results;
+	NVM_VERSION *p_fw_versions;
+	const unsigned char *p_fw;
+	unsigned int fw_size;
+	NVM_BOOL force;
+	const struct fw_update_callbacks *p_callbacks;
+};
+
+static void update_devices_fw_worker(void *arg, COMMON_UINT32 index)
+{
+	struct fw_update_work *p_work = (struct fw_update_work *)arg;
+	struct device_discovery discovery;
+	int rc = exists_and_manageable(p_work->p_device_uids[index], &discovery, 1);
+	if (rc == NVM_SUCCESS)
+	{
+		rc = update_device_fw_image(&discovery, p_work->p_fw, p_work->fw_size,
+				p_work->force, p_work->p_callbacks,
+				p_work->p_fw_versions[index]);
+	}
+	p_work->p_results[index] = rc;
+}
+
+/*
+ * Push a new FW image to several devices, updating the devices in parallel.
+ */
+int nvm_update_devices_fw(const NVM_UID *p_device_uids, int *p_results,
+		const NVM_UINT32 device_count, const NVM_PATH path, const NVM_SIZE path_len,
+		const NVM_BOOL force, const struct fw_update_callbacks *p_callbacks)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	const unsigned char *p_fw = NULL;
+	unsigned int fw_size = 0;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if ((rc = IS_NVM_FEATURE_SUPPORTED(modify_device_settings)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("Modifying device settings is not supported.");
+	}
+	else if (p_device_uids == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_device_uids is NULL");
 		rc = NVM_ERR_INVALIDPARAMETER;
 	}
-	else if (path_len == 0)
+	else if (p_results == NULL)
 	{
-		COMMON_LOG_ERROR("Invalid parameter, path length is 0");
+		COMMON_LOG_ERROR("Invalid parameter, p_results is NULL");
 		rc = NVM_ERR_INVALIDPARAMETER;
 	}
-	else if (!file_exists(path, path_len))
+	else if ((rc = check_fw_update_path(path, path_len)) != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("File %s does not exist", path);
-		rc = NVM_ERR_BADFILE;
+		// error already logged
 	}
-	else if ((rc = exists_and_manageable(device_uid, &discovery, 1)) == NVM_SUCCESS)
+	// the image is mapped and its header checked once for all the devices
+	else if ((rc = map_fw_image(path, path_len, &p_fw, &fw_size)) != NVM_SUCCESS)
 	{
-		NVM_VERSION fw_version;
-		rc = nvm_examine_device_fw(device_uid, path, path_len, fw_version, NVM_VERSION_LEN);
-#if __EARLY_HW__ // not sure what header firmware is using currently
-		rc = NVM_SUCCESS;
-#endif
-		if ((rc == NVM_SUCCESS) || (rc == NVM_ERR_REQUIRESFORCE && force == 1))
+		// error already logged
+	}
+	else if ((rc = check_fw_image_header(p_fw, fw_size)) != NVM_SUCCESS)
+	{
+		unmap_file(p_fw, fw_size);
+	}
+	else
+	{
+		struct fw_update_work work;
+		memset(&work, 0, sizeof (work));
+		work.p_device_uids = p_device_uids;
+		work.p_results = p_results;
+		work.p_fw = p_fw;
+		work.fw_size = fw_size;
+		work.force = force;
+		work.p_callbacks = p_callbacks;
+
+		if (device_count > 0 &&
+				(work.p_fw_versions = calloc(device_count, sizeof (NVM_VERSION))) == NULL)
 		{
-			rc = update_firmware(discovery.device_handle, path, path_len);
+			COMMON_LOG_ERROR("Not enough memory for the FW image versions");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			// each device is independent
+			run_parallel(device_count, PARALLEL_MAX_THREADS, update_devices_fw_worker, &work);
 
-			if (rc == NVM_SUCCESS)
-			{
-				// Log an event indicating we successfully updated
-				NVM_EVENT_ARG uid_arg;
-				uid_to_event_arg(device_uid, uid_arg);
-				NVM_EVENT_ARG version_arg;
-				s_strcpy(version_arg, fw_version, NVM_EVENT_ARG_LEN);
-				log_mgmt_event(EVENT_SEVERITY_INFO,
-						EVENT_CODE_MGMT_FIRMWARE_UPDATE,
-						device_uid,
-						0, // no action required
-						uid_arg, version_arg, NULL);
+			// Changing the state invalidates the device cache
+			invalidate_devices();
 
+			for (int i = 0; i < device_count; i++)
+			{
+				if (p_results[i] == NVM_SUCCESS)
+				{
+					log_fw_update_event(p_device_uids[i], work.p_fw_versions[i]);
+				}
 			}
 		}
+
+		free(work.p_fw_versions);
+		unmap_file(p_fw, fw_size);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -433,114 +845,16 @@ int nvm_examine_device_fw(const NVM_UID device_uid, const NVM_PATH path, const N
 	else if ((rc = exists_and_manageable(device_uid, &discovery, 1)) == NVM_SUCCESS)
 	{
 		unsigned int buf_len = 0;
-		unsigned char *p_buf = NULL;
+		const unsigned char *p_buf = NULL;
 
 		memset(image_version, 0, image_version_len);
-		if ((rc = read_file_bytes(path, path_len, &p_buf, &buf_len)) == NVM_SUCCESS)
+		if ((rc = map_fw_image(path, path_len, &p_buf, &buf_len)) == NVM_SUCCESS)
 		{
-			if (buf_len < sizeof (fwImageHeader))
+			if ((rc = check_fw_image_header(p_buf, buf_len)) == NVM_SUCCESS)
 			{
-				COMMON_LOG_ERROR("The FW image file is not valid. Image is too small.");
-				rc = NVM_ERR_BADFIRMWARE;
+				rc = examine_fw_image(&discovery, p_buf, image_version, image_version_len);
 			}
-			else
-			{
-				fwImageHeader *p_header = (fwImageHeader *)p_buf;
-
-				// check some of the header values
-				if (p_header->moduleType != FW_HEADER_MODULETYPE ||
-						p_header->moduleVendor != FW_HEADER_MODULEVENDOR)
-				{
-					COMMON_LOG_ERROR("The FW image file is not valid. ");
-					rc = NVM_ERR_BADFIRMWARE;
-					// no need to continue checking already know the FW is bad
-				}
-				else
-				{
-					unsigned short int current_major;
-					unsigned short int current_minor;
-					unsigned short int current_hotfix;
-					unsigned short int current_build;
-					unsigned short int current_fwAPI_major;
-					unsigned short int current_fwAPI_minor;
-					int image_major = p_header->imageVersion.majorVer.version;
-					int image_minor = p_header->imageVersion.minorVer.version;
-					int image_hotfix = p_header->imageVersion.hotfixVer.version;
-					int image_build = p_header->imageVersion.buildVer.build;
-					unsigned int image_fwAPI_major =
-							get_fw_api_major_version(p_header->fwApiVersion);
-					unsigned int image_fwAPI_minor =
-							get_fw_api_minor_version(p_header->fwApiVersion);
-
-					unsigned long long bsr = 0;
-
-					build_revision(image_version, image_version_len, image_major,
-							image_minor, image_hotfix, image_build);
-
-					parse_main_revision(&current_major, &current_minor, &current_hotfix,
-							&current_build, discovery.fw_revision, NVM_VERSION_LEN);
-
-					parse_fw_revision(&current_fwAPI_major, &current_fwAPI_minor,
-							discovery.fw_api_version, NVM_VERSION_LEN);
-
-					if (image_major != current_major)
-					{
-						COMMON_LOG_ERROR("The FW image file is not valid. "
-								"Product number cannot be changed.");
-						rc = NVM_ERR_BADFIRMWARE;
-					}
-					else if (image_major == current_major && image_minor < current_minor)
-					{
-						COMMON_LOG_ERROR("The FW image file is not valid. "
-								"Revision number cannot be downgraded.");
-						rc = NVM_ERR_BADFIRMWARE;
-					}
-					else if (is_fw_api_version_downgraded(current_fwAPI_major, current_fwAPI_minor,
-									image_fwAPI_major, image_fwAPI_minor))
-					{
-						if (!is_fw_api_version_supported(image_fwAPI_major, image_fwAPI_minor))
-						{
-							COMMON_LOG_ERROR("The firmware image is not compatible with this "
-									"version of software.");
-							rc = NVM_ERR_INCOMPATIBLEFW;
-						}
-						else
-						{
-							rc = NVM_ERR_REQUIRESFORCE;
-						}
-					}
-					else if (image_hotfix < current_hotfix)
-					{
-						rc = fw_get_bsr(discovery.device_handle, &bsr);
-						if (rc == NVM_SUCCESS)
-						{
-							if (!BSR_OPTIN_ENABLED(bsr))
-							{
-								COMMON_LOG_ERROR("The FW image file is not valid. "
-										"Svn Downgrade Opt-In is disabled.");
-								rc = NVM_ERR_BADFIRMWARE;
-							}
-							else
-							{
-								rc = NVM_ERR_REQUIRESFORCE;
-							}
-						}
-						else
-						{
-							COMMON_LOG_ERROR("Could not get the BSR. "
-									"Couldnot determine the Opt-In value");
-						}
-					}
-					else if (image_build < current_build)
-					{
-						rc = NVM_ERR_REQUIRESFORCE;
-					}
-				}
-			}
-		}
-		if (p_buf != NULL)
-		{
-			free(p_buf);
+			unmap_file(p_buf, buf_len);
 		}
 	}
 
@@ -663,6 +663,37 @@ int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size
 	return rc;
 }
 
+/*
+ * Windows only hands out copies of the firmware tables, so the view is always
+ * backed by get_smbios_table_alloc.
+ */
+int get_smbios_table_view(struct smbios_table_view *p_view)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	NVM_UINT8 *p_smbios_table = NULL;
+	size_t smbios_table_size = 0;
+	memset(p_view, 0, sizeof (*p_view));
+	if ((rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size)) == NVM_SUCCESS)
+	{
+		p_view->p_table = p_smbios_table;
+		p_view->size = smbios_table_size;
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+void put_smbios_table_view(struct smbios_table_view *p_view)
+{
+	if (p_view && p_view->p_table)
+	{
+		free((void *)p_view->p_table);
+		memset(p_view, 0, sizeof (*p_view));
+	}
+}
+
 /*
  * Determine if the caller has permission to make changes to the system
  */
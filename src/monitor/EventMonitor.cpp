@@ -877,20 +877,16 @@ void monitor::EventMonitor::monitorDevices()
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
 	DeviceMap devices = getCurrentDeviceMap();
+
+	// one pass checks every DIMM in parallel
+	runDiagnostic(DIAG_TYPE_QUICK);
+
 	for (DeviceMap::const_iterator dev = devices.begin(); dev != devices.end(); dev++)
 	{
-		runQuickHealthDiagnosticForDevice(dev->first);
 		monitorChangesForDevice(dev->second);
 	}
 }
 
-void monitor::EventMonitor::runQuickHealthDiagnosticForDevice(const std::string& uid)
-{
-	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-
-	runDiagnostic(DIAG_TYPE_QUICK, uid);
-}
-
 void monitor::EventMonitor::monitorChangesForDevice(const deviceInfo& device)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
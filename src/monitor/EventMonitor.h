@@ -140,7 +140,6 @@ namespace monitor
 		 * Process conditions to be detected on each monitor cycle.
 		 */
 		void monitorDevices();
-		void runQuickHealthDiagnosticForDevice(const std::string &uid);
 		void monitorChangesForDevice(const deviceInfo &device);
 		struct db_dimm_state getSavedStateForDevice(const deviceInfo &device);
 		void saveStateForDevice(struct db_dimm_state &newState);
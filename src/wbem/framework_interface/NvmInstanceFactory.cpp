@@ -33,7 +33,12 @@
 
 #include <LogEnterExit.h>
 #include <NvmStrings.h>
+#include <exception/NvmExceptionLibError.h>
+#include <libinvm-cim/ExceptionBadParameter.h>
+#include <core/exceptions/LibraryException.h>
+#include <core/exceptions/InvalidArgumentException.h>
 #include "NvmProviderFactory.h"
+#include <memory>
 
 wbem::framework_interface::NvmInstanceFactory::NvmInstanceFactory(
 		core::system::SystemService &systemService):
@@ -61,3 +66,39 @@ std::string wbem::framework_interface::NvmInstanceFactory::getHostName()
 	}
 	return m_hostName;
 }
+
+wbem::framework::instances_t *wbem::framework_interface::NvmInstanceFactory::getInstances(
+		framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	checkAttributes(attributes);
+
+	// freed on any exception from the hook, not only the translated ones
+	std::unique_ptr<framework::instances_t> pInstances(new framework::instances_t());
+	bool populated = false;
+	try
+	{
+		populated = populateInstances(*pInstances, attributes);
+	}
+	catch (core::LibraryException &e)
+	{
+		throw exception::NvmExceptionLibError(e.getErrorCode());
+	}
+	catch (core::InvalidArgumentException &e)
+	{
+		throw framework::ExceptionBadParameter(e.getArgumentName().c_str());
+	}
+
+	if (!populated)
+	{
+		return framework::InstanceFactory::getInstances(attributes);
+	}
+
+	return pInstances.release();
+}
+
+bool wbem::framework_interface::NvmInstanceFactory::populateInstances(
+		framework::instances_t &instances, framework::attribute_names_t &attributes)
+{
+	return false;
+}
@@ -61,12 +61,36 @@ public:
 	virtual ~NvmInstanceFactory() {}
 	static framework::InstanceFactory *getInstanceFactory(std::string className);
 
+	/*!
+	 * Retrieve all instances of the class. If the factory implements
+	 * populateInstances() the instances are built from a single fetch of the
+	 * underlying data, otherwise this falls back to getInstanceNames() followed
+	 * by getInstance() for each object path.
+	 * @param[in] attributes
+	 * 		The attributes to retrieve.
+	 * @return The list of instances. The caller is responsible for freeing it.
+	 */
+	virtual framework::instances_t *getInstances(framework::attribute_names_t &attributes);
+
 protected:
 	wbem::lib_interface::NvmApi *m_pApi;
 	core::system::SystemService &m_systemService;
 	std::string m_hostName;
 
 	std::string getHostName();
+
+	/*!
+	 * Bulk enumeration hook used by getInstances(). Factories that can build every
+	 * instance from one snapshot of the devices, pools, etc. override this.
+	 * @param[out] instances
+	 * 		The list to append the instances to.
+	 * @param[in] attributes
+	 * 		The attributes to retrieve, already validated.
+	 * @return true if the instances were populated, false to enumerate
+	 * 		one object path at a time.
+	 */
+	virtual bool populateInstances(framework::instances_t &instances,
+			framework::attribute_names_t &attributes);
 };
 
 }
@@ -190,7 +190,8 @@ wbem::framework::InstanceFactory *wbem::framework_interface::NvmProviderFactory:
 	}
 	else if (className == wbem::performance::PERFORMANCE_METRIC_CREATIONCLASSNAME)
 	{
-		pFactory = new wbem::performance::PerformanceMetricFactory();
+		pFactory = new wbem::performance::PerformanceMetricFactory(
+			wbem::performance::PerformanceMetricFactory::getConfiguredMaxSampleAge());
 	}
 	else if (className == wbem::performance::PERFORMANCEMETRICDEFINITION_CREATIONCLASSNAME)
 	{
@@ -107,54 +107,7 @@ wbem::framework::Instance* wbem::mem_config::MemoryAllocationSettingsFactory::ge
 		// Make sure the socket is valid
 		NVM_UINT16 socketId = validateAndReturnSocketId(instanceIdStr);
 
-		// ElementName - host name + " NVM allocation setting"
-		if (containsAttribute(ELEMENTNAME_KEY, attributes))
-		{
-			// Get the real host name
-			std::string elementName = wbem::server::getHostName() +
-									MEMORYALLOCATIONSETTINGS_ELEMENTNAME;
-			framework::Attribute a(elementName, false);
-			pInstance->setAttribute(ELEMENTNAME_KEY, a, attributes);
-		}
-
-		// Parent - "CPU" + socketId
-		if (containsAttribute(PARENT_KEY, attributes))
-		{
-			std::string parent = memory::SystemProcessorFactory::getDeviceId(socketId);
-			framework::Attribute a(parent, false);
-			pInstance->setAttribute(PARENT_KEY, a, attributes);
-		}
-
-		// AllocationUnits - "bytes"
-		if (containsAttribute(ALLOCATIONUNITS_KEY, attributes))
-		{
-			framework::Attribute a(MEMORYALLOCATIONSETTINGS_ALLOCATIONUNITS, false);
-			pInstance->setAttribute(ALLOCATIONUNITS_KEY, a, attributes);
-		}
-
-		// PoolID - "NVMPool1"
-		if (containsAttribute(POOLID_KEY, attributes))
-		{
-			std::string parent = MEMORYRESOURCES_POOLID;
-			framework::Attribute a(parent, false);
-			pInstance->setAttribute(POOLID_KEY, a, attributes);
-		}
-
-		// ResourceType - One of resourcetype_memory or resourcetype_nonvolatile
-		if (containsAttribute(RESOURCETYPE_KEY, attributes))
-		{
-			NVM_UINT16 resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_UNKNOWN;
-			if (isMemory(instanceIdStr))
-			{
-				resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_MEMORY;
-			}
-			else
-			{
-				resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_NONVOLATILE;
-			}
-			framework::Attribute a(resourceType, false);
-			pInstance->setAttribute(RESOURCETYPE_KEY, a, attributes);
-		}
+		setCommonInstanceAttributes(pInstance, instanceIdStr, socketId, attributes);
 
 		if (isGoal(instanceIdStr))
 		{
@@ -178,6 +131,104 @@ wbem::framework::Instance* wbem::mem_config::MemoryAllocationSettingsFactory::ge
 }
 
 
+/*
+ * Build all instances from one snapshot of the manageable devices and pools
+ */
+bool wbem::mem_config::MemoryAllocationSettingsFactory::populateInstances(
+		framework::instances_t &instances, framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	std::string hostName = wbem::server::getHostName();
+	physical_asset::devices_t devices = physical_asset::NVDIMMFactory::getManageableDevices();
+	wbem::mem_config::PoolViewFactory poolViewFactory;
+	std::vector<struct pool> pools = poolViewFactory.getPoolList();
+
+	// the names come from the same snapshot so the sockets don't need re-validating
+	StringListType names = getCurrentConfigNames(devices, pools);
+	StringListType goalNames = getGoalNames(devices);
+	names.insert(names.end(), goalNames.begin(), goalNames.end());
+
+	for (StringListType::iterator iter = names.begin(); iter != names.end(); iter++)
+	{
+		framework::attributes_t keys;
+		keys[INSTANCEID_KEY] = framework::Attribute(*iter, true);
+		framework::ObjectPath path(hostName, NVM_NAMESPACE,
+				MEMORYALLOCATIONSETTINGS_CREATIONCLASSNAME, keys);
+		framework::Instance instance(path);
+
+		setCommonInstanceAttributes(&instance, *iter, getSocketId(*iter), attributes);
+		if (isGoal(*iter))
+		{
+			finishGoalInstance(&instance, *iter, attributes, devices);
+		}
+		else
+		{
+			finishCurrentConfigInstance(&instance, *iter, attributes, pools);
+		}
+		instances.push_back(instance);
+	}
+
+	return true;
+}
+
+/*
+ * Add the attributes shared by current config and goal instances
+ */
+void wbem::mem_config::MemoryAllocationSettingsFactory::setCommonInstanceAttributes(
+		framework::Instance *pInstance, const std::string instanceIdStr,
+		const NVM_UINT16 socketId, const framework::attribute_names_t &attributes)
+{
+	// ElementName - host name + " NVM allocation setting"
+	if (containsAttribute(ELEMENTNAME_KEY, attributes))
+	{
+		// Get the real host name
+		std::string elementName = wbem::server::getHostName() +
+								MEMORYALLOCATIONSETTINGS_ELEMENTNAME;
+		framework::Attribute a(elementName, false);
+		pInstance->setAttribute(ELEMENTNAME_KEY, a, attributes);
+	}
+
+	// Parent - "CPU" + socketId
+	if (containsAttribute(PARENT_KEY, attributes))
+	{
+		std::string parent = memory::SystemProcessorFactory::getDeviceId(socketId);
+		framework::Attribute a(parent, false);
+		pInstance->setAttribute(PARENT_KEY, a, attributes);
+	}
+
+	// AllocationUnits - "bytes"
+	if (containsAttribute(ALLOCATIONUNITS_KEY, attributes))
+	{
+		framework::Attribute a(MEMORYALLOCATIONSETTINGS_ALLOCATIONUNITS, false);
+		pInstance->setAttribute(ALLOCATIONUNITS_KEY, a, attributes);
+	}
+
+	// PoolID - "NVMPool1"
+	if (containsAttribute(POOLID_KEY, attributes))
+	{
+		std::string parent = MEMORYRESOURCES_POOLID;
+		framework::Attribute a(parent, false);
+		pInstance->setAttribute(POOLID_KEY, a, attributes);
+	}
+
+	// ResourceType - One of resourcetype_memory or resourcetype_nonvolatile
+	if (containsAttribute(RESOURCETYPE_KEY, attributes))
+	{
+		NVM_UINT16 resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_UNKNOWN;
+		if (isMemory(instanceIdStr))
+		{
+			resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_MEMORY;
+		}
+		else
+		{
+			resourceType = MEMORYALLOCATIONSETTINGS_RESOURCETYPE_NONVOLATILE;
+		}
+		framework::Attribute a(resourceType, false);
+		pInstance->setAttribute(RESOURCETYPE_KEY, a, attributes);
+	}
+}
+
 /*
  * Retrieve a specific current config instance given an object path
  */
@@ -188,7 +239,14 @@ void wbem::mem_config::MemoryAllocationSettingsFactory::finishGoalInstance(
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
 	physical_asset::devices_t devices = physical_asset::NVDIMMFactory::getManageableDevices();
+	finishGoalInstance(pInstance, instanceIdStr, attributes, devices);
+}
 
+void wbem::mem_config::MemoryAllocationSettingsFactory::finishGoalInstance(
+		framework::Instance *pInstance, const std::string instanceIdStr,
+		const framework::attribute_names_t attributes,
+		const physical_asset::devices_t &devices)
+{
 	if (isMemory(instanceIdStr))
 	{
 		NVM_UINT64 reservation = getMemoryReservationFromGoals(devices, instanceIdStr);
@@ -216,7 +274,14 @@ void wbem::mem_config::MemoryAllocationSettingsFactory::finishCurrentConfigInsta
 	// interleave_set index and numbered accordingly.
 	wbem::mem_config::PoolViewFactory poolViewFactory;
 	std::vector<struct pool> pools = poolViewFactory.getPoolList();
+	finishCurrentConfigInstance(pInstance, instanceIdStr, attributes, pools);
+}
 
+void wbem::mem_config::MemoryAllocationSettingsFactory::finishCurrentConfigInstance(
+		framework::Instance *pInstance, const std::string instanceIdStr,
+		const framework::attribute_names_t attributes,
+		const std::vector<struct pool> &pools)
+{
 	if (isMemory(instanceIdStr))
 	{
 		NVM_UINT64 reservation = getMemoryReservationFromPools(pools, instanceIdStr);
@@ -846,10 +911,16 @@ wbem::framework::instance_names_t* wbem::mem_config::MemoryAllocationSettingsFac
 wbem::mem_config::StringListType wbem::mem_config::MemoryAllocationSettingsFactory::getCurrentConfigNames
 	(const physical_asset::devices_t &devices)
 {
-	StringListType names;
 	wbem::mem_config::PoolViewFactory poolViewFactory;
 
 	std::vector<struct pool> pools = poolViewFactory.getPoolList();
+	return getCurrentConfigNames(devices, pools);
+}
+
+wbem::mem_config::StringListType wbem::mem_config::MemoryAllocationSettingsFactory::getCurrentConfigNames
+	(const physical_asset::devices_t &devices, const std::vector<struct pool> &pools)
+{
+	StringListType names;
 	std::vector<struct pool>::const_iterator poolIter = pools.begin();
 	for (; poolIter != pools.end(); poolIter++)
 	{
@@ -178,17 +178,36 @@ private:
 	void populateAttributeList(framework::attribute_names_t &attributes)
 		throw (framework::Exception);
 
+	/*
+	 * Build all instances from a single device and pool snapshot
+	 */
+	bool populateInstances(framework::instances_t &instances,
+		framework::attribute_names_t &attributes);
+
 	/*
 	 * Add the attributes to the instance that are unique to the current config instance
 	 */
 	void finishCurrentConfigInstance(framework::Instance *pInstance,
 		const std::string instanceIdStr, const framework::attribute_names_t attributes);
+	void finishCurrentConfigInstance(framework::Instance *pInstance,
+		const std::string instanceIdStr, const framework::attribute_names_t attributes,
+		const std::vector<struct pool> &pools);
 
 	/*
 	 * Add the attributes to the instance that are unique to a goal instance
 	 */
 	void finishGoalInstance(framework::Instance *pInstance,
 		const std::string instanceIdStr, const framework::attribute_names_t attributes);
+	void finishGoalInstance(framework::Instance *pInstance,
+		const std::string instanceIdStr, const framework::attribute_names_t attributes,
+		const physical_asset::devices_t &devices);
+
+	/*
+	 * Add the attributes shared by current config and goal instances
+	 */
+	void setCommonInstanceAttributes(framework::Instance *pInstance,
+		const std::string instanceIdStr, const NVM_UINT16 socketId,
+		const framework::attribute_names_t &attributes);
 
 	/*
 	 * Finish a memory or storage instance given a reservation
@@ -205,6 +224,8 @@ private:
 	 * Get the instanceNames derived from the current config
 	 */
 	StringListType getCurrentConfigNames(const physical_asset::devices_t &devices);
+	StringListType getCurrentConfigNames(const physical_asset::devices_t &devices,
+		const std::vector<struct pool> &pools);
 
 	/*
 	 * Get the instanceNames derived from the goals
@@ -200,6 +200,17 @@ wbem::framework::Instance* wbem::memory::PersistentMemoryFactory::getInstance(
 					setInterleaveSetInstanceAttributes(*pInstance, attributes, interleave);
 				}
 			}
+
+			if (!found && pool.type == POOL_TYPE_PERSISTENT)
+			{
+				// un-mirrored persistent pools can have storage-only regions
+				size_t dimmIdx = 0;
+				found = findStorageDimmIndexForUuid(deviceId, pool, dimmIdx);
+				if (found)
+				{
+					setStorageCapacityInstanceAttributes(*pInstance, attributes, pool, dimmIdx);
+				}
+			}
 		}
 
 		if (!found)
@@ -221,6 +232,51 @@ wbem::framework::Instance* wbem::memory::PersistentMemoryFactory::getInstance(
 	return pInstance;
 }
 
+bool wbem::memory::PersistentMemoryFactory::populateInstances(
+		framework::instances_t &instances, framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	// build every instance from one pool snapshot rather than re-reading
+	// the pools for each object path
+	wbem::mem_config::PoolViewFactory poolViewFactory;
+	std::vector<struct pool> pools = poolViewFactory.getPoolList(true);
+	for (size_t i = 0; i < pools.size(); i++)
+	{
+		const struct pool &pool = pools[i];
+		if (pool.type != POOL_TYPE_VOLATILE)
+		{
+			// All non-volatile pools can have interleave sets
+			for (size_t j = 0; j < pool.ilset_count; j++)
+			{
+				const struct interleave_set &interleave = pool.ilsets[j];
+				framework::ObjectPath path = getInstanceName(
+						getInterleaveSetUuid(interleave.set_index, interleave.socket_id));
+				framework::Instance instance(path);
+				setInterleaveSetInstanceAttributes(instance, attributes, interleave);
+				instances.push_back(instance);
+			}
+		}
+
+		if (pool.type == POOL_TYPE_PERSISTENT)
+		{
+			// un-mirrored persistent pools can have storage-only regions
+			for (size_t j = 0; j < pool.dimm_count; j++)
+			{
+				NVM_UID uidStr;
+				uid_copy(pool.dimms[j], uidStr);
+				framework::ObjectPath path = getInstanceName(
+						getStorageRegionUuid(std::string(uidStr)));
+				framework::Instance instance(path);
+				setStorageCapacityInstanceAttributes(instance, attributes, pool, j);
+				instances.push_back(instance);
+			}
+		}
+	}
+
+	return true;
+}
+
 bool wbem::memory::PersistentMemoryFactory::findInterleaveSetForUuid(const std::string& uuid,
 		const struct pool& pool, struct interleave_set& interleave)
 {
@@ -570,6 +626,81 @@ void wbem::memory::PersistentMemoryFactory::setInterleaveSetInstanceAttributes(
 	}
 }
 
+void wbem::memory::PersistentMemoryFactory::setStorageCapacityInstanceAttributes(
+		framework::Instance &instance,
+		const framework::attribute_names_t &attributes,
+		const struct pool &pool, const size_t &dimmIdx)
+	throw (framework::Exception)
+{
+	setGenericInstanceAttributes(instance, attributes, pool.socket_id);
+
+	// NumberOfBlocks - uint64
+	if (containsAttribute(NUMBEROFBLOCKS_KEY, attributes))
+	{
+		framework::Attribute attr(getNumBlocks(getStorageCapacity(pool, dimmIdx)), false);
+		instance.setAttribute(NUMBEROFBLOCKS_KEY, attr);
+	}
+
+	// HealthState - uint16 enum
+	if (containsAttribute(HEALTHSTATE_KEY, attributes))
+	{
+		NVM_UINT16 healthState = getStorageRegionHealthState(pool.dimms[dimmIdx]);
+		framework::Attribute attr(healthState, getHealthStateString(healthState), false);
+		instance.setAttribute(HEALTHSTATE_KEY, attr);
+	}
+
+	// OperationalStatus - uint16 array
+	if (containsAttribute(OPERATIONALSTATUS_KEY, attributes))
+	{
+		framework::UINT16_LIST opStatus;
+		opStatus.push_back(getStorageRegionOperationalStatus(pool.dimms[dimmIdx]));
+		framework::Attribute attr(opStatus, false);
+		instance.setAttribute(OPERATIONALSTATUS_KEY, attr);
+	}
+
+	// AccessGranularity - uint16 - enum
+	// Always block-accessible for storage region
+	if (containsAttribute(ACCESSGRANULARITY_KEY, attributes))
+	{
+		NVM_UINT16 accessGranularity = PERSISTENTMEMORY_ACCESSGRANULARITY_BLOCK;
+		framework::Attribute attr(accessGranularity,
+				getAccessGranularityString(accessGranularity), false);
+		instance.setAttribute(ACCESSGRANULARITY_KEY, attr);
+	}
+
+	// Replication - uint16 - enum
+	// Storage regions are only in un-mirrored pools
+	if (containsAttribute(REPLICATION_KEY, attributes))
+	{
+		NVM_UINT16 replication = PERSISTENTMEMORY_REPLICATION_NONE;
+		framework::Attribute attr(replication, getReplicationString(replication), false);
+		instance.setAttribute(REPLICATION_KEY, attr);
+	}
+}
+
+NVM_UINT64 wbem::memory::PersistentMemoryFactory::getStorageCapacity(
+		const struct pool &pool, const size_t dimmIdx)
+{
+	// What isn't memory mode or part of an interleave set is storage.
+	// Interleave sets are striped evenly across their DIMMs.
+	NVM_UINT64 used = pool.memory_capacities[dimmIdx];
+	for (size_t i = 0; i < pool.ilset_count; i++)
+	{
+		const struct interleave_set &interleave = pool.ilsets[i];
+		for (size_t j = 0; j < interleave.dimm_count; j++)
+		{
+			if (uid_cmp(interleave.dimms[j], pool.dimms[dimmIdx]))
+			{
+				used += interleave.size / interleave.dimm_count;
+				break;
+			}
+		}
+	}
+
+	NVM_UINT64 raw = pool.raw_capacities[dimmIdx];
+	return raw > used ? raw - used : 0;
+}
+
 void wbem::memory::PersistentMemoryFactory::setGenericInstanceAttributes(framework::Instance& instance,
 		const framework::attribute_names_t& attributes,
 		const NVM_UINT16 socketId) throw (framework::Exception)
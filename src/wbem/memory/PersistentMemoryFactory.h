@@ -144,6 +144,13 @@ class NVM_CIM_API PersistentMemoryFactory : public framework_interface::NvmInsta
 		void populateAttributeList(framework::attribute_names_t &attributes)
 			throw (framework::Exception);
 
+		/*
+		 * Build all interleave set and storage region instances from a single
+		 * pool snapshot.
+		 */
+		bool populateInstances(framework::instances_t &instances,
+				framework::attribute_names_t &attributes);
+
 		/*
 		 * Validate the key attributes for the PersistentMemory object path
 		 */
@@ -199,6 +206,11 @@ class NVM_CIM_API PersistentMemoryFactory : public framework_interface::NvmInsta
 				const framework::attribute_names_t &attributes,
 				const struct pool &pool, const size_t &dimmIdx) throw (framework::Exception);
 
+		/*
+		 * Bytes of a DIMM in the pool that are in neither memory mode nor an interleave set.
+		 */
+		NVM_UINT64 getStorageCapacity(const struct pool &pool, const size_t dimmIdx);
+
 		/*
 		 * Set up the instance attributes that are uniform regardless of the type of PM extent.
 		 */
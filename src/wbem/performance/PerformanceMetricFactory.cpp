@@ -35,10 +35,13 @@
 #include <nvm_management.h>
 #include <string/revision.h>
 #include <uid/uid.h>
+#include <persistence/config_settings.h>
+#include <persistence/lib_persistence.h>
 #include <libinvm-cim/ExceptionBadParameter.h>
 #include <physical_asset/NVDIMMFactory.h>
 #include "PerformanceMetricFactory.h"
 #include "PerformanceMetricDefinitionFactory.h"
+#include "PerformanceSnapshot.h"
 #include <server/BaseServerFactory.h>
 #include <sstream>
 #include <utility.h>
@@ -75,8 +78,23 @@ bool wbem::performance::PerformanceMetricFactory::splitInstanceID(
 	return found;
 }
 
-wbem::performance::PerformanceMetricFactory::PerformanceMetricFactory()
-throw (wbem::framework::Exception)
+time_t wbem::performance::PerformanceMetricFactory::getConfiguredMaxSampleAge()
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int maxSampleAge = 0;
+	if (get_config_value_int(SQL_KEY_PERFORMANCE_METRIC_MAX_SAMPLE_AGE_SECONDS,
+		&maxSampleAge) != COMMON_SUCCESS)
+	{
+		// config DBs created before the setting existed always query the DIMMs
+		maxSampleAge = 0;
+	}
+	return (time_t)maxSampleAge;
+}
+
+wbem::performance::PerformanceMetricFactory::PerformanceMetricFactory(const time_t maxSampleAge)
+throw (wbem::framework::Exception) :
+	m_maxSampleAge(maxSampleAge)
 { }
 
 wbem::performance::PerformanceMetricFactory::~PerformanceMetricFactory()
@@ -126,27 +144,9 @@ throw (wbem::framework::Exception)
 		NVM_UID nvmUid;
 		uid_copy(deviceUid.c_str(), nvmUid);
 
-		// serialNumberStr is used in more than 1 attribute so getting here.
-		std::string serialNumberStr = getDeviceSerialNumber(nvmUid);
-
-		std::string metricName = getMetricElementNameFromType(metric) + " " + serialNumberStr;
-		framework::Attribute elementNameAttr(metricName, false);
-		(*pInstance).setAttribute(wbem::ELEMENTNAME_KEY, elementNameAttr, attributes);
-
-		const std::string metricDefId
-			= PerformanceMetricDefinitionFactory::getMetricId(metric);
-		framework::Attribute metricDefinitionAttr(metricDefId, false);
-		(*pInstance).setAttribute(wbem::METRICDEFINITION_ID_KEY, metricDefinitionAttr, attributes);
-
-		std::string metricDimm = METRIC_DIMM_STR + serialNumberStr;
-		framework::Attribute measuredElementNameAttr(metricDimm, false);
-		(*pInstance).setAttribute(wbem::MEASUREDELEMENTNAME_KEY, measuredElementNameAttr, attributes);
-
-		NVM_UINT64 metricValue = getValueForDeviceMetric(nvmUid, metric);
-		std::ostringstream stream;
-		stream << metricValue;
-		framework::Attribute metricValueAttr(stream.str(), false);
-		(*pInstance).setAttribute(wbem::METRICVALUE_KEY, metricValueAttr, attributes);
+		PerformanceSnapshot snapshot(m_maxSampleAge);
+		setMetricInstanceAttributes(*pInstance, attributes, metric,
+				getDeviceSerialNumber(nvmUid), snapshot.getPerformance(deviceUid));
 	}
 	catch (framework::Exception) // clean up and re-throw
 	{
@@ -160,6 +160,73 @@ throw (wbem::framework::Exception)
 	return pInstance;
 }
 
+/*
+ * Build every metric instance from one device list and one performance
+ * snapshot, so each DIMM's metrics are retrieved once rather than per metric.
+ */
+bool wbem::performance::PerformanceMetricFactory::populateInstances(
+	framework::instances_t &instances, framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	std::string hostName = wbem::server::getHostName();
+	PerformanceSnapshot snapshot(m_maxSampleAge);
+
+	physical_asset::devices_t devices = physical_asset::NVDIMMFactory::getManageableDevices();
+	for (size_t i = 0; i < devices.size(); i++)
+	{
+		NVM_UID uidStr;
+		uid_copy(devices[i].uid, uidStr);
+		std::string deviceUid(uidStr);
+
+		char serialNumberStr[NVM_SERIALSTR_LEN];
+		SERIAL_NUMBER_TO_STRING(devices[i].serial_number, serialNumberStr);
+
+		const struct device_performance &performance = snapshot.getPerformance(deviceUid);
+		for (int metric_itr = METRIC_FIRST_TYPE; metric_itr <= METRIC_LAST_TYPE; metric_itr++)
+		{
+			metric_type metric = static_cast<metric_type>(metric_itr);
+			framework::attributes_t keys;
+			keys[INSTANCEID_KEY] =
+				framework::Attribute(getInstanceIdNameFromType(metric, deviceUid), true);
+			framework::ObjectPath path(hostName, NVM_NAMESPACE,
+					PERFORMANCE_METRIC_CREATIONCLASSNAME, keys);
+			framework::Instance instance(path);
+			setMetricInstanceAttributes(instance, attributes, metric,
+					serialNumberStr, performance);
+			instances.push_back(instance);
+		}
+	}
+
+	return true;
+}
+
+void wbem::performance::PerformanceMetricFactory::setMetricInstanceAttributes(
+	framework::Instance &instance, const framework::attribute_names_t &attributes,
+	const metric_type metric, const std::string &serialNumberStr,
+	const struct device_performance &performance)
+throw (wbem::framework::Exception)
+{
+	std::string metricName = getMetricElementNameFromType(metric) + " " + serialNumberStr;
+	framework::Attribute elementNameAttr(metricName, false);
+	instance.setAttribute(wbem::ELEMENTNAME_KEY, elementNameAttr, attributes);
+
+	const std::string metricDefId
+		= PerformanceMetricDefinitionFactory::getMetricId(metric);
+	framework::Attribute metricDefinitionAttr(metricDefId, false);
+	instance.setAttribute(wbem::METRICDEFINITION_ID_KEY, metricDefinitionAttr, attributes);
+
+	std::string metricDimm = METRIC_DIMM_STR + serialNumberStr;
+	framework::Attribute measuredElementNameAttr(metricDimm, false);
+	instance.setAttribute(wbem::MEASUREDELEMENTNAME_KEY, measuredElementNameAttr, attributes);
+
+	NVM_UINT64 metricValue = getValueForDeviceMetric(performance, metric);
+	std::ostringstream stream;
+	stream << metricValue;
+	framework::Attribute metricValueAttr(stream.str(), false);
+	instance.setAttribute(wbem::METRICVALUE_KEY, metricValueAttr, attributes);
+}
+
 /*
  * Return the object paths for the PerformanceMetric class.
  */
@@ -320,17 +387,11 @@ wbem::performance::metric_type wbem::performance::PerformanceMetricFactory::stri
 
 
 NVM_UINT64 wbem::performance::PerformanceMetricFactory::getValueForDeviceMetric(
-	const NVM_UID deviceUid, const enum metric_type metricType)
+	const struct device_performance &nvmPerformance, const enum metric_type metricType)
 throw (framework::Exception)
 {
-	int rc;
 	NVM_UINT64 metricValue = 0;
 
-	struct device_performance nvmPerformance;
-	if ((rc = nvm_get_device_performance(deviceUid, &nvmPerformance)) != NVM_SUCCESS)
-	{
-		throw wbem::exception::NvmExceptionLibError(rc);
-	}
 	switch (metricType)
 	{
 		case METRIC_BYTES_READ :
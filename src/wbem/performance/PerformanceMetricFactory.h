@@ -58,8 +58,11 @@ public:
 
 	/*!
 	 * Initialize a new PerformanceMetric
+	 * @param[in] maxSampleAge
+	 * 		If non-zero, metric values may come from a sample stored by the
+	 * 		performance monitor no older than this many seconds.
 	 */
-	PerformanceMetricFactory() throw (framework::Exception);
+	PerformanceMetricFactory(const time_t maxSampleAge = 0) throw (framework::Exception);
 
 	/*!
 	 * Clean up the PerformanceMetric
@@ -129,11 +132,28 @@ public:
 		std::string &deviceUid,
 		metric_type& metric);
 
+	/*!
+	 * Get the configured maximum age of a stored sample used for metric values.
+	 * @return The age in seconds, 0 if metric values always come from the DIMMs.
+	 */
+	static time_t getConfiguredMaxSampleAge();
+
 private:
+	time_t m_maxSampleAge;
+
 	void populateAttributeList(framework::attribute_names_t &attributes)
 		throw (framework::Exception);
 
-	static NVM_UINT64 getValueForDeviceMetric(const NVM_UID deviceUid, const enum metric_type metricType)
+	bool populateInstances(framework::instances_t &instances,
+		framework::attribute_names_t &attributes);
+
+	void setMetricInstanceAttributes(framework::Instance &instance,
+		const framework::attribute_names_t &attributes, const metric_type metric,
+		const std::string &serialNumberStr, const struct device_performance &performance)
+		throw (framework::Exception);
+
+	static NVM_UINT64 getValueForDeviceMetric(const struct device_performance &nvmPerformance,
+		const enum metric_type metricType)
 		throw (framework::Exception);
 
 	static std::string getMetricElementNameFromType(const metric_type type)
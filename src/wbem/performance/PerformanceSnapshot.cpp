@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file contains a per-request snapshot of the NVM DIMM performance
+ * metrics shared by the performance providers.
+ */
+
+#include "PerformanceSnapshot.h"
+#include <string.h>
+#include <vector>
+#include <LogEnterExit.h>
+#include <uid/uid.h>
+#include <persistence/lib_persistence.h>
+#include <persistence/schema.h>
+#include <exception/NvmExceptionLibError.h>
+
+wbem::performance::PerformanceSnapshot::PerformanceSnapshot(const time_t maxSampleAge) :
+		m_maxSampleAge(maxSampleAge),
+		m_storedSamplesLoaded(false)
+{
+}
+
+wbem::performance::PerformanceSnapshot::~PerformanceSnapshot()
+{
+}
+
+const struct device_performance &wbem::performance::PerformanceSnapshot::getPerformance(
+		const std::string &deviceUid)
+throw (wbem::framework::Exception)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	std::map<std::string, struct device_performance>::iterator iter =
+			m_performance.find(deviceUid);
+	if (iter == m_performance.end())
+	{
+		if (m_maxSampleAge > 0 && !m_storedSamplesLoaded)
+		{
+			loadStoredSamples();
+		}
+
+		struct device_performance performance;
+		std::map<std::string, struct device_performance>::const_iterator stored =
+				m_storedSamples.find(deviceUid);
+		if (stored != m_storedSamples.end())
+		{
+			performance = stored->second;
+		}
+		else
+		{
+			NVM_UID uid;
+			uid_copy(deviceUid.c_str(), uid);
+
+			int rc = nvm_get_device_performance(uid, &performance);
+			if (rc != NVM_SUCCESS)
+			{
+				throw wbem::exception::NvmExceptionLibError(rc);
+			}
+		}
+		iter = m_performance.insert(std::make_pair(deviceUid, performance)).first;
+	}
+
+	return iter->second;
+}
+
+/*
+ * Collect the newest sample the performance monitor stored for each DIMM,
+ * as long as it is recent enough to stand in for a live query.
+ */
+void wbem::performance::PerformanceSnapshot::loadStoredSamples()
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	m_storedSamplesLoaded = true;
+
+	// the monitor stores one row per DIMM each time it runs, so the
+	// newest rows are the latest sample of every DIMM
+	PersistentStore *pStore = get_lib_store();
+	int deviceCount = nvm_get_device_count();
+	if (pStore && deviceCount > 0)
+	{
+		std::vector<struct db_performance> rows(deviceCount);
+		int rowCount = db_get_performances(pStore, &rows[0], deviceCount);
+
+		time_t now = time(NULL);
+		for (int i = 0; i < rowCount; i++)
+		{
+			const struct db_performance &row = rows[i];
+			std::string uidStr(row.dimm_uid);
+			if ((now - (time_t)row.time) <= m_maxSampleAge &&
+				m_storedSamples.find(uidStr) == m_storedSamples.end())
+			{
+				struct device_performance performance;
+				memset(&performance, 0, sizeof (performance));
+				performance.time = (time_t)row.time;
+				performance.bytes_read = row.bytes_read;
+				performance.bytes_written = row.bytes_written;
+				performance.host_reads = row.read_reqs;
+				performance.host_writes = row.host_write_cmds;
+				performance.block_reads = row.block_reads;
+				performance.block_writes = row.block_writes;
+				m_storedSamples[uidStr] = performance;
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file contains a per-request snapshot of the NVM DIMM performance
+ * metrics shared by the performance providers.
+ */
+
+#ifndef _WBEM_PERFORMANCE_SNAPSHOT_H_
+#define _WBEM_PERFORMANCE_SNAPSHOT_H_
+
+#include <map>
+#include <string>
+#include <time.h>
+
+#include <nvm_management.h>
+#include <libinvm-cim/Exception.h>
+#include <wbem/ExportCim.h>
+
+namespace wbem
+{
+namespace performance
+{
+
+/*!
+ * Retrieves the performance metrics for each DIMM at most once. Every metric
+ * instance built from the same snapshot shares a single device_performance,
+ * rather than issuing one firmware command per metric.
+ */
+class NVM_CIM_API PerformanceSnapshot
+{
+public:
+	/*!
+	 * Initialize an empty snapshot
+	 * @param[in] maxSampleAge
+	 * 		If non-zero, a sample stored by the performance monitor that is no
+	 * 		older than this many seconds is used instead of querying the DIMM.
+	 */
+	PerformanceSnapshot(const time_t maxSampleAge = 0);
+
+	~PerformanceSnapshot();
+
+	/*!
+	 * Get the performance metrics for a DIMM, fetching them on first use.
+	 * @param[in] deviceUid
+	 * 		The DIMM to retrieve the performance metrics for.
+	 * @throw NvmExceptionLibError if the metrics couldn't be retrieved.
+	 * @return The performance metrics.
+	 */
+	const struct device_performance &getPerformance(const std::string &deviceUid)
+		throw (framework::Exception);
+
+private:
+	void loadStoredSamples();
+
+	time_t m_maxSampleAge;
+	bool m_storedSamplesLoaded;
+	std::map<std::string, struct device_performance> m_storedSamples;
+	std::map<std::string, struct device_performance> m_performance;
+};
+
+} // performance
+} // wbem
+#endif // _WBEM_PERFORMANCE_SNAPSHOT_H_
@@ -930,41 +930,24 @@ std::string NVDIMMFactory::getMemoryModeString(core::device::Device &device)
 	return result.str();
 }
 
-wbem::framework::instances_t *NVDIMMFactory::getInstances(
-		wbem::framework::attribute_names_t &attributes)
+bool NVDIMMFactory::populateInstances(framework::instances_t &instances,
+		framework::attribute_names_t &attributes)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	checkAttributes(attributes);
 
-	try
+	// one discovery pass, with the details of all devices retrieved in parallel
+	core::device::DeviceCollection devices = m_deviceService.getAllDevices(true);
+	for (size_t i = 0; i < devices.size(); i++)
 	{
-		core::device::DeviceCollection devices = m_deviceService.getAllDevices();
-
-		framework::instances_t *pResult = new framework::instances_t();
-		if (!pResult)
-		{
-			throw framework::ExceptionNoMemory(__FILE__, __FUNCTION__, "pResult");
-		}
-		for (size_t i = 0; i < devices.size(); i++)
-		{
-			framework::ObjectPath path;
-			createPathFromUid(devices[i].getUid(), path);
-			framework::Instance instance(path);
+		framework::ObjectPath path;
+		createPathFromUid(devices[i].getUid(), path);
+		framework::Instance instance(path);
 
-			toInstance(devices[i], instance, attributes);
+		toInstance(devices[i], instance, attributes);
 
-			pResult->push_back(instance);
-		}
-		return pResult;
-	}
-	catch (core::LibraryException &e)
-	{
-		throw exception::NvmExceptionLibError(e.getErrorCode());
-	}
-	catch (core::InvalidArgumentException &e)
-	{
-		throw framework::ExceptionBadParameter(e.getArgumentName().c_str());
+		instances.push_back(instance);
 	}
+	return true;
 }
 
 void NVDIMMFactory::uidToHandle(const std::string &dimmUid,
@@ -121,7 +121,6 @@ public:
 	);
 	~NVDIMMFactory();
 
-	virtual framework::instances_t *getInstances(framework::attribute_names_t &attributes);
 	framework::Instance *getInstance(framework::ObjectPath &path,
 		framework::attribute_names_t &attributes);
 
@@ -235,6 +234,9 @@ private:
 
 	void populateAttributeList(framework::attribute_names_t &attributes);
 
+	bool populateInstances(framework::instances_t &instances,
+			framework::attribute_names_t &attributes);
+
 	/*
 	 * Helper to convert an integer to a fw_log_level enum.
 	 */
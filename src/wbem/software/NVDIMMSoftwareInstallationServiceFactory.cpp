@@ -55,7 +55,7 @@
 #include <core/device/DeviceHelper.h>
 
 wbem::software::NVDIMMSoftwareInstallationServiceFactory::NVDIMMSoftwareInstallationServiceFactory()
-throw (wbem::framework::Exception) : m_UpdateDeviceFw(nvm_update_device_fw),
+throw (wbem::framework::Exception) : m_UpdateDevicesFw(nvm_update_devices_fw),
 m_ExamineFwImage(nvm_examine_device_fw),
 m_GetManageableDeviceUids(physical_asset::NVDIMMFactory::getManageableDeviceUids),
 m_GetDeviceDetails(nvm_get_device_details)
@@ -367,7 +367,8 @@ wbem::software::NVDIMMSoftwareInstallationServiceFactory::getReturnCodeFromLibEx
  */
 void wbem::software::NVDIMMSoftwareInstallationServiceFactory::installFromPath(
 		const std::string& deviceUid,
-		const std::string& path, bool force) const
+		const std::string& path, bool force,
+		const struct fw_update_callbacks *pCallbacks) const
 throw (framework::Exception)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -382,29 +383,61 @@ throw (framework::Exception)
 		throw framework::ExceptionBadParameter("deviceUid");
 	}
 
-	int rc;
+	int result = NVM_SUCCESS;
 	NVM_UID uid;
 	uid_copy(deviceUid.c_str(), uid);
 	// library will check if device is manageable and can update the FW ... if not it will return an error
-	if (NVM_SUCCESS !=
-			(rc = m_UpdateDeviceFw(uid, path.c_str(), path.length(), force)))
+	int rc = m_UpdateDevicesFw(&uid, &result, 1, path.c_str(), path.length(), force,
+			pCallbacks);
+	if (rc == NVM_SUCCESS)
+	{
+		rc = result;
+	}
+	if (rc != NVM_SUCCESS)
 	{
 		throw exception::NvmExceptionLibError(rc);
 	}
 }
 
 void wbem::software::NVDIMMSoftwareInstallationServiceFactory::installFromPath(
-		const std::string& path, bool force) const
+		const std::string& path, bool force,
+		const struct fw_update_callbacks *pCallbacks) const
 throw (framework::Exception)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
+	if(path.empty())
+	{
+		throw framework::ExceptionBadParameter("path");
+	}
+
 	std::vector<std::string> devices = m_GetManageableDeviceUids();
+	if (!devices.empty())
+	{
+		// the library reads the image once and updates the devices in parallel
+		NVM_UID *pUids = new NVM_UID[devices.size()];
+		// a device is only reported updated if the library says so
+		std::vector<int> results(devices.size(), NVM_ERR_UNKNOWN);
+		for (size_t i = 0; i < devices.size(); i++)
+		{
+			uid_copy(devices[i].c_str(), pUids[i]);
+		}
 
+		int rc = m_UpdateDevicesFw(pUids, &results.front(), (NVM_UINT32)devices.size(),
+				path.c_str(), path.length(), force, pCallbacks);
+		delete[] pUids;
 
-	for (size_t i = 0; i < devices.size(); i++)
-	{
-		installFromPath(devices[i], path, force);
+		if (rc != NVM_SUCCESS)
+		{
+			throw exception::NvmExceptionLibError(rc);
+		}
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			if (results[i] != NVM_SUCCESS)
+			{
+				throw exception::NvmExceptionLibError(results[i]);
+			}
+		}
 	}
 }
 
@@ -114,20 +114,28 @@ class NVM_CIM_API NVDIMMSoftwareInstallationServiceFactory : public framework_in
 		 * @param force
 		 * 		If true, the firmware will be loaded even if the minor version is less then
 		 * 		the current FW version.
+		 * @param pCallbacks
+		 * 		Optional callbacks to follow or cancel the image transfer.
 		 */
 		void installFromPath(const std::string &deviceUid, const std::string &path,
-				bool force = false) const throw (framework::Exception);
+				bool force = false, const struct fw_update_callbacks *pCallbacks = NULL) const
+				throw (framework::Exception);
 
 		/*!
-		 * install firmware onto all devices within the system
+		 * install firmware onto all devices within the system. The devices are
+		 * updated in parallel and the first device failure is thrown once all
+		 * have been attempted.
 		 * @param path
 		 * 		path to where the firmware file is.
 		 * @param force
 		 * 		If true, the firmware will be loaded even if the minor version is less then
 		 * 		the current FW version.
+		 * @param pCallbacks
+		 * 		Optional callbacks to follow or cancel the image transfers.
 		 */
 		void installFromPath(const std::string &path,
-				bool force = false) const throw (framework::Exception);
+				bool force = false, const struct fw_update_callbacks *pCallbacks = NULL) const
+				throw (framework::Exception);
 
 		/*!
 		 * Examine a FW image and determine if it is valid for a given device
@@ -175,15 +183,19 @@ class NVM_CIM_API NVDIMMSoftwareInstallationServiceFactory : public framework_in
 		throw (framework::Exception);
 
 		/*!
-		 * API indirection
-		 * @param device_uid
+		 * API indirection for updating several devices at once
+		 * @param p_device_uids
+		 * @param p_results
+		 * @param device_count
 		 * @param path
 		 * @param path_len
 		 * @param force
+		 * @param p_callbacks
 		 * @return
 		 */
-		int (*m_UpdateDeviceFw)(const NVM_UID device_uid, const NVM_PATH path,
-				const NVM_SIZE path_len, NVM_BOOL force);
+		int (*m_UpdateDevicesFw)(const NVM_UID *p_device_uids, int *p_results,
+				const NVM_UINT32 device_count, const NVM_PATH path, const NVM_SIZE path_len,
+				const NVM_BOOL force, const struct fw_update_callbacks *p_callbacks);
 
 		/*!
 		 * API for examine FW image
@@ -279,9 +279,10 @@ throw(wbem::framework::Exception)
 	attributes.push_back(ENABLEDSTATE_KEY);
 }
 
-framework::instances_t *NVDIMMSensorFactory::getInstances(framework::attribute_names_t &attributes)
+bool NVDIMMSensorFactory::populateInstances(framework::instances_t &instances,
+	framework::attribute_names_t &attributes)
 {
-	framework::instances_t *pResult = new framework::instances_t();
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
 	sensor sensors[NVM_MAX_DEVICE_SENSORS];
 
@@ -294,10 +295,10 @@ framework::instances_t *NVDIMMSensorFactory::getInstances(framework::attribute_n
 		NVM_UID uid;
 		uid_copy(uidStr.c_str(), uid);
 
+		// one call returns every sensor on the DIMM
 		int rc = nvm_get_sensors(uid, sensors, NVM_MAX_DEVICE_SENSORS);
 		if (rc != NVM_SUCCESS)
 		{
-			delete pResult;
 			throw exception::NvmExceptionLibError(rc);
 		}
 		for (int i = 0; i < NVM_MAX_DEVICE_SENSORS; i++)
@@ -306,12 +307,11 @@ framework::instances_t *NVDIMMSensorFactory::getInstances(framework::attribute_n
 				manageableDevices[dimmIdx]);
 			framework::Instance sensorInstance(path);
 			sensorToInstance(attributes, sensors[i], sensorInstance);
-			pResult->push_back(sensorInstance);
+			instances.push_back(sensorInstance);
 		}
 	}
 
-	return pResult;
-
+	return true;
 }
 
 /*
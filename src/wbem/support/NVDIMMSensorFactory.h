@@ -86,8 +86,6 @@ public:
 
 	~NVDIMMSensorFactory();
 
-	framework::instances_t *getInstances(framework::attribute_names_t &attributes);
-
 	framework::Instance* getInstance(framework::ObjectPath &path,
 			framework::attribute_names_t &attributes) throw (framework::Exception);
 
@@ -172,6 +170,8 @@ private:
 	static const framework::UINT16& getCIMSensorTypeCode(int nvm_type) throw (framework::Exception);
 	static const std::string& getCIMSensorOtherTypeName(int nvm_type) throw (framework::Exception);
 	void populateAttributeList(framework::attribute_names_t &attributes) throw (framework::Exception);
+	bool populateInstances(framework::instances_t &instances,
+		framework::attribute_names_t &attributes);
 
 	/*
 	 * get the string associated with the enabled state